@@ -30,8 +30,12 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Animation/BatchSampler.h"
+#include "Magnum/Animation/Mixer.h"
 #include "Magnum/Animation/Easing.h"
+#include "Magnum/Animation/EasingBatch.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/UniformTrack.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -101,6 +105,15 @@ Vector3 result = lerpQuadraticInOut(a, b, t);
 static_cast<void>(result);
 }
 
+{
+/* [easeInto] */
+Containers::ArrayView<const Float> phases; /* one for each tweened widget */
+Containers::ArrayView<Float> factors;
+
+Animation::easeInto<Animation::Easing::elasticOut>(phases, factors);
+/* [easeInto] */
+}
+
 {
 /* [Easing-clamp] */
 auto lerpCircularOutClamped = Animation::easeClamped<
@@ -361,4 +374,84 @@ static_cast<void>(position);
 static_cast<void>(rotation);
 }
 
+{
+Containers::ArrayView<const Float> times;
+Containers::ArrayView<Quaternion> rotations;
+/* [UniformTrack-usage] */
+const Animation::Track<Float, Quaternion> walk{{
+    {0.0f, Quaternion::rotation(0.0_degf, Vector3::xAxis())},
+    {0.3f, Quaternion::rotation(25.0_degf, Vector3::xAxis())},
+    {0.8f, Quaternion::rotation(-25.0_degf, Vector3::xAxis())},
+    {1.0f, Quaternion::rotation(0.0_degf, Vector3::xAxis())}
+}, Math::slerpShortestPath};
+
+/* Resample so the rotation is within 0.001 of the original */
+Animation::UniformTrack<Float, Quaternion> uniformWalk =
+    Animation::resample(walk, Math::slerpShortestPath, 0.001f);
+
+/* Calculate the rotation for a lot of independently animated instances */
+uniformWalk.atInto(times, rotations);
+/* [UniformTrack-usage] */
+}
+
+{
+Animation::TrackView<const Float, const Vector3> translation;
+Animation::TrackView<const Float, const Vector3> scaling;
+Timeline timeline;
+/* [BatchSampler-usage] */
+struct Character {
+    Vector3 translation, scaling;
+    /* ... */
+};
+Containers::Array<Character> characters{10000};
+Containers::Array<Animation::Player<Float>> players{characters.size()};
+Containers::Array<Float> keys{Containers::ValueInit, characters.size()};
+
+Animation::BatchSampler<Float, Vector3> sampler{Math::lerp};
+for(std::size_t i = 0; i != characters.size(); ++i) {
+    sampler.add(translation, i, characters[i].translation)
+           .add(scaling, i, characters[i].scaling);
+    players[i].setDuration(translation.duration())
+        .play(timeline.previousFrameTime() + i*0.1f);
+}
+
+/* Every frame, update the key for each player and then all tracks at once */
+for(std::size_t i = 0; i != characters.size(); ++i)
+    players[i].advance(timeline.previousFrameTime(), keys[i]);
+sampler.sample(keys);
+/* [BatchSampler-usage] */
+}
+
+{
+Containers::ArrayView<Animation::TrackView<const Float, const Quaternion>> walk, run, breathe;
+Containers::ArrayView<const Float> upperBodyMask;
+Containers::StridedArrayView1D<Quaternion> boneRotations;
+Float speed{};
+Timeline timeline;
+/* [Mixer-usage] */
+Animation::Player<Float> walkPlayer, runPlayer, breathePlayer;
+/* Set up durations and play the players ... */
+
+Animation::Mixer<Float, Quaternion> mixer{Math::slerpShortestPath, boneRotations.size()};
+const std::size_t walkLayer = mixer.addLayer();
+const std::size_t runLayer = mixer.addLayer();
+const std::size_t breatheLayer = mixer.addAdditiveLayer();
+for(std::size_t bone = 0; bone != boneRotations.size(); ++bone) {
+    mixer.add(walkLayer, walk[bone], bone)
+         .add(runLayer, run[bone], bone)
+         .add(breatheLayer, breathe[bone], bone);
+}
+mixer.setLayerMask(breatheLayer, upperBodyMask);
+
+/* Every frame, crossfade between walking and running based on speed and
+   mix everything into the bone rotations */
+Float keys[3];
+walkPlayer.advance(timeline.previousFrameTime(), keys[walkLayer]);
+runPlayer.advance(timeline.previousFrameTime(), keys[runLayer]);
+breathePlayer.advance(timeline.previousFrameTime(), keys[breatheLayer]);
+mixer.setLayerWeight(runLayer, Math::clamp(speed - 1.0f, 0.0f, 1.0f));
+mixer.mix(keys, boneRotations);
+/* [Mixer-usage] */
+}
+
 }
@@ -35,13 +35,17 @@
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+#include "Magnum/SceneGraph/InstanceBatcher.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 #include "Magnum/Shaders/Flat.h"
 #include "Magnum/Shaders/Phong.h"
+#include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/ObjectData3D.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -235,5 +239,82 @@ new RedCubeDrawable{*redCube, &drawables};
     .rotateX(30.0_degf);
 /* [Drawable-usage-instance-multiple-inheritance] */
 
+{
+Trade::AbstractImporter& importer = *static_cast<Trade::AbstractImporter*>(nullptr);
+/* [FlatHierarchy-import] */
+Containers::Array<Containers::Pointer<Trade::ObjectData3D>> objects{importer.object3DCount()};
+for(UnsignedInt i = 0; i != objects.size(); ++i)
+    objects[i] = importer.object3D(i);
+
+SceneGraph::FlatHierarchy3D hierarchy{objects};
+
+/* Index of the object that had ID 7 in the file */
+UnsignedInt index = hierarchy.indices()[7];
+/* [FlatHierarchy-import] */
+static_cast<void>(index);
+}
+
+{
+SceneGraph::FlatHierarchy3D hierarchy;
+SceneGraph::Camera3D& camera = *static_cast<SceneGraph::Camera3D*>(nullptr);
+GL::Mesh mesh;
+Shaders::Phong shader;
+/* [FlatHierarchy-drawing] */
+/* Indices of objects that have a mesh attached, filled on scene load */
+Containers::Array<UnsignedInt> drawables;
+Containers::Array<Matrix4> transformations{drawables.size()};
+
+hierarchy.updateWorldTransformations();
+hierarchy.transformationsInto(camera.cameraMatrix(), drawables, transformations);
+for(const Matrix4& transformation: transformations) {
+    shader
+        .setTransformationMatrix(transformation)
+        .setNormalMatrix(transformation.normalMatrix())
+        .setProjectionMatrix(camera.projectionMatrix())
+        .draw(mesh);
+}
+/* [FlatHierarchy-drawing] */
+}
+
+{
+SceneGraph::Scene<SceneGraph::MatrixTransformation3D> scene;
+SceneGraph::Camera3D& camera = *static_cast<SceneGraph::Camera3D*>(nullptr);
+/* [InstanceBatcher-usage] */
+/* Meshes and shaders referenced by the IDs, each mesh with its own buffer for
+   per-instance data */
+GL::Mesh meshes[2]; // a tree and a bush, for example
+GL::Buffer instanceBuffers[2];
+Shaders::Phong shader{Shaders::Phong::Flag::InstancedTransformation|
+                      Shaders::Phong::Flag::VertexColor};
+for(std::size_t i = 0; i != 2; ++i)
+    meshes[i].addVertexBufferInstanced(instanceBuffers[i], 1, 0,
+        Shaders::Phong::TransformationMatrix{},
+        Shaders::Phong::NormalMatrix{},
+        Shaders::Phong::Color4{});
+
+SceneGraph::InstanceBatcher3D batcher;
+SceneGraph::DrawableGroup3D drawables;
+for(UnsignedInt i = 0; i != 10000; ++i) {
+    auto* object = new SceneGraph::Object<SceneGraph::MatrixTransformation3D>{&scene};
+    // ...
+    new SceneGraph::InstancedDrawable3D{*object, batcher, 0, i % 2,
+        0x33aa33_rgbf, &drawables};
+}
+
+/* Every frame, collect the visible instances and draw each batch */
+batcher.clear();
+camera.draw(drawables);
+batcher.sort();
+shader.setProjectionMatrix(camera.projectionMatrix());
+for(std::size_t i = 0; i != batcher.batches().size(); ++i) {
+    const SceneGraph::InstanceBatch& batch = batcher.batches()[i];
+    instanceBuffers[batch.mesh].setData(batcher.instanceData(i),
+        GL::BufferUsage::StreamDraw);
+    meshes[batch.mesh].setInstanceCount(batch.count);
+    shader.draw(meshes[batch.mesh]);
+}
+/* [InstanceBatcher-usage] */
+}
+
 return 0; /* on iOS SDL redefines main to SDL_main and then return is needed */
 }
@@ -31,11 +31,15 @@
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 #include "Magnum/SceneGraph/AbstractTranslationRotation3D.h"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
 #include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
 #include "Magnum/SceneGraph/Scene.h"
 
 using namespace Magnum;
@@ -387,4 +391,122 @@ camera.draw(drawableTransformations);
 /* [Drawable-culling] */
 }
 
+{
+Object3D object, cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+SceneGraph::DrawableGroup3D drawableGroup;
+struct MyDrawable: SceneGraph::Drawable3D {
+    using SceneGraph::Drawable3D::Drawable3D;
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+};
+/* [Drawable-culling-builtin] */
+/* Bounding box of the mesh, relative to the object */
+(new MyDrawable{object, &drawableGroup})
+    ->setBoundingBox({{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}});
+
+/* Draw only what's inside the view volume */
+camera.setFrustumCullingEnabled(true)
+      .draw(drawableGroup);
+/* [Drawable-culling-builtin] */
+}
+
+{
+Object3D cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+/* [BoundingVolumeHierarchy-usage] */
+SceneGraph::BoundingVolumeHierarchy3D hierarchy;
+
+Object3D object;
+new SceneGraph::BoundingVolume3D{object, {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}, &hierarchy};
+
+/* Objects hit by a ray going from the camera forward, closest first */
+std::vector<std::reference_wrapper<SceneGraph::BoundingVolume3D>> hit =
+    hierarchy.intersectRay(cameraObject.absoluteTransformation().translation(),
+                           -cameraObject.absoluteTransformation().backward());
+
+/* Objects within 5 units from the camera */
+std::vector<std::reference_wrapper<SceneGraph::BoundingVolume3D>> nearby =
+    hierarchy.intersectSphere(cameraObject.absoluteTransformation().translation(), 5.0f);
+
+/* Objects in the view */
+std::vector<std::reference_wrapper<SceneGraph::BoundingVolume3D>> visible =
+    hierarchy.intersectFrustum(Frustum::fromMatrix(
+        camera.projectionMatrix()*camera.cameraMatrix()));
+/* [BoundingVolumeHierarchy-usage] */
+static_cast<void>(hit);
+static_cast<void>(nearby);
+static_cast<void>(visible);
+}
+
+{
+Float time{};
+/* [FlatHierarchy-usage] */
+SceneGraph::FlatHierarchy3D hierarchy;
+UnsignedInt car = hierarchy.addObject(-1, Matrix4::translation({5.0f, 0.0f, 0.0f}));
+UnsignedInt wheel = hierarchy.addObject(car, Matrix4::translation({1.0f, -0.5f, 0.0f}));
+
+/* Each frame, update the changed local transformations and then recalculate
+   world transformations of everything that depends on them */
+hierarchy.setTransformation(wheel, Matrix4::translation({1.0f, -0.5f, 0.0f})*
+                                   Matrix4::rotationZ(Rad{time}));
+hierarchy.updateWorldTransformations();
+Matrix4 wheelWorld = hierarchy.worldTransformation(wheel);
+/* [FlatHierarchy-usage] */
+static_cast<void>(wheelWorld);
+}
+
+{
+Object3D object;
+SceneGraph::DrawableGroup3D drawables;
+SceneGraph::Camera3D camera{object};
+/* [RenderQueue-usage] */
+class ColoredDrawable: public SceneGraph::Drawable3D {
+    public:
+        explicit ColoredDrawable(Object3D& object, UnsignedShort shaderId, UnsignedShort meshId, SceneGraph::DrawableGroup3D* group): SceneGraph::Drawable3D{object, group}, _shaderId{shaderId}, _meshId{meshId} {}
+
+    private:
+        UnsignedLong sortKey(const Matrix4& transformationMatrix, SceneGraph::Camera3D&) override {
+            /* Group by shader and mesh, draw front-to-back within the same
+               state */
+            return SceneGraph::RenderQueue3D::key(_shaderId, 0, _meshId,
+                SceneGraph::RenderQueue3D::depthKey(
+                    -transformationMatrix.translation().z(), 100.0f));
+        }
+
+        void draw(const Matrix4&, SceneGraph::Camera3D&) override {
+            // ...
+        }
+
+        UnsignedShort _shaderId, _meshId;
+};
+
+/* Reuse the queue across frames to avoid reallocations */
+SceneGraph::RenderQueue3D queue;
+camera.draw(drawables, queue);
+/* [RenderQueue-usage] */
+}
+
+{
+SceneGraph::DrawableGroup3D drawables;
+struct MyDrawable: SceneGraph::Drawable3D {
+    using SceneGraph::Drawable3D::Drawable3D;
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+};
+/* [ObjectPool-usage] */
+/* Declared before the scene so it gets destroyed after all objects */
+SceneGraph::ObjectPool pool;
+Scene3D scene;
+
+Object3D* level = new(pool) Object3D{&scene};
+for(std::size_t i = 0; i != 50000; ++i) {
+    Object3D* object = new(pool) Object3D{level};
+    new(pool) MyDrawable{*object, &drawables};
+}
+
+/* Destroys the level including all its children and features, returning the
+   memory back to the pool */
+delete level;
+/* [ObjectPool-usage] */
+}
+
 }
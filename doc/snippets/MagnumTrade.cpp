@@ -122,6 +122,24 @@ importer->openFile("scene.gltf"); // memory-maps all files
 }
 #endif
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [AbstractImporter-usage-memory] */
+if(!(importer->features() & Trade::ImporterFeature::OpenMemory))
+    Warning{} << "The importer will make a copy of the file contents";
+
+/* The file stays mapped until the importer is closed */
+if(!importer->openFile("level.pak"))
+    Fatal{} << "Can't open level.pak";
+
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+if(mesh && (mesh->vertexDataFlags() & Trade::DataFlag::ExternallyOwned)) {
+    // the vertex data point into the mapped file, upload them before the
+    // importer is closed
+}
+/* [AbstractImporter-usage-memory] */
+}
+
 {
 Containers::Pointer<Trade::AbstractImporter> importer;
 Int materialIndex;
@@ -704,6 +722,21 @@ static_cast<void>(triangleIds);
 static_cast<void>(triangleCounts);
 }
 
+{
+Trade::MeshData mesh{MeshPrimitive::Points, 0};
+/* [MeshData-serialization] */
+/* Offline, in an asset pipeline */
+Utility::Directory::write("mesh.blob", mesh.serialize());
+
+/* At runtime. The file is page-aligned, which satisfies the 8-byte alignment
+   requirement, and has to stay mapped for as long as the mesh is used. */
+Containers::Array<const char, Utility::Directory::MapDeleter> blob =
+    Utility::Directory::mapRead("mesh.blob");
+Containers::Optional<Trade::MeshData> deserialized =
+    Trade::MeshData::deserialize(blob);
+/* [MeshData-serialization] */
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 {
 CORRADE_IGNORE_DEPRECATED_PUSH
@@ -57,6 +57,8 @@
 #  AnyImageImporter             - Any image importer
 #  AnySceneConverter            - Any scene converter
 #  AnySceneImporter             - Any scene importer
+#  BlobImporter                 - Blob importer plugin
+#  BlobSceneConverter           - Blob scene converter plugin
 #  Audio                        - Audio library
 #  DebugTools                   - DebugTools library
 #  GL                           - GL library
@@ -350,6 +352,13 @@ if(NOT TARGET Magnum::Magnum)
     # Dependent libraries
     set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
          Corrade::Utility)
+    # Multi-threaded batch APIs need pthreads, which have to be linked
+    # explicitly in case of a static build
+    if(MAGNUM_BUILD_STATIC AND NOT CORRADE_TARGET_EMSCRIPTEN)
+        find_package(Threads REQUIRED)
+        set_property(TARGET Magnum::Magnum APPEND PROPERTY
+            INTERFACE_LINK_LIBRARIES Threads::Threads)
+    endif()
 else()
     set(MAGNUM_LIBRARY Magnum::Magnum)
 endif()
@@ -362,8 +371,9 @@ set(_MAGNUM_LIBRARY_COMPONENTS
     WindowlessEglApplication EglContext OpenGLTester)
 set(_MAGNUM_PLUGIN_COMPONENTS
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneConverter
-    AnySceneImporter MagnumFont MagnumFontConverter ObjImporter
-    TgaImageConverter TgaImporter WavAudioImporter)
+    AnySceneImporter BlobImporter BlobSceneConverter MagnumFont
+    MagnumFontConverter ObjImporter TgaImageConverter TgaImporter
+    WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENTS
     imageconverter sceneconverter shaderconverter gl-info al-info)
 # Audio and Vk libs aren't enabled by default, and none of the Context,
@@ -935,6 +945,8 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnyImageConverter plugin
         # No special setup for AnyImageImporter plugin
         # No special setup for AnySceneImporter plugin
+        # No special setup for BlobImporter plugin
+        # No special setup for BlobSceneConverter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
         # No special setup for ObjImporter plugin
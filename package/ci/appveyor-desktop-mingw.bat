@@ -38,6 +38,8 @@ cmake .. ^
     -DWITH_ANYSCENECONVERTER=ON ^
     -DWITH_ANYSCENEIMPORTER=ON ^
     -DWITH_ANYSHADERCONVERTER=ON ^
+    -DWITH_BLOBIMPORTER=ON ^
+    -DWITH_BLOBSCENECONVERTER=ON ^
     -DWITH_MAGNUMFONT=ON ^
     -DWITH_MAGNUMFONTCONVERTER=ON ^
     -DWITH_OBJIMPORTER=ON ^
@@ -85,6 +85,8 @@ cmake .. \
     -DWITH_ANYIMAGEIMPORTER=OFF \
     -DWITH_ANYSCENECONVERTER=OFF \
     -DWITH_ANYSCENEIMPORTER=OFF \
+    -DWITH_BLOBIMPORTER=OFF \
+    -DWITH_BLOBSCENECONVERTER=OFF \
     -DWITH_MAGNUMFONT=OFF \
     -DWITH_MAGNUMFONTCONVERTER=OFF \
     -DWITH_OBJIMPORTER=OFF \
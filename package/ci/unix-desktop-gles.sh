@@ -39,6 +39,8 @@ cmake .. \
     -DWITH_ANYSCENECONVERTER=OFF \
     -DWITH_ANYSCENEIMPORTER=OFF \
     -DWITH_ANYSHADERCONVERTER=OFF \
+    -DWITH_BLOBIMPORTER=OFF \
+    -DWITH_BLOBSCENECONVERTER=OFF \
     -DWITH_MAGNUMFONT=ON \
     -DWITH_MAGNUMFONTCONVERTER=ON \
     -DWITH_OBJIMPORTER=OFF \
@@ -51,6 +51,8 @@ cmake .. \
     -DWITH_ANYSCENECONVERTER=OFF \
     -DWITH_ANYSCENEIMPORTER=OFF \
     -DWITH_ANYSHADERCONVERTER=OFF \
+    -DWITH_BLOBIMPORTER=OFF \
+    -DWITH_BLOBSCENECONVERTER=OFF \
     -DWITH_MAGNUMFONT=OFF \
     -DWITH_MAGNUMFONTCONVERTER=OFF \
     -DWITH_OBJIMPORTER=OFF \
@@ -41,14 +41,21 @@ namespace Implementation {
 
 template<class V> using ResultOf = typename Implementation::ResultTraits<V>::Type;
 
+class CompressedQuaternion;
+
 enum class Interpolation: UnsignedByte;
 enum class Extrapolation: UnsignedByte;
 
+template<class K, class V, class R = ResultOf<V>> class BatchSampler;
+
+template<class K, class V, class R = ResultOf<V>> class Mixer;
+
 template<class T, class K = T> class Player;
 
 template<class K, class V, class R = ResultOf<V>> class Track;
 template<class K> class TrackViewStorage;
 template<class K, class V, class R = ResultOf<V>> class TrackView;
+template<class K, class V, class R = ResultOf<V>> class UniformTrack;
 #endif
 
 }}
@@ -0,0 +1,279 @@
+#ifndef Magnum_Animation_BatchSampler_h
+#define Magnum_Animation_BatchSampler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::BatchSampler
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Batch sampler for many tracks of the same type
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+@m_since_latest
+
+The @ref Player calls a type-erased function for every track in every
+@ref Player::advance() call, which becomes the bottleneck when animating a
+large amount of instances --- for example ten thousand characters with sixty
+bones each means six hundred thousand indirect calls every frame. This class
+groups tracks of the same type and the same interpolator function together and
+samples all of them in a single loop with no per-track indirection. Track
+data, extrapolation behavior, keyframe search hints and destinations are kept
+in separate arrays to make the loop cache-friendly.
+
+Tracks that are added right after each other and have the same key view, key
+index and extrapolation behavior share the keyframe search --- which is
+commonly the case for tracks of a single animation clip, such as all channels
+of an imported @ref Trade::AnimationData that reference the same keyframe
+data. Adding tracks of the same clip together is thus beneficial.
+
+@section Animation-BatchSampler-usage Basic usage
+
+Each track is added with a destination location and an index into a list of
+keys that's passed to @ref sample(). Usually there's one key per
+@ref Player, and a player is assigned a track duration using
+@ref Player::setDuration() instead of having the tracks added to it. Then, each
+frame, @ref Player::advance(T, K&) updates the key for each player and
+@ref sample() updates all destinations at once:
+
+@snippet MagnumAnimation.cpp BatchSampler-usage
+
+It's possible to have multiple samplers for different value types and
+interpolators and the keys can be shared among all of them. Because all tracks
+in a batch use the same interpolator, the interpolator can also be passed to
+@ref sample(Interpolator, const Containers::StridedArrayView1D<const K>&)
+directly, which allows the compiler to inline it.
+
+Unlike with @ref Player::add(), the destinations are updated in every
+@ref sample() call, even if the corresponding key didn't change since the last
+time.
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class BatchSampler {
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef ResultType(*Interpolator)(const ValueType&, const ValueType&, Float);
+
+        /**
+         * @brief Constructor
+         * @param interpolator  Interpolator function used for all tracks
+         */
+        explicit BatchSampler(Interpolator interpolator) noexcept: _interpolator{interpolator}, _keyCount{} {}
+
+        /** @brief Copying is not allowed */
+        BatchSampler(const BatchSampler<K, V, R>&) = delete;
+
+        /** @brief Move constructor */
+        BatchSampler(BatchSampler<K, V, R>&&) = default;
+
+        /** @brief Copying is not allowed */
+        BatchSampler<K, V, R>& operator=(const BatchSampler<K, V, R>&) = delete;
+
+        /** @brief Move assignment */
+        BatchSampler<K, V, R>& operator=(BatchSampler<K, V, R>&&) = default;
+
+        /** @brief Interpolation function */
+        Interpolator interpolator() const { return _interpolator; }
+
+        /** @brief Whether the sampler is empty */
+        bool isEmpty() const { return _keys.empty(); }
+
+        /** @brief Count of tracks in the sampler */
+        std::size_t size() const { return _keys.size(); }
+
+        /**
+         * @brief Minimal key count
+         *
+         * One more than the largest key index passed to @ref add(), or
+         * @cpp 0 @ce if the sampler is empty. The view passed to
+         * @ref sample() is expected to have at least this many items.
+         */
+        std::size_t keyCount() const { return _keyCount; }
+
+        /**
+         * @brief Add a track
+         * @param track         Track to sample
+         * @param keyIndex      Index of the key in the view passed to
+         *      @ref sample()
+         * @param destination   Where to put the sampled value
+         *
+         * Expects that the track interpolator is the same as
+         * @ref interpolator(). The track data are referenced, so the track
+         * data and @p destination have to stay in scope for the whole
+         * lifetime of the sampler.
+         */
+        BatchSampler<K, V, R>& add(const TrackView<const K, const V, R>& track, std::size_t keyIndex, R& destination) {
+            CORRADE_ASSERT(track.interpolator() == _interpolator,
+                "Animation::BatchSampler::add(): track interpolator doesn't match the sampler", *this);
+
+            /* If the previous track has the same keys, key index and
+               extrapolation behavior, it'll produce the same keyframe index
+               and interpolation factor and so the search can be shared. Not
+               bothering with the single-keyframe special cases. */
+            const Containers::StridedArrayView1D<const K> keys = track.keys();
+            const std::size_t prev = _keys.size() - 1;
+            const bool sharesSearch = !_keys.empty() && keys.size() >= 2 &&
+                keys.data() == _keys[prev].data() &&
+                keys.size() == _keys[prev].size() &&
+                keys.stride() == _keys[prev].stride() &&
+                keyIndex == _keyIndices[prev] &&
+                track.before() == _extrapolations[prev].first &&
+                track.after() == _extrapolations[prev].second;
+
+            arrayAppend(_keys, keys);
+            arrayAppend(_values, track.values());
+            arrayAppend(_extrapolations, Containers::InPlaceInit, track.before(), track.after());
+            arrayAppend(_keyIndices, keyIndex);
+            arrayAppend(_hints, std::size_t{});
+            arrayAppend(_sharesSearch, sharesSearch);
+            arrayAppend(_destinations, &destination);
+            _keyCount = Math::max(_keyCount, keyIndex + 1);
+            return *this;
+        }
+
+        /** @overload */
+        BatchSampler<K, V, R>& add(const TrackView<K, V, R>& track, std::size_t keyIndex, R& destination) {
+            return add(reinterpret_cast<const TrackView<const K, const V, R>&>(track), keyIndex, destination);
+        }
+
+        /**
+         * @overload
+         *
+         * Note that the track ownership is *not* transferred to the
+         * @ref BatchSampler and you have to ensure that it's kept in scope for
+         * the whole lifetime of the sampler.
+         */
+        BatchSampler<K, V, R>& add(const Track<K, V, R>& track, std::size_t keyIndex, R& destination) {
+            return add(TrackView<const K, const V, R>{track}, keyIndex, destination);
+        }
+
+        /**
+         * @brief Sample all tracks
+         * @param keys      Keys at which to sample the tracks
+         *
+         * For every track added with @ref add() calculates the value at
+         * a key from @p keys corresponding to its key index and saves it to
+         * its destination, using the same extrapolation behavior and keyframe
+         * search hints as @ref TrackView::at(). Expects that @p keys has at
+         * least @ref keyCount() items.
+         */
+        void sample(const Containers::StridedArrayView1D<const K>& keys) {
+            sample(_interpolator, keys);
+        }
+
+        /**
+         * @brief Sample all tracks using given interpolator
+         *
+         * Same as @ref sample(const Containers::StridedArrayView1D<const K>&),
+         * but uses @p interpolator instead of the one passed in the
+         * constructor. Passing a function directly instead of a function
+         * pointer saved in a variable allows the compiler to inline it.
+         */
+        void sample(Interpolator interpolator, const Containers::StridedArrayView1D<const K>& keys) {
+            CORRADE_ASSERT(keys.size() >= _keyCount,
+                "Animation::BatchSampler::sample(): expected at least" << _keyCount << "keys but got" << keys.size(), );
+
+            std::size_t hint{};
+            Float factor{};
+            bool defaultConstructed{};
+            for(std::size_t i = 0; i != _keys.size(); ++i) {
+                const Containers::StridedArrayView1D<const V>& values = _values[i];
+
+                /* Keyframe search not shared with the previous track */
+                if(!_sharesSearch[i]) {
+                    const Containers::StridedArrayView1D<const K>& trackKeys = _keys[i];
+
+                    /* Less than two keyframes, delegate to the generic
+                       implementation. These never share the search with the
+                       next track. */
+                    if(trackKeys.size() < 2) {
+                        *_destinations[i] = interpolate(trackKeys, values,
+                            _extrapolations[i].first, _extrapolations[i].second,
+                            interpolator, keys[_keyIndices[i]], _hints[i]);
+                        continue;
+                    }
+
+                    /* Otherwise the same as in interpolate(), but remembering
+                       the result for the following tracks */
+                    K frame = keys[_keyIndices[i]];
+                    hint = _hints[i] = Implementation::findKeyframe(trackKeys, frame, _hints[i]);
+                    defaultConstructed = false;
+                    if(frame < trackKeys[hint]) {
+                        if(_extrapolations[i].first == Extrapolation::DefaultConstructed)
+                            defaultConstructed = true;
+                        else if(_extrapolations[i].first == Extrapolation::Constant)
+                            frame = trackKeys[hint];
+                    } else if(frame >= trackKeys[hint + 1]) {
+                        if(_extrapolations[i].second == Extrapolation::DefaultConstructed)
+                            defaultConstructed = true;
+                        else if(_extrapolations[i].second == Extrapolation::Constant)
+                            frame = trackKeys[hint + 1];
+                    }
+                    factor = Math::lerpInverted(Float(trackKeys[hint]), Float(trackKeys[hint + 1]), Float(frame));
+                }
+
+                *_destinations[i] = defaultConstructed ? R{} :
+                    interpolator(values[hint], values[hint + 1], factor);
+            }
+        }
+
+    private:
+        Interpolator _interpolator;
+        std::size_t _keyCount;
+        Containers::Array<Containers::StridedArrayView1D<const K>> _keys;
+        Containers::Array<Containers::StridedArrayView1D<const V>> _values;
+        Containers::Array<std::pair<Extrapolation, Extrapolation>> _extrapolations;
+        Containers::Array<std::size_t> _keyIndices;
+        Containers::Array<std::size_t> _hints;
+        Containers::Array<bool> _sharesSearch;
+        Containers::Array<R*> _destinations;
+};
+
+}}
+
+#endif
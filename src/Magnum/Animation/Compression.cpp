@@ -0,0 +1,297 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compression.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Animation/UniformTrack.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Animation {
+
+namespace {
+
+/* The three smallest components are in the [-1/sqrt(2), 1/sqrt(2)] range,
+   which is mapped to [0, 32766]. Using an even maximum so zero is exactly
+   representable. */
+constexpr Float QuantizationHalfRange = 16383.0f;
+
+}
+
+CompressedQuaternion::CompressedQuaternion(const Quaternion& quaternion): CompressedQuaternion{} {
+    CORRADE_ASSERT(quaternion.isNormalized(),
+        "Animation::CompressedQuaternion:" << quaternion << "is not normalized", );
+
+    const Vector4 q{quaternion.vector(), quaternion.scalar()};
+
+    /* Find the largest component, flip the sign so it's always positive */
+    UnsignedInt largest = 0;
+    for(UnsignedInt i = 1; i != 4; ++i)
+        if(Math::abs(q[i]) > Math::abs(q[largest])) largest = i;
+    const Float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float component = Math::clamp(sign*q[i]*Constants::sqrt2(), -1.0f, 1.0f);
+        _data[j++] = UnsignedShort(Math::round((component + 1.0f)*QuantizationHalfRange)) << 1;
+    }
+
+    _data[0] |= largest & 1;
+    _data[1] |= (largest >> 1) & 1;
+}
+
+CompressedQuaternion::operator Quaternion() const {
+    const UnsignedInt largest = (_data[0] & 1)|((_data[1] & 1) << 1);
+
+    Vector4 q;
+    Float dot{};
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float component = (Float(_data[j++] >> 1)/QuantizationHalfRange - 1.0f)/Constants::sqrt2();
+        q[i] = component;
+        dot += component*component;
+    }
+    q[largest] = std::sqrt(Math::max(1.0f - dot, 0.0f));
+
+    return Quaternion{q.xyz(), q.w()};
+}
+
+Debug& operator<<(Debug& debug, const CompressedQuaternion& value) {
+    return debug << "Animation::CompressedQuaternion(" << Debug::nospace << Quaternion(value) << Debug::nospace << ")";
+}
+
+Quaternion select(const CompressedQuaternion& a, const CompressedQuaternion& b, const Float t) {
+    /* Decompressing just one of them */
+    return Quaternion(t < 1.0f ? a : b);
+}
+
+Quaternion lerpShortestPath(const CompressedQuaternion& a, const CompressedQuaternion& b, const Float t) {
+    return Math::lerpShortestPath(Quaternion(a), Quaternion(b), t);
+}
+
+Quaternion slerpShortestPath(const CompressedQuaternion& a, const CompressedQuaternion& b, const Float t) {
+    return Math::slerpShortestPath(Quaternion(a), Quaternion(b), t);
+}
+
+Vector2 select(const Vector2h& a, const Vector2h& b, const Float t) {
+    return Vector2{t < 1.0f ? a : b};
+}
+
+Vector3 select(const Vector3h& a, const Vector3h& b, const Float t) {
+    return Vector3{t < 1.0f ? a : b};
+}
+
+Vector2 lerp(const Vector2h& a, const Vector2h& b, const Float t) {
+    return Math::lerp(Vector2{a}, Vector2{b}, t);
+}
+
+Vector3 lerp(const Vector3h& a, const Vector3h& b, const Float t) {
+    return Math::lerp(Vector3{a}, Vector3{b}, t);
+}
+
+namespace Implementation {
+
+auto TypeTraits<CompressedQuaternion, Math::Quaternion<Float>>::interpolator(Interpolation interpolation) -> Interpolator {
+    switch(interpolation) {
+        case Interpolation::Constant: return Animation::select;
+        case Interpolation::Linear: return Animation::slerpShortestPath;
+
+        case Interpolation::Spline:
+        case Interpolation::Custom: ; /* nope */
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
+}
+
+auto TypeTraits<Math::Vector2<Math::Half>, Math::Vector2<Float>>::interpolator(Interpolation interpolation) -> Interpolator {
+    switch(interpolation) {
+        case Interpolation::Constant: return Animation::select;
+        case Interpolation::Linear: return Animation::lerp;
+
+        case Interpolation::Spline:
+        case Interpolation::Custom: ; /* nope */
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
+}
+
+auto TypeTraits<Math::Vector3<Math::Half>, Math::Vector3<Float>>::interpolator(Interpolation interpolation) -> Interpolator {
+    switch(interpolation) {
+        case Interpolation::Constant: return Animation::select;
+        case Interpolation::Linear: return Animation::lerp;
+
+        case Interpolation::Spline:
+        case Interpolation::Custom: ; /* nope */
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
+}
+
+}
+
+namespace {
+
+/* Merging keyframe intervals doesn't change the values, except for cubic
+   Hermite splines where the tangents are relative to the interval length
+   and thus have to be scaled accordingly */
+template<class V> inline V scaleTangents(const V& value, Float, Float) {
+    return value;
+}
+template<class T> inline Math::CubicHermite<T> scaleTangents(const Math::CubicHermite<T>& value, const Float inScale, const Float outScale) {
+    return {value.inTangent()*inScale, value.point(), value.outTangent()*outScale};
+}
+
+/* Whether the original track between keyframes begin and end can be replaced
+   by a single interval */
+template<class V, class R> bool intervalFits(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView1D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const std::size_t begin, const std::size_t end, const Float maxError) {
+    /* Not merging across discontinuities */
+    const Float length = keys[end] - keys[begin];
+    const Float firstLength = keys[begin + 1] - keys[begin];
+    const Float lastLength = keys[end] - keys[end - 1];
+    if(firstLength <= 0.0f || lastLength <= 0.0f) return false;
+
+    const V a = scaleTangents(values[begin], 1.0f, length/firstLength);
+    const V b = scaleTangents(values[end], length/lastLength, 1.0f);
+
+    /* Check at every removed keyframe and halfway between all original
+       keyframes */
+    for(std::size_t i = begin; i != end; ++i) {
+        if(i != begin && Implementation::valueDistance(
+            interpolator(a, b, (keys[i] - keys[begin])/length),
+            interpolator(values[i], values[i + 1], 0.0f)) > maxError)
+            return false;
+
+        const Float halfway = (keys[i] + keys[i + 1])*0.5f;
+        if(Implementation::valueDistance(
+            interpolator(a, b, (halfway - keys[begin])/length),
+            interpolator(values[i], values[i + 1], 0.5f)) > maxError)
+            return false;
+    }
+
+    return true;
+}
+
+template<class V, class R> Track<Float, V, R> reduceKeyframesImplementation(const TrackView<const Float, const V, R>& track, const Float maxError) {
+    const Containers::StridedArrayView1D<const Float> keys = track.keys();
+    const Containers::StridedArrayView1D<const V> values = track.values();
+
+    /* Greedily extend each interval as far as possible. The first keyframe
+       is always kept, the last gets added at the end of the loop. */
+    Containers::Array<std::size_t> kept;
+    if(!keys.empty()) arrayAppend(kept, 0);
+    for(std::size_t begin = 0; begin + 1 < keys.size(); ) {
+        std::size_t end = begin + 1;
+        while(end + 1 < keys.size() && intervalFits(keys, values, track.interpolator(), begin, end + 1, maxError))
+            ++end;
+        arrayAppend(kept, end);
+        begin = end;
+    }
+
+    /* Copy the kept keyframes, adjusting spline tangents to the new interval
+       lengths. Keyframes neighboring in the original track have their
+       interval unchanged. */
+    Containers::Array<std::pair<Float, V>> data{kept.size()};
+    for(std::size_t i = 0; i != kept.size(); ++i) {
+        const std::size_t index = kept[i];
+        const Float inScale = i == 0 || kept[i - 1] + 1 == index ? 1.0f :
+            (keys[index] - keys[kept[i - 1]])/(keys[index] - keys[index - 1]);
+        const Float outScale = i + 1 == kept.size() || index + 1 == kept[i + 1] ? 1.0f :
+            (keys[kept[i + 1]] - keys[index])/(keys[index + 1] - keys[index]);
+        data[i] = {keys[index], scaleTangents(values[index], inScale, outScale)};
+    }
+
+    return Track<Float, V, R>{std::move(data), track.interpolation(), track.interpolator(), track.before(), track.after()};
+}
+
+template<class T, class V> Track<Float, T, V> compressImplementation(const TrackView<const Float, const V, V>& track, const Float maxError) {
+    typedef Track<Float, T, V> Result;
+    CORRADE_ASSERT(track.interpolation() == Interpolation::Constant || track.interpolation() == Interpolation::Linear,
+        "Animation::compress(): expected constant or linear interpolation but got" << track.interpolation(), Result{});
+
+    /* Reduce with the same interpolation as the compressed track will use */
+    const Track<Float, V> reduced = reduceKeyframes(TrackView<const Float, const V>{track.keys(), track.values(), track.interpolation(), interpolatorFor<V>(track.interpolation()), track.before(), track.after()}, maxError);
+
+    Containers::Array<std::pair<Float, T>> data{reduced.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {reduced[i].first, T{reduced[i].second}};
+
+    return Result{std::move(data), track.interpolation(), track.before(), track.after()};
+}
+
+}
+
+Track<Float, Float> reduceKeyframes(const TrackView<const Float, const Float>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, Vector2> reduceKeyframes(const TrackView<const Float, const Vector2>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, Vector3> reduceKeyframes(const TrackView<const Float, const Vector3>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, Vector4> reduceKeyframes(const TrackView<const Float, const Vector4>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, Quaternion> reduceKeyframes(const TrackView<const Float, const Quaternion>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, CubicHermite1D, Float> reduceKeyframes(const TrackView<const Float, const CubicHermite1D, Float>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, CubicHermite2D, Vector2> reduceKeyframes(const TrackView<const Float, const CubicHermite2D, Vector2>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, CubicHermite3D, Vector3> reduceKeyframes(const TrackView<const Float, const CubicHermite3D, Vector3>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, CubicHermiteQuaternion, Quaternion> reduceKeyframes(const TrackView<const Float, const CubicHermiteQuaternion, Quaternion>& track, const Float maxError) {
+    return reduceKeyframesImplementation(track, maxError);
+}
+
+Track<Float, CompressedQuaternion, Quaternion> compress(const TrackView<const Float, const Quaternion>& track, const Float maxError) {
+    return compressImplementation<CompressedQuaternion>(track, maxError);
+}
+
+Track<Float, Vector2h, Vector2> compress(const TrackView<const Float, const Vector2>& track, const Float maxError) {
+    return compressImplementation<Vector2h>(track, maxError);
+}
+
+Track<Float, Vector3h, Vector3> compress(const TrackView<const Float, const Vector3>& track, const Float maxError) {
+    return compressImplementation<Vector3h>(track, maxError);
+}
+
+}}
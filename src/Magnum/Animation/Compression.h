@@ -0,0 +1,348 @@
+#ifndef Magnum_Animation_Compression_h
+#define Magnum_Animation_Compression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::CompressedQuaternion, function @ref Magnum::Animation::reduceKeyframes(), @ref Magnum::Animation::compress()
+ * @m_since_latest
+ */
+
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Compressed quaternion
+@m_since_latest
+
+A unit quaternion stored in 48 bits using the *smallest three* encoding. The
+component with the largest absolute value is omitted and reconstructed from
+the unit length constraint. The remaining three components, which are all in
+the @f$ [-\frac{1}{\sqrt{2}}, \frac{1}{\sqrt{2}}] @f$ range, are quantized to
+15 bits each and the index of the omitted component takes the remaining two
+bits. The sign of the quaternion is chosen so the omitted component is always
+positive, which means the sign isn't preserved --- since @f$ q @f$ and
+@f$ -q @f$ represent the same rotation, compressed rotations should be
+interpolated using the shortest-path variants such as
+@ref slerpShortestPath(const CompressedQuaternion&, const CompressedQuaternion&, Float).
+Maximal error of the three stored components after a round trip is about
+@f$ 2.2 \cdot 10^{-5} @f$, the reconstructed component can have up to three
+times that.
+
+Used for rotation tracks produced by
+@ref compress(const TrackView<const Float, const Quaternion>&, Float).
+@experimental
+*/
+class MAGNUM_EXPORT CompressedQuaternion {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Equivalent to an identity quaternion.
+         */
+        constexpr /*implicit*/ CompressedQuaternion() noexcept: _data{(16383 << 1)|1, (16383 << 1)|1, 16383 << 1} {}
+
+        /**
+         * @brief Compress a quaternion
+         *
+         * Expects that the quaternion is normalized.
+         */
+        explicit CompressedQuaternion(const Quaternion& quaternion);
+
+        /**
+         * @brief Construct from raw data
+         *
+         * The components are expected to be in the same layout as returned
+         * by @ref data().
+         */
+        constexpr explicit CompressedQuaternion(const Vector3us& data) noexcept: _data{data[0], data[1], data[2]} {}
+
+        /** @brief Decompress the quaternion */
+        explicit operator Quaternion() const;
+
+        /**
+         * @brief Raw data
+         *
+         * Upper 15 bits of each component contain the three smallest
+         * quaternion components, lowest bits of the first two components
+         * contain index of the omitted component, lowest bit of the third
+         * component is zero.
+         */
+        constexpr Vector3us data() const {
+            return {_data[0], _data[1], _data[2]};
+        }
+
+        /** @brief Equality comparison */
+        constexpr bool operator==(const CompressedQuaternion& other) const {
+            return _data[0] == other._data[0] &&
+                   _data[1] == other._data[1] &&
+                   _data[2] == other._data[2];
+        }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(const CompressedQuaternion& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        UnsignedShort _data[3];
+};
+
+/**
+@debugoperator{CompressedQuaternion}
+@m_since_latest
+
+Prints the decompressed value.
+*/
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, const CompressedQuaternion& value);
+
+/** @{ @name Interpolators for compressed values
+ * @m_since_latest
+ *
+ * Decompress the values first and then interpolate them. The functions are
+ * picked by @ref interpolatorFor() for @ref CompressedQuaternion and
+ * half-float vector tracks.
+ */
+
+/**
+@brief Constant interpolation of compressed quaternions
+@m_since_latest
+
+Decompresses @p a and @p b and calls @ref Math::select().
+*/
+MAGNUM_EXPORT Quaternion select(const CompressedQuaternion& a, const CompressedQuaternion& b, Float t);
+
+/**
+@brief Shortest-path linear interpolation of compressed quaternions
+@m_since_latest
+
+Decompresses @p a and @p b and calls @ref Math::lerpShortestPath().
+*/
+MAGNUM_EXPORT Quaternion lerpShortestPath(const CompressedQuaternion& a, const CompressedQuaternion& b, Float t);
+
+/**
+@brief Shortest-path spherical linear interpolation of compressed quaternions
+@m_since_latest
+
+Decompresses @p a and @p b and calls @ref Math::slerpShortestPath().
+*/
+MAGNUM_EXPORT Quaternion slerpShortestPath(const CompressedQuaternion& a, const CompressedQuaternion& b, Float t);
+
+/**
+@brief Constant interpolation of half-float vectors
+@m_since_latest
+
+Unpacks @p a and @p b using @ref Math::unpackHalf() and calls
+@ref Math::select().
+*/
+MAGNUM_EXPORT Vector2 select(const Vector2h& a, const Vector2h& b, Float t);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Vector3 select(const Vector3h& a, const Vector3h& b, Float t);
+
+/**
+@brief Linear interpolation of half-float vectors
+@m_since_latest
+
+Unpacks @p a and @p b using @ref Math::unpackHalf() and calls
+@ref Math::lerp().
+*/
+MAGNUM_EXPORT Vector2 lerp(const Vector2h& a, const Vector2h& b, Float t);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Vector3 lerp(const Vector3h& a, const Vector3h& b, Float t);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+/** @{ @name Keyframe reduction
+ * @m_since_latest
+ */
+
+/**
+@brief Remove redundant keyframes from a track
+@param track        Track to reduce
+@param maxError     Maximal allowed error
+@m_since_latest
+
+Greedily merges adjacent keyframe intervals as long as interpolating between
+the interval ends with the track interpolator doesn't deviate from the
+original track by more than @p maxError. The error is checked at all removed
+keyframes and halfway between all original keyframes, the first and last
+keyframe is always kept. For cubic Hermite splines the tangents of the kept
+keyframes are rescaled to the length of the merged interval, which means
+smooth curves sampled into a lot of keyframes can be represented by
+considerably fewer of them.
+
+Distance between values is calculated as an absolute difference for scalars,
+as a length of the difference for vectors and as a length of the difference
+with the sign ambiguity taken into account for quaternions. Interpolation
+behavior, interpolator function and extrapolation behavior is copied from
+@p track.
+@see @ref compress()
+@experimental
+*/
+MAGNUM_EXPORT Track<Float, Float> reduceKeyframes(const TrackView<const Float, const Float>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, Vector2> reduceKeyframes(const TrackView<const Float, const Vector2>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, Vector3> reduceKeyframes(const TrackView<const Float, const Vector3>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, Vector4> reduceKeyframes(const TrackView<const Float, const Vector4>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, Quaternion> reduceKeyframes(const TrackView<const Float, const Quaternion>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, CubicHermite1D, Float> reduceKeyframes(const TrackView<const Float, const CubicHermite1D, Float>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, CubicHermite2D, Vector2> reduceKeyframes(const TrackView<const Float, const CubicHermite2D, Vector2>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, CubicHermite3D, Vector3> reduceKeyframes(const TrackView<const Float, const CubicHermite3D, Vector3>& track, Float maxError);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_EXPORT Track<Float, CubicHermiteQuaternion, Quaternion> reduceKeyframes(const TrackView<const Float, const CubicHermiteQuaternion, Quaternion>& track, Float maxError);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+/** @{ @name Track compression
+ * @m_since_latest
+ */
+
+/**
+@brief Compress a rotation track
+@param track        Track to compress
+@param maxError     Maximal allowed error for keyframe reduction
+@m_since_latest
+
+Removes redundant keyframes using @ref reduceKeyframes() and stores the
+remaining ones as @ref CompressedQuaternion, using 6 bytes instead of 16 per
+value. Expects that the track has either @ref Interpolation::Constant or
+@ref Interpolation::Linear interpolation, the compressed track uses
+@ref select(const CompressedQuaternion&, const CompressedQuaternion&, Float)
+or @ref slerpShortestPath(const CompressedQuaternion&, const CompressedQuaternion&, Float)
+for those and the keyframe reduction is done with these interpolators as well.
+Extrapolation behavior is copied from @p track. The final error is
+@p maxError plus the quantization error described in
+@ref CompressedQuaternion.
+
+The result can be used directly with @ref Player or put into a
+@ref Trade::AnimationData with @ref Trade::AnimationTrackType::CompressedQuaternion
+as the value type and @ref Trade::AnimationTrackType::Quaternion as the result
+type.
+@experimental
+*/
+MAGNUM_EXPORT Track<Float, CompressedQuaternion, Quaternion> compress(const TrackView<const Float, const Quaternion>& track, Float maxError);
+
+/**
+@brief Compress a 2D vector track
+@param track        Track to compress
+@param maxError     Maximal allowed error for keyframe reduction
+@m_since_latest
+
+Removes redundant keyframes using @ref reduceKeyframes() and stores the
+remaining ones as half-floats, using 4 bytes instead of 8 per value. Expects
+that the track has either @ref Interpolation::Constant or
+@ref Interpolation::Linear interpolation, the compressed track uses
+@ref select(const Vector2h&, const Vector2h&, Float) or
+@ref lerp(const Vector2h&, const Vector2h&, Float) for those. Extrapolation
+behavior is copied from @p track. The final error is @p maxError plus the
+half-float rounding error, which is relative to the magnitude of the value
+--- about @f$ 5 \cdot 10^{-4} @f$ of the value.
+
+The result can be used directly with @ref Player or put into a
+@ref Trade::AnimationData with @ref Trade::AnimationTrackType::Vector2h as the
+value type and @ref Trade::AnimationTrackType::Vector2 as the result type.
+@experimental
+*/
+MAGNUM_EXPORT Track<Float, Vector2h, Vector2> compress(const TrackView<const Float, const Vector2>& track, Float maxError);
+
+/**
+@brief Compress a 3D vector track
+@param track        Track to compress
+@param maxError     Maximal allowed error for keyframe reduction
+@m_since_latest
+
+Same as @ref compress(const TrackView<const Float, const Vector2>&, Float),
+storing the values using 6 bytes instead of 12. The result can be put into a
+@ref Trade::AnimationData with @ref Trade::AnimationTrackType::Vector3h as the
+value type and @ref Trade::AnimationTrackType::Vector3 as the result type.
+@experimental
+*/
+MAGNUM_EXPORT Track<Float, Vector3h, Vector3> compress(const TrackView<const Float, const Vector3>& track, Float maxError);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -289,6 +289,10 @@ point as needed:
 
 @snippet MagnumAnimation.cpp Easing-bezier-transform
 
+For evaluating an easing function on a large amount of values at once, such as
+when driving many independent tweens, use @ref easeInto() from the
+@ref Magnum/Animation/EasingBatch.h header.
+
 @section Animation-Easing-references References
 
 Functions follow the common naming from Robert Penner's Easing functions,
@@ -0,0 +1,334 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "EasingBatch.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Magnum { namespace Animation {
+
+namespace {
+
+/* Items are processed in blocks of this size, with every calculation step
+   being a branchless loop over the whole block that the compiler can turn
+   into SIMD operations regardless of the input stride */
+enum: std::size_t { BlockSize = 8 };
+
+typedef Float Block[BlockSize];
+
+/* Rounds to nearest integer, ties away from zero. A truncating conversion
+   instead of std::round() as that's what vectorizes everywhere. */
+inline Int roundToInt(const Float x) {
+    return Int(x + (x >= 0.0f ? 0.5f : -0.5f));
+}
+
+/* π split into three parts for the Cody-Waite range reduction, the first two
+   have few enough mantissa bits to be multiplied by the period count
+   exactly */
+constexpr Float PiA = 3.140625f;
+constexpr Float PiB = 0.0009670257568359375f;
+constexpr Float PiC = 6.278329465e-7f;
+
+/* sin(x) for a block. The argument is reduced to [-π/2, π/2] and a Taylor
+   polynomial up to x¹¹ is used, which has an error below 6e-8 in that
+   range. */
+void sinBlock(const Block& x, Block& out) {
+    Int k[BlockSize];
+    Float r[BlockSize];
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        k[l] = roundToInt(x[l]*(1.0f/Constants::pi()));
+        const Float kf = Float(k[l]);
+        r[l] = ((x[l] - kf*PiA) - kf*PiB) - kf*PiC;
+    }
+
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        const Float r2 = r[l]*r[l];
+        const Float p = r[l] + r[l]*r2*(-1.0f/6.0f + r2*(1.0f/120.0f + r2*(-1.0f/5040.0f + r2*(1.0f/362880.0f + r2*(-1.0f/39916800.0f)))));
+        /* sin(x + kπ) = (-1)^k sin(x) */
+        out[l] = k[l] & 1 ? -p : p;
+    }
+}
+
+/* 2^x for a block. The argument is split into an integer part, which is put
+   directly into the float exponent, and a remainder in [-0.5, 0.5], for which
+   a Taylor polynomial of e^(x ln 2) up to the seventh power is used, with a
+   relative error below 1e-8. Arguments are clamped to the range where the
+   result is a normal float. */
+void exp2Block(const Block& x, Block& out) {
+    Int k[BlockSize];
+    Float y[BlockSize];
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        const Float clamped = std::min(std::max(x[l], -126.0f), 127.0f);
+        k[l] = roundToInt(clamped);
+        y[l] = (clamped - Float(k[l]))*0.6931471805599453f;
+    }
+
+    Int exponent[BlockSize];
+    for(std::size_t l = 0; l != BlockSize; ++l)
+        exponent[l] = (k[l] + 127) << 23;
+    Float scale[BlockSize];
+    std::memcpy(scale, exponent, sizeof(scale));
+
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        const Float p = 1.0f + y[l]*(1.0f + y[l]*(1.0f/2.0f + y[l]*(1.0f/6.0f + y[l]*(1.0f/24.0f + y[l]*(1.0f/120.0f + y[l]*(1.0f/720.0f + y[l]*(1.0f/5040.0f)))))));
+        out[l] = p*scale[l];
+    }
+}
+
+/* Easing::bounceOut() for a block, selecting the parabola coefficients
+   instead of branching */
+void bounceOutBlock(const Block& t, Block& out) {
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        Float a, b, c;
+        if(t[l] < 4.0f/11.0f) {
+            a = 121.0f/16.0f; b = 0.0f; c = 0.0f;
+        } else if(t[l] < 8.0f/11.0f) {
+            a = 363.0f/40.0f; b = -99.0f/10.0f; c = 17.0f/5.0f;
+        } else if(t[l] < 9.0f/10.0f) {
+            a = 4356.0f/361.0f; b = -35442.0f/1805.0f; c = 16061.0f/1805.0f;
+        } else {
+            a = 54.0f/5.0f; b = -513.0f/25.0f; c = 268.0f/25.0f;
+        }
+        out[l] = a*t[l]*t[l] + b*t[l] + c;
+    }
+}
+
+/* Full blocks are processed separately from the remainder so the loads and
+   stores have a compile-time item count there. Everything is loaded before
+   storing so the output can alias the input. */
+template<class Kernel> void easeBlocks(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst, Kernel kernel) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Animation::easeInto(): expected destination view size" << src.size() << "but got" << dst.size(), );
+
+    const char* srcPtr = static_cast<const char*>(src.data());
+    char* dstPtr = static_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride();
+    const std::ptrdiff_t dstStride = dst.stride();
+
+    Block in, out;
+    std::size_t i = 0;
+    for(; i + BlockSize <= src.size(); i += BlockSize) {
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            in[l] = *reinterpret_cast<const Float*>(srcPtr + std::ptrdiff_t(l)*srcStride);
+        kernel(in, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            *reinterpret_cast<Float*>(dstPtr + std::ptrdiff_t(l)*dstStride) = out[l];
+        srcPtr += srcStride*BlockSize;
+        dstPtr += dstStride*BlockSize;
+    }
+
+    if(i != src.size()) {
+        const std::size_t count = src.size() - i;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            in[l] = l < count ? *reinterpret_cast<const Float*>(srcPtr + std::ptrdiff_t(l)*srcStride) : 0.0f;
+        kernel(in, out);
+        for(std::size_t l = 0; l != count; ++l)
+            *reinterpret_cast<Float*>(dstPtr + std::ptrdiff_t(l)*dstStride) = out[l];
+    }
+}
+
+}
+
+template<> void easeInto<Easing::sineIn>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = Constants::piHalf()*(t[l] - 1.0f);
+        sinBlock(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] += 1.0f;
+    });
+}
+
+template<> void easeInto<Easing::sineOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = Constants::piHalf()*t[l];
+        sinBlock(x, out);
+    });
+}
+
+template<> void easeInto<Easing::sineInOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        /* cos(x) = sin(π/2 - x) */
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = Constants::piHalf() - t[l]*Constants::pi();
+        sinBlock(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = 0.5f*(1.0f - out[l]);
+    });
+}
+
+template<> void easeInto<Easing::exponentialIn>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = 10.0f*(t[l] - 1.0f);
+        exp2Block(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = t[l] <= 0.0f ? 0.0f : out[l];
+    });
+}
+
+template<> void easeInto<Easing::exponentialOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = -10.0f*t[l];
+        exp2Block(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = t[l] >= 1.0f ? 1.0f : 1.0f - out[l];
+    });
+}
+
+template<> void easeInto<Easing::exponentialInOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = t[l] < 0.5f ? 20.0f*t[l] - 10.0f : 10.0f - 20.0f*t[l];
+        exp2Block(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const Float half = 0.5f*out[l];
+            out[l] = t[l] <= 0.0f ? 0.0f :
+                     t[l] < 0.5f ? half :
+                     t[l] < 1.0f ? 1.0f - half : 1.0f;
+        }
+    });
+}
+
+template<> void easeInto<Easing::elasticIn>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x, y, sin;
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            x[l] = 10.0f*(t[l] - 1.0f);
+            y[l] = 13.0f*Constants::piHalf()*t[l];
+        }
+        exp2Block(x, out);
+        sinBlock(y, sin);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] *= sin[l];
+    });
+}
+
+template<> void easeInto<Easing::elasticOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x, y, sin;
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            x[l] = -10.0f*t[l];
+            y[l] = 13.0f*Constants::piHalf()*(t[l] + 1.0f);
+        }
+        exp2Block(x, out);
+        sinBlock(y, sin);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = 1.0f - out[l]*sin[l];
+    });
+}
+
+template<> void easeInto<Easing::elasticInOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x, y, sin;
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            x[l] = t[l] < 0.5f ? 10.0f*(2.0f*t[l] - 1.0f) : 10.0f*(1.0f - 2.0f*t[l]);
+            y[l] = 13.0f*Constants::pi()*t[l];
+        }
+        exp2Block(x, out);
+        sinBlock(y, sin);
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const Float half = 0.5f*out[l]*sin[l];
+            out[l] = t[l] < 0.5f ? half : 1.0f - half;
+        }
+    });
+}
+
+template<> void easeInto<Easing::backIn>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block x;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            x[l] = Constants::pi()*t[l];
+        sinBlock(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = t[l]*(t[l]*t[l] - out[l]);
+    });
+}
+
+template<> void easeInto<Easing::backOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block inv, x;
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            inv[l] = 1.0f - t[l];
+            x[l] = Constants::pi()*inv[l];
+        }
+        sinBlock(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = 1.0f - inv[l]*(inv[l]*inv[l] - out[l]);
+    });
+}
+
+template<> void easeInto<Easing::backInOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        /* Both halves are the same function of a different argument */
+        Block u, x;
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            u[l] = t[l] < 0.5f ? 2.0f*t[l] : 2.0f - 2.0f*t[l];
+            x[l] = Constants::pi()*u[l];
+        }
+        sinBlock(x, out);
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const Float half = 0.5f*u[l]*(u[l]*u[l] - out[l]);
+            out[l] = t[l] < 0.5f ? half : 1.0f - half;
+        }
+    });
+}
+
+template<> void easeInto<Easing::bounceIn>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block inv;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            inv[l] = 1.0f - t[l];
+        bounceOutBlock(inv, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = 1.0f - out[l];
+    });
+}
+
+template<> void easeInto<Easing::bounceOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, bounceOutBlock);
+}
+
+template<> void easeInto<Easing::bounceInOut>(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    easeBlocks(src, dst, [](const Block& t, Block& out) {
+        Block u;
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            u[l] = t[l] < 0.5f ? 1.0f - 2.0f*t[l] : 2.0f*t[l] - 1.0f;
+        bounceOutBlock(u, out);
+        for(std::size_t l = 0; l != BlockSize; ++l)
+            out[l] = t[l] < 0.5f ? 0.5f*(1.0f - out[l]) : 0.5f*out[l] + 0.5f;
+    });
+}
+
+}}
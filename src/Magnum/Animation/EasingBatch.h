@@ -0,0 +1,93 @@
+#ifndef Magnum_Animation_EasingBatch_h
+#define Magnum_Animation_EasingBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Animation::easeInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Animation/Easing.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Evaluate an easing function over a range of values
+@tparam     easing  Easing function, usually one from the @ref Easing
+    namespace
+@param[in]  src     Input values
+@param[out] dst     Destination values
+@m_since_latest
+
+Equivalent to calling @p easing with @cpp src[i] @ce and saving the result to
+@cpp dst[i] @ce for every item, useful for example when driving a large amount
+of tweened values at once. Expects that @p src and @p dst have the same size.
+The @p dst view is allowed to alias @p src.
+
+@snippet MagnumAnimation.cpp easeInto
+
+The @ref Easing::sineIn(), @ref Easing::exponentialIn(),
+@ref Easing::elasticIn(), @ref Easing::backIn() and @ref Easing::bounceIn()
+functions, together with their @cpp Out @ce and @cpp InOut @ce variants, have
+a specialized implementation. It processes the items in blocks, evaluates
+branches for the whole block and replaces @ref std::sin(), @ref std::cos() and
+@ref std::pow() with polynomial approximations, so the compiler can vectorize
+all of it. For inputs in the @f$ [0, 1] @f$ range the difference from the
+scalar functions is below @cpp 5.0e-7f @ce. The remaining easing functions are
+simple enough that the compiler is able to vectorize a plain loop over them.
+*/
+template<Float(*easing)(Float)> void easeInto(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Animation::easeInto(): expected destination view size" << src.size() << "but got" << dst.size(), );
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = easing(src[i]);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<> MAGNUM_EXPORT void easeInto<Easing::sineIn>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::sineOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::sineInOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::exponentialIn>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::exponentialOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::exponentialInOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::elasticIn>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::elasticOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::elasticInOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::backIn>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::backOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::backInOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::bounceIn>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::bounceOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+template<> MAGNUM_EXPORT void easeInto<Easing::bounceInOut>(const Corrade::Containers::StridedArrayView1D<const Float>& src, const Corrade::Containers::StridedArrayView1D<Float>& dst);
+#endif
+
+}}
+
+#endif
@@ -175,9 +175,10 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, Extrapolation value);
 @param frame        Frame at which to interpolate
 @param hint         Hint for keyframe search
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value.
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately
+following keyframe is passed to @p interpolator along with calculated
+interpolation factor, returning the interpolated value.
 
 -   In case the first keyframe is already larger than @p frame or @p frame is
     larger or equal to the last keyframe, either the first two or last two
@@ -187,9 +188,13 @@ calculated interpolation factor, returning the interpolated value.
     the interpolator.
 -   In case no keyframes are present, default-constructed value is returned.
 
-The @p hint parameter hints where to start the linear search and is updated
-with keyframe index matching @p frame. If @p frame is earlier than @p hint, the
-search is restarted from the beginning.
+The @p hint parameter hints where to start the search and is updated with
+keyframe index matching @p frame. The search starts at @p hint and proceeds
+forward or backward with exponentially growing steps until it brackets
+@p frame, followed by a binary search in the bracketed range. Advancing to the
+same or the next keyframe thus takes constant time, while seeking to an
+arbitrary @p frame is logarithmic in the distance from @p hint. A hint that's
+out of bounds is clamped to the last valid keyframe pair.
 
 Used internally from @ref Track::at() / @ref TrackView::at(), see @ref Track
 documentation for more information.
@@ -203,12 +208,12 @@ template<class K, class V, class R = ResultOf<V>> R interpolate(const Containers
 /**
 @brief Interpolate animation value with strict constraints
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
-calculated interpolation factor, returning the interpolated value. The @p hint
-parameter hints where to start the linear search and is updated with keyframe
-index matching @p frame. If @p frame is earlier than @p hint, the search is
-restarted from the beginning.
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately
+following keyframe is passed to @p interpolator along with calculated
+interpolation factor, returning the interpolated value. The @p hint parameter
+hints where to start the search and is updated with keyframe index matching
+@p frame, see @ref interpolate() for details about the search.
 
 This is a stricter but more performant version of @ref interpolate() with
 implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
@@ -301,6 +306,26 @@ template<class T> struct ResultTraits<Math::CubicHermite<T>> {
 template<class T> struct ResultTraits<const Math::CubicHermite<T>> {
     typedef T Type;
 };
+/* Compressed types, decompressed for interpolation. The interpolators are
+   defined in Compression.cpp. */
+template<> struct ResultTraits<CompressedQuaternion> {
+    typedef Math::Quaternion<Float> Type;
+};
+template<> struct ResultTraits<const CompressedQuaternion> {
+    typedef Math::Quaternion<Float> Type;
+};
+template<> struct ResultTraits<Math::Vector2<Math::Half>> {
+    typedef Math::Vector2<Float> Type;
+};
+template<> struct ResultTraits<const Math::Vector2<Math::Half>> {
+    typedef Math::Vector2<Float> Type;
+};
+template<> struct ResultTraits<Math::Vector3<Math::Half>> {
+    typedef Math::Vector3<Float> Type;
+};
+template<> struct ResultTraits<const Math::Vector3<Math::Half>> {
+    typedef Math::Vector3<Float> Type;
+};
 template<class V> struct TypeTraits<V, V> {
     typedef V(*Interpolator)(const V&, const V&, Float);
 
@@ -410,6 +435,73 @@ TypeTraits<Math::CubicHermite<T>, T> {
 
 }
 
+namespace Implementation {
+
+/* Returns the last index in the [0, keys.size() - 2] range with the key not
+   larger than frame, or 0 if the frame is before the first key. Expects at
+   least two keys. Gallops from the hint in the direction of the frame with
+   exponentially growing steps and then bisects the bracketed range, so
+   sequential playback costs a constant amount of comparisons while an
+   arbitrary seek is logarithmic in the distance from the hint. */
+template<class K> std::size_t findKeyframe(const Containers::StridedArrayView1D<const K>& keys, const K frame, std::size_t hint) {
+    const std::size_t last = keys.size() - 2;
+    if(hint > last) hint = last;
+
+    /* The result is in the [lo, hi) range, keys[lo] is not larger than frame
+       (or lo is 0) and keys[hi] is larger than frame (or hi is last + 1) */
+    std::size_t lo, hi;
+    std::size_t step = 1;
+    if(frame >= keys[hint]) {
+        /* Fast path for staying on the same keyframe, which is the most
+           common case during playback */
+        if(hint == last || frame < keys[hint + 1]) return hint;
+
+        lo = hint + 1;
+        while(lo + step <= last && frame >= keys[lo + step]) {
+            lo += step;
+            step *= 2;
+        }
+        hi = Math::min(lo + step, last + 1);
+    } else {
+        hi = hint;
+        while(step <= hi && frame < keys[hi - step]) {
+            hi -= step;
+            step *= 2;
+        }
+        if(step > hi) {
+            if(hi == 0 || frame < keys[0]) return 0;
+            lo = 0;
+        } else lo = hi - step;
+    }
+
+    while(hi - lo > 1) {
+        const std::size_t mid = lo + (hi - lo)/2;
+        if(frame >= keys[mid]) lo = mid;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+/* Compressed types */
+template<> struct TypeTraits<CompressedQuaternion, Math::Quaternion<Float>> {
+    typedef Math::Quaternion<Float>(*Interpolator)(const CompressedQuaternion&, const CompressedQuaternion&, Float);
+
+    MAGNUM_EXPORT static Interpolator interpolator(Interpolation interpolation);
+};
+template<> struct TypeTraits<Math::Vector2<Math::Half>, Math::Vector2<Float>> {
+    typedef Math::Vector2<Float>(*Interpolator)(const Math::Vector2<Math::Half>&, const Math::Vector2<Math::Half>&, Float);
+
+    MAGNUM_EXPORT static Interpolator interpolator(Interpolation interpolation);
+};
+template<> struct TypeTraits<Math::Vector3<Math::Half>, Math::Vector3<Float>> {
+    typedef Math::Vector3<Float>(*Interpolator)(const Math::Vector3<Math::Half>&, const Math::Vector3<Math::Half>&, Float);
+
+    MAGNUM_EXPORT static Interpolator interpolator(Interpolation interpolation);
+};
+
+}
+
 /* Needs to be defined later so it can pick up the TypeTraits definitions */
 template<class V, class R> auto interpolatorFor(Interpolation interpolation) -> R(*)(const V&, const V&, Float) {
     return Implementation::TypeTraits<typename std::remove_const<V>::type, R>::interpolator(interpolation);
@@ -430,12 +522,8 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
         return interpolator(values[0], values[0], 0.0f);
     }
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair that is around given time, starting from the hint */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
@@ -455,12 +543,8 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair that is around given time, starting from the hint */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     return interpolator(values[hint], values[hint + 1],
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
@@ -0,0 +1,406 @@
+#ifndef Magnum_Animation_Mixer_h
+#define Magnum_Animation_Mixer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::Mixer
+ * @m_since_latest
+ */
+
+#include "Magnum/Animation/BatchSampler.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    template<class> struct MixerTraits;
+}
+
+/**
+@brief Animation blending and layering mixer
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+@m_since_latest
+
+Blends multiple animations affecting the same set of targets --- for example
+bones of a skinned mesh --- together. Blending using @ref Player alone would
+mean adding a user callback to every track via @ref Player::addWithCallback()
+and combining the values there, resulting in scattered writes and a separate
+indirect call for every value in every layer. Instead, this class samples each
+layer into a contiguous temporary buffer using a @ref BatchSampler and then
+combines the whole buffer with the destination in a single loop.
+
+Each layer consists of tracks that are assigned to target indices in the
+destination and has a weight and an optional per-target mask. Layers are
+applied in the order they were added, each layer is one of these two kinds:
+
+-   A layer added with @ref addLayer() replaces the destination value, linearly
+    interpolating between the existing value and the sampled value with the
+    layer weight multiplied by the mask value for given target. For quaternions
+    normalized linear interpolation on the shortest path is used. To
+    crossfade between two animations, keep the first layer at weight
+    @cpp 1.0f @ce and change the weight of the second layer from
+    @cpp 0.0f @ce to @cpp 1.0f @ce. Fading the first layer out at the same
+    time would not result in a crossfade, as the interpolations are chained
+    and the result would dip towards the destination value halfway through.
+-   A layer added with @ref addAdditiveLayer() adds the sampled value scaled by
+    the layer weight and mask value to the destination value. For quaternions,
+    the destination is rotated by the sampled value interpolated from an
+    identity quaternion by the weight and mask value. The tracks are expected
+    to contain a difference from some reference pose.
+
+Targets that don't have any track in given layer are not affected by it. The
+mixer doesn't have its own storage for the result, the destination is
+provided by the caller in @ref mix() and its existing contents are used as
+the base, for example as a rest pose. Only scalar, vector and quaternion result
+types are supported.
+
+@section Animation-Mixer-usage Basic usage
+
+The following blends a walk and a run animation of a character together based
+on its speed and adds an additive breathing layer that affects only the upper
+body. Each layer is sampled at its own key, usually coming from a @ref Player
+through @ref Player::advance(T, K&):
+
+@snippet MagnumAnimation.cpp Mixer-usage
+
+Because a mixer has just a single value type and interpolator, translation,
+rotation and scaling tracks need a mixer each.
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class Mixer {
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef ResultType(*Interpolator)(const ValueType&, const ValueType&, Float);
+
+        /**
+         * @brief Constructor
+         * @param interpolator  Interpolator function used for all tracks
+         * @param count         Target count
+         */
+        explicit Mixer(Interpolator interpolator, std::size_t count) noexcept: _interpolator{interpolator}, _count{count} {}
+
+        /** @brief Copying is not allowed */
+        Mixer(const Mixer<K, V, R>&) = delete;
+
+        /** @brief Move constructor */
+        Mixer(Mixer<K, V, R>&&) = default;
+
+        /** @brief Copying is not allowed */
+        Mixer<K, V, R>& operator=(const Mixer<K, V, R>&) = delete;
+
+        /** @brief Move assignment */
+        Mixer<K, V, R>& operator=(Mixer<K, V, R>&&) = default;
+
+        /** @brief Interpolation function */
+        Interpolator interpolator() const { return _interpolator; }
+
+        /**
+         * @brief Target count
+         *
+         * The destination view passed to @ref mix() is expected to have
+         * exactly this many items.
+         */
+        std::size_t count() const { return _count; }
+
+        /**
+         * @brief Layer count
+         *
+         * The key view passed to @ref mix() is expected to have exactly this
+         * many items.
+         */
+        std::size_t layerCount() const { return _layers.size(); }
+
+        /**
+         * @brief Add a layer
+         * @param weight    Layer weight
+         * @return ID of the newly added layer
+         *
+         * The layer replaces destination values of targets it has tracks
+         * for, interpolating between the existing and the sampled value by
+         * @p weight. The mask is initially @cpp 1.0f @ce for all targets.
+         * @see @ref addAdditiveLayer(), @ref setLayerWeight(),
+         *      @ref setLayerMask()
+         */
+        std::size_t addLayer(Float weight = 1.0f) {
+            return addLayerInternal(weight, false);
+        }
+
+        /**
+         * @brief Add an additive layer
+         * @param weight    Layer weight
+         * @return ID of the newly added layer
+         *
+         * The layer adds the sampled values scaled by @p weight to
+         * destination values of targets it has tracks for. The mask is
+         * initially @cpp 1.0f @ce for all targets.
+         * @see @ref addLayer(), @ref setLayerWeight(), @ref setLayerMask()
+         */
+        std::size_t addAdditiveLayer(Float weight = 1.0f) {
+            return addLayerInternal(weight, true);
+        }
+
+        /**
+         * @brief Whether a layer is additive
+         *
+         * Expects that @p layer is less than @ref layerCount().
+         */
+        bool isLayerAdditive(std::size_t layer) const {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::isLayerAdditive(): index" << layer << "out of range for" << _layers.size() << "layers", {});
+            return _layers[layer].additive;
+        }
+
+        /**
+         * @brief Layer weight
+         *
+         * Expects that @p layer is less than @ref layerCount().
+         */
+        Float layerWeight(std::size_t layer) const {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::layerWeight(): index" << layer << "out of range for" << _layers.size() << "layers", {});
+            return _layers[layer].weight;
+        }
+
+        /**
+         * @brief Set layer weight
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount(). Changing the
+         * weight every frame is cheap, so it can be used to fade layers in
+         * and out.
+         */
+        Mixer<K, V, R>& setLayerWeight(std::size_t layer, Float weight) {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::setLayerWeight(): index" << layer << "out of range for" << _layers.size() << "layers", *this);
+            _layers[layer].weight = weight;
+            return *this;
+        }
+
+        /**
+         * @brief Layer mask
+         *
+         * Per-target weight multiplier. Expects that @p layer is less than
+         * @ref layerCount().
+         */
+        Containers::ArrayView<const Float> layerMask(std::size_t layer) const {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::layerMask(): index" << layer << "out of range for" << _layers.size() << "layers", {});
+            return _layers[layer].mask;
+        }
+
+        /**
+         * @brief Set layer mask
+         * @return Reference to self (for method chaining)
+         *
+         * The @p mask is copied and multiplies the layer weight for each
+         * target, which allows for example to apply a layer to only a part
+         * of a skeleton. Expects that @p layer is less than
+         * @ref layerCount() and @p mask has exactly @ref count() items.
+         */
+        Mixer<K, V, R>& setLayerMask(std::size_t layer, const Containers::StridedArrayView1D<const Float>& mask) {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::setLayerMask(): index" << layer << "out of range for" << _layers.size() << "layers", *this);
+            CORRADE_ASSERT(mask.size() == _count,
+                "Animation::Mixer::setLayerMask(): expected" << _count << "items but got" << mask.size(), *this);
+            Layer& l = _layers[layer];
+            for(std::size_t i = 0; i != _count; ++i) l.mask[i] = mask[i];
+            return *this;
+        }
+
+        /**
+         * @brief Add a track to a layer
+         * @param layer     Layer ID
+         * @param track     Track to sample
+         * @param target    Target index in the view passed to @ref mix()
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount(), @p target is
+         * less than @ref count() and the layer doesn't have a track for
+         * @p target yet, and that the track interpolator is the same as
+         * @ref interpolator(). The track data are referenced, so they have to
+         * stay in scope for the whole lifetime of the mixer.
+         */
+        Mixer<K, V, R>& add(std::size_t layer, const TrackView<const K, const V, R>& track, std::size_t target) {
+            CORRADE_ASSERT(layer < _layers.size(),
+                "Animation::Mixer::add(): index" << layer << "out of range for" << _layers.size() << "layers", *this);
+            CORRADE_ASSERT(target < _count,
+                "Animation::Mixer::add(): target" << target << "out of range for" << _count << "targets", *this);
+            CORRADE_ASSERT(track.interpolator() == _interpolator,
+                "Animation::Mixer::add(): track interpolator doesn't match the mixer", *this);
+            Layer& l = _layers[layer];
+            CORRADE_ASSERT(!l.hasTrack[target],
+                "Animation::Mixer::add(): layer" << layer << "already has a track for target" << target, *this);
+            l.hasTrack[target] = true;
+            l.sampler.add(track, 0, l.values[target]);
+            return *this;
+        }
+
+        /** @overload */
+        Mixer<K, V, R>& add(std::size_t layer, const TrackView<K, V, R>& track, std::size_t target) {
+            return add(layer, reinterpret_cast<const TrackView<const K, const V, R>&>(track), target);
+        }
+
+        /**
+         * @overload
+         *
+         * Note that the track ownership is *not* transferred to the
+         * @ref Mixer and you have to ensure that it's kept in scope for the
+         * whole lifetime of the mixer.
+         */
+        Mixer<K, V, R>& add(std::size_t layer, const Track<K, V, R>& track, std::size_t target) {
+            return add(layer, TrackView<const K, const V, R>{track}, target);
+        }
+
+        /**
+         * @brief Mix all layers
+         * @param keys          Keys at which to sample each layer
+         * @param destination   Destination values
+         *
+         * Samples each layer at a key from @p keys corresponding to its ID
+         * and applies it to @p destination as described in the
+         * @ref Animation-Mixer "class documentation". Expects that @p keys
+         * has exactly @ref layerCount() items and @p destination has
+         * exactly @ref count() items. Quaternion destination values are
+         * expected to be normalized.
+         */
+        void mix(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<R>& destination) {
+            CORRADE_ASSERT(keys.size() == _layers.size(),
+                "Animation::Mixer::mix(): expected" << _layers.size() << "keys but got" << keys.size(), );
+            CORRADE_ASSERT(destination.size() == _count,
+                "Animation::Mixer::mix(): expected" << _count << "destination items but got" << destination.size(), );
+
+            for(std::size_t i = 0; i != _layers.size(); ++i) {
+                Layer& l = _layers[i];
+                if(l.sampler.isEmpty()) continue;
+
+                /* Sample the whole layer at once */
+                const K key = keys[i];
+                l.sampler.sample(Containers::arrayView(&key, 1));
+
+                /* Calculate weight for each target, zero for targets that
+                   aren't affected by this layer */
+                for(std::size_t j = 0; j != _count; ++j)
+                    l.weights[j] = l.hasTrack[j] ? l.weight*l.mask[j] : 0.0f;
+
+                /* And combine it with the destination */
+                if(l.additive)
+                    Implementation::MixerTraits<R>::add(destination, l.values, l.weights);
+                else
+                    Implementation::MixerTraits<R>::blend(destination, l.values, l.weights);
+            }
+        }
+
+    private:
+        struct Layer {
+            explicit Layer(Interpolator interpolator, std::size_t count, Float weight, bool additive): sampler{interpolator}, values{Containers::ValueInit, count}, weights{Containers::ValueInit, count}, mask{Containers::DirectInit, count, 1.0f}, hasTrack{Containers::ValueInit, count}, weight{weight}, additive{additive} {}
+
+            BatchSampler<K, V, R> sampler;
+            /* Indexed by target, the sampler writes directly here. Values of
+               targets without a track stay default-constructed. */
+            Containers::Array<R> values;
+            Containers::Array<Float> weights;
+            Containers::Array<Float> mask;
+            Containers::Array<bool> hasTrack;
+            Float weight;
+            bool additive;
+        };
+
+        std::size_t addLayerInternal(Float weight, bool additive) {
+            arrayAppend(_layers, Containers::InPlaceInit, _interpolator, _count, weight, additive);
+            return _layers.size() - 1;
+        }
+
+        Interpolator _interpolator;
+        std::size_t _count;
+        Containers::Array<Layer> _layers;
+};
+
+namespace Implementation {
+
+/* Scalar and vector types */
+template<class R> struct MixerTraits {
+    static void blend(const Containers::StridedArrayView1D<R>& destination, const Containers::ArrayView<const R> values, const Containers::ArrayView<const Float> weights) {
+        for(std::size_t i = 0; i != values.size(); ++i)
+            destination[i] = Math::lerp(destination[i], values[i], weights[i]);
+    }
+
+    static void add(const Containers::StridedArrayView1D<R>& destination, const Containers::ArrayView<const R> values, const Containers::ArrayView<const Float> weights) {
+        for(std::size_t i = 0; i != values.size(); ++i)
+            destination[i] += values[i]*weights[i];
+    }
+};
+
+template<class T> struct MixerTraits<Math::Quaternion<T>> {
+    static void blend(const Containers::StridedArrayView1D<Math::Quaternion<T>>& destination, const Containers::ArrayView<const Math::Quaternion<T>> values, const Containers::ArrayView<const Float> weights) {
+        for(std::size_t i = 0; i != values.size(); ++i)
+            destination[i] = Math::lerpShortestPath(destination[i], values[i], T(weights[i]));
+    }
+
+    static void add(const Containers::StridedArrayView1D<Math::Quaternion<T>>& destination, const Containers::ArrayView<const Math::Quaternion<T>> values, const Containers::ArrayView<const Float> weights) {
+        for(std::size_t i = 0; i != values.size(); ++i)
+            destination[i] = (Math::lerpShortestPath(Math::Quaternion<T>{}, values[i], T(weights[i]))*destination[i]).normalized();
+    }
+};
+
+/* Float quaternions use the batch interpolation */
+template<> struct MixerTraits<Math::Quaternion<Float>> {
+    static void blend(const Containers::StridedArrayView1D<Math::Quaternion<Float>>& destination, const Containers::ArrayView<const Math::Quaternion<Float>> values, const Containers::ArrayView<const Float> weights) {
+        Math::lerpShortestPathInto(destination, values, weights, destination);
+    }
+
+    static void add(const Containers::StridedArrayView1D<Math::Quaternion<Float>>& destination, const Containers::ArrayView<Math::Quaternion<Float>> values, const Containers::ArrayView<const Float> weights) {
+        /* Scale the rotations in-place, as the values get sampled again in
+           every mix() call anyway */
+        const Math::Quaternion<Float> identity;
+        Math::lerpShortestPathInto(
+            Containers::StridedArrayView1D<const Math::Quaternion<Float>>{Containers::arrayView(&identity, 1), &identity, values.size(), 0},
+            values, weights, values);
+        for(std::size_t i = 0; i != values.size(); ++i)
+            destination[i] = (values[i]*destination[i]).normalized();
+    }
+};
+
+}
+
+}}
+
+#endif
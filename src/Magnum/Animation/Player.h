@@ -116,7 +116,11 @@ The @ref addWithCallbackOnChange() variant will fire the callback only if the
 interpolated value changes, which is useful for triggering other events. See
 @ref Animation-Player-higher-order "below" for an example. Lastly, there is
 @ref addRawCallback() that allows for greater control and further performance
-optimizations. See its documentation for a usage example code snippet.
+optimizations. See its documentation for a usage example code snippet. When
+animating a large number of instances, it's possible to add the tracks to a
+@ref BatchSampler instead and drive it with @ref advance(T, K&), avoiding the
+per-track overhead. Similarly, for blending several animations together, use a
+@ref Mixer instead of combining the values in callbacks.
 
 The animation is implicitly played only once, use @ref setPlayCount() to set a
 number of repeats or make it repeat indefinitely. By default, the
@@ -265,6 +269,39 @@ template<class T, class K
          */
         static void advance(T time, std::initializer_list<Containers::Reference<Player<T, K>>> players);
 
+        /**
+         * @brief Advance multiple players in parallel
+         * @param time          Time
+         * @param players       Players to advance
+         * @param threadCount   Thread count. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         * @m_since_latest
+         *
+         * Splits @p players into @p threadCount contiguous chunks and advances
+         * each on a separate thread. The threads come from a pool that's
+         * created on first use and shared by all multi-threaded APIs, so
+         * calling this every frame doesn't create new threads. Only tracks added with @ref add() are
+         * advanced concurrently, as those only write to their destination.
+         * Tracks added with @ref addWithCallback(),
+         * @ref addWithCallbackOnChange() and @ref addRawCallback() are
+         * advanced afterwards on the calling thread, in order of @p players
+         * and in order they were added, so the user callbacks are always
+         * called in the same order regardless of @p threadCount. That also
+         * means destinations of all players are updated before any callback
+         * is called. Apart from that, the result is the same as calling
+         * @ref advance(T) for each item in @p players. Destinations of
+         * different players are expected to not overlap. On
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" all players are
+         * advanced on the calling thread.
+         */
+        static void advance(T time, Containers::ArrayView<Player<T, K>> players, std::size_t threadCount);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        static void advance(T time, Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, std::size_t threadCount);
+
         /** @brief Constructor */
         explicit Player();
 
@@ -801,10 +838,23 @@ template<class T, class K
          */
         Player<T, K>& advance(T time);
 
+        /**
+         * @brief Advance the animation and retrieve the current key
+         * @m_since_latest
+         *
+         * Same as @ref advance(T), but additionally saves the key at which
+         * the tracks were advanced to @p key. If the tracks were not advanced,
+         * @p key is left untouched. Useful for driving tracks that aren't
+         * added to the player, such as in a @ref BatchSampler.
+         */
+        Player<T, K>& advance(T time, K& key);
+
     private:
         struct Track;
 
-        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData);
+        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, bool concurrent = false);
+
+        static void advanceInternal(T time, std::size_t count, Player<T, K>&(*player)(const void*, std::size_t), const void* players, std::size_t threadCount);
 
         Containers::Optional<std::pair<UnsignedInt, K>> elapsedInternal(T time, T& updatedStartTime, T& updatedPauseTime, State& updatedState) const;
 
@@ -820,7 +870,7 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
     return addInternal(track,
         [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void* destination, void(*)(), void*) {
             *static_cast<R*>(destination) = static_cast<const TrackView<const K, const V, R>&>(track).at(key, hint);
-        }, &destination, nullptr, nullptr);
+        }, &destination, nullptr, nullptr, true);
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -35,6 +35,8 @@
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Reference.h>
 
+#include "Magnum/Implementation/parallelFor.h"
+
 namespace Magnum { namespace Animation {
 
 namespace Implementation {
@@ -61,13 +63,16 @@ namespace Implementation {
 template<class T, class K> struct Player<T, K>::Track  {
     /* Not sure why is this still needed for emplace_back(). It's 2018,
        COME ON  ¯\_(ツ)_/¯ */
-    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hint{hint} {}
+    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, bool concurrent, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, concurrent{concurrent}, hint{hint} {}
 
     TrackViewStorage<const K> track;
     void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*);
     void* destination;
     void(*userCallback)();
     void* userCallbackData;
+    /* Only writes to the destination and thus can be advanced from multiple
+       threads, as opposed to tracks with arbitrary user callbacks */
+    bool concurrent;
     std::size_t hint;
 };
 #endif
@@ -76,6 +81,18 @@ template<class T, class K> void Player<T, K>::advance(const T time, const std::i
     for(Player<T, K>& p: players) p.advance(time);
 }
 
+template<class T, class K> void Player<T, K>::advance(const T time, const Containers::ArrayView<Player<T, K>> players, const std::size_t threadCount) {
+    advanceInternal(time, players.size(), [](const void* players, std::size_t i) -> Player<T, K>& {
+        return static_cast<Player<T, K>*>(const_cast<void*>(players))[i];
+    }, players.data(), threadCount);
+}
+
+template<class T, class K> void Player<T, K>::advance(const T time, const Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, const std::size_t threadCount) {
+    advanceInternal(time, players.size(), [](const void* players, std::size_t i) -> Player<T, K>& {
+        return static_cast<const Containers::Reference<Player<T, K>>*>(players)[i];
+    }, players.data(), threadCount);
+}
+
 template<class T, class K> Player<T, K>::Player(Player<T, K>&&) noexcept = default;
 
 template<class T, class K> Player<T, K>& Player<T, K>::operator=(Player<T, K>&&) noexcept = default;
@@ -101,12 +118,12 @@ template<class T, class K> const TrackViewStorage<const K>& Player<T, K>::track(
     return _tracks[i].track;
 }
 
-template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData) {
+template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData, const bool concurrent) {
     if(_tracks.empty() && _duration == Math::Range1D<K>{})
         _duration = track.duration();
     else
         _duration = Math::join(track.duration(), _duration);
-    arrayAppend(_tracks, Containers::InPlaceInit, track, advancer, destination, userCallback, userCallbackData, 0u);
+    arrayAppend(_tracks, Containers::InPlaceInit, track, advancer, destination, userCallback, userCallbackData, concurrent, 0u);
     return *this;
 }
 
@@ -296,18 +313,59 @@ template<class T, class K> std::pair<UnsignedInt, K> Player<T, K>::elapsed(const
 }
 
 template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time) {
+    K key;
+    return advance(time, key);
+}
+
+template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time, K& key) {
     /* Get the elapsed time. If we shouldn't advance anything (player already
        stopped / not yet playing, quit */
     Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(_duration.size(), _playCount, _scaler, time, _startTime, _stopPauseTime, _state);
     if(!elapsed) return *this;
 
     /* Advance all tracks. Properly handle durations that don't start at 0. */
+    key = _duration.min() + elapsed->second;
     for(Track& t: _tracks)
-        t.advancer(t.track, _duration.min() + elapsed->second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        t.advancer(t.track, key, t.hint, t.destination, t.userCallback, t.userCallbackData);
 
     return *this;
 }
 
+template<class T, class K> void Player<T, K>::advanceInternal(const T time, const std::size_t count, Player<T, K>&(*const player)(const void*, std::size_t), const void* const players, const std::size_t threadCount) {
+    /* Key at which each player got advanced, if at all */
+    Containers::Array<Containers::Optional<K>> keys{count};
+
+    /* Update the state and advance the tracks that only write to their
+       destination in parallel */
+    struct AdvanceState {
+        T time;
+        Player<T, K>&(*player)(const void*, std::size_t);
+        const void* players;
+        Containers::Array<Containers::Optional<K>>& keys;
+    } state{time, player, players, keys};
+    Magnum::Implementation::parallelFor(count, Magnum::Implementation::parallelChunkCount(count, threadCount), [](void* data, std::size_t, std::size_t begin, std::size_t end) {
+        AdvanceState& state = *static_cast<AdvanceState*>(data);
+        for(std::size_t i = begin; i != end; ++i) {
+            Player<T, K>& p = state.player(state.players, i);
+            Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(p._duration.size(), p._playCount, p._scaler, state.time, p._startTime, p._stopPauseTime, p._state);
+            if(!elapsed) continue;
+
+            const K key = p._duration.min() + elapsed->second;
+            state.keys[i] = key;
+            for(Track& t: p._tracks) if(t.concurrent)
+                t.advancer(t.track, key, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        }
+    }, &state);
+
+    /* Advance the tracks with user callbacks on this thread in a
+       deterministic order */
+    for(std::size_t i = 0; i != count; ++i) {
+        if(!keys[i]) continue;
+        for(Track& t: player(players, i)._tracks) if(!t.concurrent)
+            t.advancer(t.track, *keys[i], t.hint, t.destination, t.userCallback, t.userCallbackData);
+    }
+}
+
 }}
 
 #endif
@@ -0,0 +1,260 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/BatchSampler.h"
+#include "Magnum/Animation/Player.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct BatchSamplerTest: TestSuite::Tester {
+    explicit BatchSamplerTest();
+
+    void construct();
+    void constructMove();
+
+    void add();
+    void addInvalid();
+
+    void sample();
+    void sampleExtrapolation();
+    void sampleInterpolator();
+    void sampleSharedSearch();
+    void sampleInvalid();
+
+    void players();
+};
+
+const Track<Float, Vector3> TrackA{{
+    {0.0f, {0.0f, 1.0f, 2.0f}},
+    {2.0f, {2.0f, 1.0f, 0.0f}},
+    {4.0f, {2.0f, 3.0f, 4.0f}}
+}, Math::lerp};
+
+const Track<Float, Vector3> TrackB{{
+    {1.0f, {1.0f, 1.0f, 1.0f}},
+    {3.0f, {-1.0f, 0.0f, 1.0f}}
+}, Math::lerp, Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+BatchSamplerTest::BatchSamplerTest() {
+    addTests({&BatchSamplerTest::construct,
+              &BatchSamplerTest::constructMove,
+
+              &BatchSamplerTest::add,
+              &BatchSamplerTest::addInvalid,
+
+              &BatchSamplerTest::sample,
+              &BatchSamplerTest::sampleExtrapolation,
+              &BatchSamplerTest::sampleInterpolator,
+              &BatchSamplerTest::sampleSharedSearch,
+              &BatchSamplerTest::sampleInvalid,
+
+              &BatchSamplerTest::players});
+}
+
+void BatchSamplerTest::construct() {
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    CORRADE_COMPARE(sampler.interpolator(), static_cast<Vector3(*)(const Vector3&, const Vector3&, Float)>(Math::lerp));
+    CORRADE_VERIFY(sampler.isEmpty());
+    CORRADE_COMPARE(sampler.size(), 0);
+    CORRADE_COMPARE(sampler.keyCount(), 0);
+}
+
+void BatchSamplerTest::constructMove() {
+    Vector3 destination;
+    BatchSampler<Float, Vector3> a{Math::lerp};
+    a.add(TrackA, 3, destination);
+
+    BatchSampler<Float, Vector3> b{std::move(a)};
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.keyCount(), 4);
+
+    BatchSampler<Float, Vector3> c{Math::select};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.keyCount(), 4);
+    CORRADE_COMPARE(c.interpolator(), static_cast<Vector3(*)(const Vector3&, const Vector3&, Float)>(Math::lerp));
+
+    CORRADE_VERIFY(!std::is_copy_constructible<BatchSampler<Float, Vector3>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<BatchSampler<Float, Vector3>>::value);
+}
+
+void BatchSamplerTest::add() {
+    Vector3 a, b, c;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 2, a)
+        .add(TrackView<const Float, const Vector3>{TrackB}, 0, b)
+        .add(TrackA, 1, c);
+
+    CORRADE_VERIFY(!sampler.isEmpty());
+    CORRADE_COMPARE(sampler.size(), 3);
+    CORRADE_COMPARE(sampler.keyCount(), 3);
+}
+
+void BatchSamplerTest::addInvalid() {
+    Vector3 a;
+    BatchSampler<Float, Vector3> sampler{Math::select};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    sampler.add(TrackA, 0, a);
+    CORRADE_VERIFY(sampler.isEmpty());
+    CORRADE_COMPARE(out.str(), "Animation::BatchSampler::add(): track interpolator doesn't match the sampler\n");
+}
+
+void BatchSamplerTest::sample() {
+    Vector3 a, b, c;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 0, a)
+        .add(TrackB, 1, b)
+        .add(TrackA, 1, c);
+
+    const Float keys[]{1.0f, 3.5f};
+    sampler.sample(keys);
+    CORRADE_COMPARE(a, TrackA.at(1.0f));
+    CORRADE_COMPARE(b, TrackB.at(3.5f));
+    CORRADE_COMPARE(c, TrackA.at(3.5f));
+
+    /* Going back in time and forward again, hints get updated */
+    for(Float key: {0.5f, 3.0f, 1.5f, 2.5f, 4.0f}) {
+        const Float keys2[]{key, key};
+        sampler.sample(keys2);
+        CORRADE_COMPARE(a, TrackA.at(key));
+        CORRADE_COMPARE(b, TrackB.at(key));
+        CORRADE_COMPARE(c, TrackA.at(key));
+    }
+}
+
+void BatchSamplerTest::sampleExtrapolation() {
+    Vector3 a{3.0f}, b{3.0f};
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 0, a)
+        .add(TrackB, 0, b);
+
+    /* Constant extrapolation for A, extrapolated for B */
+    const Float before[]{-1.0f};
+    sampler.sample(before);
+    CORRADE_COMPARE(a, (Vector3{0.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(b, (Vector3{3.0f, 2.0f, 1.0f}));
+
+    /* Constant extrapolation for A, default-constructed for B */
+    const Float after[]{5.0f};
+    sampler.sample(after);
+    CORRADE_COMPARE(a, (Vector3{2.0f, 3.0f, 4.0f}));
+    CORRADE_COMPARE(b, Vector3{});
+}
+
+void BatchSamplerTest::sampleInterpolator() {
+    Vector3 a, b;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 0, a)
+        .add(TrackB, 0, b);
+
+    const Float keys[]{1.5f};
+    sampler.sample(Math::select, keys);
+    CORRADE_COMPARE(a, TrackA.at(Math::select, 1.5f));
+    CORRADE_COMPARE(b, TrackB.at(Math::select, 1.5f));
+}
+
+void BatchSamplerTest::sampleSharedSearch() {
+    const Float keys[]{0.0f, 1.0f, 3.0f};
+    const Vector3 valuesA[]{{0.0f, 1.0f, 2.0f}, {1.0f, 1.0f, 1.0f}, {3.0f, 0.0f, 1.0f}};
+    const Vector3 valuesB[]{{2.0f, 2.0f, 2.0f}, {0.0f, 4.0f, 1.0f}, {1.0f, -1.0f, 0.0f}};
+    const Float singleKey[]{1.0f};
+    const TrackView<const Float, const Vector3> a{keys, valuesA, Math::lerp, Extrapolation::DefaultConstructed, Extrapolation::Extrapolated};
+    const TrackView<const Float, const Vector3> b{keys, valuesB, Math::lerp, Extrapolation::DefaultConstructed, Extrapolation::Extrapolated};
+    /* Different extrapolation, can't share */
+    const TrackView<const Float, const Vector3> c{keys, valuesB, Math::lerp, Extrapolation::Constant, Extrapolation::Constant};
+    /* Single keyframe, not sharing with anything */
+    const TrackView<const Float, const Vector3> d{Containers::arrayView(singleKey), Containers::arrayView(valuesB).prefix(1), Math::lerp};
+
+    Vector3 a0, b0, a1, b1, c0, d0, d1;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(a, 0, a0)
+        .add(b, 0, b0)
+        .add(a, 1, a1)
+        .add(b, 1, b1)
+        .add(c, 1, c0)
+        .add(d, 1, d0)
+        .add(d, 1, d1);
+
+    for(const Vector2& key: {Vector2{0.5f, 2.0f}, Vector2{-1.0f, 4.0f}, Vector2{3.0f, 1.0f}}) {
+        sampler.sample(Containers::arrayView(key.data(), 2));
+        CORRADE_COMPARE(a0, a.at(key[0]));
+        CORRADE_COMPARE(b0, b.at(key[0]));
+        CORRADE_COMPARE(a1, a.at(key[1]));
+        CORRADE_COMPARE(b1, b.at(key[1]));
+        CORRADE_COMPARE(c0, c.at(key[1]));
+        CORRADE_COMPARE(d0, d.at(key[1]));
+        CORRADE_COMPARE(d1, d.at(key[1]));
+    }
+}
+
+void BatchSamplerTest::sampleInvalid() {
+    Vector3 a;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 2, a);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const Float keys[]{1.0f, 2.0f};
+    sampler.sample(keys);
+    CORRADE_COMPARE(out.str(), "Animation::BatchSampler::sample(): expected at least 3 keys but got 2\n");
+}
+
+void BatchSamplerTest::players() {
+    /* Two players, each with a key in the list, sharing the same tracks */
+    Float keys[]{0.0f, 0.0f};
+    Player<Float> players[2];
+    players[0].setDuration(TrackA.duration())
+        .play(1.0f);
+    players[1].setDuration(TrackA.duration())
+        .play(2.0f);
+
+    Vector3 a0, b0, a1, b1;
+    BatchSampler<Float, Vector3> sampler{Math::lerp};
+    sampler.add(TrackA, 0, a0)
+        .add(TrackB, 0, b0)
+        .add(TrackA, 1, a1)
+        .add(TrackB, 1, b1);
+
+    for(std::size_t i = 0; i != 2; ++i)
+        players[i].advance(3.5f, keys[i]);
+    sampler.sample(keys);
+    CORRADE_COMPARE(keys[0], 2.5f);
+    CORRADE_COMPARE(keys[1], 1.5f);
+    CORRADE_COMPARE(a0, TrackA.at(2.5f));
+    CORRADE_COMPARE(b0, TrackB.at(2.5f));
+    CORRADE_COMPARE(a1, TrackA.at(1.5f));
+    CORRADE_COMPARE(b1, TrackB.at(1.5f));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::BatchSamplerTest)
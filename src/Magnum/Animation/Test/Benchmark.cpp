@@ -25,7 +25,9 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Animation/BatchSampler.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/UniformTrack.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
 
@@ -43,12 +45,21 @@ struct Benchmark: TestSuite::Tester {
     void atStrictInterleaved();
     void atStrictInterleavedDirectInterpolator();
 
+    void atRandomAccessLinearSearch();
+    void atRandomAccess();
+    void atScrubbingLinearSearch();
+    void atScrubbing();
+    void atRandomAccessUniform();
+
     void playerAdvanceEmpty();
     void playerAdvanceEmptyTrack();
     void playerAdvance();
     void playerAdvanceCallback();
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
+    void playerAdvanceMany();
+    void playerAdvanceManyBatchSampler();
+    void playerAdvanceManyBatchSamplerDirectInterpolator();
 
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
@@ -57,10 +68,33 @@ struct Benchmark: TestSuite::Tester {
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
     TrackView<const Float, const Int> _trackInterleaved;
+
+    Containers::Array<Float> _longKeys;
+    Containers::Array<Int> _longValues;
+    Containers::Array<Float> _randomFrames;
+    Containers::Array<Float> _scrubbingFrames;
+    TrackView<const Float, const Int> _longTrack;
+    UniformTrack<Float, Int> _longUniformTrack;
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t {
+        DataSize = 2000,
+        LongDataSize = 10000,
+        SeekCount = 500,
+        PlayerCount = 200,
+        PlayerTrackCount = 60
+    };
+
+    /* Keyframe search as done before galloping was implemented, to have a
+       baseline for comparison */
+    Int atLinearSearch(const TrackView<const Float, const Int>& track, Float frame, std::size_t& hint) {
+        const Containers::StridedArrayView1D<const Float> keys = track.keys();
+        if(hint >= keys.size() || frame < keys[hint]) hint = 0;
+        while(hint + 2 < keys.size() && frame >= keys[hint + 1])
+            ++hint;
+        return track.values()[hint];
+    }
 }
 
 Benchmark::Benchmark() {
@@ -75,12 +109,21 @@ Benchmark::Benchmark() {
                    &Benchmark::atStrictInterleaved,
                    &Benchmark::atStrictInterleavedDirectInterpolator,
 
+                   &Benchmark::atRandomAccessLinearSearch,
+                   &Benchmark::atRandomAccess,
+                   &Benchmark::atScrubbingLinearSearch,
+                   &Benchmark::atScrubbing,
+                   &Benchmark::atRandomAccessUniform,
+
                    &Benchmark::playerAdvanceEmpty,
                    &Benchmark::playerAdvanceEmptyTrack,
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+                   &Benchmark::playerAdvanceMany,
+                   &Benchmark::playerAdvanceManyBatchSampler,
+                   &Benchmark::playerAdvanceManyBatchSamplerDirectInterpolator}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{Containers::DirectInit, DataSize, 1};
@@ -94,6 +137,35 @@ Benchmark::Benchmark() {
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+
+    _longKeys = Containers::Array<Float>{LongDataSize};
+    _longValues = Containers::Array<Int>{Containers::DirectInit, LongDataSize, 1};
+    for(std::size_t i = 0; i != LongDataSize; ++i)
+        _longKeys[i] = Float(i)*0.25f;
+    _longTrack = TrackView<const Float, const Int>{
+        Containers::arrayView(_longKeys), Containers::arrayView(_longValues),
+        Math::select};
+    /* The keys are already uniformly spaced so the values can be used as-is */
+    _longUniformTrack = UniformTrack<Float, Int>{
+        {_longKeys[0], _longKeys[LongDataSize - 1]},
+        Containers::Array<Int>{Containers::DirectInit, LongDataSize, 1},
+        Math::select};
+
+    /* Seeking to random times anywhere in the track, and scrubbing back and
+       forth around the current position. Using a simple LCG to have the
+       same sequence on every platform. */
+    const Float duration = _longKeys[LongDataSize - 1];
+    _randomFrames = Containers::Array<Float>{SeekCount};
+    _scrubbingFrames = Containers::Array<Float>{SeekCount};
+    UnsignedInt state = 1;
+    Float position = duration*0.5f;
+    for(std::size_t i = 0; i != SeekCount; ++i) {
+        state = state*1664525u + 1013904223u;
+        const Float random = Float(state >> 8)/Float(1 << 24);
+        _randomFrames[i] = random*duration;
+        position = Math::clamp(position + (random - 0.5f)*100.0f, 0.0f, duration);
+        _scrubbingFrames[i] = position;
+    }
 }
 
 void Benchmark::interpolateEmpty() {
@@ -184,6 +256,55 @@ void Benchmark::atStrictInterleavedDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atRandomAccessLinearSearch() {
+    Int result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float frame: _randomFrames)
+            result += atLinearSearch(_longTrack, frame, hint);
+    }
+    CORRADE_COMPARE(result, 5000);
+}
+
+void Benchmark::atRandomAccess() {
+    Int result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float frame: _randomFrames)
+            result += _longTrack.atStrict(frame, hint);
+    }
+    CORRADE_COMPARE(result, 5000);
+}
+
+void Benchmark::atScrubbingLinearSearch() {
+    Int result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float frame: _scrubbingFrames)
+            result += atLinearSearch(_longTrack, frame, hint);
+    }
+    CORRADE_COMPARE(result, 5000);
+}
+
+void Benchmark::atScrubbing() {
+    Int result{};
+    CORRADE_BENCHMARK(10) {
+        std::size_t hint{};
+        for(Float frame: _scrubbingFrames)
+            result += _longTrack.atStrict(frame, hint);
+    }
+    CORRADE_COMPARE(result, 5000);
+}
+
+void Benchmark::atRandomAccessUniform() {
+    Int result{};
+    CORRADE_BENCHMARK(10) {
+        for(Float frame: _randomFrames)
+            result += _longUniformTrack.at(frame);
+    }
+    CORRADE_COMPARE(result, 5000);
+}
+
 void Benchmark::playerAdvanceEmpty() {
     Player<Float> player;
     player.play(0.0f);
@@ -260,6 +381,72 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceMany() {
+    Containers::Array<Int> results{Containers::ValueInit, PlayerCount*PlayerTrackCount};
+    Containers::Array<Player<Float>> players{PlayerCount};
+    for(std::size_t i = 0; i != PlayerCount; ++i) {
+        for(std::size_t j = 0; j != PlayerTrackCount; ++j)
+            players[i].add(_track, results[i*PlayerTrackCount + j]);
+        players[i].play(Float(i)*0.1f);
+    }
+
+    CORRADE_BENCHMARK(5) {
+        for(Float time = 20.0f; time < 30.0f; time += 1.0f)
+            for(Player<Float>& player: players) player.advance(time);
+    }
+
+    CORRADE_COMPARE(results[0], 1);
+    CORRADE_COMPARE(results[PlayerCount*PlayerTrackCount - 1], 1);
+}
+
+void Benchmark::playerAdvanceManyBatchSampler() {
+    Containers::Array<Int> results{Containers::ValueInit, PlayerCount*PlayerTrackCount};
+    Containers::Array<Float> keys{Containers::ValueInit, PlayerCount};
+    Containers::Array<Player<Float>> players{PlayerCount};
+    BatchSampler<Float, Int> sampler{Math::select};
+    for(std::size_t i = 0; i != PlayerCount; ++i) {
+        for(std::size_t j = 0; j != PlayerTrackCount; ++j)
+            sampler.add(_track, i, results[i*PlayerTrackCount + j]);
+        players[i].setDuration(_track.duration())
+            .play(Float(i)*0.1f);
+    }
+
+    CORRADE_BENCHMARK(5) {
+        for(Float time = 20.0f; time < 30.0f; time += 1.0f) {
+            for(std::size_t i = 0; i != PlayerCount; ++i)
+                players[i].advance(time, keys[i]);
+            sampler.sample(keys);
+        }
+    }
+
+    CORRADE_COMPARE(results[0], 1);
+    CORRADE_COMPARE(results[PlayerCount*PlayerTrackCount - 1], 1);
+}
+
+void Benchmark::playerAdvanceManyBatchSamplerDirectInterpolator() {
+    Containers::Array<Int> results{Containers::ValueInit, PlayerCount*PlayerTrackCount};
+    Containers::Array<Float> keys{Containers::ValueInit, PlayerCount};
+    Containers::Array<Player<Float>> players{PlayerCount};
+    BatchSampler<Float, Int> sampler{Math::select};
+    for(std::size_t i = 0; i != PlayerCount; ++i) {
+        for(std::size_t j = 0; j != PlayerTrackCount; ++j)
+            sampler.add(_track, i, results[i*PlayerTrackCount + j]);
+        players[i].setDuration(_track.duration())
+            .play(Float(i)*0.1f);
+    }
+
+    CORRADE_BENCHMARK(5) {
+        for(Float time = 20.0f; time < 30.0f; time += 1.0f) {
+            for(std::size_t i = 0; i != PlayerCount; ++i)
+                players[i].advance(time, keys[i]);
+            sampler.sample(Math::select, keys);
+        }
+    }
+
+    CORRADE_COMPARE(results[0], 1);
+    CORRADE_COMPARE(results[PlayerCount*PlayerTrackCount - 1], 1);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
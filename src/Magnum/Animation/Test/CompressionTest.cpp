@@ -0,0 +1,405 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/Compression.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct CompressionTest: TestSuite::Tester {
+    explicit CompressionTest();
+
+    void constructDefault();
+    void construct();
+    void constructData();
+    void constructNotNormalized();
+    void compare();
+    void debug();
+
+    void interpolateQuaternion();
+    void interpolateHalf();
+    void interpolatorFor();
+
+    void reduceKeyframesEmpty();
+    void reduceKeyframesLinear();
+    void reduceKeyframesConstant();
+    void reduceKeyframesErrorBound();
+    void reduceKeyframesDiscontinuity();
+    void reduceKeyframesQuaternion();
+    void reduceKeyframesSpline();
+
+    void compressQuaternion();
+    void compressVector();
+    void compressInvalid();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Quaternion quaternion;
+    Quaternion expected;
+} ConstructData[] {
+    {"identity", {}, {}},
+    {"X largest", Quaternion{{0.8f, 0.2f, -0.3f}, 0.1f}.normalized(),
+                  Quaternion{{0.8f, 0.2f, -0.3f}, 0.1f}.normalized()},
+    {"Y largest", Quaternion{{0.2f, 0.7f, 0.3f}, -0.5f}.normalized(),
+                  Quaternion{{0.2f, 0.7f, 0.3f}, -0.5f}.normalized()},
+    {"Z largest", Quaternion{{-0.1f, 0.4f, 0.9f}, 0.2f}.normalized(),
+                  Quaternion{{-0.1f, 0.4f, 0.9f}, 0.2f}.normalized()},
+    {"W largest", Quaternion::rotation(35.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized()),
+                  Quaternion::rotation(35.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized())},
+    /* The largest component is always made positive */
+    {"negative", Quaternion{{0.3f, -0.9f, 0.1f}, 0.2f}.normalized(),
+                 -Quaternion{{0.3f, -0.9f, 0.1f}, 0.2f}.normalized()},
+    {"all equal", Quaternion{{0.5f, 0.5f, 0.5f}, 0.5f},
+                  Quaternion{{0.5f, 0.5f, 0.5f}, 0.5f}}
+};
+
+CompressionTest::CompressionTest() {
+    addTests({&CompressionTest::constructDefault});
+
+    addInstancedTests({&CompressionTest::construct},
+        Containers::arraySize(ConstructData));
+
+    addTests({&CompressionTest::constructData,
+              &CompressionTest::constructNotNormalized,
+              &CompressionTest::compare,
+              &CompressionTest::debug,
+
+              &CompressionTest::interpolateQuaternion,
+              &CompressionTest::interpolateHalf,
+              &CompressionTest::interpolatorFor,
+
+              &CompressionTest::reduceKeyframesEmpty,
+              &CompressionTest::reduceKeyframesLinear,
+              &CompressionTest::reduceKeyframesConstant,
+              &CompressionTest::reduceKeyframesErrorBound,
+              &CompressionTest::reduceKeyframesDiscontinuity,
+              &CompressionTest::reduceKeyframesQuaternion,
+              &CompressionTest::reduceKeyframesSpline,
+
+              &CompressionTest::compressQuaternion,
+              &CompressionTest::compressVector,
+              &CompressionTest::compressInvalid});
+}
+
+void CompressionTest::constructDefault() {
+    constexpr CompressedQuaternion a;
+    CORRADE_COMPARE(Quaternion(a), Quaternion{});
+    CORRADE_COMPARE(a, CompressedQuaternion{Quaternion{}});
+}
+
+void CompressionTest::construct() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The largest component is calculated from the other three, so its
+       error is up to three times the quantization error of the others */
+    const Quaternion a{CompressedQuaternion{data.quaternion}};
+    CORRADE_VERIFY(a.isNormalized());
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE_AS(Math::abs(a.vector()[i] - data.expected.vector()[i]), 7.0e-5f, TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(Math::abs(a.scalar() - data.expected.scalar()), 7.0e-5f, TestSuite::Compare::Less);
+}
+
+void CompressionTest::constructData() {
+    constexpr CompressedQuaternion a{Vector3us{(16383 << 1)|1, (16383 << 1)|1, 16383 << 1}};
+    constexpr Vector3us data = a.data();
+    CORRADE_COMPARE(data, (Vector3us{(16383 << 1)|1, (16383 << 1)|1, 16383 << 1}));
+    CORRADE_COMPARE(a, CompressedQuaternion{});
+
+    /* Largest component index 1 (Y), all others zero */
+    CompressedQuaternion b{Vector3us{(16383 << 1)|1, 16383 << 1, 16383 << 1}};
+    CORRADE_COMPARE(Quaternion(b), (Quaternion{{0.0f, 1.0f, 0.0f}, 0.0f}));
+    CORRADE_COMPARE(b, CompressedQuaternion{(Quaternion{{0.0f, 1.0f, 0.0f}, 0.0f})});
+}
+
+void CompressionTest::constructNotNormalized() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CompressedQuaternion{Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f}};
+    CORRADE_COMPARE(out.str(), "Animation::CompressedQuaternion: Quaternion({1, 2, 3}, 4) is not normalized\n");
+}
+
+void CompressionTest::compare() {
+    const CompressedQuaternion a{Quaternion::rotation(15.0_degf, Vector3::xAxis())};
+    const CompressedQuaternion b{Quaternion::rotation(15.0_degf, Vector3::xAxis())};
+    const CompressedQuaternion c{Quaternion::rotation(15.0_degf, Vector3::yAxis())};
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(!(a != b));
+    CORRADE_VERIFY(a != c);
+    CORRADE_VERIFY(!(a == c));
+}
+
+void CompressionTest::debug() {
+    std::ostringstream out;
+    Debug{&out} << CompressedQuaternion{};
+    CORRADE_COMPARE(out.str(), "Animation::CompressedQuaternion(Quaternion({0, 0, 0}, 1))\n");
+}
+
+void CompressionTest::interpolateQuaternion() {
+    const Quaternion a = Quaternion::rotation(20.0_degf, Vector3::zAxis());
+    const Quaternion b = Quaternion::rotation(80.0_degf, Vector3::zAxis());
+    const CompressedQuaternion ca{a}, cb{b};
+
+    CORRADE_COMPARE(Animation::select(ca, cb, 0.8f), Quaternion(ca));
+    CORRADE_COMPARE(Animation::select(ca, cb, 1.0f), Quaternion(cb));
+    CORRADE_COMPARE(Animation::lerpShortestPath(ca, cb, 0.25f),
+        Math::lerpShortestPath(Quaternion(ca), Quaternion(cb), 0.25f));
+    CORRADE_COMPARE(Animation::slerpShortestPath(ca, cb, 0.25f),
+        Math::slerpShortestPath(Quaternion(ca), Quaternion(cb), 0.25f));
+
+    /* Shortest path is taken even if one of them is stored negated */
+    const CompressedQuaternion cbNegated{-b};
+    CORRADE_COMPARE(Animation::slerpShortestPath(ca, cbNegated, 0.5f),
+        Quaternion::rotation(50.0_degf, Vector3::zAxis()));
+}
+
+void CompressionTest::interpolateHalf() {
+    const Vector3h a{0.0_h, 2.0_h, -1.0_h};
+    const Vector3h b{1.0_h, 4.0_h, -3.0_h};
+
+    CORRADE_COMPARE(Animation::select(a, b, 0.5f), (Vector3{0.0f, 2.0f, -1.0f}));
+    CORRADE_COMPARE(Animation::select(a, b, 1.0f), (Vector3{1.0f, 4.0f, -3.0f}));
+    CORRADE_COMPARE(Animation::lerp(a, b, 0.25f), (Vector3{0.25f, 2.5f, -1.5f}));
+    CORRADE_COMPARE(Animation::select(a.xy(), b.xy(), 0.5f), (Vector2{0.0f, 2.0f}));
+    CORRADE_COMPARE(Animation::lerp(a.xy(), b.xy(), 0.25f), (Vector2{0.25f, 2.5f}));
+}
+
+void CompressionTest::interpolatorFor() {
+    CORRADE_VERIFY(Animation::interpolatorFor<CompressedQuaternion>(Interpolation::Constant) == static_cast<Quaternion(*)(const CompressedQuaternion&, const CompressedQuaternion&, Float)>(Animation::select));
+    CORRADE_VERIFY(Animation::interpolatorFor<CompressedQuaternion>(Interpolation::Linear) == Animation::slerpShortestPath);
+    CORRADE_VERIFY(Animation::interpolatorFor<Vector2h>(Interpolation::Constant) == static_cast<Vector2(*)(const Vector2h&, const Vector2h&, Float)>(Animation::select));
+    CORRADE_VERIFY(Animation::interpolatorFor<Vector2h>(Interpolation::Linear) == static_cast<Vector2(*)(const Vector2h&, const Vector2h&, Float)>(Animation::lerp));
+    CORRADE_VERIFY(Animation::interpolatorFor<Vector3h>(Interpolation::Constant) == static_cast<Vector3(*)(const Vector3h&, const Vector3h&, Float)>(Animation::select));
+    CORRADE_VERIFY(Animation::interpolatorFor<Vector3h>(Interpolation::Linear) == static_cast<Vector3(*)(const Vector3h&, const Vector3h&, Float)>(Animation::lerp));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::interpolatorFor<CompressedQuaternion>(Interpolation::Spline);
+    Animation::interpolatorFor<Vector3h>(Interpolation::Custom);
+    CORRADE_COMPARE(out.str(),
+        "Animation::interpolatorFor(): can't deduce interpolator function for Animation::Interpolation::Spline\n"
+        "Animation::interpolatorFor(): can't deduce interpolator function for Animation::Interpolation::Custom\n");
+}
+
+void CompressionTest::reduceKeyframesEmpty() {
+    const Track<Float, Float> empty{nullptr, Math::lerp};
+    CORRADE_COMPARE(reduceKeyframes(empty, 0.1f).size(), 0);
+
+    const Track<Float, Float> single{{{1.0f, 3.0f}}, Interpolation::Linear, Extrapolation::DefaultConstructed, Extrapolation::Extrapolated};
+    const Track<Float, Float> reduced = reduceKeyframes(single, 0.1f);
+    CORRADE_COMPARE(reduced.size(), 1);
+    CORRADE_COMPARE(reduced[0], std::make_pair(1.0f, 3.0f));
+    CORRADE_COMPARE(reduced.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(reduced.before(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(reduced.after(), Extrapolation::Extrapolated);
+}
+
+void CompressionTest::reduceKeyframesLinear() {
+    /* The middle keyframes in each of the two segments are redundant */
+    const Track<Float, Vector3> track{{
+        {0.0f, {0.0f, 1.0f, 2.0f}},
+        {0.5f, {0.5f, 1.0f, 3.0f}},
+        {1.0f, {1.0f, 1.0f, 4.0f}},
+        {3.0f, {3.0f, 1.0f, 8.0f}},
+        {4.0f, {3.0f, 0.0f, 8.0f}},
+        {6.0f, {3.0f, -2.0f, 8.0f}}
+    }, Interpolation::Linear};
+
+    const Track<Float, Vector3> reduced = reduceKeyframes(track, 1.0e-5f);
+    CORRADE_COMPARE(reduced.size(), 3);
+    CORRADE_COMPARE(reduced.keys()[0], 0.0f);
+    CORRADE_COMPARE(reduced.keys()[1], 3.0f);
+    CORRADE_COMPARE(reduced.keys()[2], 6.0f);
+    CORRADE_COMPARE(reduced.values()[1], (Vector3{3.0f, 1.0f, 8.0f}));
+    CORRADE_COMPARE(reduced.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(reduced.interpolator(), track.interpolator());
+
+    for(Float t: {0.25f, 0.75f, 2.0f, 3.5f, 5.0f})
+        CORRADE_COMPARE(reduced.at(t), track.at(t));
+}
+
+void CompressionTest::reduceKeyframesConstant() {
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {2.0f, 1.0f},
+        {3.0f, 1.0f},
+        {4.0f, 1.0f}
+    }, Interpolation::Constant};
+
+    const Track<Float, Float> reduced = reduceKeyframes(track, 0.0f);
+    CORRADE_COMPARE(reduced.size(), 3);
+    CORRADE_COMPARE(reduced[0], std::make_pair(0.0f, 0.0f));
+    CORRADE_COMPARE(reduced[1], std::make_pair(2.0f, 1.0f));
+    CORRADE_COMPARE(reduced[2], std::make_pair(4.0f, 1.0f));
+
+    for(Float t: {0.5f, 1.5f, 2.0f, 3.5f})
+        CORRADE_COMPARE(reduced.at(t), track.at(t));
+}
+
+void CompressionTest::reduceKeyframesErrorBound() {
+    Containers::Array<std::pair<Float, Float>> data{Containers::NoInit, 201};
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const Float t = i*0.05f;
+        data[i] = {t, Math::sin(Rad(t))};
+    }
+    const Track<Float, Float> track{std::move(data), Interpolation::Linear};
+
+    const Track<Float, Float> reduced = reduceKeyframes(track, 0.01f);
+    CORRADE_COMPARE_AS(reduced.size(), 40, TestSuite::Compare::Less);
+    CORRADE_COMPARE(reduced.keys().front(), 0.0f);
+    CORRADE_COMPARE(reduced.keys().back(), 10.0f);
+
+    /* Error at all original keyframes and halfway between them stays within
+       the bounds */
+    for(std::size_t i = 0; i != track.size(); ++i) {
+        const Float t = track.keys()[i];
+        CORRADE_COMPARE_AS(Math::abs(reduced.at(t) - track.at(t)), 0.01f, TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(Math::abs(reduced.at(t + 0.025f) - track.at(t + 0.025f)), 0.01f, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void CompressionTest::reduceKeyframesDiscontinuity() {
+    /* Duplicate keys denote a jump, which should be preserved */
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {1.0f, 1.0f},
+        {1.0f, 5.0f},
+        {2.0f, 6.0f},
+        {3.0f, 7.0f}
+    }, Interpolation::Linear};
+
+    const Track<Float, Float> reduced = reduceKeyframes(track, 0.001f);
+    CORRADE_COMPARE(reduced.size(), 4);
+    CORRADE_COMPARE(reduced[0], std::make_pair(0.0f, 0.0f));
+    CORRADE_COMPARE(reduced[1], std::make_pair(1.0f, 1.0f));
+    CORRADE_COMPARE(reduced[2], std::make_pair(1.0f, 5.0f));
+    CORRADE_COMPARE(reduced[3], std::make_pair(3.0f, 7.0f));
+}
+
+void CompressionTest::reduceKeyframesQuaternion() {
+    /* Constant angular velocity is perfectly represented by slerp */
+    Containers::Array<std::pair<Float, Quaternion>> data{Containers::NoInit, 10};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Float(i), Quaternion::rotation(Deg(i*15.0f), Vector3::yAxis())};
+    const Track<Float, Quaternion> track{std::move(data), Interpolation::Linear};
+
+    const Track<Float, Quaternion> reduced = reduceKeyframes(track, 1.0e-4f);
+    CORRADE_COMPARE(reduced.size(), 2);
+    CORRADE_COMPARE(reduced.at(4.5f), Quaternion::rotation(67.5_degf, Vector3::yAxis()));
+}
+
+void CompressionTest::reduceKeyframesSpline() {
+    /* Keyframes sampled from f(t) = t^3 with tangents matching the derivative
+       scaled by interval length. Merging the intervals results in a single
+       interval with scaled tangents, reproducing the exact same curve. */
+    const Track<Float, CubicHermite1D, Float> track{{
+        {0.0f, {0.0f, 0.0f, 0.0f}},
+        {1.0f, {3.0f, 1.0f, 3.0f}},
+        {2.0f, {12.0f, 8.0f, 12.0f}},
+        {3.0f, {27.0f, 27.0f, 27.0f}},
+        {4.0f, {48.0f, 64.0f, 48.0f}}
+    }, Interpolation::Spline};
+
+    const Track<Float, CubicHermite1D, Float> reduced = reduceKeyframes(track, 1.0e-3f);
+    CORRADE_COMPARE(reduced.size(), 2);
+    CORRADE_COMPARE(reduced.values()[0], (CubicHermite1D{0.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(reduced.values()[1], (CubicHermite1D{192.0f, 64.0f, 48.0f}));
+    CORRADE_COMPARE(reduced.at(1.5f), 3.375f);
+    CORRADE_COMPARE(reduced.at(2.5f), 15.625f);
+}
+
+void CompressionTest::compressQuaternion() {
+    Containers::Array<std::pair<Float, Quaternion>> data{Containers::NoInit, 20};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {i*0.1f, Quaternion::rotation(Deg(i*10.0f), Vector3{1.0f, 0.0f, 1.0f}.normalized())*
+                           Quaternion::rotation(Deg(i*i*0.5f), Vector3::xAxis())};
+    const Track<Float, Quaternion> track{std::move(data), Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::Constant};
+
+    const Track<Float, CompressedQuaternion, Quaternion> compressed = compress(track, 1.0e-3f);
+    CORRADE_COMPARE_AS(compressed.size(), track.size(), TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE(compressed.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(compressed.interpolator(), Animation::slerpShortestPath);
+    CORRADE_COMPARE(compressed.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(compressed.after(), Extrapolation::Constant);
+
+    for(std::size_t i = 0; i != track.size(); ++i) {
+        const Quaternion expected = track.values()[i];
+        const Quaternion actual = compressed.at(track.keys()[i]);
+        CORRADE_COMPARE_AS(Math::min((actual - expected).length(), (actual + expected).length()), 1.0e-3f + 1.0e-4f, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void CompressionTest::compressVector() {
+    const Track<Float, Vector3> track{{
+        {0.0f, {0.0f, 1.0f, 2.0f}},
+        {0.5f, {0.5f, 1.0f, 3.0f}},
+        {1.0f, {1.0f, 1.0f, 4.0f}},
+        {3.0f, {3.0f, 1.0f, 8.0f}}
+    }, Interpolation::Linear};
+
+    const Track<Float, Vector3h, Vector3> compressed = compress(track, 1.0e-3f);
+    CORRADE_COMPARE(compressed.size(), 2);
+    CORRADE_COMPARE(compressed.values()[0], (Vector3h{0.0_h, 1.0_h, 2.0_h}));
+    CORRADE_COMPARE(compressed.values()[1], (Vector3h{3.0_h, 1.0_h, 8.0_h}));
+    CORRADE_COMPARE(compressed.at(0.5f), (Vector3{0.5f, 1.0f, 3.0f}));
+
+    const Track<Float, Vector2> track2{{
+        {0.0f, {0.0f, 1.0f}},
+        {1.0f, {1.0f, 1.0f}},
+        {2.0f, {1.0f, 1.0f}}
+    }, Interpolation::Constant};
+
+    const Track<Float, Vector2h, Vector2> compressed2 = compress(track2, 1.0e-3f);
+    CORRADE_COMPARE(compressed2.size(), 3);
+    CORRADE_COMPARE(compressed2.interpolation(), Interpolation::Constant);
+    CORRADE_COMPARE(compressed2.at(1.5f), (Vector2{1.0f, 1.0f}));
+}
+
+void CompressionTest::compressInvalid() {
+    const Track<Float, Quaternion> track{{
+        {0.0f, {}},
+        {1.0f, {}}
+    }, Math::slerp};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compress(track, 1.0e-3f);
+    CORRADE_COMPARE(out.str(), "Animation::compress(): expected constant or linear interpolation but got Animation::Interpolation::Custom\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::CompressionTest)
@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Animation/EasingBatch.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct EasingBatchBenchmark: TestSuite::Tester {
+    explicit EasingBatchBenchmark();
+
+    void scalar();
+    void batch();
+};
+
+#define _c(name) #name, Easing::name, easeInto<Easing::name>
+constexpr struct {
+    const char* name;
+    Float(*function)(Float);
+    void(*batch)(const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Float>&);
+} BenchmarkData[] {
+    {_c(cubicInOut)},
+    {_c(sineInOut)},
+    {_c(exponentialInOut)},
+    {_c(elasticInOut)},
+    {_c(backInOut)},
+    {_c(bounceInOut)}
+};
+#undef _c
+
+EasingBatchBenchmark::EasingBatchBenchmark() {
+    addInstancedBenchmarks({&EasingBatchBenchmark::scalar,
+                            &EasingBatchBenchmark::batch}, 10,
+        Containers::arraySize(BenchmarkData));
+}
+
+constexpr std::size_t BenchmarkStepCount = 100000;
+
+void EasingBatchBenchmark::scalar() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Float> t{Containers::NoInit, BenchmarkStepCount};
+    for(std::size_t i = 0; i != t.size(); ++i)
+        t[i] = Float(i)/Float(t.size() - 1);
+    Containers::Array<Float> out{Containers::NoInit, t.size()};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != t.size(); ++i)
+            out[i] = data.function(t[i]);
+
+    CORRADE_COMPARE(out[t.size()/2], data.function(t[t.size()/2]));
+}
+
+void EasingBatchBenchmark::batch() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Float> t{Containers::NoInit, BenchmarkStepCount};
+    for(std::size_t i = 0; i != t.size(); ++i)
+        t[i] = Float(i)/Float(t.size() - 1);
+    Containers::Array<Float> out{Containers::NoInit, t.size()};
+
+    CORRADE_BENCHMARK(1)
+        data.batch(t, out);
+
+    CORRADE_COMPARE_WITH(out[t.size()/2], data.function(t[t.size()/2]),
+        TestSuite::Compare::around(1.0e-6f));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::EasingBatchBenchmark)
@@ -0,0 +1,178 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/EasingBatch.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct EasingBatchTest: TestSuite::Tester {
+    explicit EasingBatchTest();
+
+    void accuracy();
+    void strided();
+    void aliased();
+    void invalidSize();
+};
+
+#define _c(name) #name, Easing::name, easeInto<Easing::name>
+constexpr struct {
+    const char* name;
+    Float(*function)(Float);
+    void(*batch)(const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Float>&);
+    Float maxError;
+} AccuracyData[] {
+    {_c(linear), 0.0f},
+    {_c(step), 0.0f},
+    {_c(smoothstep), 0.0f},
+    {_c(smootherstep), 0.0f},
+    {_c(quadraticIn), 0.0f},
+    {_c(quadraticOut), 0.0f},
+    {_c(quadraticInOut), 0.0f},
+    {_c(cubicIn), 0.0f},
+    {_c(cubicOut), 0.0f},
+    {_c(cubicInOut), 0.0f},
+    {_c(quarticIn), 0.0f},
+    {_c(quarticOut), 0.0f},
+    {_c(quarticInOut), 0.0f},
+    {_c(quinticIn), 0.0f},
+    {_c(quinticOut), 0.0f},
+    {_c(quinticInOut), 0.0f},
+    {_c(sineIn), 5.0e-7f},
+    {_c(sineOut), 5.0e-7f},
+    {_c(sineInOut), 5.0e-7f},
+    {_c(circularIn), 0.0f},
+    {_c(circularOut), 0.0f},
+    {_c(circularInOut), 0.0f},
+    {_c(exponentialIn), 5.0e-7f},
+    {_c(exponentialOut), 5.0e-7f},
+    {_c(exponentialInOut), 5.0e-7f},
+    {_c(elasticIn), 5.0e-7f},
+    {_c(elasticOut), 5.0e-7f},
+    {_c(elasticInOut), 5.0e-7f},
+    {_c(backIn), 5.0e-7f},
+    {_c(backOut), 5.0e-7f},
+    {_c(backInOut), 5.0e-7f},
+    {_c(bounceIn), 5.0e-7f},
+    {_c(bounceOut), 5.0e-7f},
+    {_c(bounceInOut), 5.0e-7f}
+};
+#undef _c
+
+EasingBatchTest::EasingBatchTest() {
+    addInstancedTests({&EasingBatchTest::accuracy},
+        Containers::arraySize(AccuracyData));
+
+    addTests({&EasingBatchTest::strided,
+              &EasingBatchTest::aliased,
+              &EasingBatchTest::invalidSize});
+}
+
+/* Not a multiple of the block size to test the remainder as well */
+constexpr std::size_t AccuracyStepCount = 10001;
+
+void EasingBatchTest::accuracy() {
+    auto&& data = AccuracyData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Float> t{Containers::NoInit, AccuracyStepCount};
+    for(std::size_t i = 0; i != t.size(); ++i)
+        t[i] = Float(i)/Float(t.size() - 1);
+
+    Containers::Array<Float> out{Containers::NoInit, t.size()};
+    data.batch(t, out);
+
+    Float maxError = 0.0f;
+    for(std::size_t i = 0; i != t.size(); ++i)
+        maxError = Math::max(maxError, Math::abs(out[i] - data.function(t[i])));
+    CORRADE_COMPARE_AS(maxError, data.maxError, TestSuite::Compare::LessOrEqual);
+}
+
+void EasingBatchTest::strided() {
+    const struct {
+        Float t;
+        Float other;
+    } src[]{
+        {0.0f, 3.0f},
+        {0.25f, 3.0f},
+        {0.5f, 3.0f},
+        {0.75f, 3.0f},
+        {1.0f, 3.0f}
+    };
+    struct {
+        Int other;
+        Float value;
+    } dst[]{{7, 0.0f}, {7, 0.0f}, {7, 0.0f}, {7, 0.0f}, {7, 0.0f}};
+
+    const Containers::StridedArrayView1D<const Float> srcView{src, &src[0].t, 5, sizeof(src[0])};
+    const Containers::StridedArrayView1D<Float> dstView{dst, &dst[0].value, 5, sizeof(dst[0])};
+
+    easeInto<Easing::elasticOut>(srcView, dstView);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE_WITH(dst[i].value, Easing::elasticOut(src[i].t),
+            TestSuite::Compare::around(5.0e-7f));
+        CORRADE_COMPARE(dst[i].other, 7);
+    }
+
+    easeInto<Easing::quadraticIn>(srcView, dstView);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE(dst[i].value, Easing::quadraticIn(src[i].t));
+        CORRADE_COMPARE(dst[i].other, 7);
+    }
+}
+
+void EasingBatchTest::aliased() {
+    Float data[11];
+    for(std::size_t i = 0; i != 11; ++i)
+        data[i] = i*0.1f;
+
+    easeInto<Easing::bounceInOut>(data, data);
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(data[i], Easing::bounceInOut(i*0.1f));
+}
+
+void EasingBatchTest::invalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Float src[3]{};
+    Float dst[2];
+    easeInto<Easing::cubicIn>(src, dst);
+    easeInto<Easing::sineIn>(src, dst);
+    CORRADE_COMPARE(out.str(),
+        "Animation::easeInto(): expected destination view size 3 but got 2\n"
+        "Animation::easeInto(): expected destination view size 3 but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::EasingBatchTest)
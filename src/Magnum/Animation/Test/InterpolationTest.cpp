@@ -68,6 +68,8 @@ struct InterpolationTest: TestSuite::Tester {
 
     void interpolateHint();
     void interpolateStrictHint();
+    void interpolateHintSeek();
+    void interpolateStrictHintSeek();
 
     void interpolateDifferentResultType();
     void interpolateStrictDifferentResultType();
@@ -191,6 +193,9 @@ InterpolationTest::InterpolationTest() {
                        &InterpolationTest::interpolateStrictHint},
                        Containers::arraySize(HintData));
 
+    addTests({&InterpolationTest::interpolateHintSeek,
+              &InterpolationTest::interpolateStrictHintSeek});
+
     addTests({&InterpolationTest::interpolateDifferentResultType,
               &InterpolationTest::interpolateStrictDifferentResultType,
 
@@ -518,6 +523,55 @@ void InterpolationTest::interpolateStrictHint() {
     CORRADE_COMPARE(hint, 2);
 }
 
+/* Keys with repeated values to verify the search picks the last matching
+   keyframe also in presence of duplicates */
+constexpr Float SeekKeys[]{
+    0.0f, 1.0f, 2.0f, 2.0f, 2.0f, 3.0f, 4.5f, 5.0f, 7.0f, 8.0f, 8.0f,
+    9.0f, 10.0f, 11.0f, 12.5f, 13.0f, 14.0f, 15.0f, 16.0f, 18.0f, 20.0f,
+    21.0f, 22.0f, 24.0f, 25.0f, 26.0f, 26.0f, 27.0f, 28.0f, 30.0f, 31.0f,
+    32.0f, 33.0f, 34.0f, 35.0f, 36.0f, 37.0f, 38.0f, 39.0f, 40.0f, 41.0f};
+
+std::size_t seekReference(Float frame) {
+    std::size_t i = 0;
+    while(i + 2 < Containers::arraySize(SeekKeys) && frame >= SeekKeys[i + 1])
+        ++i;
+    return i;
+}
+
+void InterpolationTest::interpolateHintSeek() {
+    Float values[Containers::arraySize(SeekKeys)];
+    for(std::size_t i = 0; i != Containers::arraySize(values); ++i)
+        values[i] = Float(i);
+
+    /* Every combination of the hint and frame, including frames outside of
+       the range, exactly on a key and hints that are out of bounds */
+    for(std::size_t start = 0; start != Containers::arraySize(SeekKeys) + 2; ++start) {
+        for(Float frame = -1.5f; frame <= 43.0f; frame += 0.25f) {
+            std::size_t hint = start;
+            Animation::interpolate<Float, Float>(
+                SeekKeys, values, Extrapolation::Extrapolated,
+                Extrapolation::Extrapolated, Math::select, frame, hint);
+            CORRADE_COMPARE(hint, seekReference(frame));
+        }
+    }
+}
+
+void InterpolationTest::interpolateStrictHintSeek() {
+    Float values[Containers::arraySize(SeekKeys)];
+    for(std::size_t i = 0; i != Containers::arraySize(values); ++i)
+        values[i] = Float(i);
+
+    /* Scrubbing back and forth with the hint carried over */
+    std::size_t hint{};
+    for(Float frame: {40.5f, 0.5f, 26.0f, 25.9f, 2.0f, 8.0f, 7.9f, 41.0f,
+                      -3.0f, 13.0f, 12.9f, 100.0f, 2.5f, 1.9f}) {
+        Float value = Animation::interpolateStrict<Float, Float>(
+            SeekKeys, values, Math::select, frame, hint);
+        CORRADE_COMPARE(hint, seekReference(frame));
+        CORRADE_COMPARE(value, Float(frame < SeekKeys[hint + 1] ? hint : hint + 1));
+    }
+}
+
 using namespace Math::Literals;
 
 const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
@@ -0,0 +1,377 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/Mixer.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct MixerTest: TestSuite::Tester {
+    explicit MixerTest();
+
+    void construct();
+    void constructMove();
+
+    void addLayer();
+    void addLayerInvalid();
+    void add();
+    void addInvalid();
+
+    void mixEmpty();
+    void mix();
+    void mixCrossfade();
+    void mixAdditive();
+    void mixMask();
+    void mixQuaternion();
+    void mixQuaternionAdditive();
+    void mixQuaternionDouble();
+    void mixInvalid();
+};
+
+using namespace Math::Literals;
+
+const Track<Float, Vector3> TrackA{{
+    {0.0f, {0.0f, 1.0f, 2.0f}},
+    {2.0f, {2.0f, 1.0f, 0.0f}},
+    {4.0f, {2.0f, 3.0f, 4.0f}}
+}, Math::lerp};
+
+const Track<Float, Vector3> TrackB{{
+    {1.0f, {1.0f, 1.0f, 1.0f}},
+    {3.0f, {-1.0f, 0.0f, 1.0f}}
+}, Math::lerp};
+
+const Track<Float, Quaternion> TrackRotationA{{
+    {0.0f, Quaternion::rotation(0.0_degf, Vector3::xAxis())},
+    {2.0f, Quaternion::rotation(90.0_degf, Vector3::xAxis())}
+}, Math::lerp};
+
+const Track<Float, Quaternion> TrackRotationB{{
+    {0.0f, Quaternion::rotation(30.0_degf, Vector3::xAxis())},
+    {2.0f, Quaternion::rotation(-30.0_degf, Vector3::xAxis())}
+}, Math::lerp};
+
+MixerTest::MixerTest() {
+    addTests({&MixerTest::construct,
+              &MixerTest::constructMove,
+
+              &MixerTest::addLayer,
+              &MixerTest::addLayerInvalid,
+              &MixerTest::add,
+              &MixerTest::addInvalid,
+
+              &MixerTest::mixEmpty,
+              &MixerTest::mix,
+              &MixerTest::mixCrossfade,
+              &MixerTest::mixAdditive,
+              &MixerTest::mixMask,
+              &MixerTest::mixQuaternion,
+              &MixerTest::mixQuaternionAdditive,
+              &MixerTest::mixQuaternionDouble,
+              &MixerTest::mixInvalid});
+}
+
+void MixerTest::construct() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 5};
+    CORRADE_COMPARE(mixer.interpolator(), static_cast<Vector3(*)(const Vector3&, const Vector3&, Float)>(Math::lerp));
+    CORRADE_COMPARE(mixer.count(), 5);
+    CORRADE_COMPARE(mixer.layerCount(), 0);
+}
+
+void MixerTest::constructMove() {
+    Mixer<Float, Vector3> a{Math::lerp, 2};
+    a.add(a.addLayer(), TrackA, 1);
+
+    Mixer<Float, Vector3> b{std::move(a)};
+    CORRADE_COMPARE(b.count(), 2);
+    CORRADE_COMPARE(b.layerCount(), 1);
+
+    Mixer<Float, Vector3> c{Math::select, 3};
+    c = std::move(b);
+    CORRADE_COMPARE(c.count(), 2);
+    CORRADE_COMPARE(c.layerCount(), 1);
+    CORRADE_COMPARE(c.interpolator(), static_cast<Vector3(*)(const Vector3&, const Vector3&, Float)>(Math::lerp));
+
+    /* The sampler destinations should survive the move */
+    Vector3 destination[2];
+    const Float keys[]{1.0f};
+    c.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], Vector3{});
+    CORRADE_COMPARE(destination[1], TrackA.at(1.0f));
+
+    CORRADE_VERIFY(!std::is_copy_constructible<Mixer<Float, Vector3>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<Mixer<Float, Vector3>>::value);
+}
+
+void MixerTest::addLayer() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 3};
+    CORRADE_COMPARE(mixer.addLayer(), 0);
+    CORRADE_COMPARE(mixer.addAdditiveLayer(0.25f), 1);
+    CORRADE_COMPARE(mixer.addLayer(0.5f), 2);
+    CORRADE_COMPARE(mixer.layerCount(), 3);
+
+    CORRADE_VERIFY(!mixer.isLayerAdditive(0));
+    CORRADE_VERIFY(mixer.isLayerAdditive(1));
+    CORRADE_VERIFY(!mixer.isLayerAdditive(2));
+    CORRADE_COMPARE(mixer.layerWeight(0), 1.0f);
+    CORRADE_COMPARE(mixer.layerWeight(1), 0.25f);
+    CORRADE_COMPARE(mixer.layerWeight(2), 0.5f);
+    CORRADE_COMPARE_AS(mixer.layerMask(1),
+        Containers::arrayView({1.0f, 1.0f, 1.0f}),
+        TestSuite::Compare::Container);
+
+    mixer.setLayerWeight(1, 0.75f)
+        .setLayerMask(1, Containers::arrayView({0.0f, 0.5f, 1.0f}));
+    CORRADE_COMPARE(mixer.layerWeight(1), 0.75f);
+    CORRADE_COMPARE_AS(mixer.layerMask(1),
+        Containers::arrayView({0.0f, 0.5f, 1.0f}),
+        TestSuite::Compare::Container);
+    /* Other layers not affected */
+    CORRADE_COMPARE_AS(mixer.layerMask(0),
+        Containers::arrayView({1.0f, 1.0f, 1.0f}),
+        TestSuite::Compare::Container);
+}
+
+void MixerTest::addLayerInvalid() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 3};
+    mixer.addLayer();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mixer.isLayerAdditive(1);
+    mixer.layerWeight(1);
+    mixer.setLayerWeight(1, 0.5f);
+    mixer.layerMask(1);
+    mixer.setLayerMask(1, Containers::arrayView({0.0f, 0.5f, 1.0f}));
+    mixer.setLayerMask(0, Containers::arrayView({0.0f, 0.5f}));
+    CORRADE_COMPARE(out.str(),
+        "Animation::Mixer::isLayerAdditive(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::layerWeight(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::setLayerWeight(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::layerMask(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::setLayerMask(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::setLayerMask(): expected 3 items but got 2\n");
+}
+
+void MixerTest::add() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 3};
+    const std::size_t layer0 = mixer.addLayer();
+    const std::size_t layer1 = mixer.addLayer();
+    mixer.add(layer0, TrackA, 2)
+        .add(layer0, TrackView<const Float, const Vector3>{TrackB}, 0)
+        /* The same target can be in a different layer */
+        .add(layer1, TrackA, 0);
+
+    Vector3 destination[3]{Vector3{7.0f}, Vector3{7.0f}, Vector3{7.0f}};
+    const Float keys[]{1.5f, 0.5f};
+    mixer.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], TrackA.at(0.5f));
+    /* Target 1 has no tracks, it's left untouched */
+    CORRADE_COMPARE(destination[1], Vector3{7.0f});
+    CORRADE_COMPARE(destination[2], TrackA.at(1.5f));
+}
+
+void MixerTest::addInvalid() {
+    Mixer<Float, Vector3> mixer{Math::select, 3};
+    Mixer<Float, Vector3> mixerLerp{Math::lerp, 3};
+    mixer.addLayer();
+    mixerLerp.addLayer();
+    mixerLerp.add(0, TrackA, 1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mixerLerp.add(1, TrackA, 0);
+    mixerLerp.add(0, TrackA, 3);
+    mixer.add(0, TrackA, 0);
+    mixerLerp.add(0, TrackB, 1);
+    CORRADE_COMPARE(out.str(),
+        "Animation::Mixer::add(): index 1 out of range for 1 layers\n"
+        "Animation::Mixer::add(): target 3 out of range for 3 targets\n"
+        "Animation::Mixer::add(): track interpolator doesn't match the mixer\n"
+        "Animation::Mixer::add(): layer 0 already has a track for target 1\n");
+}
+
+void MixerTest::mixEmpty() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 2};
+    mixer.addLayer();
+    mixer.addAdditiveLayer();
+
+    /* Empty layers do nothing */
+    Vector3 destination[2]{Vector3{1.0f}, Vector3{2.0f}};
+    const Float keys[]{1.0f, 2.0f};
+    mixer.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], Vector3{1.0f});
+    CORRADE_COMPARE(destination[1], Vector3{2.0f});
+}
+
+void MixerTest::mix() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 2};
+    mixer.add(mixer.addLayer(), TrackA, 0)
+        .add(mixer.addLayer(0.25f), TrackB, 0);
+    mixer.add(1, TrackA, 1);
+
+    /* The first layer overwrites, the second blends to it with 0.25 weight.
+       The layers are sampled at different keys. */
+    Vector3 destination[2]{Vector3{7.0f}, Vector3{7.0f}};
+    const Float keys[]{0.5f, 2.5f};
+    mixer.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], Math::lerp(TrackA.at(0.5f), TrackB.at(2.5f), 0.25f));
+    CORRADE_COMPARE(destination[1], Math::lerp(Vector3{7.0f}, TrackA.at(2.5f), 0.25f));
+}
+
+void MixerTest::mixCrossfade() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 1};
+    const std::size_t walk = mixer.addLayer();
+    const std::size_t run = mixer.addLayer();
+    mixer.add(walk, TrackA, 0)
+        .add(run, TrackB, 0);
+
+    for(Float t: {0.0f, 0.3f, 1.0f}) {
+        mixer.setLayerWeight(walk, 1.0f)
+            .setLayerWeight(run, t);
+        Vector3 destination[1];
+        const Float keys[]{1.0f, 2.0f};
+        mixer.mix(keys, destination);
+        CORRADE_COMPARE(destination[0], Math::lerp(TrackA.at(1.0f), TrackB.at(2.0f), t));
+    }
+}
+
+void MixerTest::mixAdditive() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 2};
+    mixer.add(mixer.addLayer(), TrackA, 0)
+        .add(mixer.addAdditiveLayer(0.5f), TrackB, 0);
+    mixer.add(1, TrackB, 1);
+
+    Vector3 destination[2]{Vector3{7.0f}, Vector3{7.0f}};
+    const Float keys[]{3.0f, 2.0f};
+    mixer.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], TrackA.at(3.0f) + TrackB.at(2.0f)*0.5f);
+    CORRADE_COMPARE(destination[1], Vector3{7.0f} + TrackB.at(2.0f)*0.5f);
+}
+
+void MixerTest::mixMask() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 3};
+    const std::size_t base = mixer.addLayer();
+    const std::size_t upper = mixer.addLayer(0.5f);
+    const std::size_t additive = mixer.addAdditiveLayer();
+    for(std::size_t i = 0; i != 3; ++i) {
+        mixer.add(base, TrackA, i)
+            .add(upper, TrackB, i)
+            .add(additive, TrackB, i);
+    }
+    mixer.setLayerMask(upper, Containers::arrayView({0.0f, 1.0f, 0.5f}))
+        .setLayerMask(additive, Containers::arrayView({1.0f, 0.0f, 0.5f}));
+
+    Vector3 destination[3];
+    const Float keys[]{1.0f, 2.0f, 3.0f};
+    mixer.mix(keys, destination);
+    const Vector3 a = TrackA.at(1.0f);
+    const Vector3 b = TrackB.at(2.0f);
+    const Vector3 c = TrackB.at(3.0f);
+    CORRADE_COMPARE(destination[0], a + c);
+    CORRADE_COMPARE(destination[1], Math::lerp(a, b, 0.5f));
+    CORRADE_COMPARE(destination[2], Math::lerp(a, b, 0.25f) + c*0.5f);
+}
+
+void MixerTest::mixQuaternion() {
+    Mixer<Float, Quaternion> mixer{Math::lerp, 3};
+    const std::size_t a = mixer.addLayer();
+    const std::size_t b = mixer.addLayer(0.5f);
+    mixer.add(a, TrackRotationA, 0)
+        .add(a, TrackRotationA, 1)
+        .add(b, TrackRotationB, 1)
+        .add(b, TrackRotationB, 2);
+
+    Quaternion destination[3]{{}, {}, Quaternion::rotation(45.0_degf, Vector3::yAxis())};
+    const Float keys[]{1.0f, 0.5f};
+    mixer.mix(keys, destination);
+    CORRADE_COMPARE(destination[0], TrackRotationA.at(1.0f));
+    CORRADE_COMPARE(destination[1], Math::lerpShortestPath(TrackRotationA.at(1.0f), TrackRotationB.at(0.5f), 0.5f));
+    CORRADE_COMPARE(destination[2], Math::lerpShortestPath(Quaternion::rotation(45.0_degf, Vector3::yAxis()), TrackRotationB.at(0.5f), 0.5f));
+    CORRADE_VERIFY(destination[1].isNormalized());
+}
+
+void MixerTest::mixQuaternionAdditive() {
+    Mixer<Float, Quaternion> mixer{Math::lerp, 2};
+    const std::size_t base = mixer.addLayer();
+    const std::size_t additive = mixer.addAdditiveLayer(0.5f);
+    mixer.add(base, TrackRotationA, 0)
+        .add(additive, TrackRotationB, 0)
+        .add(additive, TrackRotationB, 1);
+
+    Quaternion destination[2]{{}, Quaternion::rotation(45.0_degf, Vector3::yAxis())};
+    const Float keys[]{2.0f, 0.0f};
+    mixer.mix(keys, destination);
+    /* 90° around X, then 15° more */
+    CORRADE_COMPARE(destination[0], Quaternion::rotation(105.0_degf, Vector3::xAxis()));
+    CORRADE_COMPARE(destination[1], Quaternion::rotation(15.0_degf, Vector3::xAxis())*Quaternion::rotation(45.0_degf, Vector3::yAxis()));
+}
+
+void MixerTest::mixQuaternionDouble() {
+    Quaterniond(*const interpolator)(const Quaterniond&, const Quaterniond&, Float) = [](const Quaterniond& a, const Quaterniond& b, Float t) {
+        return Math::lerp(a, b, Double(t));
+    };
+    const Track<Float, Quaterniond> track{{
+        {0.0f, Quaterniond::rotation(0.0_deg, Vector3d::xAxis())},
+        {2.0f, Quaterniond::rotation(90.0_deg, Vector3d::xAxis())}
+    }, interpolator};
+
+    Mixer<Float, Quaterniond> mixer{interpolator, 1};
+    mixer.add(mixer.addLayer(0.5f), track, 0)
+        .add(mixer.addAdditiveLayer(), track, 0);
+
+    Quaterniond destination[1];
+    const Float keys[]{2.0f, 1.0f};
+    mixer.mix(keys, destination);
+    /* Halfway to 90°, which with normalized lerp isn't exactly 45° */
+    const Quaterniond blended = Math::lerpShortestPath(Quaterniond{}, Quaterniond::rotation(90.0_deg, Vector3d::xAxis()), 0.5);
+    CORRADE_COMPARE(destination[0], Quaterniond::rotation(45.0_deg, Vector3d::xAxis())*blended);
+}
+
+void MixerTest::mixInvalid() {
+    Mixer<Float, Vector3> mixer{Math::lerp, 3};
+    mixer.addLayer();
+    mixer.addLayer();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Vector3 destination[3];
+    const Float keys[]{1.0f, 2.0f, 3.0f};
+    mixer.mix(Containers::arrayView(keys).prefix(1), destination);
+    mixer.mix(Containers::arrayView(keys).prefix(2), Containers::arrayView(destination).prefix(2));
+    CORRADE_COMPARE(out.str(),
+        "Animation::Mixer::mix(): expected 2 keys but got 1\n"
+        "Animation::Mixer::mix(): expected 3 destination items but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::MixerTest)
@@ -62,6 +62,9 @@ struct PlayerTest: TestSuite::Tester {
     void advancePlayCountInfinite();
     void advanceChrono();
     void advanceList();
+    void advanceKey();
+    void advanceParallel();
+    void advanceParallelReferences();
     void advanceZeroDurationStop();
     void advanceZeroDurationPause();
     void advanceZeroDurationInfinitePlayCount();
@@ -153,6 +156,9 @@ PlayerTest::PlayerTest() {
               &PlayerTest::advancePlayCountInfinite,
               &PlayerTest::advanceChrono,
               &PlayerTest::advanceList,
+              &PlayerTest::advanceKey,
+              &PlayerTest::advanceParallel,
+              &PlayerTest::advanceParallelReferences,
               &PlayerTest::advanceZeroDurationStop,
               &PlayerTest::advanceZeroDurationPause,
               &PlayerTest::advanceZeroDurationInfinitePlayCount,
@@ -804,6 +810,107 @@ void PlayerTest::advanceList() {
     CORRADE_COMPARE(valueB, 2.75f);
 }
 
+void PlayerTest::advanceKey() {
+    Float value = -1.0f;
+    Float key = -1.0f;
+    Player<Float> player;
+    player.add(Track, value)
+        .play(2.0f);
+
+    /* Still before starting time, key is not touched */
+    player.advance(1.75f, key);
+    CORRADE_COMPARE(value, -1.0f);
+    CORRADE_COMPARE(key, -1.0f);
+
+    /* 1.75 secs in, the key is offset by the duration start */
+    player.advance(3.75f, key);
+    CORRADE_COMPARE(value, 4.0f);
+    CORRADE_COMPARE(key, 2.75f);
+
+    /* Stopped at the end */
+    player.advance(5.5f, key);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE(value, 2.0f);
+    CORRADE_COMPARE(key, 4.0f);
+
+    /* Not advancing anymore */
+    key = -1.0f;
+    player.advance(6.0f, key);
+    CORRADE_COMPARE(key, -1.0f);
+
+    /* Works also with no tracks and just a duration */
+    Player<Float> empty;
+    empty.setDuration({1.0f, 4.0f})
+        .play(2.0f);
+    empty.advance(3.75f, key);
+    CORRADE_COMPARE(key, 2.75f);
+}
+
+void PlayerTest::advanceParallel() {
+    struct CallbackData {
+        Containers::Array<std::pair<std::size_t, Float>>* calls;
+        std::size_t id;
+    };
+
+    /* Two identical sets of players, one advanced serially and one in
+       parallel. Every third player has also a callback track. */
+    Containers::Array<std::pair<std::size_t, Float>> callsExpected, calls;
+    Containers::Array<Float> valuesExpected{Containers::DirectInit, 50, -1.0f};
+    Containers::Array<Float> values{Containers::DirectInit, 50, -1.0f};
+    Containers::Array<CallbackData> callbackDataExpected{50}, callbackData{50};
+    Containers::Array<Player<Float>> playersExpected{50}, players{50};
+    for(std::size_t i = 0; i != players.size(); ++i) {
+        callbackDataExpected[i] = {&callsExpected, i};
+        callbackData[i] = {&calls, i};
+        auto callback = [](Float, const Float& value, CallbackData& data) {
+            arrayAppend(*data.calls, Containers::InPlaceInit, data.id, value);
+        };
+        if(i % 3 == 0) {
+            playersExpected[i].addWithCallback(Track, callback, callbackDataExpected[i]);
+            players[i].addWithCallback(Track, callback, callbackData[i]);
+        }
+        playersExpected[i].add(Track, valuesExpected[i]);
+        players[i].add(Track, values[i]);
+
+        /* Some players are not started yet */
+        playersExpected[i].play(i*0.05f);
+        players[i].play(i*0.05f);
+    }
+
+    for(Float time: {1.0f, 2.0f, 3.5f}) {
+        for(Player<Float>& player: playersExpected) player.advance(time);
+        Player<Float>::advance(time, players, 3);
+
+        for(std::size_t i = 0; i != players.size(); ++i) {
+            CORRADE_COMPARE(players[i].state(), playersExpected[i].state());
+            CORRADE_COMPARE(values[i], valuesExpected[i]);
+        }
+    }
+
+    /* Callbacks are called in the same order */
+    CORRADE_VERIFY(!calls.empty());
+    CORRADE_COMPARE(calls.size(), callsExpected.size());
+    for(std::size_t i = 0; i != calls.size(); ++i) {
+        CORRADE_COMPARE(calls[i].first, callsExpected[i].first);
+        CORRADE_COMPARE(calls[i].second, callsExpected[i].second);
+    }
+}
+
+void PlayerTest::advanceParallelReferences() {
+    Float valueA = -1.0f, valueB = -1.0f;
+    Player<Float> a, b;
+    a.add(Track, valueA)
+     .play(2.0f);
+    b.add(Track, valueB)
+     .play(1.0f);
+
+    /* 1.75 secs in for A, 2.75 seconds in for B */
+    const Containers::Reference<Player<Float>> players[]{a, b};
+    Player<Float>::advance(3.75f, players, 0);
+    CORRADE_COMPARE(valueA, 4.0f);
+    CORRADE_COMPARE(valueB, 2.75f);
+}
+
 void PlayerTest::advanceZeroDurationStop() {
     Float value = -1.0f;
     Player<Float> player;
@@ -0,0 +1,414 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/UniformTrack.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct UniformTrackTest: TestSuite::Tester {
+    explicit UniformTrackTest();
+
+    void constructEmpty();
+    void constructInterpolator();
+    void constructInterpolation();
+    void constructInterpolationInterpolator();
+    void constructZeroDuration();
+    void constructInvalid();
+    void constructMove();
+
+    void at();
+    void atIntegerKey();
+    void atInto();
+    void atIntoInvalid();
+
+    void resampleLinear();
+    void resample();
+    void resampleConstant();
+    void resampleSpline();
+    void resampleQuaternion();
+    void resampleSingleKeyframe();
+    void resampleMaxSampleCount();
+    void resampleInvalid();
+};
+
+const struct {
+    const char* name;
+    Float time;
+    Float expected;
+} AtData[] {
+    {"before", -1.0f, 3.0f},
+    {"at the beginning", 1.0f, 3.0f},
+    {"at a sample", 3.0f, 1.0f},
+    {"between samples", 4.0f, 1.75f},
+    {"at the end", 9.0f, -1.0f},
+    {"after", 11.5f, -1.0f}
+};
+
+UniformTrackTest::UniformTrackTest() {
+    addTests({&UniformTrackTest::constructEmpty,
+              &UniformTrackTest::constructInterpolator,
+              &UniformTrackTest::constructInterpolation,
+              &UniformTrackTest::constructInterpolationInterpolator,
+              &UniformTrackTest::constructZeroDuration,
+              &UniformTrackTest::constructInvalid,
+              &UniformTrackTest::constructMove});
+
+    addInstancedTests({&UniformTrackTest::at},
+        Containers::arraySize(AtData));
+
+    addTests({&UniformTrackTest::atIntegerKey,
+              &UniformTrackTest::atInto,
+              &UniformTrackTest::atIntoInvalid,
+
+              &UniformTrackTest::resampleLinear,
+              &UniformTrackTest::resample,
+              &UniformTrackTest::resampleConstant,
+              &UniformTrackTest::resampleSpline,
+              &UniformTrackTest::resampleQuaternion,
+              &UniformTrackTest::resampleSingleKeyframe,
+              &UniformTrackTest::resampleMaxSampleCount,
+              &UniformTrackTest::resampleInvalid});
+}
+
+using namespace Math::Literals;
+
+void UniformTrackTest::constructEmpty() {
+    UniformTrack<Float, Vector3> a;
+
+    CORRADE_VERIFY(!a.interpolator());
+    CORRADE_COMPARE(a.duration(), Range1D{});
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.values().empty());
+}
+
+void UniformTrackTest::constructInterpolator() {
+    UniformTrack<Float, Vector3> a{{1.0f, 5.0f},
+        Containers::Array<Vector3>{Containers::InPlaceInit, {
+            {3.0f, 1.0f, 0.1f},
+            {0.3f, 0.6f, 1.0f}}},
+        Math::select};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.values().size(), 2);
+    CORRADE_COMPARE(a.values()[1], (Vector3{0.3f, 0.6f, 1.0f}));
+    CORRADE_COMPARE(a.at(4.9f), (Vector3{3.0f, 1.0f, 0.1f}));
+}
+
+void UniformTrackTest::constructInterpolation() {
+    UniformTrack<Float, Vector3> a{{1.0f, 5.0f},
+        Containers::Array<Vector3>{Containers::InPlaceInit, {
+            {3.0f, 1.0f, 0.1f},
+            {0.3f, 0.6f, 1.0f}}},
+        Interpolation::Linear};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.at(3.0f), (Vector3{1.65f, 0.8f, 0.55f}));
+}
+
+void UniformTrackTest::constructInterpolationInterpolator() {
+    UniformTrack<Float, Vector3> a{{1.0f, 5.0f},
+        Containers::Array<Vector3>{Containers::InPlaceInit, {
+            {3.0f, 1.0f, 0.1f},
+            {0.3f, 0.6f, 1.0f}}},
+        Interpolation::Linear, Math::select};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.at(3.0f), (Vector3{3.0f, 1.0f, 0.1f}));
+}
+
+void UniformTrackTest::constructZeroDuration() {
+    UniformTrack<Float, Float> a{{2.0f, 2.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {3.0f, 3.0f}},
+        Math::lerp};
+
+    CORRADE_COMPARE(a.at(-1.0f), 3.0f);
+    CORRADE_COMPARE(a.at(2.0f), 3.0f);
+    CORRADE_COMPARE(a.at(5.0f), 3.0f);
+}
+
+void UniformTrackTest::constructInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    UniformTrack<Float, Float> a{{1.0f, 5.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {3.0f}},
+        Math::lerp};
+    CORRADE_COMPARE(out.str(),
+        "Animation::UniformTrack: at least two values required\n");
+}
+
+void UniformTrackTest::constructMove() {
+    UniformTrack<Float, Float> a{{1.0f, 5.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {3.0f, 1.0f}},
+        Math::lerp};
+
+    UniformTrack<Float, Float> b{std::move(a)};
+    CORRADE_COMPARE(b.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.at(3.0f), 2.0f);
+
+    UniformTrack<Float, Float> c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_COMPARE(c.at(3.0f), 2.0f);
+
+    CORRADE_VERIFY(!std::is_copy_constructible<UniformTrack<Float, Float>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<UniformTrack<Float, Float>>{});
+}
+
+void UniformTrackTest::at() {
+    auto&& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Samples at 1, 3, 5, 7 and 9 */
+    UniformTrack<Float, Float> a{{1.0f, 9.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {
+            3.0f, 1.0f, 2.5f, 0.5f, -1.0f}},
+        Math::lerp};
+
+    CORRADE_COMPARE(a.at(data.time), data.expected);
+}
+
+void UniformTrackTest::atIntegerKey() {
+    UniformTrack<Int, Float> a{{-24, 72},
+        Containers::Array<Float>{Containers::InPlaceInit, {
+            3.0f, 1.0f, 2.5f, 0.5f, -1.0f}},
+        Math::lerp};
+
+    CORRADE_COMPARE(a.at(-100), 3.0f);
+    CORRADE_COMPARE(a.at(0), 1.0f);
+    CORRADE_COMPARE(a.at(12), 1.75f);
+    CORRADE_COMPARE(a.at(72), -1.0f);
+    CORRADE_COMPARE(a.at(100), -1.0f);
+}
+
+void UniformTrackTest::atInto() {
+    UniformTrack<Float, Float> a{{1.0f, 9.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {
+            3.0f, 1.0f, 2.5f, 0.5f, -1.0f}},
+        Math::lerp};
+
+    const Float frames[]{-1.0f, 1.0f, 3.0f, 4.0f, 9.0f, 11.5f};
+    Float out[Containers::arraySize(frames)];
+    a.atInto(frames, out);
+    for(std::size_t i = 0; i != Containers::arraySize(frames); ++i)
+        CORRADE_COMPARE(out[i], a.at(frames[i]));
+    CORRADE_COMPARE(out[3], 1.75f);
+}
+
+void UniformTrackTest::atIntoInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UniformTrack<Float, Float> a{{1.0f, 9.0f},
+        Containers::Array<Float>{Containers::InPlaceInit, {3.0f, 1.0f}},
+        Math::lerp};
+
+    const Float frames[3]{};
+    Float out[2];
+
+    std::ostringstream out_;
+    Error redirectError{&out_};
+    a.atInto(frames, out);
+    CORRADE_COMPARE(out_.str(),
+        "Animation::UniformTrack::atInto(): expected destination view size 3 but got 2\n");
+}
+
+void UniformTrackTest::resampleLinear() {
+    const Track<Float, Vector3> track{{
+        {1.0f, {3.0f, 1.0f, 0.1f}},
+        {5.0f, {0.3f, 0.6f, 1.0f}}
+    }, Math::lerp};
+
+    /* A linear track is represented exactly with just two samples */
+    UniformTrack<Float, Vector3> a = Animation::resample(track, 1.0e-5f);
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.at(2.2f), track.at(2.2f));
+}
+
+void UniformTrackTest::resample() {
+    /* Non-uniformly spaced keyframes */
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {0.3f, 1.0f},
+        {1.0f, 0.5f},
+        {1.1f, 2.5f},
+        {2.7f, -1.0f},
+        {3.0f, 0.0f}
+    }, Math::lerp};
+
+    for(Float maxError: {0.5f, 0.05f, 0.005f}) {
+        UniformTrack<Float, Float> a = Animation::resample(track, maxError);
+        CORRADE_COMPARE(a.duration(), (Range1D{0.0f, 3.0f}));
+        /* Sample count is always 2^n + 1 */
+        CORRADE_COMPARE((a.size() - 1) & (a.size() - 2), 0);
+
+        /* The difference of two piecewise linear functions is piecewise
+           linear with extremes at either original keyframes or samples, so
+           the tolerance should be met everywhere */
+        Float error{};
+        for(Float t = -0.5f; t < 3.5f; t += 0.001f)
+            error = Math::max(error, Math::abs(a.at(t) - track.at(t)));
+        CORRADE_COMPARE_AS(error, maxError*1.0001f, TestSuite::Compare::LessOrEqual);
+    }
+
+    /* Tighter tolerance needs more samples */
+    CORRADE_COMPARE_AS(Animation::resample(track, 0.5f).size(),
+        Animation::resample(track, 0.005f).size(),
+        TestSuite::Compare::Less);
+}
+
+void UniformTrackTest::resampleConstant() {
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {0.5f, 1.0f},
+        {1.0f, 2.0f}
+    }, Interpolation::Constant};
+
+    /* The constant interpolation is taken from the track, so keyframes
+       aligned to the samples are represented exactly with three samples. With
+       linear interpolation it'd need all 65536. */
+    UniformTrack<Float, Float> a = Animation::resample(track, 1.0e-5f);
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Constant);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.at(0.2f), 0.0f);
+    CORRADE_COMPARE(a.at(0.7f), 1.0f);
+    CORRADE_COMPARE(a.at(1.0f), 2.0f);
+}
+
+void UniformTrackTest::resampleSpline() {
+    const Track<Float, CubicHermite1D, Float> track{{
+        {0.0f, {0.0f, 0.0f, 3.0f}},
+        {1.0f, {-1.0f, 2.0f, 0.0f}},
+        {2.0f, {0.0f, -1.0f, 0.0f}}
+    }, Interpolation::Spline};
+
+    /* The resampled track contains interpolated results and not spline
+       points, so it's interpolated linearly instead */
+    UniformTrack<Float, Float> a = Animation::resample(track, 1.0e-3f);
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.duration(), (Range1D{0.0f, 2.0f}));
+    CORRADE_COMPARE_AS(a.size(), 2, TestSuite::Compare::Greater);
+    for(Float t = 0.0f; t < 2.0f; t += 0.01f)
+        CORRADE_COMPARE_WITH(a.at(t), track.at(t), TestSuite::Compare::around(2.0e-3f));
+}
+
+void UniformTrackTest::resampleQuaternion() {
+    const Quaternion keyframes[]{
+        Quaternion::rotation(0.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(90.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(45.0_degf, Vector3::yAxis()),
+        /* Opposite hemisphere, should take the shortest path */
+        -Quaternion::rotation(-30.0_degf, Vector3::zAxis())
+    };
+    const Float keys[]{0.0f, 0.5f, 2.0f, 2.2f};
+    const TrackView<const Float, const Quaternion> track{keys, keyframes,
+        Math::slerpShortestPath};
+
+    UniformTrack<Float, Quaternion> a = Animation::resample(track, Math::slerpShortestPath, 1.0e-3f);
+    CORRADE_COMPARE(a.duration(), (Range1D{0.0f, 2.2f}));
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(a.interpolator(), Math::slerpShortestPath);
+    for(Float t = 0.0f; t < 2.2f; t += 0.01f) {
+        const Quaternion expected = track.at(t);
+        const Quaternion actual = a.at(t);
+        CORRADE_COMPARE_AS(Math::min((actual - expected).length(), (actual + expected).length()), 1.0e-3f, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void UniformTrackTest::resampleSingleKeyframe() {
+    const Track<Float, Float> track{{
+        {1.5f, 3.0f}
+    }, Math::lerp};
+
+    UniformTrack<Float, Float> a = Animation::resample(track, 0.0f);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.5f, 1.5f}));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.at(0.0f), 3.0f);
+    CORRADE_COMPARE(a.at(1.5f), 3.0f);
+    CORRADE_COMPARE(a.at(2.0f), 3.0f);
+}
+
+void UniformTrackTest::resampleMaxSampleCount() {
+    /* A step function can't be represented exactly by a linearly
+       interpolated uniform track, so it stops at the max sample count */
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {0.3f, 1.0f},
+        {1.0f, 0.0f}
+    }, Math::select};
+
+    UniformTrack<Float, Float> a = Animation::resample(track, Math::lerp, 1.0e-3f, 100);
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(a.at(0.0f), 0.0f);
+    CORRADE_COMPARE(a.at(0.5f), 1.0f);
+}
+
+void UniformTrackTest::resampleInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Track<Float, Float> empty;
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {1.0f, 1.0f}
+    }, Math::lerp};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::resample(empty, 0.1f);
+    Animation::resample(track, 0.1f, 1);
+    CORRADE_COMPARE(out.str(),
+        "Animation::resample(): at least one keyframe required\n"
+        "Animation::resample(): expected at least two samples but got 1\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::UniformTrackTest)
@@ -76,12 +76,24 @@ performance. You have the following options:
 @subsection Animation-Track-performance-hint Keyframe hinting
 
 The @ref Track and @ref TrackView classes are fully stateless and the
-@ref at(K) const function performs a linear search for matching keyframe from
-the beginning every time. You can use @ref at(K, std::size_t&) const to
-remember last used keyframe index and pass it in the next iteration as a hint:
+@ref at(K) const function searches for matching keyframe from the beginning
+every time. You can use @ref at(K, std::size_t&) const to remember last used
+keyframe index and pass it in the next iteration as a hint:
 
 @snippet MagnumAnimation.cpp Track-performance-hint
 
+The search gallops from the hint towards the requested frame with
+exponentially growing steps and then bisects the bracketed range. With a hint,
+sequential playback thus needs only a constant amount of key comparisons per
+frame, while seeking or scrubbing to an arbitrary time is logarithmic in the
+distance from the previous position, both forward and backward. See
+@ref interpolate() for details.
+
+If the same track is sampled at many unrelated times, for example for a large
+number of independently animated instances, consider converting it to a
+@ref UniformTrack using @ref resample(). It trades some memory for a
+constant-time lookup without any search.
+
 @subsection Animation-Track-performance-strict Strict interpolation
 
 While it's possible to have different @ref Extrapolation modes for frames
@@ -348,8 +360,9 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function searches from the first
+         * keyframe every time, use @ref at(K, std::size_t&) const to supply
+         * a search hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
@@ -725,8 +738,9 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function searches from the first
+         * keyframe every time, use @ref at(K, std::size_t&) const to supply
+         * a search hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
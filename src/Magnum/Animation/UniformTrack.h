@@ -0,0 +1,358 @@
+#ifndef Magnum_Animation_UniformTrack_h
+#define Magnum_Animation_UniformTrack_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::UniformTrack, function @ref Magnum::Animation::resample()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Uniformly sampled animation track
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+@m_since_latest
+
+Immutable storage of values sampled at a fixed rate over a time range. Compared
+to @ref Track, there's no keyframe search --- calculating the value at given
+time is a single multiplication to get the sample index and an interpolation
+between two adjacent samples, with the cost being the same for any time and
+any access pattern. This is useful when the same animation is sampled at many
+unrelated times, for example for a large number of animated instances, and
+comes at a cost of higher memory use for tracks with sparse keyframes.
+
+@section Animation-UniformTrack-usage Basic usage
+
+The track is defined by its duration, a list of at least two values, where the
+first and last value correspond to the beginning and end of the duration and
+the rest is evenly spaced between, and an interpolator function. Usually it's
+however created from an existing track using @ref resample(), which picks a
+sample count satisfying given error tolerance:
+
+@snippet MagnumAnimation.cpp UniformTrack-usage
+
+Times outside of the track duration are clamped, i.e. the track has an
+implicit @ref Extrapolation::Constant behavior on both sides.
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class UniformTrack {
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef ResultType(*Interpolator)(const ValueType&, const ValueType&, Float);
+
+        /**
+         * @brief Construct an empty track
+         *
+         * The @ref values() and @ref interpolator() functions return
+         * @cpp nullptr @ce. It's not allowed to call @ref at() or
+         * @ref atInto() on an empty track.
+         */
+        explicit UniformTrack() noexcept: _values{}, _interpolator{}, _interpolation{}, _rate{} {}
+
+        /**
+         * @brief Construct with custom interpolator
+         * @param duration      Track duration
+         * @param values        Sampled values
+         * @param interpolator  Interpolator function
+         *
+         * Expects that there are at least two values. The first value
+         * corresponds to the beginning of @p duration, the last to its end.
+         * The @ref interpolation() field is set to @ref Interpolation::Custom.
+         */
+        explicit UniformTrack(const Math::Range1D<K>& duration, Containers::Array<V>&& values, Interpolator interpolator) noexcept: UniformTrack<K, V, R>{duration, std::move(values), Interpolation::Custom, interpolator} {}
+
+        /**
+         * @brief Construct with both generic and custom interpolator
+         * @param duration      Track duration
+         * @param values        Sampled values
+         * @param interpolation Interpolation behavior
+         * @param interpolator  Interpolator function
+         *
+         * Expects that there are at least two values. The first value
+         * corresponds to the beginning of @p duration, the last to its end.
+         * @p interpolation acts as a behavior hint to users that might want to
+         * supply their own interpolator function.
+         */
+        explicit UniformTrack(const Math::Range1D<K>& duration, Containers::Array<V>&& values, Interpolation interpolation, Interpolator interpolator) noexcept: _values{std::move(values)}, _interpolator{interpolator}, _interpolation{interpolation}, _duration{duration}, _rate{} {
+            CORRADE_ASSERT(_values.size() >= 2,
+                "Animation::UniformTrack: at least two values required", );
+            /* Zero-length track always returns the first value */
+            if(duration.size() != K{})
+                _rate = Float(_values.size() - 1)/Float(duration.size());
+        }
+
+        /**
+         * @brief Construct with generic interpolation behavior
+         * @param duration      Track duration
+         * @param values        Sampled values
+         * @param interpolation Interpolation behavior
+         *
+         * Expects that there are at least two values. The first value
+         * corresponds to the beginning of @p duration, the last to its end.
+         * The @ref interpolator() function is autodetected from
+         * @p interpolation using @ref interpolatorFor(). See its documentation
+         * for more information.
+         */
+        explicit UniformTrack(const Math::Range1D<K>& duration, Containers::Array<V>&& values, Interpolation interpolation) noexcept: UniformTrack<K, V, R>{duration, std::move(values), interpolation, interpolatorFor<V, R>(interpolation)} {}
+
+        /** @brief Copying is not allowed */
+        UniformTrack(const UniformTrack<K, V, R>&) = delete;
+
+        /** @brief Move constructor */
+        UniformTrack(UniformTrack<K, V, R>&&) = default;
+
+        /** @brief Copying is not allowed */
+        UniformTrack<K, V, R>& operator=(const UniformTrack<K, V, R>&) = delete;
+
+        /** @brief Move assignment */
+        UniformTrack<K, V, R>& operator=(UniformTrack<K, V, R>&&) = default;
+
+        /**
+         * @brief Interpolation behavior
+         *
+         * Acts as a behavior hint to users that might want to supply their own
+         * interpolator function.
+         * @see @ref interpolator()
+         */
+        Interpolation interpolation() const { return _interpolation; }
+
+        /**
+         * @brief Interpolation function
+         *
+         * @see @ref interpolation()
+         */
+        Interpolator interpolator() const { return _interpolator; }
+
+        /** @brief Duration of the track */
+        Math::Range1D<K> duration() const { return _duration; }
+
+        /** @brief Sample count */
+        std::size_t size() const { return _values.size(); }
+
+        /** @brief Sampled values */
+        Containers::ArrayView<const V> values() const { return _values; }
+
+        /**
+         * @brief Animated value at a given time
+         *
+         * Calculates index of the sample at or before @p frame and
+         * interpolates between it and the next sample using
+         * @ref interpolator(). Times outside of @ref duration() are clamped.
+         * Expects that the track is not empty.
+         * @see @ref atInto()
+         */
+        R at(K frame) const {
+            const Float position = Math::clamp(Float(frame - _duration.min())*_rate, 0.0f, Float(_values.size() - 1));
+            const std::size_t i = Math::min(std::size_t(position), _values.size() - 2);
+            return _interpolator(_values[i], _values[i + 1], position - Float(i));
+        }
+
+        /**
+         * @brief Animated values at given times
+         * @param[in]  frames       Times at which to calculate the values
+         * @param[out] destination  Where to put the results
+         *
+         * Equivalent to calling @ref at() for each item of @p frames. Expects
+         * that @p destination has the same size as @p frames and that the
+         * track is not empty.
+         */
+        void atInto(const Containers::StridedArrayView1D<const K>& frames, const Containers::StridedArrayView1D<R>& destination) const {
+            CORRADE_ASSERT(frames.size() == destination.size(),
+                "Animation::UniformTrack::atInto(): expected destination view size" << frames.size() << "but got" << destination.size(), );
+            for(std::size_t i = 0; i != frames.size(); ++i)
+                destination[i] = at(frames[i]);
+        }
+
+    private:
+        Containers::Array<V> _values;
+        Interpolator _interpolator;
+        Interpolation _interpolation;
+        Math::Range1D<K> _duration;
+        Float _rate;
+};
+
+namespace Implementation {
+
+/* Distance between two animation values, used by resample() and
+   reduceKeyframes() to check the error tolerance */
+template<class T> inline typename std::enable_if<std::is_arithmetic<T>::value, Float>::type valueDistance(const T a, const T b) {
+    return Float(a > b ? a - b : b - a);
+}
+template<std::size_t size, class T> inline Float valueDistance(const Math::Vector<size, T>& a, const Math::Vector<size, T>& b) {
+    return Float((a - b).length());
+}
+template<class T> inline Float valueDistance(const Math::Complex<T>& a, const Math::Complex<T>& b) {
+    return Float((a - b).length());
+}
+/* q and -q represent the same rotation */
+template<class T> inline Float valueDistance(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b) {
+    return Float(Math::min((a - b).length(), (a + b).length()));
+}
+template<class T> inline Float valueDistance(const Math::DualQuaternion<T>& a, const Math::DualQuaternion<T>& b) {
+    return Float(Math::min(
+        (a.real() - b.real()).length() + (a.dual() - b.dual()).length(),
+        (a.real() + b.real()).length() + (a.dual() + b.dual()).length()));
+}
+
+template<class K, class V, class R> UniformTrack<K, R> resample(const TrackView<const K, const V, R>& track, const Interpolation interpolation, const typename UniformTrack<K, R>::Interpolator interpolator, const Float maxError, const std::size_t maxSampleCount) {
+    static_assert(std::is_floating_point<K>::value,
+        "only floating-point keys can be resampled");
+    const Containers::StridedArrayView1D<const K> keys = track.keys();
+    CORRADE_ASSERT(!keys.empty(),
+        "Animation::resample(): at least one keyframe required", (UniformTrack<K, R>{}));
+    CORRADE_ASSERT(maxSampleCount >= 2,
+        "Animation::resample(): expected at least two samples but got" << maxSampleCount, (UniformTrack<K, R>{}));
+
+    const Math::Range1D<K> duration = track.duration();
+    std::size_t count = 2;
+    for(;;) {
+        /* Sample the original track */
+        Containers::Array<R> values{count};
+        std::size_t hint{};
+        for(std::size_t i = 0; i != count; ++i)
+            values[i] = track.at(i == count - 1 ? duration.max() :
+                duration.min() + duration.size()*K(i)/K(count - 1), hint);
+        UniformTrack<K, R> out{duration, std::move(values), interpolation, interpolator};
+
+        /* Zero-length track doesn't need any more samples */
+        if(count == maxSampleCount || duration.size() == K{})
+            return out;
+
+        /* Measure the error at original keyframes, halfway between them and
+           halfway between the samples */
+        Float error{};
+        hint = 0;
+        for(std::size_t i = 0; i != keys.size(); ++i) {
+            error = Math::max(error, valueDistance(track.at(keys[i], hint), out.at(keys[i])));
+            if(i + 1 != keys.size()) {
+                const K frame = (keys[i] + keys[i + 1])*K(0.5);
+                error = Math::max(error, valueDistance(track.at(frame, hint), out.at(frame)));
+            }
+        }
+        hint = 0;
+        for(std::size_t i = 0; i != count - 1; ++i) {
+            const K frame = duration.min() + duration.size()*(K(i) + K(0.5))/K(count - 1);
+            error = Math::max(error, valueDistance(track.at(frame, hint), out.at(frame)));
+        }
+
+        if(error <= maxError) return out;
+
+        count = Math::min((count - 1)*2 + 1, maxSampleCount);
+    }
+}
+
+}
+
+/**
+@brief Resample a track to a uniformly sampled one
+@param track            Track to resample
+@param interpolator     Interpolator function for the resampled track
+@param maxError         Maximal allowed error
+@param maxSampleCount   Maximal sample count
+@m_since_latest
+
+Samples @p track at evenly spaced times over its @ref TrackView::duration(),
+starting with two samples and repeatedly doubling the sample rate until the
+maximal distance between the original and resampled track is not larger than
+@p maxError or @p maxSampleCount is reached. The error is measured at all
+original keyframes and halfway between both the original keyframes and the
+new samples. Distance is calculated as an absolute difference for scalars,
+@ref Math::Vector::length() of the difference for vectors and complex numbers,
+and with the sign ambiguity taken into account for quaternions and dual
+quaternions.
+
+If the tolerance can't be met with @p maxSampleCount samples, which is
+usually the case for discontinuous animations such as tracks with
+@ref Interpolation::Constant, a track with @p maxSampleCount samples is
+returned. Expects that @p track has at least one keyframe, @p maxSampleCount
+is at least two and @p K is a floating-point type. A @ref Trade::AnimationData
+track can be resampled by passing @ref Trade::AnimationData::track() directly
+to this function. The @ref UniformTrack::interpolation() of the resampled track
+is set to @ref Interpolation::Custom.
+@experimental
+*/
+template<class K, class V, class R> UniformTrack<K, R> resample(const TrackView<const K, const V, R>& track, typename UniformTrack<K, R>::Interpolator interpolator, Float maxError, std::size_t maxSampleCount = 65536) {
+    return Implementation::resample(track, Interpolation::Custom, interpolator, maxError, maxSampleCount);
+}
+
+/**
+@overload
+@m_since_latest
+
+The interpolation of the resampled track is taken from
+@ref TrackView::interpolation() of @p track and the interpolator is chosen for
+it using @ref interpolatorFor(). As the resampled track stores the
+interpolated results and not the original values, tracks with
+@ref Interpolation::Spline are resampled with @ref Interpolation::Linear
+instead, and so are tracks with @ref Interpolation::Custom, as there's no way
+to know what the custom interpolator does. Use the overload above to resample
+with a different interpolator.
+*/
+template<class K, class V, class R> UniformTrack<K, R> resample(const TrackView<const K, const V, R>& track, Float maxError, std::size_t maxSampleCount = 65536) {
+    const Interpolation interpolation = track.interpolation() == Interpolation::Constant ? Interpolation::Constant : Interpolation::Linear;
+    return Implementation::resample(track, interpolation, interpolatorFor<R, R>(interpolation), maxError, maxSampleCount);
+}
+
+/**
+@overload
+@m_since_latest
+*/
+template<class K, class V, class R> UniformTrack<K, R> resample(const Track<K, V, R>& track, typename UniformTrack<K, R>::Interpolator interpolator, Float maxError, std::size_t maxSampleCount = 65536) {
+    return resample(TrackView<const K, const V, R>(track), interpolator, maxError, maxSampleCount);
+}
+
+/**
+@overload
+@m_since_latest
+*/
+template<class K, class V, class R> UniformTrack<K, R> resample(const Track<K, V, R>& track, Float maxError, std::size_t maxSampleCount = 65536) {
+    return resample(TrackView<const K, const V, R>(track), maxError, maxSampleCount);
+}
+
+}}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "parallelFor.h"
+
+#include <algorithm>
+#include <Corrade/configure.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Corrade/Utility/Macros.h>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+std::size_t parallelChunkCount(const std::size_t count, std::size_t threadCount) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(!threadCount)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    threadCount = 1;
+    #endif
+    return std::min(count, threadCount);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+namespace {
+
+/* Set for worker threads and for the calling thread while it processes its
+   chunk, nested parallelFor() calls are executed serially in that case */
+CORRADE_THREAD_LOCAL bool insideParallelFor = false;
+
+struct ThreadPool {
+    /* Called with dispatchMutex locked */
+    void run(std::size_t count, std::size_t chunkCount, void(*function)(void*, std::size_t, std::size_t, std::size_t), void* state);
+
+    void work();
+
+    /* Serializes calls to run() from multiple threads */
+    std::mutex dispatchMutex;
+
+    /* Guards everything below, chunks are distributed one by one under the
+       lock. The chunks are coarse, so the contention is negligible compared
+       to the work done. */
+    std::mutex mutex;
+    std::condition_variable workAvailable, workDone;
+    std::vector<std::thread> threads;
+    void(*function)(void*, std::size_t, std::size_t, std::size_t);
+    void* state;
+    std::size_t count{}, chunkCount{}, nextChunk{}, remainingChunks{};
+};
+
+void ThreadPool::work() {
+    insideParallelFor = true;
+
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        workAvailable.wait(lock, [this]() { return nextChunk < chunkCount; });
+
+        const std::size_t chunk = nextChunk++;
+        void(*const function)(void*, std::size_t, std::size_t, std::size_t) = this->function;
+        void* const state = this->state;
+        const std::size_t count = this->count;
+        const std::size_t chunkCount = this->chunkCount;
+
+        lock.unlock();
+        function(state, chunk, count*chunk/chunkCount, count*(chunk + 1)/chunkCount);
+        lock.lock();
+
+        if(!--remainingChunks) workDone.notify_one();
+    }
+}
+
+void ThreadPool::run(const std::size_t count, const std::size_t chunkCount, void(*const function)(void*, std::size_t, std::size_t, std::size_t), void* const state) {
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        /* Grow the pool to have a worker for each chunk except the first */
+        while(threads.size() < chunkCount - 1)
+            threads.emplace_back(&ThreadPool::work, this);
+
+        this->function = function;
+        this->state = state;
+        this->count = count;
+        this->chunkCount = chunkCount;
+        nextChunk = 1;
+        remainingChunks = chunkCount - 1;
+    }
+    workAvailable.notify_all();
+
+    insideParallelFor = true;
+    function(state, 0, 0, count/chunkCount);
+    insideParallelFor = false;
+
+    std::unique_lock<std::mutex> lock{mutex};
+    workDone.wait(lock, [this]() { return !remainingChunks; });
+    this->chunkCount = nextChunk = 0;
+}
+
+}
+#endif
+
+void parallelFor(const std::size_t count, const std::size_t chunkCount, void(*const function)(void*, std::size_t, std::size_t, std::size_t), void* const state) {
+    if(!count) return;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(chunkCount > 1 && !insideParallelFor) {
+        /* Intentionally never destroyed --- the workers wait for new work
+           until the process exits. Joining them from a static destructor
+           could deadlock when the library is unloaded on Windows. */
+        static ThreadPool& pool = *new ThreadPool;
+        std::lock_guard<std::mutex> lock{pool.dispatchMutex};
+        pool.run(count, chunkCount, function, state);
+        return;
+    }
+    #endif
+
+    for(std::size_t i = 0; i != chunkCount; ++i)
+        function(state, i, count*i/chunkCount, count*(i + 1)/chunkCount);
+}
+
+}}
@@ -0,0 +1,66 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Used by the multi-threaded batch APIs. Returns how many chunks a range of
+   given size gets split to for given thread count, with zero meaning
+   hardware concurrency. Never more than count (so empty ranges result in zero
+   chunks) and always 1 on Emscripten, where we don't assume pthreads are
+   available. */
+MAGNUM_EXPORT std::size_t parallelChunkCount(std::size_t count, std::size_t threadCount);
+
+/* Calls function(state, chunk, begin, end) for each of chunkCount contiguous
+   chunks of a [0, count) range. The split depends only on count and
+   chunkCount, so results combined in chunk order are reproducible for a fixed
+   thread count. The first chunk is processed on the calling thread, the rest
+   by a persistent pool of worker threads that's created on first use and
+   grown to the largest chunk count requested so far. The function returns
+   after all chunks are done.
+
+   Calls from multiple threads are serialized. Calls made from inside a chunk
+   don't wait for the pool and process all their chunks on the current thread
+   instead. Not a template so the threading headers don't need to be included
+   in installed template implementation files. */
+MAGNUM_EXPORT void parallelFor(std::size_t count, std::size_t chunkCount, void(*function)(void*, std::size_t, std::size_t, std::size_t), void* state);
+
+/* Convenience wrapper calling f(chunk, begin, end) */
+template<class F> void parallelFor(const std::size_t count, const std::size_t chunkCount, F&& f) {
+    typedef typename std::remove_reference<F>::type Function;
+    parallelFor(count, chunkCount, [](void* state, std::size_t chunk, std::size_t begin, std::size_t end) {
+        (*static_cast<Function*>(state))(chunk, begin, end);
+    }, const_cast<void*>(static_cast<const void*>(&f)));
+}
+
+}}
+
+#endif
@@ -57,6 +57,11 @@ with some row padding or when the inputs are generated / converted from other
 values):
 
 @snippet MagnumMathAlgorithms.cpp kahanSum-iterative
+
+For large contiguous or strided ranges of @ref Magnum::Float "Float" or
+@ref Magnum::Double "Double" values, @ref pairwiseSum() gives a comparable
+precision while being several times faster, and can optionally run on
+multiple threads.
 */
 template<class Iterator, class T = typename std::decay<decltype(*std::declval<Iterator>())>::type> T kahanSum(Iterator begin, Iterator end, T sum = T(0), T* compensation = nullptr) {
     T c = compensation ? *compensation : T(0);
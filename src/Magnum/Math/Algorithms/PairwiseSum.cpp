@@ -0,0 +1,144 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PairwiseSum.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace {
+
+enum: std::size_t {
+    Lanes = 8,
+    BlockSize = Lanes*8
+};
+
+/* Compensated accumulation of the per-block sums. Neumaier's variant of the
+   Kahan algorithm, which handles also the case where the added value is
+   larger than the running sum. */
+template<class T> struct Accumulator {
+    void add(const T value) {
+        const T t = sum + value;
+        if((sum < T(0) ? -sum : sum) >= (value < T(0) ? -value : value))
+            c += (sum - t) + value;
+        else
+            c += (value - t) + sum;
+        sum = t;
+    }
+
+    T result() const { return sum + c; }
+
+    T sum{}, c{};
+};
+
+/* Adds the lanes together pairwise, in a fixed order */
+template<class T> inline T reduceLanes(const T(&lanes)[Lanes]) {
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+/* Lane l of each block gets items l, l + 8, l + 16, ... The lanes are
+   independent of each other, so the compiler is free to put them into SIMD
+   registers without changing the order of operations within a lane. The
+   contiguous case is a separate instantiation to make the loads trivially
+   vectorizable. */
+template<bool contiguous, class T> T sumImplementation(const char* data, const std::size_t count, const std::ptrdiff_t stride) {
+    Accumulator<T> accumulator;
+
+    std::size_t i = 0;
+    for(; i + BlockSize <= count; i += BlockSize) {
+        T lanes[Lanes]{};
+        if(contiguous) {
+            const T* const block = reinterpret_cast<const T*>(data) + i;
+            for(std::size_t j = 0; j != BlockSize; j += Lanes)
+                for(std::size_t l = 0; l != Lanes; ++l)
+                    lanes[l] += block[j + l];
+        } else {
+            const char* const block = data + std::ptrdiff_t(i)*stride;
+            for(std::size_t j = 0; j != BlockSize; j += Lanes)
+                for(std::size_t l = 0; l != Lanes; ++l)
+                    lanes[l] += *reinterpret_cast<const T*>(block + std::ptrdiff_t(j + l)*stride);
+        }
+        accumulator.add(reduceLanes(lanes));
+    }
+
+    /* Remaining items, distributed to the lanes the same way */
+    if(i != count) {
+        T lanes[Lanes]{};
+        for(std::size_t j = 0; i + j != count; ++j)
+            lanes[j % Lanes] += *reinterpret_cast<const T*>(data + std::ptrdiff_t(i + j)*stride);
+        accumulator.add(reduceLanes(lanes));
+    }
+
+    return accumulator.result();
+}
+
+template<class T> T pairwiseSumImplementation(const Corrade::Containers::StridedArrayView1D<const T>& range) {
+    const char* const data = static_cast<const char*>(range.data());
+    if(range.stride() == sizeof(T))
+        return sumImplementation<true, T>(data, range.size(), range.stride());
+    return sumImplementation<false, T>(data, range.size(), range.stride());
+}
+
+template<class T> T pairwiseSumParallelImplementation(const Corrade::Containers::StridedArrayView1D<const T>& range, const std::size_t threadCount) {
+    const std::size_t chunkCount = Magnum::Implementation::parallelChunkCount(range.size(), threadCount);
+    if(chunkCount <= 1) return pairwiseSumImplementation(range);
+
+    /* The per-chunk sums are combined in chunk order on the calling thread,
+       so the result depends only on the chunk split and not on the order in
+       which the threads finish */
+    Corrade::Containers::Array<T> sums{Corrade::Containers::ValueInit, chunkCount};
+    Magnum::Implementation::parallelFor(range.size(), chunkCount, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        sums[chunk] = pairwiseSumImplementation(range.slice(begin, end));
+    });
+
+    Accumulator<T> accumulator;
+    for(const T sum: sums) accumulator.add(sum);
+    return accumulator.result();
+}
+
+}
+
+Float pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>& range) {
+    return pairwiseSumImplementation(range);
+}
+
+Double pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Double>& range) {
+    return pairwiseSumImplementation(range);
+}
+
+Float pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>& range, const std::size_t threadCount) {
+    return pairwiseSumParallelImplementation(range, threadCount);
+}
+
+Double pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Double>& range, const std::size_t threadCount) {
+    return pairwiseSumParallelImplementation(range, threadCount);
+}
+
+}}}
@@ -0,0 +1,97 @@
+#ifndef Magnum_Math_Algorithms_PairwiseSum_h
+#define Magnum_Math_Algorithms_PairwiseSum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::pairwiseSum()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Blocked pairwise summation
+@param range        Range to sum
+@m_since_latest
+
+Calculates a sum of a large range of floating-point numbers with an error
+comparable to @ref kahanSum(), but considerably faster. The range is split
+into blocks of 64 items, each block is summed in eight independent lanes that
+are then added together pairwise, and the per-block sums are accumulated with
+roundoff error compensation. The lanes break the dependency chain of the
+classic Kahan loop and allow the compiler to vectorize the inner loop, while
+the compensation step is executed only once per block. The error of the
+result is thus bounded by about a dozen machine epsilons times the sum of
+absolute values, independently of the range size, whereas with plain summation
+using for example @ref std::accumulate() the error grows linearly with the
+size.
+
+For a given input the result is always the same, but in general it's not
+bit-exact with @ref kahanSum(), as the additions are done in a different
+order.
+@see @ref pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>&, std::size_t)
+*/
+MAGNUM_EXPORT Float pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>& range);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Double>& range);
+
+/**
+@brief Blocked pairwise summation, calculated on multiple threads
+@param range        Range to sum
+@param threadCount  Thread count. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Splits @p range into @p threadCount contiguous chunks, calculates
+@ref pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>&)
+on each and then adds the per-chunk results together in chunk order, again
+with roundoff error compensation. The split depends only on the range size and
+@p threadCount, so for a fixed thread count the result is reproducible
+regardless of how the threads get scheduled. Different thread counts may give
+results that differ in the last few bits. On
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the calculation is always done on
+the calling thread.
+*/
+MAGNUM_EXPORT Float pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Float>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT Double pairwiseSum(const Corrade::Containers::StridedArrayView1D<const Double>& range, std::size_t threadCount);
+
+}}}
+
+#endif
@@ -0,0 +1,275 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <numeric>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Algorithms/KahanSum.h"
+#include "Magnum/Math/Algorithms/PairwiseSum.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct PairwiseSumTest: TestSuite::Tester {
+    explicit PairwiseSumTest();
+
+    void empty();
+    void small();
+    void ones();
+    void precision();
+    void precisionDouble();
+    void largeAndSmall();
+    void strided();
+
+    void parallel();
+    void parallelReproducible();
+    void parallelEmpty();
+
+    void accumulate1MFloats();
+    void kahan1MFloats();
+    void pairwise1MFloats();
+    void pairwise1MFloatsStrided();
+    void pairwise1MFloatsParallel();
+};
+
+PairwiseSumTest::PairwiseSumTest() {
+    addTests({&PairwiseSumTest::empty,
+              &PairwiseSumTest::small,
+              &PairwiseSumTest::ones,
+              &PairwiseSumTest::precision,
+              &PairwiseSumTest::precisionDouble,
+              &PairwiseSumTest::largeAndSmall,
+              &PairwiseSumTest::strided,
+
+              &PairwiseSumTest::parallel,
+              &PairwiseSumTest::parallelReproducible,
+              &PairwiseSumTest::parallelEmpty});
+
+    addBenchmarks({&PairwiseSumTest::accumulate1MFloats,
+                   &PairwiseSumTest::kahan1MFloats,
+                   &PairwiseSumTest::pairwise1MFloats,
+                   &PairwiseSumTest::pairwise1MFloatsStrided,
+                   &PairwiseSumTest::pairwise1MFloatsParallel}, 20);
+}
+
+/* Deliberately not a multiple of the block size to test the remainder
+   handling as well */
+constexpr std::size_t Count = 1000003;
+
+/* Values that are not exactly representable in a float, so all methods
+   accumulate some error */
+template<class T> Containers::Array<T> testData() {
+    Containers::Array<T> out{Containers::NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        out[i] = T(0.1) + T(i % 1000)*T(0.001);
+    return out;
+}
+
+template<class T> Double reference(const Containers::Array<T>& data) {
+    Double sum{};
+    for(const T i: data) sum += Double(i);
+    return sum;
+}
+
+void PairwiseSumTest::empty() {
+    CORRADE_COMPARE(pairwiseSum(Containers::StridedArrayView1D<const Float>{}), 0.0f);
+    CORRADE_COMPARE(pairwiseSum(Containers::StridedArrayView1D<const Double>{}), 0.0);
+}
+
+void PairwiseSumTest::small() {
+    const Float a[]{1.0f, 2.5f, -0.5f, 4.0f, 3.0f};
+    CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(a)), 10.0f);
+}
+
+void PairwiseSumTest::ones() {
+    /* Same as in KahanSumTest::floats(), but with 20M items instead of 100M
+       to not need excessive amounts of memory. Still enough for plain
+       summation to get stuck at 2^24. */
+    Containers::Array<Float> data{Containers::DirectInit, 20000000, 1.0f};
+
+    CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(data)), 2.0e7f);
+    CORRADE_COMPARE(std::accumulate(data.begin(), data.end(), 0.0f), 1.6777216e7f);
+}
+
+void PairwiseSumTest::precision() {
+    const Containers::Array<Float> data = testData<Float>();
+    const Double expected = reference(data);
+
+    const Float accumulate = std::accumulate(data.begin(), data.end(), 0.0f);
+    const Float kahan = kahanSum(data.begin(), data.end());
+    const Float pairwise = pairwiseSum(Containers::stridedArrayView(data));
+    CORRADE_INFO("Relative error of accumulate:" << Math::abs(accumulate - expected)/expected
+        << "kahan:" << Math::abs(kahan - expected)/expected
+        << "pairwise:" << Math::abs(pairwise - expected)/expected);
+
+    /* Plain summation is off by several ULPs, Kahan and pairwise should both
+       be within one ULP from the exact value */
+    CORRADE_COMPARE_AS(Math::abs(accumulate - expected)/expected, 1.0e-7,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(Math::abs(kahan - expected)/expected, 1.0e-7,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(Math::abs(pairwise - expected)/expected, 1.0e-7,
+        TestSuite::Compare::Less);
+}
+
+void PairwiseSumTest::precisionDouble() {
+    const Containers::Array<Double> data = testData<Double>();
+    Double expected = 0.0;
+    for(std::size_t i = 0; i != Count; ++i)
+        expected += Double(i % 1000);
+    /* Multiplying the sum of integers that's exact instead of summing the
+       inexact values */
+    expected = Double(Count)*0.1 + expected*0.001;
+
+    const Double pairwise = pairwiseSum(Containers::stridedArrayView(data));
+    CORRADE_COMPARE_AS(Math::abs(pairwise - expected)/expected, 1.0e-15,
+        TestSuite::Compare::Less);
+}
+
+void PairwiseSumTest::largeAndSmall() {
+    /* A large value followed by a lot of values that are each below the
+       precision of the large one. Plain summation loses all of them. */
+    Containers::Array<Float> data{Containers::DirectInit, 1000000, 1.0f};
+    data[0] = 1.0e8f;
+
+    CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(data)), 1.00999999e8f);
+    CORRADE_COMPARE(std::accumulate(data.begin(), data.end(), 0.0f), 1.0e8f);
+}
+
+void PairwiseSumTest::strided() {
+    const Containers::Array<Float> data = testData<Float>();
+    Containers::StridedArrayView1D<const Float> everyOther = Containers::stridedArrayView(data).every(2);
+
+    /* Same order of operations, so the result should be bit-exact with the
+       contiguous variant */
+    Containers::Array<Float> contiguous{Containers::NoInit, everyOther.size()};
+    for(std::size_t i = 0; i != everyOther.size(); ++i)
+        contiguous[i] = everyOther[i];
+
+    CORRADE_COMPARE(pairwiseSum(everyOther), pairwiseSum(Containers::stridedArrayView(contiguous)));
+}
+
+void PairwiseSumTest::parallel() {
+    const Containers::Array<Float> data = testData<Float>();
+    const Double expected = reference(data);
+
+    /* Single thread is the same as the non-threaded variant */
+    CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(data), 1), pairwiseSum(Containers::stridedArrayView(data)));
+
+    for(std::size_t threadCount: {2, 3, 7, 0}) {
+        CORRADE_ITERATION(threadCount);
+        const Float pairwise = pairwiseSum(Containers::stridedArrayView(data), threadCount);
+        CORRADE_COMPARE_AS(Math::abs(pairwise - expected)/expected, 1.0e-7,
+            TestSuite::Compare::Less);
+    }
+
+    /* More threads than items */
+    const Double small[]{1.0, 2.5, -0.5};
+    CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(small), 16), 3.0);
+}
+
+void PairwiseSumTest::parallelReproducible() {
+    const Containers::Array<Float> data = testData<Float>();
+
+    /* The chunk split depends only on the size and the thread count, so
+       repeated calls should give a bit-exact result */
+    const Float first = pairwiseSum(Containers::stridedArrayView(data), 5);
+    for(std::size_t i = 0; i != 10; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(pairwiseSum(Containers::stridedArrayView(data), 5), first);
+    }
+}
+
+void PairwiseSumTest::parallelEmpty() {
+    CORRADE_COMPARE(pairwiseSum(Containers::StridedArrayView1D<const Float>{}, 4), 0.0f);
+}
+
+void PairwiseSumTest::accumulate1MFloats() {
+    const Containers::Array<Float> data = testData<Float>();
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = std::accumulate(data.begin(), data.end(), 0.0f);
+    }
+
+    CORRADE_VERIFY(Float(a) > 0.0f);
+}
+
+void PairwiseSumTest::kahan1MFloats() {
+    const Containers::Array<Float> data = testData<Float>();
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = kahanSum(data.begin(), data.end());
+    }
+
+    CORRADE_VERIFY(Float(a) > 0.0f);
+}
+
+void PairwiseSumTest::pairwise1MFloats() {
+    const Containers::Array<Float> data = testData<Float>();
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = pairwiseSum(Containers::stridedArrayView(data));
+    }
+
+    CORRADE_VERIFY(Float(a) > 0.0f);
+}
+
+void PairwiseSumTest::pairwise1MFloatsStrided() {
+    Containers::Array<Vector2<Float>> data{Containers::NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        data[i] = Vector2<Float>{0.1f + Float(i % 1000)*0.001f};
+
+    Containers::StridedArrayView1D<const Float> x = Containers::arrayCast<const Float>(Containers::stridedArrayView(data));
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = pairwiseSum(x);
+    }
+
+    CORRADE_VERIFY(Float(a) > 0.0f);
+}
+
+void PairwiseSumTest::pairwise1MFloatsParallel() {
+    const Containers::Array<Float> data = testData<Float>();
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = pairwiseSum(Containers::stridedArrayView(data), 0);
+    }
+
+    CORRADE_VERIFY(Float(a) > 0.0f);
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::PairwiseSumTest)
@@ -396,6 +396,9 @@ template<class T> class Color3: public Vector3<T> {
          *
          * @snippet MagnumMath.cpp Color3-unpack
          *
+         * For converting large amounts of 8-bit data at once, there's also
+         * a lookup-table-based @ref fromSrgbInto() batch function.
+         *
          * @see @ref fromSrgb(UnsignedInt), @link operator""_srgbf() @endlink,
          *      @ref Color4::fromSrgbAlpha(const Vector4<Integral>&)
          */
@@ -571,6 +574,9 @@ template<class T> class Color3: public Vector3<T> {
          *
          * @snippet MagnumMath.cpp Color3-pack
          *
+         * For converting large amounts of data to 8-bit sRGB at once, there's
+         * also an approximating @ref toSrgbInto() batch function.
+         *
          * @see @ref toSrgbInt(), @ref Color4::toSrgbAlpha()
          */
         template<class Integral> Vector3<Integral> toSrgb() const {
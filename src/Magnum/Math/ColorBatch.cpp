@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ColorBatch.h"
+
+#include <cmath>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Implementation/srgbTables.hpp"
+
+namespace Magnum { namespace Math {
+
+static_assert(sizeof(SrgbToLinearTable) == 1024,
+    "improper size of sRGB->linear conversion table");
+
+static_assert(sizeof(LinearToSrgbTable) == 1664,
+    "improper size of linear->sRGB conversion table");
+
+namespace {
+
+union FloatBits {
+    UnsignedInt u;
+    Float f;
+};
+
+/* Based on fp32_to_srgb8_tab4() from https://gist.github.com/rygorous/2203834,
+   but with 32 instead of 8 buckets per exponent. See generateSrgbTables.py
+   for details. */
+inline UnsignedByte linearToSrgb(const Float value) {
+    /* 2^-13, everything below maps to 0 */
+    constexpr const FloatBits Min{(127 - 13) << 23};
+    /* 1 - epsilon, everything above maps to 255 */
+    constexpr const FloatBits AlmostOne{0x3f7fffff};
+
+    /* Written this way to catch NaNs, which then map to 0 */
+    FloatBits in;
+    in.f = value > Min.f ? value : Min.f;
+    if(in.f > AlmostOne.f) in.f = AlmostOne.f;
+
+    /* Table lookup with the exponent and top five mantissa bits, the next
+       eight mantissa bits are used to interpolate the bias and scale */
+    const UnsignedInt entry = LinearToSrgbTable[(in.u - Min.u) >> 18];
+    const UnsignedInt bias = (entry >> 16) << 8;
+    const UnsignedInt scale = entry & 0xffff;
+    const UnsignedInt t = (in.u >> 10) & 0xff;
+    return UnsignedByte((bias + scale*t) >> 16);
+}
+
+template<bool alpha> void fromSrgbIntoImplementation(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst, const char* const messagePrefix) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        messagePrefix << "wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>() && dst.isContiguous<1>(),
+        messagePrefix << "second view dimension is not contiguous", );
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    #endif
+
+    /* Caching values to avoid inline function calls in debug builds */
+    const char* srcPtr = reinterpret_cast<const char*>(src.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride()[0];
+    const std::ptrdiff_t dstStride = dst.stride()[0];
+    const std::size_t maxJ = src.size()[1];
+    const std::size_t maxJSrgb = alpha && maxJ ? maxJ - 1 : maxJ;
+    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+        const UnsignedByte* srcPtrI = reinterpret_cast<const UnsignedByte*>(srcPtr);
+        UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
+        for(std::size_t j = 0; j != maxJSrgb; ++j)
+            *dstPtrI++ = SrgbToLinearTable[*srcPtrI++];
+        if(alpha && maxJ)
+            *reinterpret_cast<Float*>(dstPtrI) = *srcPtrI/255.0f;
+
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+template<bool alpha> void toSrgbIntoImplementation(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedByte>& dst, const char* const messagePrefix) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        messagePrefix << "wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>() && dst.isContiguous<1>(),
+        messagePrefix << "second view dimension is not contiguous", );
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    #endif
+
+    /* Caching values to avoid inline function calls in debug builds */
+    const char* srcPtr = reinterpret_cast<const char*>(src.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t srcStride = src.stride()[0];
+    const std::ptrdiff_t dstStride = dst.stride()[0];
+    const std::size_t maxJ = src.size()[1];
+    const std::size_t maxJSrgb = alpha && maxJ ? maxJ - 1 : maxJ;
+    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
+        UnsignedByte* dstPtrI = reinterpret_cast<UnsignedByte*>(dstPtr);
+        for(std::size_t j = 0; j != maxJSrgb; ++j)
+            *dstPtrI++ = linearToSrgb(*srcPtrI++);
+        if(alpha && maxJ)
+            *dstPtrI = UnsignedByte(std::round(*srcPtrI*255.0f));
+
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+}
+
+void fromSrgbInto(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
+    fromSrgbIntoImplementation<false>(src, dst, "Math::fromSrgbInto():");
+}
+
+void fromSrgbAlphaInto(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
+    fromSrgbIntoImplementation<true>(src, dst, "Math::fromSrgbAlphaInto():");
+}
+
+void toSrgbInto(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    toSrgbIntoImplementation<false>(src, dst, "Math::toSrgbInto():");
+}
+
+void toSrgbAlphaInto(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    toSrgbIntoImplementation<true>(src, dst, "Math::toSrgbAlphaInto():");
+}
+
+}}
@@ -0,0 +1,126 @@
+#ifndef Magnum_Math_ColorBatch_h
+#define Magnum_Math_ColorBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::fromSrgbInto(), @ref Magnum::Math::fromSrgbAlphaInto(), @ref Magnum::Math::toSrgbInto(), @ref Magnum::Math::toSrgbAlphaInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch color conversion functions
+
+These functions process an unbounded range of values, as opposed to single
+colors. Compared to @ref Color3::fromSrgb() and @ref Color3::toSrgb(), which
+calculate @ref pow() for every channel, these use lookup tables and are thus
+significantly faster.
+*/
+
+/**
+@brief Convert 8-bit sRGB values to linear floating-point values
+@param[in]  src     Source sRGB values
+@param[out] dst     Destination linear values
+@m_since_latest
+
+Uses a 256-entry lookup table, the results are the same as with
+@ref Color3::fromSrgb(const Vector3<Integral>&) with the conversion done in
+double precision. Second dimension is meant to contain color channels, all of
+them are treated as sRGB. Expects that @p src and @p dst have the same size
+and that the second dimension in both is contiguous.
+@see @ref fromSrgbAlphaInto(), @ref toSrgbInto(),
+    @ref Corrade::Containers::StridedArrayView::isContiguous()
+*/
+MAGNUM_EXPORT void fromSrgbInto(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Convert 8-bit sRGB + alpha values to linear floating-point values
+@param[in]  src     Source sRGB + alpha values
+@param[out] dst     Destination linear values
+@m_since_latest
+
+Same as @ref fromSrgbInto(), except that the last component in the second
+dimension is treated as a linear alpha and is only unpacked to the
+@f$ [0, 1] @f$ range, equivalently to
+@ref Color4::fromSrgbAlpha(const Vector4<Integral>&).
+@see @ref toSrgbAlphaInto(), @ref unpackInto()
+*/
+MAGNUM_EXPORT void fromSrgbAlphaInto(const Corrade::Containers::StridedArrayView2D<const UnsignedByte>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Convert linear floating-point values to 8-bit sRGB values
+@param[in]  src     Source linear values
+@param[out] dst     Destination sRGB values
+@m_since_latest
+
+Instead of calculating @ref pow(), the sRGB curve is approximated with a
+piecewise linear function on the floating-point representation, based on
+[a float to sRGB conversion by Fabian Giesen](https://gist.github.com/rygorous/2203834).
+The error compared to the exact calculation is at most @f$ 0.51 @f$ of an
+8-bit step, which means the result may differ from
+@ref Color3::toSrgb() const by one for inputs lying very close to a rounding
+boundary. All 256 values coming from @ref fromSrgbInto() convert back to the
+original value.
+
+Input values outside of the @f$ [0, 1] @f$ range are clamped, *NaN*s are
+converted to @cpp 0 @ce. Second dimension is meant to contain color channels,
+all of them are treated as linear RGB. Expects that @p src and @p dst have the
+same size and that the second dimension in both is contiguous.
+@see @ref toSrgbAlphaInto(), @ref fromSrgbInto(),
+    @ref Corrade::Containers::StridedArrayView::isContiguous()
+*/
+MAGNUM_EXPORT void toSrgbInto(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedByte>& dst);
+
+/**
+@brief Convert linear floating-point values to 8-bit sRGB + alpha values
+@param[in]  src     Source linear values
+@param[out] dst     Destination sRGB + alpha values
+@m_since_latest
+
+Same as @ref toSrgbInto(), except that the last component in the second
+dimension is treated as a linear alpha and is only packed from the
+@f$ [0, 1] @f$ range, equivalently to @ref Color4::toSrgbAlpha() const.
+Conversion result for alpha values outside of the @f$ [0, 1] @f$ range is
+undefined.
+@see @ref fromSrgbAlphaInto(), @ref packInto()
+*/
+MAGNUM_EXPORT void toSrgbAlphaInto(const Corrade::Containers::StridedArrayView2D<const Float>& src, const Corrade::Containers::StridedArrayView2D<UnsignedByte>& dst);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
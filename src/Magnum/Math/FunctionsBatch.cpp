@@ -0,0 +1,280 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FunctionsBatch.h"
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Vector4.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <xmmintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Same semantics as Math::min() / Math::max() -- if value is NaN, the
+   accumulator is kept. Written without branches so it compiles to min/max
+   instructions. */
+template<class T> inline T minOf(T acc, T value) { return value < acc ? value : acc; }
+template<class T> inline T maxOf(T acc, T value) { return acc < value ? value : acc; }
+
+/* Processes the items four at a time with independent accumulators to break
+   the dependency chain, which also allows the compiler to vectorize the
+   loop. Results of the accumulators are combined in order at the end. */
+template<std::size_t components, bool doMin, bool doMax, class T> void minmaxScalar(const char* data, const std::size_t count, const std::ptrdiff_t stride, T* const min, T* const max) {
+    T mins[4][components];
+    T maxs[4][components];
+    for(std::size_t i = 0; i != 4; ++i) {
+        for(std::size_t c = 0; c != components; ++c) {
+            if(doMin) mins[i][c] = min[c];
+            if(doMax) maxs[i][c] = max[c];
+        }
+    }
+
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4, data += 4*stride) {
+        for(std::size_t j = 0; j != 4; ++j) {
+            const T* const item = reinterpret_cast<const T*>(data + j*stride);
+            for(std::size_t c = 0; c != components; ++c) {
+                if(doMin) mins[j][c] = minOf(mins[j][c], item[c]);
+                if(doMax) maxs[j][c] = maxOf(maxs[j][c], item[c]);
+            }
+        }
+    }
+
+    for(std::size_t j = 0; j != 4; ++j) {
+        for(std::size_t c = 0; c != components; ++c) {
+            if(doMin) min[c] = minOf(min[c], mins[j][c]);
+            if(doMax) max[c] = maxOf(max[c], maxs[j][c]);
+        }
+    }
+
+    /* Remaining items */
+    for(; i != count; ++i, data += stride) {
+        const T* const item = reinterpret_cast<const T*>(data);
+        for(std::size_t c = 0; c != components; ++c) {
+            if(doMin) min[c] = minOf(min[c], item[c]);
+            if(doMax) max[c] = maxOf(max[c], item[c]);
+        }
+    }
+}
+
+/* Returns count of items that was processed, the rest is done by
+   minmaxScalar() */
+template<std::size_t, bool, bool, class T> std::size_t minmaxVectorized(const char*, std::size_t, std::ptrdiff_t, T*, T*) {
+    return 0;
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* Contiguous floats, processed in blocks of eight items, which is
+   2*components SSE registers. Lane j of register r then always contains
+   component (r*4 + j) % components, so the registers can be folded back to
+   the components at the end. The _mm_min_ps(value, acc) / _mm_max_ps(value,
+   acc) order has the same NaN handling as minOf() / maxOf() above. */
+template<std::size_t components, bool doMin, bool doMax> std::size_t minmaxVectorized(const char* const data, const std::size_t count, const std::ptrdiff_t stride, Float* const min, Float* const max) {
+    if(stride != std::ptrdiff_t(components*sizeof(Float))) return 0;
+
+    const std::size_t blockCount = count/8;
+    if(!blockCount) return 0;
+
+    __m128 mins[2*components];
+    __m128 maxs[2*components];
+    for(std::size_t r = 0; r != 2*components; ++r) {
+        if(doMin) mins[r] = _mm_setr_ps(
+            min[(r*4 + 0) % components], min[(r*4 + 1) % components],
+            min[(r*4 + 2) % components], min[(r*4 + 3) % components]);
+        if(doMax) maxs[r] = _mm_setr_ps(
+            max[(r*4 + 0) % components], max[(r*4 + 1) % components],
+            max[(r*4 + 2) % components], max[(r*4 + 3) % components]);
+    }
+
+    const Float* floats = reinterpret_cast<const Float*>(data);
+    for(std::size_t b = 0; b != blockCount; ++b, floats += 8*components) {
+        for(std::size_t r = 0; r != 2*components; ++r) {
+            const __m128 value = _mm_loadu_ps(floats + r*4);
+            if(doMin) mins[r] = _mm_min_ps(value, mins[r]);
+            if(doMax) maxs[r] = _mm_max_ps(value, maxs[r]);
+        }
+    }
+
+    for(std::size_t r = 0; r != 2*components; ++r) {
+        Float lanes[4];
+        if(doMin) {
+            _mm_storeu_ps(lanes, mins[r]);
+            for(std::size_t j = 0; j != 4; ++j)
+                min[(r*4 + j) % components] = minOf(min[(r*4 + j) % components], lanes[j]);
+        }
+        if(doMax) {
+            _mm_storeu_ps(lanes, maxs[r]);
+            for(std::size_t j = 0; j != 4; ++j)
+                max[(r*4 + j) % components] = maxOf(max[(r*4 + j) % components], lanes[j]);
+        }
+    }
+
+    return blockCount*8;
+}
+#endif
+
+template<std::size_t components, bool doMin, bool doMax, class T> void minmaxComponents(const Corrade::Containers::StridedArrayView2D<const T>& range, T* const min, T* const max) {
+    const char* const data = static_cast<const char*>(range.data());
+    const std::size_t count = range.size()[0];
+    const std::ptrdiff_t stride = range.stride()[0];
+    const std::size_t done = minmaxVectorized<components, doMin, doMax>(data, count, stride, min, max);
+    minmaxScalar<components, doMin, doMax>(data + done*stride, count - done, stride, min, max);
+}
+
+template<bool doMin, bool doMax, class T> void minmaxImplementation(const Corrade::Containers::StridedArrayView2D<const T>& range, T* const min, T* const max) {
+    /* The views coming from the FunctionsBatch.h templates always have the
+       components tightly packed and at most four of them, anything else goes
+       through a plain loop */
+    if(range.stride()[1] == sizeof(T)) switch(range.size()[1]) {
+        case 1: return minmaxComponents<1, doMin, doMax>(range, min, max);
+        case 2: return minmaxComponents<2, doMin, doMax>(range, min, max);
+        case 3: return minmaxComponents<3, doMin, doMax>(range, min, max);
+        case 4: return minmaxComponents<4, doMin, doMax>(range, min, max);
+    }
+
+    for(std::size_t i = 0; i != range.size()[0]; ++i) {
+        for(std::size_t c = 0; c != range.size()[1]; ++c) {
+            if(doMin) min[c] = minOf(min[c], range[i][c]);
+            if(doMax) max[c] = maxOf(max[c], range[i][c]);
+        }
+    }
+}
+
+template<class T> std::pair<T, T> minmaxParallelImplementation(const Corrade::Containers::StridedArrayView1D<const T>& range, const std::size_t threadCount) {
+    const std::size_t chunkCount = Magnum::Implementation::parallelChunkCount(range.size(), threadCount);
+    if(chunkCount <= 1) return Math::minmax<T>(range);
+
+    /* Each chunk does its own NaN skipping, the per-chunk results are then
+       combined using min() and max(), which skip NaNs coming from chunks that
+       were all NaNs */
+    Corrade::Containers::Array<T> mins{Corrade::Containers::ValueInit, chunkCount};
+    Corrade::Containers::Array<T> maxs{Corrade::Containers::ValueInit, chunkCount};
+    Magnum::Implementation::parallelFor(range.size(), chunkCount, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        const std::pair<T, T> chunkMinmax = Math::minmax<T>(range.slice(begin, end));
+        mins[chunk] = chunkMinmax.first;
+        maxs[chunk] = chunkMinmax.second;
+    });
+
+    return {Math::min<T>(Corrade::Containers::StridedArrayView1D<const T>{mins}),
+            Math::max<T>(Corrade::Containers::StridedArrayView1D<const T>{maxs})};
+}
+
+}
+
+namespace Implementation {
+
+void minRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* const min) {
+    minmaxImplementation<true, false, Float>(range, min, nullptr);
+}
+
+void minRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* const min) {
+    minmaxImplementation<true, false, Int>(range, min, nullptr);
+}
+
+void minRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* const min) {
+    minmaxImplementation<true, false, UnsignedInt>(range, min, nullptr);
+}
+
+void maxRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* const max) {
+    minmaxImplementation<false, true, Float>(range, nullptr, max);
+}
+
+void maxRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* const max) {
+    minmaxImplementation<false, true, Int>(range, nullptr, max);
+}
+
+void maxRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* const max) {
+    minmaxImplementation<false, true, UnsignedInt>(range, nullptr, max);
+}
+
+void minmaxRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* const min, Float* const max) {
+    minmaxImplementation<true, true, Float>(range, min, max);
+}
+
+void minmaxRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* const min, Int* const max) {
+    minmaxImplementation<true, true, Int>(range, min, max);
+}
+
+void minmaxRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* const min, UnsignedInt* const max) {
+    minmaxImplementation<true, true, UnsignedInt>(range, min, max);
+}
+
+}
+
+std::pair<Float, Float> minmax(const Corrade::Containers::StridedArrayView1D<const Float>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Int, Int> minmax(const Corrade::Containers::StridedArrayView1D<const Int>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<UnsignedInt, UnsignedInt> minmax(const Corrade::Containers::StridedArrayView1D<const UnsignedInt>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector2<Float>, Vector2<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<Float>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector3<Float>, Vector3<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector4<Float>, Vector4<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<Float>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector2<Int>, Vector2<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<Int>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector3<Int>, Vector3<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<Int>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector4<Int>, Vector4<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<Int>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector2<UnsignedInt>, Vector2<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<UnsignedInt>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector3<UnsignedInt>, Vector3<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<UnsignedInt>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+std::pair<Vector4<UnsignedInt>, Vector4<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<UnsignedInt>>& range, const std::size_t threadCount) {
+    return minmaxParallelImplementation(range, threadCount);
+}
+
+}}
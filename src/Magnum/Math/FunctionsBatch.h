@@ -33,6 +33,7 @@
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
 
 namespace Magnum { namespace Math {
 
@@ -190,21 +191,68 @@ namespace Implementation {
         }
         return {firstValid, out};
     }
+
+    /* Types for which there's an optimized implementation of the min/max/
+       minmax() loops in FunctionsBatch.cpp. Only plain Float, Int and
+       UnsignedInt scalars and vectors of them, wrapped types such as Deg go
+       through the generic loop. */
+    template<class> struct MinmaxBatch: std::false_type {};
+    template<> struct MinmaxBatch<Float>: std::true_type { typedef Float Type; };
+    template<> struct MinmaxBatch<Int>: std::true_type { typedef Int Type; };
+    template<> struct MinmaxBatch<UnsignedInt>: std::true_type { typedef UnsignedInt Type; };
+    template<std::size_t size, class T> struct MinmaxBatch<Vector<size, T>>: MinmaxBatch<T> {};
+    template<class T> struct MinmaxBatch<Vector2<T>>: MinmaxBatch<T> {};
+    template<class T> struct MinmaxBatch<Vector3<T>>: MinmaxBatch<T> {};
+    template<class T> struct MinmaxBatch<Vector4<T>>: MinmaxBatch<T> {};
+    template<class T> struct MinmaxBatch<Color3<T>>: MinmaxBatch<T> {};
+    template<class T> struct MinmaxBatch<Color4<T>>: MinmaxBatch<T> {};
+
+    /* The first dimension of the view is items, the second is components.
+       The min / max arrays contain the initial values, are expected to have
+       the same size as the second dimension and are updated in-place. */
+    MAGNUM_EXPORT void minRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* min);
+    MAGNUM_EXPORT void minRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* min);
+    MAGNUM_EXPORT void minRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* min);
+    MAGNUM_EXPORT void maxRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* max);
+    MAGNUM_EXPORT void maxRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* max);
+    MAGNUM_EXPORT void maxRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* max);
+    MAGNUM_EXPORT void minmaxRange(const Corrade::Containers::StridedArrayView2D<const Float>& range, Float* min, Float* max);
+    MAGNUM_EXPORT void minmaxRange(const Corrade::Containers::StridedArrayView2D<const Int>& range, Int* min, Int* max);
+    MAGNUM_EXPORT void minmaxRange(const Corrade::Containers::StridedArrayView2D<const UnsignedInt>& range, UnsignedInt* min, UnsignedInt* max);
+
+    template<class T> inline void minRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& min, std::false_type) {
+        for(std::size_t i = 0; i != range.size(); ++i)
+            min = Math::min(min, range[i]);
+    }
+    template<class T> inline void minRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& min, std::true_type) {
+        typedef typename MinmaxBatch<T>::Type Type;
+        minRange(Corrade::Containers::arrayCast<2, const Type>(range), reinterpret_cast<Type*>(&min));
+    }
+    template<class T> inline void maxRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& max, std::false_type) {
+        for(std::size_t i = 0; i != range.size(); ++i)
+            max = Math::max(max, range[i]);
+    }
+    template<class T> inline void maxRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& max, std::true_type) {
+        typedef typename MinmaxBatch<T>::Type Type;
+        maxRange(Corrade::Containers::arrayCast<2, const Type>(range), reinterpret_cast<Type*>(&max));
+    }
 }
 
 /**
 @brief Minimum of a range
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
-ignored, unless the range is all <em>NaN</em>s.
+ignored, unless the range is all <em>NaN</em>s. For @ref Magnum::Float "Float",
+@ref Magnum::Int "Int", @ref Magnum::UnsignedInt "UnsignedInt" and vectors of
+these the loop is done by an optimized implementation that uses SIMD
+instructions on contiguous @ref Magnum::Float "Float" data if available.
 @see @ref min(T, T), @ref isNan(const Corrade::Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T min(const Corrade::Containers::StridedArrayView1D<const T>& range) {
     if(range.empty()) return {};
 
     std::pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first; iOut.first != range.size(); ++iOut.first)
-        iOut.second = Math::min(iOut.second, range[iOut.first]);
+    Implementation::minRange(range.suffix(iOut.first + 1), iOut.second, Implementation::MinmaxBatch<T>{});
 
     return iOut.second;
 }
@@ -241,15 +289,16 @@ template<class T, std::size_t size> inline T min(const T(&array)[size]) {
 @brief Maximum of a range
 
 If the range is empty, returns default-constructed value. <em>NaN</em>s are
-ignored, unless the range is all <em>NaN</em>s.
+ignored, unless the range is all <em>NaN</em>s. Uses the same optimized
+implementation as @ref min(const Corrade::Containers::StridedArrayView1D<const T>&)
+for the types listed there.
 @see @ref max(T, T), @ref isNan(const Corrade::Containers::StridedArrayView1D<const T>&)
 */
 template<class T> inline T max(const Corrade::Containers::StridedArrayView1D<const T>& range) {
     if(range.empty()) return {};
 
     std::pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first; iOut.first != range.size(); ++iOut.first)
-        iOut.second = Math::max(iOut.second, range[iOut.first]);
+    Implementation::maxRange(range.suffix(iOut.first + 1), iOut.second, Implementation::MinmaxBatch<T>{});
 
     return iOut.second;
 }
@@ -293,13 +342,25 @@ namespace Implementation {
         for(std::size_t i = 0; i != size; ++i)
             minmax(min[i], max[i], value[i]);
     }
+
+    template<class T> inline void minmaxRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& min, T& max, std::false_type) {
+        for(std::size_t i = 0; i != range.size(); ++i)
+            Implementation::minmax(min, max, range[i]);
+    }
+    template<class T> inline void minmaxRange(const Corrade::Containers::StridedArrayView1D<const T>& range, T& min, T& max, std::true_type) {
+        typedef typename MinmaxBatch<T>::Type Type;
+        minmaxRange(Corrade::Containers::arrayCast<2, const Type>(range), reinterpret_cast<Type*>(&min), reinterpret_cast<Type*>(&max));
+    }
 }
 
 /**
 @brief Minimum and maximum of a range
 
 If the range is empty, returns default-constructed values. <em>NaN</em>s are
-ignored, unless the range is all <em>NaN</em>s.
+ignored, unless the range is all <em>NaN</em>s. Uses the same optimized
+implementation as @ref min(const Corrade::Containers::StridedArrayView1D<const T>&)
+for the types listed there. For very large ranges see also
+@ref minmax(const Corrade::Containers::StridedArrayView1D<const Float>&, std::size_t).
 @see @ref minmax(T, T),
     @ref Range::Range(const std::pair<VectorType, VectorType>&),
     @ref isNan(const Corrade::Containers::StridedArrayView1D<const T>&)
@@ -309,8 +370,7 @@ template<class T> inline std::pair<T, T> minmax(const Corrade::Containers::Strid
 
     std::pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
     T min{iOut.second}, max{iOut.second};
-    for(++iOut.first; iOut.first != range.size(); ++iOut.first)
-        Implementation::minmax(min, max, range[iOut.first]);
+    Implementation::minmaxRange(range.suffix(iOut.first + 1), min, max, Implementation::MinmaxBatch<T>{});
 
     return {min, max};
 }
@@ -343,6 +403,89 @@ template<class T, std::size_t size> inline std::pair<T, T> minmax(const T(&array
     return minmax<T>(Corrade::Containers::StridedArrayView1D<const T>{array});
 }
 
+/**
+@brief Minimum and maximum of a range, calculated on multiple threads
+@param range        Range to go through
+@param threadCount  Thread count. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Splits @p range into @p threadCount contiguous chunks, calculates
+@ref minmax(const Corrade::Containers::StridedArrayView1D<const T>&) on each
+and combines the results. Useful for example for calculating bounding boxes of
+large meshes, for small ranges the threading overhead outweighs the benefits.
+The result is the same as from the single-threaded variant, including the
+handling of <em>NaN</em>s. On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the
+calculation is always done on the calling thread.
+*/
+MAGNUM_EXPORT std::pair<Float, Float> minmax(const Corrade::Containers::StridedArrayView1D<const Float>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Int, Int> minmax(const Corrade::Containers::StridedArrayView1D<const Int>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<UnsignedInt, UnsignedInt> minmax(const Corrade::Containers::StridedArrayView1D<const UnsignedInt>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector2<Float>, Vector2<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<Float>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector3<Float>, Vector3<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector4<Float>, Vector4<Float>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<Float>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector2<Int>, Vector2<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<Int>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector3<Int>, Vector3<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<Int>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector4<Int>, Vector4<Int>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<Int>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector2<UnsignedInt>, Vector2<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector2<UnsignedInt>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector3<UnsignedInt>, Vector3<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector3<UnsignedInt>>& range, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT std::pair<Vector4<UnsignedInt>, Vector4<UnsignedInt>> minmax(const Corrade::Containers::StridedArrayView1D<const Vector4<UnsignedInt>>& range, std::size_t threadCount);
+
 /* Since 1.8.17, the original short-hand group closing doesn't work anymore.
    FFS. */
 /**
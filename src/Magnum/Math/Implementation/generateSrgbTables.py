@@ -0,0 +1,148 @@
+#!/usr/bin/python3
+
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+# Tables for the batch sRGB conversion functions in ColorBatch.cpp. The 8-bit
+# sRGB to linear float table contains the exact result for each of the 256
+# input values. The linear float to 8-bit sRGB conversion is a piecewise
+# linear approximation of the sRGB curve over the float bit representation,
+# based on the approach described by Fabian Giesen in
+# https://gist.github.com/rygorous/2203834. Compared to the original, which
+# has 8 buckets per binary exponent, there's 32 buckets per exponent between
+# 2^-13 and 1, which reduces the max error from 0.544 to about 0.51 of an
+# 8-bit step. Each bucket stores a 16-bit bias and a 16-bit slope, which are
+# then interpolated using the next eight mantissa bits.
+
+import struct
+
+def f32(value):
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+def bits_to_f32(bits):
+    return struct.unpack('<f', struct.pack('<I', bits))[0]
+
+def f32_to_bits(value):
+    return struct.unpack('<I', struct.pack('<f', value))[0]
+
+def srgb_to_linear(srgb):
+    if srgb <= 0.04045:
+        return srgb/12.92
+    return ((srgb + 0.055)/1.055)**2.4
+
+def linear_to_srgb(linear):
+    if linear <= 0.0031308:
+        return linear*12.92
+    return 1.055*linear**(1.0/2.4) - 0.055
+
+srgb_to_linear_table = [f32(srgb_to_linear(i/255.0)) for i in range(256)]
+
+# Minimal value, 2^-13, everything below maps to zero
+min_bits = (127 - 13) << 23
+bucket_mantissa_bits = 5
+bucket_shift = 23 - bucket_mantissa_bits
+step_shift = bucket_shift - 8
+bucket_count = 13 << bucket_mantissa_bits
+samples_per_step = 8
+
+linear_to_srgb_table = []
+for bucket in range(bucket_count):
+    begin = min_bits + (bucket << bucket_shift)
+
+    # Least-squares fit of 255*srgb(x) + 0.5 in the 8-bit interpolation
+    # factor. The +0.5 is there so the conversion can just truncate instead of
+    # rounding.
+    n = 0
+    sum_t = sum_y = sum_tt = sum_ty = 0.0
+    for t in range(256):
+        for s in range(samples_per_step):
+            x = bits_to_f32(begin + (t << step_shift) + (s << step_shift)//samples_per_step)
+            y = 255.0*linear_to_srgb(x) + 0.5
+            n += 1
+            sum_t += t
+            sum_y += y
+            sum_tt += t*t
+            sum_ty += t*y
+    scale = (n*sum_ty - sum_t*sum_y)/(n*sum_tt - sum_t*sum_t)
+    bias = (sum_y - scale*sum_t)/n
+
+    scale_int = int(round(scale*65536.0))
+    bias_int = int(round(bias*65536.0/256.0))
+    assert 0 <= scale_int < 65536 and 0 <= bias_int < 65536
+    linear_to_srgb_table += [(bias_int << 16)|scale_int]
+
+# Print the stuff
+print("""#ifndef Magnum_Math_srgbTables_hpp
+#define Magnum_Math_srgbTables_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Types.h"
+
+/* Generated by ./generateSrgbTables.py */
+
+namespace Magnum { namespace Math { namespace {
+""")
+
+def print32bit(table):
+    for i, v in enumerate(table):
+        print("0x{:08x}".format(v), end=",\n    " if not (i + 1) % 6 else ", " if not i == len(table) - 1 else "")
+
+# Floats are printed as their bit representation to avoid any precision loss
+print("constexpr UnsignedInt SrgbToLinearTable[256] = {\n    ", end="")
+print32bit([f32_to_bits(v) for v in srgb_to_linear_table])
+print("\n};\n")
+
+print("constexpr UnsignedInt LinearToSrgbTable[{}] = {{\n    ".format(bucket_count), end="")
+print32bit(linear_to_srgb_table)
+print("""
+};
+
+}}}
+
+#endif
+""")
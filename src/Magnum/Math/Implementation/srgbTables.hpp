@@ -0,0 +1,156 @@
+#ifndef Magnum_Math_srgbTables_hpp
+#define Magnum_Math_srgbTables_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Types.h"
+
+/* Generated by ./generateSrgbTables.py */
+
+namespace Magnum { namespace Math { namespace {
+
+constexpr UnsignedInt SrgbToLinearTable[256] = {
+    0x00000000, 0x399f22b4, 0x3a1f22b4, 0x3a6eb40e, 0x3a9f22b4, 0x3ac6eb61,
+    0x3aeeb40e, 0x3b0b3e5d, 0x3b1f22b4, 0x3b33070a, 0x3b46eb61, 0x3b5b518e,
+    0x3b70f18f, 0x3b83e1c6, 0x3b8fe616, 0x3b9c87fd, 0x3ba9c9b6, 0x3bb7ad6f,
+    0x3bc6354a, 0x3bd56360, 0x3be539c1, 0x3bf5ba71, 0x3c0373b6, 0x3c0c6153,
+    0x3c15a705, 0x3c1f45be, 0x3c293e6b, 0x3c3391f7, 0x3c3e4149, 0x3c494d44,
+    0x3c54b6c9, 0x3c607eb4, 0x3c6ca5df, 0x3c792d22, 0x3c830aa9, 0x3c89af9f,
+    0x3c9085dc, 0x3c978dc6, 0x3c9ec7c2, 0x3ca63433, 0x3cadd37d, 0x3cb5a602,
+    0x3cbdac21, 0x3cc5e63a, 0x3cce54ac, 0x3cd6f7d5, 0x3cdfd010, 0x3ce8ddba,
+    0x3cf2212d, 0x3cfb9ac3, 0x3d02a56a, 0x3d0798dd, 0x3d0ca7e6, 0x3d11d2af,
+    0x3d171964, 0x3d1c7c30, 0x3d21fb3c, 0x3d2796b2, 0x3d2d4ebb, 0x3d332381,
+    0x3d39152b, 0x3d3f23e4, 0x3d454fd2, 0x3d4b991d, 0x3d51ffec, 0x3d588468,
+    0x3d5f26b6, 0x3d65e6fd, 0x3d6cc563, 0x3d73c20e, 0x3d7add24, 0x3d810b65,
+    0x3d84b793, 0x3d88732e, 0x3d8c3e48, 0x3d9018f4, 0x3d940344, 0x3d97fd49,
+    0x3d9c0715, 0x3da020ba, 0x3da44a4a, 0x3da883d6, 0x3daccd6f, 0x3db12727,
+    0x3db5910f, 0x3dba0b38, 0x3dbe95b3, 0x3dc33090, 0x3dc7dbe0, 0x3dcc97b4,
+    0x3dd1641d, 0x3dd6412b, 0x3ddb2eee, 0x3de02d76, 0x3de53cd4, 0x3dea5d18,
+    0x3def8e51, 0x3df4d090, 0x3dfa23e5, 0x3dff885e, 0x3e027f06, 0x3e05427f,
+    0x3e080ea2, 0x3e0ae377, 0x3e0dc104, 0x3e10a753, 0x3e13966a, 0x3e168e51,
+    0x3e198f0f, 0x3e1c98ac, 0x3e1fab30, 0x3e22c6a1, 0x3e25eb07, 0x3e29186a,
+    0x3e2c4ed0, 0x3e2f8e42, 0x3e32d6c5, 0x3e362862, 0x3e39831f, 0x3e3ce703,
+    0x3e405417, 0x3e43ca60, 0x3e4749e6, 0x3e4ad2af, 0x3e4e64c3, 0x3e520029,
+    0x3e55a4e7, 0x3e595305, 0x3e5d0a89, 0x3e60cb7a, 0x3e6495df, 0x3e6869be,
+    0x3e6c471f, 0x3e702e07, 0x3e741e7e, 0x3e78188b, 0x3e7c1c33, 0x3e8014bf,
+    0x3e822039, 0x3e84308b, 0x3e8645b8, 0x3e885fc3, 0x3e8a7eb0, 0x3e8ca281,
+    0x3e8ecb3b, 0x3e90f8df, 0x3e932b72, 0x3e9562f6, 0x3e979f6f, 0x3e99e0e0,
+    0x3e9c274c, 0x3e9e72b6, 0x3ea0c321, 0x3ea31890, 0x3ea57307, 0x3ea7d288,
+    0x3eaa3716, 0x3eaca0b6, 0x3eaf0f68, 0x3eb18332, 0x3eb3fc15, 0x3eb67a14,
+    0x3eb8fd34, 0x3ebb8576, 0x3ebe12de, 0x3ec0a56e, 0x3ec33d2a, 0x3ec5da14,
+    0x3ec87c30, 0x3ecb2380, 0x3ecdd008, 0x3ed081ca, 0x3ed338c9, 0x3ed5f508,
+    0x3ed8b68a, 0x3edb7d52, 0x3ede4963, 0x3ee11abf, 0x3ee3f169, 0x3ee6cd65,
+    0x3ee9aeb5, 0x3eec955b, 0x3eef815c, 0x3ef272b8, 0x3ef56974, 0x3ef86593,
+    0x3efb6716, 0x3efe6e00, 0x3f00bd2b, 0x3f02460c, 0x3f03d1a5, 0x3f055ff7,
+    0x3f06f104, 0x3f0884cd, 0x3f0a1b54, 0x3f0bb499, 0x3f0d509f, 0x3f0eef65,
+    0x3f1090ef, 0x3f12353d, 0x3f13dc50, 0x3f15862a, 0x3f1732cc, 0x3f18e237,
+    0x3f1a946e, 0x3f1c4970, 0x3f1e0140, 0x3f1fbbde, 0x3f21794d, 0x3f23398c,
+    0x3f24fc9f, 0x3f26c285, 0x3f288b41, 0x3f2a56d2, 0x3f2c253c, 0x3f2df67f,
+    0x3f2fca9c, 0x3f31a194, 0x3f337b6a, 0x3f35581d, 0x3f3737b0, 0x3f391a24,
+    0x3f3aff7a, 0x3f3ce7b2, 0x3f3ed2cf, 0x3f40c0d2, 0x3f42b1bc, 0x3f44a58e,
+    0x3f469c49, 0x3f4895ef, 0x3f4a9280, 0x3f4c91ff, 0x3f4e946c, 0x3f5099c9,
+    0x3f52a216, 0x3f54ad56, 0x3f56bb88, 0x3f58ccaf, 0x3f5ae0cc, 0x3f5cf7df,
+    0x3f5f11ea, 0x3f612eef, 0x3f634eee, 0x3f6571e9, 0x3f6797e0, 0x3f69c0d5,
+    0x3f6becca, 0x3f6e1bbf, 0x3f704db5, 0x3f7282ae, 0x3f74baab, 0x3f76f5ae,
+    0x3f7933b6, 0x3f7b74c6, 0x3f7db8de, 0x3f800000
+};
+
+constexpr UnsignedInt LinearToSrgbTable[416] = {
+    0x00e70003, 0x00ea0003, 0x00ed0003, 0x00f10003, 0x00f40003, 0x00f70003,
+    0x00fa0003, 0x00fd0003, 0x01010003, 0x01040003, 0x01070003, 0x010a0003,
+    0x010e0003, 0x01110003, 0x01140003, 0x01170003, 0x011a0003, 0x011e0003,
+    0x01210003, 0x01240003, 0x01270003, 0x012b0003, 0x012e0003, 0x01310003,
+    0x01340003, 0x01370003, 0x013b0003, 0x013e0003, 0x01410003, 0x01440003,
+    0x01470003, 0x014b0003, 0x014e0006, 0x01540006, 0x015b0006, 0x01610006,
+    0x01680006, 0x016e0006, 0x01750006, 0x017b0006, 0x01810006, 0x01880006,
+    0x018e0006, 0x01950006, 0x019b0006, 0x01a20006, 0x01a80006, 0x01ae0006,
+    0x01b50006, 0x01bb0006, 0x01c20006, 0x01c80006, 0x01cf0006, 0x01d50006,
+    0x01db0006, 0x01e20006, 0x01e80006, 0x01ef0006, 0x01f50006, 0x01fc0006,
+    0x02020006, 0x02090006, 0x020f0006, 0x02150006, 0x021c000d, 0x0229000d,
+    0x0236000d, 0x0242000d, 0x024f000d, 0x025c000d, 0x0269000d, 0x0276000d,
+    0x0283000d, 0x0290000d, 0x029d000d, 0x02a9000d, 0x02b6000d, 0x02c3000d,
+    0x02d0000d, 0x02dd000d, 0x02ea000d, 0x02f7000d, 0x0303000d, 0x0310000d,
+    0x031d000d, 0x032a000d, 0x0337000d, 0x0344000d, 0x0351000d, 0x035e000d,
+    0x036a000d, 0x0377000d, 0x0384000d, 0x0391000d, 0x039e000d, 0x03ab000d,
+    0x03b8001a, 0x03d1001a, 0x03eb001a, 0x0405001a, 0x041f001a, 0x0438001a,
+    0x0452001a, 0x046c001a, 0x0486001a, 0x049f001a, 0x04b9001a, 0x04d3001a,
+    0x04ed001a, 0x0506001a, 0x0520001a, 0x053a001a, 0x0554001a, 0x056d001a,
+    0x0587001a, 0x05a1001a, 0x05ba001a, 0x05d4001a, 0x05ee001a, 0x0608001a,
+    0x0621001a, 0x063b001a, 0x0655001a, 0x066f001a, 0x0688001a, 0x06a2001a,
+    0x06bc001a, 0x06d6001a, 0x06ef0033, 0x07230033, 0x07560033, 0x078a0033,
+    0x07bd0033, 0x07f10033, 0x08240033, 0x08580033, 0x088b0033, 0x08bf0033,
+    0x08f20033, 0x09260033, 0x09590033, 0x098d0033, 0x09c00033, 0x09f40033,
+    0x0a270033, 0x0a5b0033, 0x0a8e0033, 0x0ac20033, 0x0af40032, 0x0b260031,
+    0x0b580031, 0x0b880030, 0x0bb90030, 0x0be9002f, 0x0c18002f, 0x0c47002e,
+    0x0c75002e, 0x0ca3002e, 0x0cd1002d, 0x0cfe002d, 0x0d2b0058, 0x0d830057,
+    0x0dd90055, 0x0e2f0054, 0x0e820052, 0x0ed50051, 0x0f260050, 0x0f76004f,
+    0x0fc4004e, 0x1012004c, 0x105e004b, 0x10aa004a, 0x10f40049, 0x113e0048,
+    0x11860048, 0x11ce0047, 0x12140046, 0x125a0045, 0x129f0044, 0x12e30043,
+    0x13270043, 0x13690042, 0x13ab0041, 0x13ec0041, 0x142d0040, 0x146d003f,
+    0x14ac003f, 0x14eb003e, 0x1528003d, 0x1566003d, 0x15a3003c, 0x15df003c,
+    0x161b0076, 0x16900074, 0x17040072, 0x17760070, 0x17e5006e, 0x1853006c,
+    0x18c0006b, 0x192a0069, 0x19930068, 0x19fb0066, 0x1a610065, 0x1ac50063,
+    0x1b290062, 0x1b8b0061, 0x1beb005f, 0x1c4b005e, 0x1ca9005d, 0x1d06005c,
+    0x1d63005b, 0x1dbe005a, 0x1e170059, 0x1e700058, 0x1ec80057, 0x1f1f0056,
+    0x1f760055, 0x1fcb0054, 0x201f0054, 0x20730053, 0x20c50052, 0x21170051,
+    0x21680050, 0x21b90050, 0x2209009d, 0x22a6009a, 0x23400098, 0x23d80095,
+    0x246d0093, 0x25000091, 0x2590008e, 0x261f008c, 0x26ab008a, 0x27350088,
+    0x27bd0086, 0x28440085, 0x28c80083, 0x294b0081, 0x29cc007f, 0x2a4c007e,
+    0x2ac9007c, 0x2b46007b, 0x2bc10079, 0x2c3a0078, 0x2cb20077, 0x2d290075,
+    0x2d9e0074, 0x2e130073, 0x2e860072, 0x2ef70071, 0x2f68006f, 0x2fd8006e,
+    0x3046006d, 0x30b3006c, 0x3120006b, 0x318b006a, 0x31f600d2, 0x32c700ce,
+    0x339500cb, 0x346000c7, 0x352700c4, 0x35eb00c1, 0x36ac00be, 0x376a00bb,
+    0x382500b8, 0x38dd00b6, 0x399300b3, 0x3a4600b1, 0x3af700af, 0x3ba600ac,
+    0x3c5200aa, 0x3cfc00a8, 0x3da400a6, 0x3e4a00a4, 0x3eee00a2, 0x3f9100a0,
+    0x4031009f, 0x40cf009d, 0x416c009b, 0x42070099, 0x42a10098, 0x43390096,
+    0x43cf0095, 0x44640093, 0x44f70092, 0x45890091, 0x461a008f, 0x46a9008e,
+    0x47370118, 0x484f0113, 0x4962010e, 0x4a71010a, 0x4b7a0106, 0x4c800102,
+    0x4d8100fe, 0x4e7f00fa, 0x4f7900f6, 0x506f00f3, 0x516200ef, 0x525100ec,
+    0x533d00e9, 0x542600e6, 0x550c00e3, 0x55ef00e0, 0x56d000de, 0x57ad00db,
+    0x588800d8, 0x596100d6, 0x5a3700d4, 0x5b0a00d1, 0x5bdc00cf, 0x5cab00cd,
+    0x5d7700cb, 0x5e4200c9, 0x5f0b00c7, 0x5fd200c5, 0x609600c3, 0x615900c1,
+    0x621a00bf, 0x62d900bd, 0x63970176, 0x650d016f, 0x667c0169, 0x67e50163,
+    0x6948015d, 0x6aa50158, 0x6bfc0152, 0x6d4f014d, 0x6e9c0149, 0x6fe50144,
+    0x71290140, 0x7268013b, 0x73a40137, 0x74db0133, 0x760e012f, 0x773d012b,
+    0x78680128, 0x79900124, 0x7ab50121, 0x7bd5011e, 0x7cf3011a, 0x7e0e0117,
+    0x7f250114, 0x80390111, 0x814b010f, 0x8259010c, 0x83650109, 0x846e0107,
+    0x85750104, 0x86790102, 0x877a00ff, 0x887a00fd, 0x897701f3, 0x8b6a01ea,
+    0x8d5401e2, 0x8f3601da, 0x910f01d2, 0x92e201cb, 0x94ac01c4, 0x967001bd,
+    0x982d01b7, 0x99e401b0, 0x9b9401ab, 0x9d3f01a5, 0x9ee4019f, 0xa083019a,
+    0xa21d0195, 0xa3b10190, 0xa541018b, 0xa6cc0186, 0xa8520182, 0xa9d4017d,
+    0xab510179, 0xacca0175, 0xae3f0171, 0xafb0016d, 0xb11d0169, 0xb2860166,
+    0xb3ec0162, 0xb54e015e, 0xb6ac015b, 0xb8070158, 0xb95f0155, 0xbab30151,
+    0xbc06029a, 0xbea0028e, 0xc12e0283, 0xc3b10278, 0xc629026e, 0xc8970264,
+    0xcafc025b, 0xcd570252, 0xcfa9024a, 0xd1f20241, 0xd4340239, 0xd66d0232,
+    0xd89f022a, 0xdac90223, 0xdcec021c, 0xdf080216, 0xe11e020f, 0xe32d0209,
+    0xe5360203, 0xe73801fd, 0xe93501f7, 0xeb2d01f2, 0xed1e01ec, 0xef0b01e7,
+    0xf0f201e2, 0xf2d401dd, 0xf4b201d9, 0xf68a01d4, 0xf85e01cf, 0xfa2d01cb,
+    0xfbf801c7, 0xfdbf01c2
+};
+
+}}}
+
+#endif
+
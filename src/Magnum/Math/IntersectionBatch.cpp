@@ -0,0 +1,105 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* Planes in the outer loop, shapes in the inner. The result is first set to
+   true for everything and then each plane can only clear it, so the inner
+   loop has no early exit and no dependency between iterations. */
+template<class T> void aabbFrustumIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Vector3<T>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<T>>& aabbExtents, const Frustum<T>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size(),
+        "Math::Intersection::aabbFrustumInto(): expected views of the same size but got" << aabbCenters.size() << "and" << aabbExtents.size(), );
+    CORRADE_ASSERT(aabbCenters.size() == dst.size(),
+        "Math::Intersection::aabbFrustumInto(): expected destination view size" << aabbCenters.size() << "but got" << dst.size(), );
+
+    for(std::size_t i = 0, max = dst.size(); i != max; ++i)
+        dst[i] = true;
+
+    for(const Vector4<T>& plane: frustum) {
+        const Vector3<T> normal = plane.xyz();
+        const Vector3<T> absNormal = Math::abs(normal);
+        const T w = plane.w();
+        for(std::size_t i = 0, max = dst.size(); i != max; ++i) {
+            const Vector3<T>& c = aabbCenters[i];
+            const Vector3<T>& e = aabbExtents[i];
+            const T d = c.x()*normal.x() + c.y()*normal.y() + c.z()*normal.z();
+            const T r = e.x()*absNormal.x() + e.y()*absNormal.y() + e.z()*absNormal.z();
+            dst[i] = dst[i] && !(d + r < -w);
+        }
+    }
+}
+
+template<class T> void sphereFrustumIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Vector3<T>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const T>& sphereRadii, const Frustum<T>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereFrustumInto(): expected views of the same size but got" << sphereCenters.size() << "and" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == dst.size(),
+        "Math::Intersection::sphereFrustumInto(): expected destination view size" << sphereCenters.size() << "but got" << dst.size(), );
+
+    for(std::size_t i = 0, max = dst.size(); i != max; ++i)
+        dst[i] = true;
+
+    for(const Vector4<T>& plane: frustum) {
+        const Vector3<T> normal = plane.xyz();
+        const T w = plane.w();
+        /* The distance is scaled by the normal length, so scale the radius as
+           well instead of normalizing the plane */
+        const T normalLength = normal.length();
+        for(std::size_t i = 0, max = dst.size(); i != max; ++i) {
+            const Vector3<T>& c = sphereCenters[i];
+            const T distance = c.x()*normal.x() + c.y()*normal.y() + c.z()*normal.z() + w;
+            dst[i] = dst[i] && !(distance < -sphereRadii[i]*normalLength);
+        }
+    }
+}
+
+}
+
+void aabbFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    aabbFrustumIntoImplementation(aabbCenters, aabbExtents, frustum, dst);
+}
+
+void aabbFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& aabbExtents, const Frustum<Double>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    aabbFrustumIntoImplementation(aabbCenters, aabbExtents, frustum, dst);
+}
+
+void sphereFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    sphereFrustumIntoImplementation(sphereCenters, sphereRadii, frustum, dst);
+}
+
+void sphereFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Double>& sphereRadii, const Frustum<Double>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst) {
+    sphereFrustumIntoImplementation(sphereCenters, sphereRadii, frustum, dst);
+}
+
+}}}
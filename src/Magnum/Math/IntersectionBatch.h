@@ -0,0 +1,105 @@
+#ifndef Magnum_Math_IntersectionBatch_h
+#define Magnum_Math_IntersectionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Intersection::aabbFrustumInto(), @ref Magnum::Math::Intersection::sphereFrustumInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Math/Math.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+/**
+@{ @name Batch intersection functions
+
+These functions test an unbounded range of shapes against a single frustum, as
+opposed to the single-shape variants in @ref Intersection.h. The frustum
+planes are iterated in the outer loop and the shapes in the inner loop, which
+makes the inner operations independent of each other and thus vectorizable.
+*/
+
+/**
+@brief Intersection of a range of axis-aligned boxes and a frustum
+@param[in]  aabbCenters     Centers of the AABBs
+@param[in]  aabbExtents     (Half-)extents of the AABBs
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] dst             Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref aabbFrustum() for every item, putting
+@cpp true @ce to @p dst for boxes that intersect the frustum and
+@cpp false @ce otherwise. Expects that @p aabbCenters, @p aabbExtents and
+@p dst have the same size.
+*/
+MAGNUM_EXPORT void aabbFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void aabbFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& aabbExtents, const Frustum<Double>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst);
+
+/**
+@brief Intersection of a range of spheres and a frustum
+@param[in]  sphereCenters   Sphere centers
+@param[in]  sphereRadii     Sphere radii
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] dst             Where to put the results
+@m_since_latest
+
+Puts @cpp true @ce to @p dst for spheres that intersect the frustum and
+@cpp false @ce otherwise. Expects that @p sphereCenters, @p sphereRadii and
+@p dst have the same size. The frustum planes don't need to be normalized.
+
+Unlike @ref sphereFrustum(), which compares the distance of the sphere center
+from each plane against a squared radius, this function compares it against
+the radius, which makes the result exact. The results thus differ from
+@ref sphereFrustum() for spheres with radius different from @cpp 1 @ce that
+are close to a frustum plane.
+*/
+MAGNUM_EXPORT void sphereFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void sphereFrustumInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Double>& sphereRadii, const Frustum<Double>& frustum, const Corrade::Containers::StridedArrayView1D<bool>& dst);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MatrixBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Operating on raw column-major data to avoid the generic RectangularMatrix
+   loops and the temporaries they create, which matter a lot especially in
+   debug builds. Each output column is a linear combination of the columns of
+   a, which is a pattern compilers reliably turn into four-wide vector
+   multiply-adds. The result is first put into a local array so the output is
+   allowed to alias any of the inputs. */
+template<class T> inline void multiplyMatrix4(const T* a, const T* b, T* out) {
+    T result[16];
+    for(std::size_t col = 0; col != 4; ++col) {
+        const T b0 = b[col*4 + 0];
+        const T b1 = b[col*4 + 1];
+        const T b2 = b[col*4 + 2];
+        const T b3 = b[col*4 + 3];
+        for(std::size_t row = 0; row != 4; ++row)
+            result[col*4 + row] = a[row]*b0 + a[4 + row]*b1 + a[8 + row]*b2 + a[12 + row]*b3;
+    }
+    for(std::size_t i = 0; i != 16; ++i) out[i] = result[i];
+}
+
+template<class T> void multiplyIntoImplementation(const Matrix4<T>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<T>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<T>>& dst) {
+    CORRADE_ASSERT(b.size() == dst.size(),
+        "Math::multiplyInto(): expected destination view size" << b.size() << "but got" << dst.size(), );
+
+    /* Copying the shared matrix to a local so the compiler doesn't need to
+       assume it aliases the output */
+    T aData[16];
+    for(std::size_t i = 0; i != 16; ++i) aData[i] = a.data()[i];
+
+    const char* bPtr = reinterpret_cast<const char*>(b.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t bStride = b.stride();
+    const std::ptrdiff_t dstStride = dst.stride();
+    for(std::size_t i = 0, max = b.size(); i != max; ++i) {
+        multiplyMatrix4(aData, reinterpret_cast<const T*>(bPtr), reinterpret_cast<T*>(dstPtr));
+        bPtr += bStride;
+        dstPtr += dstStride;
+    }
+}
+
+template<class T> void multiplyIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Matrix4<T>>& a, const Matrix4<T>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<T>>& dst) {
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::multiplyInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+
+    T bData[16];
+    for(std::size_t i = 0; i != 16; ++i) bData[i] = b.data()[i];
+
+    const char* aPtr = reinterpret_cast<const char*>(a.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t aStride = a.stride();
+    const std::ptrdiff_t dstStride = dst.stride();
+    for(std::size_t i = 0, max = a.size(); i != max; ++i) {
+        multiplyMatrix4(reinterpret_cast<const T*>(aPtr), bData, reinterpret_cast<T*>(dstPtr));
+        aPtr += aStride;
+        dstPtr += dstStride;
+    }
+}
+
+template<class T> void multiplyIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Matrix4<T>>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<T>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<T>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::multiplyInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::multiplyInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+
+    const char* aPtr = reinterpret_cast<const char*>(a.data());
+    const char* bPtr = reinterpret_cast<const char*>(b.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t aStride = a.stride();
+    const std::ptrdiff_t bStride = b.stride();
+    const std::ptrdiff_t dstStride = dst.stride();
+    for(std::size_t i = 0, max = a.size(); i != max; ++i) {
+        multiplyMatrix4(reinterpret_cast<const T*>(aPtr), reinterpret_cast<const T*>(bPtr), reinterpret_cast<T*>(dstPtr));
+        aPtr += aStride;
+        bPtr += bStride;
+        dstPtr += dstStride;
+    }
+}
+
+/* Rotation part of Quaternion::toMatrix(), with each column additionally
+   multiplied by a scale */
+template<class T> inline void rotationScaling(const Vector3<T>& v, const T s, const Vector3<T>& scaling, T* out) {
+    const T xx = v.x()*v.x();
+    const T yy = v.y()*v.y();
+    const T zz = v.z()*v.z();
+    const T xy = v.x()*v.y();
+    const T xz = v.x()*v.z();
+    const T yz = v.y()*v.z();
+    const T xs = v.x()*s;
+    const T ys = v.y()*s;
+    const T zs = v.z()*s;
+
+    out[0] = (T(1) - T(2)*(yy + zz))*scaling.x();
+    out[1] = T(2)*(xy + zs)*scaling.x();
+    out[2] = T(2)*(xz - ys)*scaling.x();
+    out[3] = T(0);
+
+    out[4] = T(2)*(xy - zs)*scaling.y();
+    out[5] = (T(1) - T(2)*(xx + zz))*scaling.y();
+    out[6] = T(2)*(yz + xs)*scaling.y();
+    out[7] = T(0);
+
+    out[8] = T(2)*(xz + ys)*scaling.z();
+    out[9] = T(2)*(yz - xs)*scaling.z();
+    out[10] = (T(1) - T(2)*(xx + yy))*scaling.z();
+    out[11] = T(0);
+}
+
+template<class T> void transformationMatrixIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Vector3<T>>& translations, const Corrade::Containers::StridedArrayView1D<const Quaternion<T>>& rotations, const Corrade::Containers::StridedArrayView1D<const Vector3<T>>& scalings, const Corrade::Containers::StridedArrayView1D<Matrix4<T>>& dst) {
+    CORRADE_ASSERT(translations.size() == rotations.size() && translations.size() == scalings.size(),
+        "Math::transformationMatrixInto(): expected views of the same size but got" << translations.size() << Corrade::Utility::Debug::nospace << "," << rotations.size() << "and" << scalings.size(), );
+    CORRADE_ASSERT(translations.size() == dst.size(),
+        "Math::transformationMatrixInto(): expected destination view size" << translations.size() << "but got" << dst.size(), );
+
+    for(std::size_t i = 0, max = dst.size(); i != max; ++i) {
+        const Quaternion<T>& rotation = rotations[i];
+        const Vector3<T>& translation = translations[i];
+        T* out = dst[i].data();
+        rotationScaling(rotation.vector(), rotation.scalar(), scalings[i], out);
+        out[12] = translation.x();
+        out[13] = translation.y();
+        out[14] = translation.z();
+        out[15] = T(1);
+    }
+}
+
+template<class T> void transformationMatrixIntoImplementation(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<T>>& src, const Corrade::Containers::StridedArrayView1D<Matrix4<T>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformationMatrixInto(): expected destination view size" << src.size() << "but got" << dst.size(), );
+
+    const Vector3<T> unitScaling{T(1)};
+    for(std::size_t i = 0, max = src.size(); i != max; ++i) {
+        const DualQuaternion<T>& dq = src[i];
+        const Vector3<T>& rv = dq.real().vector();
+        const T rs = dq.real().scalar();
+        const Vector3<T>& dv = dq.dual().vector();
+        const T ds = dq.dual().scalar();
+        T* out = dst[i].data();
+        rotationScaling(rv, rs, unitScaling, out);
+
+        /* Equivalent to (dual*real.conjugated()).vector()*2 as done in
+           DualQuaternion::translation(), expanded to avoid calculating the
+           unused scalar part */
+        const Vector3<T> translation = T(2)*(rs*dv - ds*rv + cross(rv, dv));
+        out[12] = translation.x();
+        out[13] = translation.y();
+        out[14] = translation.z();
+        out[15] = T(1);
+    }
+}
+
+template<class T> void normalMatrixIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Matrix4<T>>& src, const Corrade::Containers::StridedArrayView1D<Matrix3x3<T>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::normalMatrixInto(): expected destination view size" << src.size() << "but got" << dst.size(), );
+
+    for(std::size_t i = 0, max = src.size(); i != max; ++i) {
+        const Matrix4<T>& matrix = src[i];
+        const Vector3<T> a = matrix[0].xyz();
+        const Vector3<T> b = matrix[1].xyz();
+        const Vector3<T> c = matrix[2].xyz();
+
+        /* The comatrix of a 3x3 matrix consists of cross products of its
+           columns, which is significantly cheaper than going through the
+           generic cofactor calculation in Matrix::comatrix() */
+        Matrix3x3<T>& out = dst[i];
+        out[0] = cross(b, c);
+        out[1] = cross(c, a);
+        out[2] = cross(a, b);
+    }
+}
+
+}
+
+void multiplyInto(const Matrix4<Float>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void multiplyInto(const Matrix4<Double>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Matrix4<Float>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& a, const Matrix4<Double>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst) {
+    multiplyIntoImplementation(a, b, dst);
+}
+
+void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& translations, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& rotations, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& scalings, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    transformationMatrixIntoImplementation(translations, rotations, scalings, dst);
+}
+
+void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& translations, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& rotations, const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& scalings, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst) {
+    transformationMatrixIntoImplementation(translations, rotations, scalings, dst);
+}
+
+void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& src, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    transformationMatrixIntoImplementation(src, dst);
+}
+
+void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& src, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst) {
+    transformationMatrixIntoImplementation(src, dst);
+}
+
+void normalMatrixInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& src, const Corrade::Containers::StridedArrayView1D<Matrix3x3<Float>>& dst) {
+    normalMatrixIntoImplementation(src, dst);
+}
+
+void normalMatrixInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& src, const Corrade::Containers::StridedArrayView1D<Matrix3x3<Double>>& dst) {
+    normalMatrixIntoImplementation(src, dst);
+}
+
+}}
@@ -0,0 +1,186 @@
+#ifndef Magnum_Math_MatrixBatch_h
+#define Magnum_Math_MatrixBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::multiplyInto(), @ref Magnum::Math::transformationMatrixInto(), @ref Magnum::Math::normalMatrixInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Math/Math.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch transformation functions
+
+These functions process an unbounded range of transformations, as opposed to
+single matrices or quaternions. Compared to calling the corresponding
+single-value operations in a loop, the implementation is unrolled for the
+fixed matrix sizes, avoids temporaries and is laid out so the compiler can
+vectorize the inner operations.
+*/
+
+/**
+@brief Multiply a matrix with a range of matrices
+@param[in]  a       Left-hand-side matrix
+@param[in]  b       Right-hand-side matrices
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calculating @cpp a*b[i] @ce for every item in @p b, useful for
+example to apply a common parent or camera transformation to a list of
+objects. Expects that @p b and @p dst have the same size. The @p dst view is
+allowed to alias @p b.
+@see @ref Matrix4::operator*()
+*/
+MAGNUM_EXPORT void multiplyInto(const Matrix4<Float>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void multiplyInto(const Matrix4<Double>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst);
+
+/**
+@brief Multiply a range of matrices with a matrix
+@param[in]  a       Left-hand-side matrices
+@param[in]  b       Right-hand-side matrix
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calculating @cpp a[i]*b @ce for every item in @p a. Expects that
+@p a and @p dst have the same size. The @p dst view is allowed to alias @p a.
+@see @ref Matrix4::operator*()
+*/
+MAGNUM_EXPORT void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Matrix4<Float>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& a, const Matrix4<Double>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst);
+
+/**
+@brief Multiply two ranges of matrices
+@param[in]  a       Left-hand-side matrices
+@param[in]  b       Right-hand-side matrices
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calculating @cpp a[i]*b[i] @ce for every item, useful for
+example to combine per-object parent and local transformations. Expects that
+@p a, @p b and @p dst have the same size. The @p dst view is allowed to alias
+either @p a or @p b.
+@see @ref Matrix4::operator*()
+*/
+MAGNUM_EXPORT void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void multiplyInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& b, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst);
+
+/**
+@brief Create transformation matrices from translation, rotation and scaling
+@param[in]  translations    Translations
+@param[in]  rotations       Rotations
+@param[in]  scalings        Scalings
+@param[out] dst             Destination matrices
+@m_since_latest
+
+Equivalent to calculating the following for every item, but without any
+intermediate matrix multiplications: @m_class{m-noindent}
+
+@cpp
+Matrix4::translation(translations[i])*
+Matrix4::from(rotations[i].toMatrix(), {})*
+Matrix4::scaling(scalings[i])
+@ce
+
+Expects that all views have the same size and that the quaternions are
+normalized, the normalization is however not checked for performance reasons.
+@see @ref Matrix4::translation(), @ref Quaternion::toMatrix(),
+    @ref Matrix4::scaling()
+*/
+MAGNUM_EXPORT void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& translations, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& rotations, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& scalings, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& translations, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& rotations, const Corrade::Containers::StridedArrayView1D<const Vector3<Double>>& scalings, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst);
+
+/**
+@brief Convert dual quaternions to transformation matrices
+@param[in]  src     Source dual quaternions
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calling @ref DualQuaternion::toMatrix() for every item. Expects
+that @p src and @p dst have the same size and that the dual quaternions are
+normalized, the normalization is however not checked for performance reasons.
+*/
+MAGNUM_EXPORT void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& src, const Corrade::Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void transformationMatrixInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& src, const Corrade::Containers::StridedArrayView1D<Matrix4<Double>>& dst);
+
+/**
+@brief Extract normal matrices from a range of transformation matrices
+@param[in]  src     Source transformation matrices
+@param[out] dst     Destination normal matrices
+@m_since_latest
+
+Equivalent to calling @ref Matrix4::normalMatrix() for every item, but
+calculating the comatrix directly as cross products of the upper-left 3x3 part
+columns. Expects that @p src and @p dst have the same size.
+*/
+MAGNUM_EXPORT void normalMatrixInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Float>>& src, const Corrade::Containers::StridedArrayView1D<Matrix3x3<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void normalMatrixInto(const Corrade::Containers::StridedArrayView1D<const Matrix4<Double>>& src, const Corrade::Containers::StridedArrayView1D<Matrix3x3<Double>>& dst);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -0,0 +1,410 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "QuaternionBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Items are processed in blocks of this size. The block is transposed into
+   arrays of separate components, every calculation step is then a loop over
+   the whole block that the compiler can turn into SIMD operations regardless
+   of the input stride. */
+enum: std::size_t { BlockSize = 8 };
+
+/* Truncated power series of sin(tθ)/sin(θ) in x - 1, where x = cos(θ), from
+   "A Fast and Accurate Estimate for SLERP" by David Eberly. Term i is
+   multiplied by (t² - i²)/(i(2i + 1))(x - 1), the last one additionally by a
+   factor that compensates for the truncation. With 14 terms and the factor
+   minimizing the error over t in [0, 1] and θ in [0, π/2], which is the range
+   left after picking the shortest path, the error is below 2e-7. */
+constexpr Float SlerpSeriesMu = 1.9066f;
+constexpr Float SlerpSeriesU[]{
+    1.0f/(1*3), 1.0f/(2*5), 1.0f/(3*7), 1.0f/(4*9), 1.0f/(5*11),
+    1.0f/(6*13), 1.0f/(7*15), 1.0f/(8*17), 1.0f/(9*19), 1.0f/(10*21),
+    1.0f/(11*23), 1.0f/(12*25), 1.0f/(13*27), SlerpSeriesMu/(14*29)
+};
+constexpr Float SlerpSeriesV[]{
+    1.0f/3, 2.0f/5, 3.0f/7, 4.0f/9, 5.0f/11,
+    6.0f/13, 7.0f/15, 8.0f/17, 9.0f/19, 10.0f/21,
+    11.0f/23, 12.0f/25, 13.0f/27, SlerpSeriesMu*14/29
+};
+
+/* Calculates sin((1 - t)θ)/sin(θ) and sin(tθ)/sin(θ) for a block, with
+   cosAngle being cos(θ) in [0, 1] */
+void slerpFactors(const Float(&cosAngle)[BlockSize], const Float(&t)[BlockSize], Float(&factorA)[BlockSize], Float(&factorB)[BlockSize]) {
+    /* Operating on local arrays so the compiler doesn't need to assume the
+       outputs alias each other */
+    Float xm1[BlockSize], squaredA[BlockSize], squaredB[BlockSize], a[BlockSize], b[BlockSize];
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        xm1[l] = cosAngle[l] - 1.0f;
+        squaredA[l] = (1.0f - t[l])*(1.0f - t[l]);
+        squaredB[l] = t[l]*t[l];
+        a[l] = 1.0f;
+        b[l] = 1.0f;
+    }
+
+    for(std::size_t i = Corrade::Containers::arraySize(SlerpSeriesU); i != 0; --i) {
+        const Float u = SlerpSeriesU[i - 1];
+        const Float v = SlerpSeriesV[i - 1];
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            a[l] = 1.0f + (u*squaredA[l] - v)*xm1[l]*a[l];
+            b[l] = 1.0f + (u*squaredB[l] - v)*xm1[l]*b[l];
+        }
+    }
+
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        factorA[l] = a[l]*(1.0f - t[l]);
+        factorB[l] = b[l]*t[l];
+    }
+}
+
+/* The series converges too slowly to reach full double precision, so here
+   it's done the same way as in slerpShortestPath() */
+void slerpFactors(const Double(&cosAngle)[BlockSize], const Double(&t)[BlockSize], Double(&factorA)[BlockSize], Double(&factorB)[BlockSize]) {
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        if(cosAngle[l] >= 1.0 - TypeTraits<Double>::epsilon()) {
+            factorA[l] = 1.0 - t[l];
+            factorB[l] = t[l];
+        } else {
+            const Double a = std::acos(cosAngle[l]);
+            const Double invSinA = 1.0/std::sin(a);
+            factorA[l] = std::sin((1.0 - t[l])*a)*invSinA;
+            factorB[l] = std::sin(t[l]*a)*invSinA;
+        }
+    }
+}
+
+/* Copies up to BlockSize items of given component count into separate
+   arrays. The remaining lanes of a partial block get an identity so the
+   calculation doesn't produce any NaNs there. */
+template<std::size_t components, class T> inline void loadBlock(const char* data, const std::ptrdiff_t stride, const std::size_t count, T(&out)[components][BlockSize]) {
+    for(std::size_t l = 0; l != BlockSize; ++l) {
+        if(l < count) {
+            const T* item = reinterpret_cast<const T*>(data + std::ptrdiff_t(l)*stride);
+            for(std::size_t c = 0; c != components; ++c)
+                out[c][l] = item[c];
+        } else for(std::size_t c = 0; c != components; ++c)
+            out[c][l] = c == 3 ? T(1) : T(0);
+    }
+}
+
+template<class T> inline void loadFactors(const char* data, const std::ptrdiff_t stride, const std::size_t count, T(&out)[BlockSize]) {
+    for(std::size_t l = 0; l != BlockSize; ++l)
+        out[l] = l < count ? *reinterpret_cast<const T*>(data + std::ptrdiff_t(l)*stride) : T(0);
+}
+
+template<std::size_t components, class T> inline void storeBlock(const T(&in)[components][BlockSize], char* data, const std::ptrdiff_t stride, const std::size_t count) {
+    for(std::size_t l = 0; l != count; ++l) {
+        T* item = reinterpret_cast<T*>(data + std::ptrdiff_t(l)*stride);
+        for(std::size_t c = 0; c != components; ++c)
+            item[c] = in[c][l];
+    }
+}
+
+template<std::size_t components, class T, class Kernel> inline void interpolateBlock(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t count, Kernel kernel) {
+    T qa[components][BlockSize], qb[components][BlockSize], factors[BlockSize];
+    loadBlock(a, aStride, count, qa);
+    loadBlock(b, bStride, count, qb);
+    loadFactors(t, tStride, count, factors);
+
+    /* Everything is loaded before storing so the output can alias the
+       inputs */
+    T out[components][BlockSize];
+    kernel(qa, qb, factors, out);
+    storeBlock(out, dst, dstStride, count);
+}
+
+/* Full blocks are processed separately from the remainder so the loads and
+   stores have a compile-time item count there */
+template<class T, class Item, class Kernel> void interpolateBlocks(const Corrade::Containers::StridedArrayView1D<const Item>& a, const Corrade::Containers::StridedArrayView1D<const Item>& b, const Corrade::Containers::StridedArrayView1D<const T>& t, const Corrade::Containers::StridedArrayView1D<Item>& dst, Kernel kernel) {
+    constexpr std::size_t components = sizeof(Item)/sizeof(T);
+    const char* aPtr = reinterpret_cast<const char*>(a.data());
+    const char* bPtr = reinterpret_cast<const char*>(b.data());
+    const char* tPtr = reinterpret_cast<const char*>(t.data());
+    char* dstPtr = reinterpret_cast<char*>(dst.data());
+    const std::ptrdiff_t aBlockStride = a.stride()*BlockSize;
+    const std::ptrdiff_t bBlockStride = b.stride()*BlockSize;
+    const std::ptrdiff_t tBlockStride = t.stride()*BlockSize;
+    const std::ptrdiff_t dstBlockStride = dst.stride()*BlockSize;
+
+    std::size_t i = 0;
+    for(const std::size_t max = a.size(); i + BlockSize <= max; i += BlockSize) {
+        interpolateBlock<components, T>(aPtr, a.stride(), bPtr, b.stride(), tPtr, t.stride(), dstPtr, dst.stride(), BlockSize, kernel);
+        aPtr += aBlockStride;
+        bPtr += bBlockStride;
+        tPtr += tBlockStride;
+        dstPtr += dstBlockStride;
+    }
+
+    if(i != a.size())
+        interpolateBlock<components, T>(aPtr, a.stride(), bPtr, b.stride(), tPtr, t.stride(), dstPtr, dst.stride(), a.size() - i, kernel);
+}
+
+/* Quaternion product of single lanes, components in XYZW order */
+template<class T> inline void multiply(const T ax, const T ay, const T az, const T aw, const T bx, const T by, const T bz, const T bw, T& x, T& y, T& z, T& w) {
+    x = aw*bx + bw*ax + ay*bz - az*by;
+    y = aw*by + bw*ay + az*bx - ax*bz;
+    z = aw*bz + bw*az + ax*by - ay*bx;
+    w = aw*bw - ax*bx - ay*by - az*bz;
+}
+
+struct LerpShortestPath {
+    template<class T> void operator()(const T(&qa)[4][BlockSize], const T(&qb)[4][BlockSize], const T(&t)[BlockSize], T(&out)[4][BlockSize]) const {
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const T d = qa[0][l]*qb[0][l] + qa[1][l]*qb[1][l] + qa[2][l]*qb[2][l] + qa[3][l]*qb[3][l];
+            const T factorA = d < T(0) ? t[l] - T(1) : T(1) - t[l];
+            const T x = factorA*qa[0][l] + t[l]*qb[0][l];
+            const T y = factorA*qa[1][l] + t[l]*qb[1][l];
+            const T z = factorA*qa[2][l] + t[l]*qb[2][l];
+            const T w = factorA*qa[3][l] + t[l]*qb[3][l];
+            const T invLength = T(1)/std::sqrt(x*x + y*y + z*z + w*w);
+            out[0][l] = x*invLength;
+            out[1][l] = y*invLength;
+            out[2][l] = z*invLength;
+            out[3][l] = w*invLength;
+        }
+    }
+};
+
+struct SlerpShortestPath {
+    template<class T> void operator()(const T(&qa)[4][BlockSize], const T(&qb)[4][BlockSize], const T(&t)[BlockSize], T(&out)[4][BlockSize]) const {
+        /* Flip the first quaternion if the dot product is negative to
+           interpolate on the shortest path, the same as slerpShortestPath()
+           does */
+        T cosHalfAngle[BlockSize], sign[BlockSize];
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const T d = qa[0][l]*qb[0][l] + qa[1][l]*qb[1][l] + qa[2][l]*qb[2][l] + qa[3][l]*qb[3][l];
+            sign[l] = d < T(0) ? T(-1) : T(1);
+            cosHalfAngle[l] = d*sign[l];
+        }
+
+        T factorA[BlockSize], factorB[BlockSize];
+        slerpFactors(cosHalfAngle, t, factorA, factorB);
+
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const T signedFactorA = sign[l]*factorA[l];
+            for(std::size_t c = 0; c != 4; ++c)
+                out[c][l] = signedFactorA*qa[c][l] + factorB[l]*qb[c][l];
+        }
+    }
+};
+
+/* Components 0-3 are the real part, 4-7 the dual part */
+struct SclerpShortestPath {
+    template<class T> void operator()(const T(&qa)[8][BlockSize], const T(&qb)[8][BlockSize], const T(&t)[BlockSize], T(&out)[8][BlockSize]) const {
+        /* l + εm = q_A^*q_B, with q_B negated if the dot product of the real
+           parts is negative to interpolate on the shortest path. The scalar
+           part of l is then the cosine of the half-angle, in [0, 1]. */
+        T diffReal[4][BlockSize], diffDual[4][BlockSize];
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            const T d = qa[0][l]*qb[0][l] + qa[1][l]*qb[1][l] + qa[2][l]*qb[2][l] + qa[3][l]*qb[3][l];
+            const T sign = d < T(0) ? T(-1) : T(1);
+            const T bx = sign*qb[0][l], by = sign*qb[1][l], bz = sign*qb[2][l], bw = sign*qb[3][l];
+            const T bdx = sign*qb[4][l], bdy = sign*qb[5][l], bdz = sign*qb[6][l], bdw = sign*qb[7][l];
+
+            multiply(-qa[0][l], -qa[1][l], -qa[2][l], qa[3][l], bx, by, bz, bw,
+                diffReal[0][l], diffReal[1][l], diffReal[2][l], diffReal[3][l]);
+            T m1x, m1y, m1z, m1w, m2x, m2y, m2z, m2w;
+            multiply(-qa[0][l], -qa[1][l], -qa[2][l], qa[3][l], bdx, bdy, bdz, bdw,
+                m1x, m1y, m1z, m1w);
+            multiply(-qa[4][l], -qa[5][l], -qa[6][l], qa[7][l], bx, by, bz, bw,
+                m2x, m2y, m2z, m2w);
+            diffDual[0][l] = m1x + m2x;
+            diffDual[1][l] = m1y + m2y;
+            diffDual[2][l] = m1z + m2z;
+            diffDual[3][l] = m1w + m2w;
+        }
+
+        T factorA[BlockSize], factorB[BlockSize];
+        slerpFactors(diffReal[3], t, factorA, factorB);
+
+        for(std::size_t l = 0; l != BlockSize; ++l) {
+            /* The rotation angle is θ = acos(l_S), r = |l_V| = sin(θ).
+               Expressed using the slerp factors, sin(tθ) = factorB*r and
+               cos(tθ) = factorA + l_S*factorB. The dual part of the angle is
+               a_ε = -m_S/r. Substituting these into the
+               n*sin(t*a/2) + cos(t*a/2) dual quaternion from
+               sclerpShortestPath() leaves just a single division. */
+            const T lS = diffReal[3][l];
+            const T rSquared = diffReal[0][l]*diffReal[0][l] + diffReal[1][l]*diffReal[1][l] + diffReal[2][l]*diffReal[2][l];
+            const T cosT = factorA[l] + lS*factorB[l];
+            const T mS = diffDual[3][l];
+            const T k = -mS/rSquared*(t[l]*cosT - lS*factorB[l]);
+
+            const T rx = diffReal[0][l]*factorB[l];
+            const T ry = diffReal[1][l]*factorB[l];
+            const T rz = diffReal[2][l]*factorB[l];
+            const T rw = cosT;
+            const T dx = diffReal[0][l]*k + diffDual[0][l]*factorB[l];
+            const T dy = diffReal[1][l]*k + diffDual[1][l]*factorB[l];
+            const T dz = diffReal[2][l]*k + diffDual[2][l]*factorB[l];
+            const T dw = t[l]*mS*factorB[l];
+
+            /* q_ScLERP = q_A*(real + εdual) */
+            T outReal[4], outDual1[4], outDual2[4];
+            multiply(qa[0][l], qa[1][l], qa[2][l], qa[3][l], rx, ry, rz, rw,
+                outReal[0], outReal[1], outReal[2], outReal[3]);
+            multiply(qa[0][l], qa[1][l], qa[2][l], qa[3][l], dx, dy, dz, dw,
+                outDual1[0], outDual1[1], outDual1[2], outDual1[3]);
+            multiply(qa[4][l], qa[5][l], qa[6][l], qa[7][l], rx, ry, rz, rw,
+                outDual2[0], outDual2[1], outDual2[2], outDual2[3]);
+
+            /* If the rotations are nearly the same, the above is all NaNs and
+               just the translation gets interpolated, with the same condition
+               as in sclerpShortestPath(). Translation of q is 2(q_ε q_0^*)_V
+               and the result is q_A0 + ε[translation/2, 0]*q_A0. */
+            T ta[4], tb[4];
+            multiply(qa[4][l], qa[5][l], qa[6][l], qa[7][l], -qa[0][l], -qa[1][l], -qa[2][l], qa[3][l],
+                ta[0], ta[1], ta[2], ta[3]);
+            multiply(qb[4][l], qb[5][l], qb[6][l], qb[7][l], -qb[0][l], -qb[1][l], -qb[2][l], qb[3][l],
+                tb[0], tb[1], tb[2], tb[3]);
+            T translationDual[4];
+            multiply((T(1) - t[l])*ta[0] + t[l]*tb[0],
+                     (T(1) - t[l])*ta[1] + t[l]*tb[1],
+                     (T(1) - t[l])*ta[2] + t[l]*tb[2], T(0),
+                qa[0][l], qa[1][l], qa[2][l], qa[3][l],
+                translationDual[0], translationDual[1], translationDual[2], translationDual[3]);
+
+            const bool degenerate = lS >= T(1) - TypeTraits<T>::epsilon();
+            for(std::size_t c = 0; c != 4; ++c) {
+                out[c][l] = degenerate ? qa[c][l] : outReal[c];
+                out[4 + c][l] = degenerate ? translationDual[c] : outDual1[c] + outDual2[c];
+            }
+        }
+    }
+};
+
+}
+
+void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, LerpShortestPath{});
+}
+
+void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, LerpShortestPath{});
+}
+
+void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Float t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Float>{{&t, 1}, a.size(), 0}, dst, LerpShortestPath{});
+}
+
+void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Double t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Double>{{&t, 1}, a.size(), 0}, dst, LerpShortestPath{});
+}
+
+void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, SlerpShortestPath{});
+}
+
+void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, SlerpShortestPath{});
+}
+
+void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Float t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Float>{{&t, 1}, a.size(), 0}, dst, SlerpShortestPath{});
+}
+
+void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Double t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Double>{{&t, 1}, a.size(), 0}, dst, SlerpShortestPath{});
+}
+
+void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::sclerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::sclerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, SclerpShortestPath{});
+}
+
+void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == t.size(),
+        "Math::sclerpShortestPathInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << "and" << t.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::sclerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    interpolateBlocks(a, b, t, dst, SclerpShortestPath{});
+}
+
+void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& b, const Float t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::sclerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::sclerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Float>{{&t, 1}, a.size(), 0}, dst, SclerpShortestPath{});
+}
+
+void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& b, const Double t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Double>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::sclerpShortestPathInto(): expected views of the same size but got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::sclerpShortestPathInto(): expected destination view size" << a.size() << "but got" << dst.size(), );
+    /* A zero-stride view repeating the single value */
+    interpolateBlocks(a, b, Corrade::Containers::StridedArrayView1D<const Double>{{&t, 1}, a.size(), 0}, dst, SclerpShortestPath{});
+}
+
+}}
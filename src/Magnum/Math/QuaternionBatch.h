@@ -0,0 +1,199 @@
+#ifndef Magnum_Math_QuaternionBatch_h
+#define Magnum_Math_QuaternionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::lerpShortestPathInto(), @ref Magnum::Math::slerpShortestPathInto(), @ref Magnum::Math::sclerpShortestPathInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Math/Math.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch quaternion interpolation functions
+
+These functions interpolate an unbounded range of quaternion or dual
+quaternion pairs, as opposed to single values. The items are processed in
+blocks that are transposed to a structure-of-arrays layout, so each step of
+the calculation is done for the whole block at once and the compiler can
+vectorize it. All variants interpolate on the shortest path, matching the
+single-value functions they're named after. For all of them it's expected
+that the inputs are normalized, the normalization is however not checked for
+performance reasons.
+*/
+
+/**
+@brief Linear shortest-path interpolation of a range of quaternions
+@param[in]  a       First quaternions
+@param[in]  b       Second quaternions
+@param[in]  t       Interpolation phases
+@param[out] dst     Destination quaternions
+@m_since_latest
+
+Equivalent to calling
+@ref lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T) with
+@cpp a[i] @ce, @cpp b[i] @ce and @cpp t[i] @ce for every item. Expects that
+@p a, @p b, @p t and @p dst have the same size. The @p dst view is allowed to
+alias either @p a or @p b.
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst);
+
+/**
+@brief Linear shortest-path interpolation of a range of quaternions with a shared interpolation phase
+@param[in]  a       First quaternions
+@param[in]  b       Second quaternions
+@param[in]  t       Interpolation phase
+@param[out] dst     Destination quaternions
+@m_since_latest
+
+Same as the overload above, but with @p t used for all items.
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, Float t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, Double t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst);
+
+/**
+@brief Spherical linear shortest-path interpolation of a range of quaternions
+@param[in]  a       First quaternions
+@param[in]  b       Second quaternions
+@param[in]  t       Interpolation phases
+@param[out] dst     Destination quaternions
+@m_since_latest
+
+Equivalent to calling
+@ref slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T) with
+@cpp a[i] @ce, @cpp b[i] @ce and @cpp t[i] @ce for every item. Expects that
+@p a, @p b, @p t and @p dst have the same size. The @p dst view is allowed to
+alias either @p a or @p b.
+
+For @ref Magnum::Float "Float" the interpolation coefficients
+@f$ \frac{\sin((1 - t) \theta)}{\sin(\theta)} @f$ and
+@f$ \frac{\sin(t \theta)}{\sin(\theta)} @f$ are not calculated using
+trigonometric functions but with a truncated power series in
+@f$ \cos(\theta) - 1 @f$, as described in
+[A Fast and Accurate Estimate for SLERP](https://www.geometrictools.com/Documentation/FastAndAccurateSlerp.pdf)
+by David Eberly. The coefficients are within @f$ 2 \cdot 10^{-7} @f$ of the
+exact values, which is on par with the precision of the calculation done with
+@ref std::acos() and @ref std::sin(). For @ref Magnum::Double "Double" the
+series would need too many terms to reach the full precision and so the
+exact calculation is used.
+*/
+MAGNUM_EXPORT void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst);
+
+/**
+@brief Spherical linear shortest-path interpolation of a range of quaternions with a shared interpolation phase
+@param[in]  a       First quaternions
+@param[in]  b       Second quaternions
+@param[in]  t       Interpolation phase
+@param[out] dst     Destination quaternions
+@m_since_latest
+
+Same as the overload above, but with @p t used for all items.
+*/
+MAGNUM_EXPORT void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& b, Float t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const Quaternion<Double>>& b, Double t, const Corrade::Containers::StridedArrayView1D<Quaternion<Double>>& dst);
+
+/**
+@brief Screw linear shortest-path interpolation of a range of dual quaternions
+@param[in]  a       First dual quaternions
+@param[in]  b       Second dual quaternions
+@param[in]  t       Interpolation phases
+@param[out] dst     Destination dual quaternions
+@m_since_latest
+
+Equivalent to calling @ref sclerpShortestPath() with @cpp a[i] @ce,
+@cpp b[i] @ce and @cpp t[i] @ce for every item. Expects that @p a, @p b,
+@p t and @p dst have the same size. The @p dst view is allowed to alias either
+@p a or @p b.
+
+The screw motion is calculated without inverse trigonometric functions, using
+the same interpolation coefficients as
+@ref slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>&, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>&, const Corrade::Containers::StridedArrayView1D<const Float>&, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>&).
+Items with nearly the same rotation interpolate just the translation, the same
+as in the single-value variant.
+*/
+MAGNUM_EXPORT void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& b, const Corrade::Containers::StridedArrayView1D<const Double>& t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Double>>& dst);
+
+/**
+@brief Screw linear shortest-path interpolation of a range of dual quaternions with a shared interpolation phase
+@param[in]  a       First dual quaternions
+@param[in]  b       Second dual quaternions
+@param[in]  t       Interpolation phase
+@param[out] dst     Destination dual quaternions
+@m_since_latest
+
+Same as the overload above, but with @p t used for all items.
+*/
+MAGNUM_EXPORT void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Float>>& b, Float t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void sclerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& a, const Corrade::Containers::StridedArrayView1D<const DualQuaternion<Double>>& b, Double t, const Corrade::Containers::StridedArrayView1D<DualQuaternion<Double>>& dst);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -0,0 +1,256 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/ColorBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct ColorBatchTest: Corrade::TestSuite::Tester {
+    explicit ColorBatchTest();
+
+    void fromSrgb();
+    void fromSrgbAlpha();
+    void toSrgb();
+    void toSrgbAlpha();
+    void toSrgbOutOfRange();
+    void roundtrip();
+    void strided();
+
+    void assertions();
+};
+
+typedef Math::Color3<Float> Color3;
+typedef Math::Color4<Float> Color4;
+typedef Math::Vector3<UnsignedByte> Vector3ub;
+typedef Math::Vector4<UnsignedByte> Vector4ub;
+typedef Math::Constants<Float> Constants;
+
+ColorBatchTest::ColorBatchTest() {
+    addTests({&ColorBatchTest::fromSrgb,
+              &ColorBatchTest::fromSrgbAlpha,
+              &ColorBatchTest::toSrgb,
+              &ColorBatchTest::toSrgbAlpha,
+              &ColorBatchTest::toSrgbOutOfRange,
+              &ColorBatchTest::roundtrip,
+              &ColorBatchTest::strided,
+
+              &ColorBatchTest::assertions});
+}
+
+void ColorBatchTest::fromSrgb() {
+    Vector3ub src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = {UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i/2)};
+
+    Color3 dst[256];
+    fromSrgbInto(Corrade::Containers::arrayCast<2, const UnsignedByte>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, Float>(Corrade::Containers::stridedArrayView(dst)));
+
+    for(std::size_t i = 0; i != 256; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Color3::fromSrgb(src[i]));
+    }
+}
+
+void ColorBatchTest::fromSrgbAlpha() {
+    Vector4ub src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = {UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i/2), UnsignedByte(255 - i)};
+
+    Color4 dst[256];
+    fromSrgbAlphaInto(Corrade::Containers::arrayCast<2, const UnsignedByte>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, Float>(Corrade::Containers::stridedArrayView(dst)));
+
+    for(std::size_t i = 0; i != 256; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Color4::fromSrgbAlpha(src[i]));
+    }
+}
+
+void ColorBatchTest::toSrgb() {
+    /* Going through the whole range with a step smaller than what's
+       representable in 8 bits */
+    enum: std::size_t { Count = 20001 };
+    Float src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Float(i)/Float(Count - 1);
+
+    UnsignedByte dst[Count];
+    toSrgbInto(Corrade::Containers::arrayCast<2, const Float>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, UnsignedByte>(Corrade::Containers::stridedArrayView(dst)));
+
+    /* The approximation is never more than 0.51 of a step off, which means
+       it differs from the exact calculation by one only if the exact value
+       lies very close to a rounding boundary */
+    Double maxError = 0.0;
+    Int maxDifference = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const Double exact = Math::Color3<Double>{Double(src[i])}.toSrgb()[0]*255.0;
+        const Int expected = Color3{src[i]}.toSrgb<UnsignedByte>()[0];
+        maxError = Math::max(maxError, Math::abs(dst[i] - exact));
+        maxDifference = Math::max(maxDifference, Math::abs(Int(dst[i]) - expected));
+    }
+
+    CORRADE_COMPARE_AS(maxError, 0.51,
+        Corrade::TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(maxDifference, 1,
+        Corrade::TestSuite::Compare::LessOrEqual);
+
+    CORRADE_COMPARE(dst[0], 0);
+    CORRADE_COMPARE(dst[Count - 1], 255);
+}
+
+void ColorBatchTest::toSrgbAlpha() {
+    const Color4 src[]{
+        {0.0f, 0.25f, 0.5f, 0.0f},
+        {0.75f, 1.0f, 0.1f, 0.5f},
+        {0.01f, 0.9f, 0.33f, 1.0f}
+    };
+
+    Vector4ub dst[3];
+    toSrgbAlphaInto(Corrade::Containers::arrayCast<2, const Float>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, UnsignedByte>(Corrade::Containers::stridedArrayView(dst)));
+
+    /* These are far enough from the rounding boundaries to match exactly */
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], src[i].toSrgbAlpha<UnsignedByte>());
+    }
+}
+
+void ColorBatchTest::toSrgbOutOfRange() {
+    const Float src[]{-1.0f, -0.0f, 1.5f, Constants::inf(), -Constants::inf(), Constants::nan(), 1.0e-10f};
+
+    UnsignedByte dst[7];
+    toSrgbInto(Corrade::Containers::arrayCast<2, const Float>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, UnsignedByte>(Corrade::Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[0], 0);
+    CORRADE_COMPARE(dst[1], 0);
+    CORRADE_COMPARE(dst[2], 255);
+    CORRADE_COMPARE(dst[3], 255);
+    CORRADE_COMPARE(dst[4], 0);
+    CORRADE_COMPARE(dst[5], 0);
+    CORRADE_COMPARE(dst[6], 0);
+}
+
+void ColorBatchTest::roundtrip() {
+    UnsignedByte src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = UnsignedByte(i);
+
+    Float linear[256];
+    UnsignedByte dst[256];
+    fromSrgbInto(Corrade::Containers::arrayCast<2, const UnsignedByte>(Corrade::Containers::stridedArrayView(src)),
+        Corrade::Containers::arrayCast<2, Float>(Corrade::Containers::stridedArrayView(linear)));
+    toSrgbInto(Corrade::Containers::arrayCast<2, const Float>(Corrade::Containers::stridedArrayView(linear)),
+        Corrade::Containers::arrayCast<2, UnsignedByte>(Corrade::Containers::stridedArrayView(dst)));
+
+    for(std::size_t i = 0; i != 256; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], src[i]);
+    }
+}
+
+void ColorBatchTest::strided() {
+    struct Pixel {
+        Vector4ub srgb;
+        Color4 linear;
+    } pixels[]{
+        {{0x00, 0x33, 0x66, 0x99}, {}},
+        {{0xcc, 0xff, 0x11, 0x44}, {}},
+        {{0x77, 0xaa, 0xdd, 0xee}, {}}
+    };
+
+    Corrade::Containers::StridedArrayView1D<Vector4ub> srgb{pixels, &pixels[0].srgb, 3, sizeof(Pixel)};
+    Corrade::Containers::StridedArrayView1D<Color4> linear{pixels, &pixels[0].linear, 3, sizeof(Pixel)};
+
+    /* Converting just the RGB part, the alpha stays zero */
+    fromSrgbInto(Corrade::Containers::arrayCast<2, const UnsignedByte>(srgb).prefix({3, 3}),
+        Corrade::Containers::arrayCast<2, Float>(linear).prefix({3, 3}));
+    CORRADE_COMPARE(pixels[0].linear, (Color4{Color3::fromSrgb(0x003366), 0.0f}));
+    CORRADE_COMPARE(pixels[1].linear, (Color4{Color3::fromSrgb(0xccff11), 0.0f}));
+    CORRADE_COMPARE(pixels[2].linear, (Color4{Color3::fromSrgb(0x77aadd), 0.0f}));
+
+    /* Converting back with alpha */
+    pixels[0].linear.a() = 0.6f;
+    pixels[1].linear.a() = 0.2667f;
+    pixels[2].linear.a() = 0.9333f;
+    for(Pixel& pixel: pixels) pixel.srgb = {};
+    toSrgbAlphaInto(Corrade::Containers::arrayCast<2, const Float>(linear),
+        Corrade::Containers::arrayCast<2, UnsignedByte>(srgb));
+    CORRADE_COMPARE(pixels[0].srgb, (Vector4ub{0x00, 0x33, 0x66, 0x99}));
+    CORRADE_COMPARE(pixels[1].srgb, (Vector4ub{0xcc, 0xff, 0x11, 0x44}));
+    CORRADE_COMPARE(pixels[2].srgb, (Vector4ub{0x77, 0xaa, 0xdd, 0xee}));
+}
+
+void ColorBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Vector3ub srgb[2]{};
+    Color3 linearWrongCount[1]{};
+    Color4 linearWrongVectorSize[2]{};
+    Math::Vector<6, Float> linearNonContiguous[2]{};
+
+    auto src = Corrade::Containers::arrayCast<2, UnsignedByte>(
+        Corrade::Containers::arrayView(srgb));
+    auto dstWrongCount = Corrade::Containers::arrayCast<2, Float>(
+        Corrade::Containers::arrayView(linearWrongCount));
+    auto dstWrongVectorSize = Corrade::Containers::arrayCast<2, Float>(
+        Corrade::Containers::arrayView(linearWrongVectorSize));
+    auto dstNotContiguous = Corrade::Containers::arrayCast<2, Float>(
+        Corrade::Containers::arrayView(linearNonContiguous)).every({1, 2});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    fromSrgbInto(src, dstWrongCount);
+    fromSrgbInto(src, dstWrongVectorSize);
+    fromSrgbInto(src, dstNotContiguous);
+    fromSrgbAlphaInto(src, dstWrongCount);
+    toSrgbInto(dstWrongCount, src);
+    toSrgbInto(dstNotContiguous, src);
+    toSrgbAlphaInto(dstWrongVectorSize, src);
+    CORRADE_COMPARE(out.str(),
+        "Math::fromSrgbInto(): wrong destination size, got {1, 3} but expected {2, 3}\n"
+        "Math::fromSrgbInto(): wrong destination size, got {2, 4} but expected {2, 3}\n"
+        "Math::fromSrgbInto(): second view dimension is not contiguous\n"
+        "Math::fromSrgbAlphaInto(): wrong destination size, got {1, 3} but expected {2, 3}\n"
+        "Math::toSrgbInto(): wrong destination size, got {2, 3} but expected {1, 3}\n"
+        "Math::toSrgbInto(): second view dimension is not contiguous\n"
+        "Math::toSrgbAlphaInto(): wrong destination size, got {2, 3} but expected {2, 4}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::ColorBatchTest)
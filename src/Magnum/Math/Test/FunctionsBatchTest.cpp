@@ -28,7 +28,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -44,6 +44,13 @@ struct FunctionsBatchTest: Corrade::TestSuite::Tester {
 
     void nanIgnoring();
     void nanIgnoringVector();
+
+    void minmaxLarge();
+    void minmaxLargeVector();
+    void minmaxLargeStrided();
+    void minmaxLargeNan();
+    void minmaxParallel();
+    void minmaxParallelNan();
 };
 
 using namespace Literals;
@@ -52,6 +59,8 @@ typedef Math::Constants<Float> Constants;
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Int> Vector3i;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector2<UnsignedInt> Vector2ui;
 
 FunctionsBatchTest::FunctionsBatchTest() {
     addTests({&FunctionsBatchTest::isInf,
@@ -62,7 +71,14 @@ FunctionsBatchTest::FunctionsBatchTest() {
               &FunctionsBatchTest::minmax,
 
               &FunctionsBatchTest::nanIgnoring,
-              &FunctionsBatchTest::nanIgnoringVector});
+              &FunctionsBatchTest::nanIgnoringVector,
+
+              &FunctionsBatchTest::minmaxLarge,
+              &FunctionsBatchTest::minmaxLargeVector,
+              &FunctionsBatchTest::minmaxLargeStrided,
+              &FunctionsBatchTest::minmaxLargeNan,
+              &FunctionsBatchTest::minmaxParallel,
+              &FunctionsBatchTest::minmaxParallelNan});
 }
 
 void FunctionsBatchTest::isInf() {
@@ -284,6 +300,221 @@ void FunctionsBatchTest::nanIgnoringVector() {
     CORRADE_COMPARE(Math::minmax(allNan).second[1], Constants::nan());
 }
 
+/* Enough items to go through both the vectorized and the remainder code
+   paths. As 37, 53, 71 and 97 are coprime with 1001, (i*37)%1001 goes
+   through all values from 0 to 1000. */
+enum: std::size_t { LargeCount = 1003 };
+
+void FunctionsBatchTest::minmaxLarge() {
+    Float floats[LargeCount];
+    Int ints[LargeCount];
+    UnsignedInt uints[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        floats[i] = Float((i*37)%1001) - 500.0f;
+        ints[i] = Int((i*37)%1001) - 500;
+        uints[i] = UnsignedInt((i*37)%1001);
+    }
+
+    /* Extremes in the middle of the vectorized part and in the remainder */
+    floats[517] = -1000.0f;
+    floats[1001] = 2000.0f;
+
+    CORRADE_COMPARE(Math::min(floats), -1000.0f);
+    CORRADE_COMPARE(Math::max(floats), 2000.0f);
+    CORRADE_COMPARE(Math::minmax(floats), std::make_pair(-1000.0f, 2000.0f));
+
+    CORRADE_COMPARE(Math::min(ints), -500);
+    CORRADE_COMPARE(Math::max(ints), 500);
+    CORRADE_COMPARE(Math::minmax(ints), std::make_pair(-500, 500));
+
+    CORRADE_COMPARE(Math::min(uints), 0);
+    CORRADE_COMPARE(Math::max(uints), 1000);
+    CORRADE_COMPARE(Math::minmax(uints), std::make_pair(0u, 1000u));
+}
+
+void FunctionsBatchTest::minmaxLargeVector() {
+    Vector2 vec2[LargeCount];
+    Vector3 vec3[LargeCount];
+    Vector4 vec4[LargeCount];
+    Vector3i vec3i[LargeCount];
+    Vector2ui vec2ui[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        const Float a = Float((i*37)%1001);
+        const Float b = Float((i*53)%1001);
+        const Float c = Float((i*71)%1001);
+        const Float d = Float((i*97)%1001);
+        vec2[i] = {a, -b};
+        vec3[i] = {a, -b, c - 500.0f};
+        vec4[i] = {a, -b, c - 500.0f, d*0.5f};
+        vec3i[i] = {Int(a), -Int(b), Int(c) - 500};
+        vec2ui[i] = {UnsignedInt(a), UnsignedInt(b)};
+    }
+
+    CORRADE_COMPARE(Math::min(vec2), (Vector2{0.0f, -1000.0f}));
+    CORRADE_COMPARE(Math::max(vec2), (Vector2{1000.0f, 0.0f}));
+    CORRADE_COMPARE(Math::minmax(vec2), std::make_pair(
+        Vector2{0.0f, -1000.0f}, Vector2{1000.0f, 0.0f}));
+
+    CORRADE_COMPARE(Math::min(vec3), (Vector3{0.0f, -1000.0f, -500.0f}));
+    CORRADE_COMPARE(Math::max(vec3), (Vector3{1000.0f, 0.0f, 500.0f}));
+    CORRADE_COMPARE(Math::minmax(vec3), std::make_pair(
+        Vector3{0.0f, -1000.0f, -500.0f}, Vector3{1000.0f, 0.0f, 500.0f}));
+
+    CORRADE_COMPARE(Math::minmax(vec4), std::make_pair(
+        Vector4{0.0f, -1000.0f, -500.0f, 0.0f},
+        Vector4{1000.0f, 0.0f, 500.0f, 500.0f}));
+
+    CORRADE_COMPARE(Math::minmax(vec3i), std::make_pair(
+        Vector3i{0, -1000, -500}, Vector3i{1000, 0, 500}));
+
+    CORRADE_COMPARE(Math::minmax(vec2ui), std::make_pair(
+        Vector2ui{0, 0}, Vector2ui{1000, 1000}));
+}
+
+void FunctionsBatchTest::minmaxLargeStrided() {
+    struct Vertex {
+        Vector3 position;
+        Float weight;
+    } vertices[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        vertices[i].position = {Float((i*37)%1001), -Float((i*53)%1001), 0.5f};
+        vertices[i].weight = Float((i*71)%1001) - 500.0f;
+    }
+
+    Corrade::Containers::StridedArrayView1D<Vector3> positions{vertices, &vertices[0].position, LargeCount, sizeof(Vertex)};
+    Corrade::Containers::StridedArrayView1D<Float> weights{vertices, &vertices[0].weight, LargeCount, sizeof(Vertex)};
+
+    CORRADE_COMPARE(Math::minmax(positions), std::make_pair(
+        Vector3{0.0f, -1000.0f, 0.5f}, Vector3{1000.0f, 0.0f, 0.5f}));
+    CORRADE_COMPARE(Math::min(weights), -500.0f);
+    CORRADE_COMPARE(Math::max(weights), 500.0f);
+    CORRADE_COMPARE(Math::minmax(weights), std::make_pair(-500.0f, 500.0f));
+
+    /* Every other item, in reverse, compared to the same items copied to a
+       contiguous array */
+    Vector3 everyOther[LargeCount/2 + 1];
+    for(std::size_t i = 0; i != LargeCount/2 + 1; ++i)
+        everyOther[i] = vertices[LargeCount - 1 - 2*i].position;
+    CORRADE_COMPARE(Math::minmax(positions.flipped<0>().every(2)),
+        Math::minmax(everyOther));
+}
+
+void FunctionsBatchTest::minmaxLargeNan() {
+    Float floats[LargeCount];
+    Vector3 vec3[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        floats[i] = Float((i*37)%1001) - 500.0f;
+        vec3[i] = {Float((i*37)%1001), -Float((i*53)%1001), 0.5f};
+    }
+
+    /* NaNs at the start and scattered over the vectorized part, each time
+       in a different lane */
+    for(std::size_t i = 0; i != 20; ++i) {
+        floats[i] = Constants::nan();
+        vec3[i] = Vector3{Constants::nan()};
+    }
+    for(std::size_t i = 20; i < LargeCount; i += 7) {
+        floats[i] = Constants::nan();
+        vec3[i][i % 3] = Constants::nan();
+    }
+
+    /* Values that got replaced by NaNs were neither the min nor the max
+       except for the first 20 items, those are below */
+    Float expectedMin = Constants::inf(), expectedMax = -Constants::inf();
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        if(floats[i] == floats[i]) {
+            expectedMin = Math::min(expectedMin, floats[i]);
+            expectedMax = Math::max(expectedMax, floats[i]);
+        }
+    }
+
+    CORRADE_COMPARE(Math::min(floats), expectedMin);
+    CORRADE_COMPARE(Math::max(floats), expectedMax);
+    CORRADE_COMPARE(Math::minmax(floats), std::make_pair(expectedMin, expectedMax));
+
+    Vector3 expectedMinVec{Constants::inf()}, expectedMaxVec{-Constants::inf()};
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(vec3[i][j] != vec3[i][j]) continue;
+            expectedMinVec[j] = Math::min(expectedMinVec[j], vec3[i][j]);
+            expectedMaxVec[j] = Math::max(expectedMaxVec[j], vec3[i][j]);
+        }
+    }
+
+    CORRADE_COMPARE(Math::min(vec3), expectedMinVec);
+    CORRADE_COMPARE(Math::max(vec3), expectedMaxVec);
+    CORRADE_COMPARE(Math::minmax(vec3), std::make_pair(expectedMinVec, expectedMaxVec));
+}
+
+void FunctionsBatchTest::minmaxParallel() {
+    Float floats[LargeCount];
+    Vector3 vec3[LargeCount];
+    Vector3i vec3i[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        floats[i] = Float((i*37)%1001) - 500.0f;
+        vec3[i] = {Float((i*37)%1001), -Float((i*53)%1001), 0.5f};
+        vec3i[i] = {Int((i*37)%1001), -Int((i*53)%1001), 7};
+    }
+
+    /* Zero means hardware concurrency, more threads than items get clamped */
+    for(std::size_t threadCount: {0, 1, 2, 3, 7, 5000}) {
+        CORRADE_ITERATION(threadCount);
+
+        CORRADE_COMPARE(Math::minmax(floats, threadCount),
+            std::make_pair(-500.0f, 500.0f));
+        CORRADE_COMPARE(Math::minmax(vec3, threadCount), std::make_pair(
+            Vector3{0.0f, -1000.0f, 0.5f}, Vector3{1000.0f, 0.0f, 0.5f}));
+        CORRADE_COMPARE(Math::minmax(vec3i, threadCount), std::make_pair(
+            Vector3i{0, -1000, 7}, Vector3i{1000, 0, 7}));
+    }
+
+    /* Empty range */
+    CORRADE_COMPARE(Math::minmax(Corrade::Containers::StridedArrayView1D<const Float>{}, 4), std::make_pair(0.0f, 0.0f));
+}
+
+void FunctionsBatchTest::minmaxParallelNan() {
+    Float floats[LargeCount];
+    Vector2 vec2[LargeCount];
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        floats[i] = Float((i*37)%1001) - 500.0f;
+        vec2[i] = {Float((i*37)%1001), -Float((i*53)%1001)};
+    }
+
+    /* The first half is all NaNs, so with more than one thread there are
+       chunks that have only NaNs. The X component of the second half is NaN
+       as well. */
+    for(std::size_t i = 0; i != LargeCount/2; ++i) {
+        floats[i] = Constants::nan();
+        vec2[i] = Vector2{Constants::nan()};
+    }
+    for(std::size_t i = LargeCount/2; i != LargeCount; ++i)
+        vec2[i].x() = Constants::nan();
+
+    const std::pair<Float, Float> expected = Math::minmax(floats);
+    const std::pair<Vector2, Vector2> expectedVec = Math::minmax(vec2);
+    CORRADE_COMPARE(expectedVec.first[0], Constants::nan());
+    CORRADE_COMPARE(expectedVec.second[0], Constants::nan());
+
+    for(std::size_t threadCount: {1, 2, 3, 7}) {
+        CORRADE_ITERATION(threadCount);
+
+        CORRADE_COMPARE(Math::minmax(floats, threadCount), expected);
+
+        /* Need to compare this way because of NaNs */
+        const std::pair<Vector2, Vector2> out = Math::minmax(vec2, threadCount);
+        CORRADE_COMPARE(out.first[0], Constants::nan());
+        CORRADE_COMPARE(out.first[1], expectedVec.first[1]);
+        CORRADE_COMPARE(out.second[0], Constants::nan());
+        CORRADE_COMPARE(out.second[1], expectedVec.second[1]);
+    }
+
+    /* All NaNs */
+    for(std::size_t i = 0; i != LargeCount; ++i)
+        floats[i] = Constants::nan();
+    CORRADE_COMPARE(Math::minmax(floats, 4).first, Constants::nan());
+    CORRADE_COMPARE(Math::minmax(floats, 4).second, Constants::nan());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsBatchTest)
@@ -23,10 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
-#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Vector3.h"
 
 #ifdef CORRADE_TARGET_SSE2
 #include <xmmintrin.h>
@@ -48,6 +50,10 @@ struct FunctionsBenchmark: Corrade::TestSuite::Tester {
 
     void sinCosSeparate();
     void sinCosCombined();
+
+    void minmaxVector3Loop();
+    void minmaxVector3();
+    void minmaxVector3Parallel();
 };
 
 FunctionsBenchmark::FunctionsBenchmark() {
@@ -66,11 +72,16 @@ FunctionsBenchmark::FunctionsBenchmark() {
 
     addBenchmarks({&FunctionsBenchmark::sinCosSeparate,
                    &FunctionsBenchmark::sinCosCombined}, 100);
+
+    addBenchmarks({&FunctionsBenchmark::minmaxVector3Loop,
+                   &FunctionsBenchmark::minmaxVector3,
+                   &FunctionsBenchmark::minmaxVector3Parallel}, 10);
 }
 
 typedef Math::Constants<Float> Constants;
 typedef Math::Deg<Float> Deg;
 typedef Math::Rad<Float> Rad;
+typedef Math::Vector3<Float> Vector3;
 
 enum: std::size_t { Repeats = 100000 };
 
@@ -215,6 +226,63 @@ void FunctionsBenchmark::sinCosCombined() {
     CORRADE_COMPARE_AS(a, 10.0f, Corrade::TestSuite::Compare::Greater);
 }
 
+enum: std::size_t { MinmaxCount = 1000000 };
+
+Corrade::Containers::Array<Vector3> minmaxData() {
+    Corrade::Containers::Array<Vector3> data{Corrade::Containers::NoInit, MinmaxCount};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Float((i*37)%1001), -Float((i*53)%1001), Float(i % 3)};
+    return data;
+}
+
+/* Verbatim copy of what minmax() did before it got a vectorized
+   implementation, to have a baseline to compare against */
+template<class T> std::pair<T, T> minmaxOriginal(const Corrade::Containers::StridedArrayView1D<const T>& range) {
+    if(range.empty()) return {};
+
+    std::pair<std::size_t, T> iOut = Math::Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    T min{iOut.second}, max{iOut.second};
+    for(++iOut.first; iOut.first != range.size(); ++iOut.first)
+        Math::Implementation::minmax(min, max, range[iOut.first]);
+
+    return {min, max};
+}
+
+void FunctionsBenchmark::minmaxVector3Loop() {
+    Corrade::Containers::Array<Vector3> data = minmaxData();
+
+    std::pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1) {
+        out = minmaxOriginal<Vector3>(data);
+    }
+
+    CORRADE_COMPARE(out.first, (Vector3{0.0f, -1000.0f, 0.0f}));
+    CORRADE_COMPARE(out.second, (Vector3{1000.0f, 0.0f, 2.0f}));
+}
+
+void FunctionsBenchmark::minmaxVector3() {
+    Corrade::Containers::Array<Vector3> data = minmaxData();
+
+    std::pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::minmax(data);
+    }
+
+    CORRADE_COMPARE(out.first, (Vector3{0.0f, -1000.0f, 0.0f}));
+    CORRADE_COMPARE(out.second, (Vector3{1000.0f, 0.0f, 2.0f}));
+}
+
+void FunctionsBenchmark::minmaxVector3Parallel() {
+    Corrade::Containers::Array<Vector3> data = minmaxData();
+
+    std::pair<Vector3, Vector3> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::minmax(data, 0);
+    }
+
+    CORRADE_COMPARE(out.first, (Vector3{0.0f, -1000.0f, 0.0f}));
+    CORRADE_COMPARE(out.second, (Vector3{1000.0f, 0.0f, 2.0f}));
+}
 
 }}}}
 
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #ifndef CORRADE_NO_ASSERT
@@ -30,6 +32,7 @@
 #endif
 
 #include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -43,6 +46,13 @@ struct InterpolationBenchmark: Corrade::TestSuite::Tester {
     void quaternionSlerpShortestPath();
     void dualQuaternionSclerp();
     void dualQuaternionSclerpShortestPath();
+
+    void quaternionLerpShortestPathLoop();
+    void quaternionLerpShortestPathBatch();
+    void quaternionSlerpShortestPathLoop();
+    void quaternionSlerpShortestPathBatch();
+    void dualQuaternionSclerpShortestPathLoop();
+    void dualQuaternionSclerpShortestPathBatch();
 };
 
 using namespace Math::Literals;
@@ -59,6 +69,13 @@ InterpolationBenchmark::InterpolationBenchmark() {
                    &InterpolationBenchmark::quaternionSlerpShortestPath,
                    &InterpolationBenchmark::dualQuaternionSclerp,
                    &InterpolationBenchmark::dualQuaternionSclerpShortestPath}, 100);
+
+    addBenchmarks({&InterpolationBenchmark::quaternionLerpShortestPathLoop,
+                   &InterpolationBenchmark::quaternionLerpShortestPathBatch,
+                   &InterpolationBenchmark::quaternionSlerpShortestPathLoop,
+                   &InterpolationBenchmark::quaternionSlerpShortestPathBatch,
+                   &InterpolationBenchmark::dualQuaternionSclerpShortestPathLoop,
+                   &InterpolationBenchmark::dualQuaternionSclerpShortestPathBatch}, 10);
 }
 
 void InterpolationBenchmark::baseline() {
@@ -150,6 +167,89 @@ void InterpolationBenchmark::dualQuaternionSclerpShortestPath() {
     CORRADE_VERIFY(!c.isNormalized());
 }
 
+/* The batch benchmarks interpolate the same ten thousand items both in a loop
+   and with a single batch call */
+constexpr std::size_t BatchSize = 10000;
+
+struct BatchData {
+    explicit BatchData(): a{Corrade::Containers::NoInit, BatchSize}, b{Corrade::Containers::NoInit, BatchSize}, dualA{Corrade::Containers::NoInit, BatchSize}, dualB{Corrade::Containers::NoInit, BatchSize}, t{Corrade::Containers::NoInit, BatchSize} {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            a[i] = Quaternion::rotation(Rad<Float>(Float(i)*0.0007f), Vector3{1.0f, -2.0f, 0.5f}.normalized());
+            b[i] = Quaternion::rotation(Rad<Float>(3.0f - Float(i)*0.0003f), Vector3::zAxis());
+            dualA[i] = DualQuaternion::translation({Float(i), 1.0f, 2.0f})*DualQuaternion{a[i]};
+            dualB[i] = DualQuaternion::translation({-3.0f, Float(i), 1.0f})*DualQuaternion{b[i]};
+            t[i] = Float(i % 100)*0.01f;
+        }
+    }
+
+    Corrade::Containers::Array<Quaternion> a, b;
+    Corrade::Containers::Array<DualQuaternion> dualA, dualB;
+    Corrade::Containers::Array<Float> t;
+};
+
+void InterpolationBenchmark::quaternionLerpShortestPathLoop() {
+    BatchData data;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = lerpShortestPath(data.a[i], data.b[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionLerpShortestPathBatch() {
+    BatchData data;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        lerpShortestPathInto(data.a, data.b, data.t, out);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathLoop() {
+    BatchData data;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = slerpShortestPath(data.a[i], data.b[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathBatch() {
+    BatchData data;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        slerpShortestPathInto(data.a, data.b, data.t, out);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
+void InterpolationBenchmark::dualQuaternionSclerpShortestPathLoop() {
+    BatchData data;
+    Corrade::Containers::Array<DualQuaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = sclerpShortestPath(data.dualA[i], data.dualB[i], data.t[i]);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
+void InterpolationBenchmark::dualQuaternionSclerpShortestPathBatch() {
+    BatchData data;
+    Corrade::Containers::Array<DualQuaternion> out{Corrade::Containers::NoInit, BatchSize};
+    CORRADE_BENCHMARK(1) {
+        sclerpShortestPathInto(data.dualA, data.dualB, data.t, out);
+    }
+
+    CORRADE_VERIFY(out[BatchSize/2].isNormalized());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBenchmark)
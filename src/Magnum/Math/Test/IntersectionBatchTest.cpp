@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: Corrade::TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    template<class T> void aabbFrustum();
+    template<class T> void sphereFrustum();
+    template<class T> void sphereFrustumStraddling();
+
+    void assertions();
+};
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addTests({&IntersectionBatchTest::aabbFrustum<Float>,
+              &IntersectionBatchTest::aabbFrustum<Double>,
+              &IntersectionBatchTest::sphereFrustum<Float>,
+              &IntersectionBatchTest::sphereFrustum<Double>,
+              &IntersectionBatchTest::sphereFrustumStraddling<Float>,
+              &IntersectionBatchTest::sphereFrustumStraddling<Double>,
+
+              &IntersectionBatchTest::assertions});
+}
+
+template<class T> struct TypeName {
+    static const char* name() { return "Float"; }
+};
+template<> struct TypeName<Double> {
+    static const char* name() { return "Double"; }
+};
+
+template<class T> void IntersectionBatchTest::aabbFrustum() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Frustum<T> frustum{
+        {T(1.0), T(0.0), T(0.0), T(0.0)},
+        {T(-1.0), T(0.0), T(0.0), T(5.0)},
+        {T(0.0), T(1.0), T(0.0), T(0.0)},
+        {T(0.0), T(-1.0), T(0.0), T(1.0)},
+        {T(0.0), T(0.0), T(1.0), T(0.0)},
+        {T(0.0), T(0.0), T(-1.0), T(10.0)}};
+
+    /* Same cases as in IntersectionTest */
+    const Vector3<T> centers[]{
+        /* Fully inside */
+        Vector3<T>{T(0.0)},
+        /* Intersects with exactly one plane each */
+        {T(2.5), T(0.0), T(5.0)},
+        {T(2.5), T(1.0), T(5.0)},
+        {T(0.0), T(0.5), T(5.0)},
+        {T(5.0), T(0.5), T(5.0)},
+        {T(2.5), T(0.5), T(0.0)},
+        {T(2.5), T(0.5), T(10.0)},
+        /* Bigger than frustum, but still intersects */
+        Vector3<T>{T(0.0)},
+        /* Outside of frustum */
+        Vector3<T>{T(-7.5)},
+        {T(2.5), T(0.5), T(12.0)}
+    };
+    const Vector3<T> extents[]{
+        Vector3<T>{T(1.0)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(0.1)},
+        Vector3<T>{T(100.0)},
+        Vector3<T>{T(2.5)},
+        Vector3<T>{T(1.0)}
+    };
+
+    bool out[10];
+    Intersection::aabbFrustumInto(Corrade::Containers::stridedArrayView(centers), Corrade::Containers::stridedArrayView(extents), frustum, Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out), Corrade::Containers::arrayView({
+        true, true, true, true, true, true, true, true, false, false
+    }), Corrade::TestSuite::Compare::Container);
+
+    /* Should match the single-value version */
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(centers); ++i)
+        CORRADE_COMPARE(out[i], Intersection::aabbFrustum(centers[i], extents[i], frustum));
+}
+
+template<class T> void IntersectionBatchTest::sphereFrustum() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Frustum<T> frustum{
+        {T(1.0), T(0.0), T(0.0), T(0.0)},
+        {T(-1.0), T(0.0), T(0.0), T(10.0)},
+        {T(0.0), T(1.0), T(0.0), T(0.0)},
+        {T(0.0), T(-1.0), T(0.0), T(10.0)},
+        {T(0.0), T(0.0), T(1.0), T(0.0)},
+        {T(0.0), T(0.0), T(-1.0), T(10.0)}};
+
+    const Vector3<T> centers[]{
+        /* On edge */
+        {T(0.0), T(0.0), T(-1.0)},
+        /* Inside */
+        {T(5.5), T(5.5), T(5.5)},
+        /* Outside */
+        {T(0.0), T(0.0), T(100.0)}
+    };
+    const T radii[]{T(1.5), T(1.5), T(0.5)};
+
+    bool out[3];
+    Intersection::sphereFrustumInto(Corrade::Containers::stridedArrayView(centers), Corrade::Containers::stridedArrayView(radii), frustum, Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out), Corrade::Containers::arrayView({
+        true, true, false
+    }), Corrade::TestSuite::Compare::Container);
+
+    /* Should match the single-value version for these */
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(centers); ++i)
+        CORRADE_COMPARE(out[i], Intersection::sphereFrustum(centers[i], radii[i], frustum));
+}
+
+template<class T> void IntersectionBatchTest::sphereFrustumStraddling() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Planes with non-unit normals, which shouldn't affect the result */
+    const Frustum<T> frustum{
+        {T(2.0), T(0.0), T(0.0), T(0.0)},
+        {T(-2.0), T(0.0), T(0.0), T(20.0)},
+        {T(0.0), T(2.0), T(0.0), T(0.0)},
+        {T(0.0), T(-2.0), T(0.0), T(20.0)},
+        {T(0.0), T(0.0), T(2.0), T(0.0)},
+        {T(0.0), T(0.0), T(-2.0), T(20.0)}};
+
+    const Vector3<T> centers[]{
+        /* Small sphere straddling the z = 0 plane, comparing against a
+           squared radius would cull it */
+        {T(5.0), T(5.0), T(-0.4)},
+        /* Small sphere just outside */
+        {T(5.0), T(5.0), T(-0.6)},
+        /* Large sphere outside, comparing against a squared radius would
+           keep it */
+        {T(5.0), T(5.0), T(-5.0)},
+        /* Large sphere straddling the plane */
+        {T(5.0), T(5.0), T(-2.5)}
+    };
+    const T radii[]{T(0.5), T(0.5), T(3.0), T(3.0)};
+
+    bool out[4];
+    Intersection::sphereFrustumInto(Corrade::Containers::stridedArrayView(centers), Corrade::Containers::stridedArrayView(radii), frustum, Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out), Corrade::Containers::arrayView({
+        true, false, false, true
+    }), Corrade::TestSuite::Compare::Container);
+}
+
+void IntersectionBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3<Float> vectors[3]{};
+    const Float radii[3]{};
+    bool out[2];
+
+    std::ostringstream out_;
+    Error redirectError{&out_};
+    Intersection::aabbFrustumInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(vectors).prefix(2), Frustum<Float>{}, Corrade::Containers::stridedArrayView(out));
+    Intersection::aabbFrustumInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(vectors), Frustum<Float>{}, Corrade::Containers::stridedArrayView(out));
+    Intersection::sphereFrustumInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(radii).prefix(2), Frustum<Float>{}, Corrade::Containers::stridedArrayView(out));
+    Intersection::sphereFrustumInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(radii), Frustum<Float>{}, Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out_.str(),
+        "Math::Intersection::aabbFrustumInto(): expected views of the same size but got 3 and 2\n"
+        "Math::Intersection::aabbFrustumInto(): expected destination view size 3 but got 2\n"
+        "Math::Intersection::sphereFrustumInto(): expected views of the same size but got 3 and 2\n"
+        "Math::Intersection::sphereFrustumInto(): expected destination view size 3 but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
@@ -0,0 +1,279 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/MatrixBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct MatrixBatchTest: Corrade::TestSuite::Tester {
+    explicit MatrixBatchTest();
+
+    template<class T> void multiplyOneToMany();
+    template<class T> void multiplyManyToOne();
+    template<class T> void multiplyManyToMany();
+    void multiplyInPlace();
+
+    template<class T> void transformationMatrixTrs();
+    template<class T> void transformationMatrixDualQuaternion();
+    template<class T> void normalMatrix();
+
+    void assertions();
+};
+
+MatrixBatchTest::MatrixBatchTest() {
+    addTests({&MatrixBatchTest::multiplyOneToMany<Float>,
+              &MatrixBatchTest::multiplyOneToMany<Double>,
+              &MatrixBatchTest::multiplyManyToOne<Float>,
+              &MatrixBatchTest::multiplyManyToOne<Double>,
+              &MatrixBatchTest::multiplyManyToMany<Float>,
+              &MatrixBatchTest::multiplyManyToMany<Double>,
+              &MatrixBatchTest::multiplyInPlace,
+
+              &MatrixBatchTest::transformationMatrixTrs<Float>,
+              &MatrixBatchTest::transformationMatrixTrs<Double>,
+              &MatrixBatchTest::transformationMatrixDualQuaternion<Float>,
+              &MatrixBatchTest::transformationMatrixDualQuaternion<Double>,
+              &MatrixBatchTest::normalMatrix<Float>,
+              &MatrixBatchTest::normalMatrix<Double>,
+
+              &MatrixBatchTest::assertions});
+}
+
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+template<class T> struct TypeName {
+    static const char* name() { return "Float"; }
+};
+template<> struct TypeName<Double> {
+    static const char* name() { return "Double"; }
+};
+
+template<class T> Math::Matrix4<T> transformation(T i) {
+    return Math::Matrix4<T>::translation({i, T(1) - i, T(2)*i})*
+        Math::Matrix4<T>::rotation(Rad<T>(i*T(0.7)), Math::Vector3<T>{T(1), T(-2), i + T(0.5)}.normalized())*
+        Math::Matrix4<T>::scaling({T(1.5), i + T(1), T(-0.5)});
+}
+
+template<class T> void MatrixBatchTest::multiplyOneToMany() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Math::Matrix4<T> a = transformation(T(3.5));
+    Math::Matrix4<T> b[5];
+    Math::Matrix4<T> expected[5];
+    for(std::size_t i = 0; i != 5; ++i) {
+        b[i] = transformation(T(i));
+        expected[i] = a*b[i];
+    }
+
+    Math::Matrix4<T> out[5];
+    multiplyInto(a, Corrade::Containers::stridedArrayView(b), Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void MatrixBatchTest::multiplyManyToOne() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Math::Matrix4<T> b = transformation(T(-1.5));
+    Math::Matrix4<T> a[5];
+    Math::Matrix4<T> expected[5];
+    for(std::size_t i = 0; i != 5; ++i) {
+        a[i] = transformation(T(i));
+        expected[i] = a[i]*b;
+    }
+
+    Math::Matrix4<T> out[5];
+    multiplyInto(Corrade::Containers::stridedArrayView(a), b, Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void MatrixBatchTest::multiplyManyToMany() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Interleaved to verify strides are handled properly */
+    struct Data {
+        Math::Matrix4<T> a, b, out;
+    } data[5];
+    Math::Matrix4<T> expected[5];
+    for(std::size_t i = 0; i != 5; ++i) {
+        data[i].a = transformation(T(i));
+        data[i].b = transformation(T(4) - T(i)*T(0.25));
+        expected[i] = data[i].a*data[i].b;
+    }
+
+    Corrade::Containers::StridedArrayView1D<const Math::Matrix4<T>> a{data, &data[0].a, 5, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<const Math::Matrix4<T>> b{data, &data[0].b, 5, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<Math::Matrix4<T>> out{data, &data[0].out, 5, sizeof(Data)};
+    multiplyInto(a, b, out);
+    CORRADE_COMPARE_AS(out, Corrade::Containers::stridedArrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+void MatrixBatchTest::multiplyInPlace() {
+    const Matrix4 a = transformation(3.5f);
+    Matrix4 data[3];
+    Matrix4 expected[3];
+    for(std::size_t i = 0; i != 3; ++i) {
+        data[i] = transformation(Float(i));
+        expected[i] = a*data[i]*a;
+    }
+
+    multiplyInto(a, Corrade::Containers::stridedArrayView(data), Corrade::Containers::stridedArrayView(data));
+    multiplyInto(Corrade::Containers::stridedArrayView(data), a, Corrade::Containers::stridedArrayView(data));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(data),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void MatrixBatchTest::transformationMatrixTrs() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Math::Vector3<T> translations[]{
+        {T(1.0), T(2.0), T(3.0)},
+        {},
+        {T(-0.5), T(7.0), T(0.25)}
+    };
+    const Math::Quaternion<T> rotations[]{
+        Math::Quaternion<T>::rotation(Deg<T>(T(35.0)), Math::Vector3<T>::xAxis()),
+        {},
+        Math::Quaternion<T>::rotation(Deg<T>(T(-127.0)), Math::Vector3<T>{T(1.0), T(1.0), T(-1.0)}.normalized())
+    };
+    const Math::Vector3<T> scalings[]{
+        {T(1.0), T(1.0), T(1.0)},
+        {T(2.0), T(-1.0), T(0.5)},
+        {T(0.25), T(3.0), T(3.0)}
+    };
+
+    Math::Matrix4<T> expected[3];
+    for(std::size_t i = 0; i != 3; ++i)
+        expected[i] = Math::Matrix4<T>::translation(translations[i])*
+            Math::Matrix4<T>::from(rotations[i].toMatrix(), {})*
+            Math::Matrix4<T>::scaling(scalings[i]);
+
+    Math::Matrix4<T> out[3];
+    transformationMatrixInto(
+        Corrade::Containers::stridedArrayView(translations),
+        Corrade::Containers::stridedArrayView(rotations),
+        Corrade::Containers::stridedArrayView(scalings),
+        Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void MatrixBatchTest::transformationMatrixDualQuaternion() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    const Math::DualQuaternion<T> src[]{
+        Math::DualQuaternion<T>::translation({T(1.0), T(-2.0), T(3.0)})*
+            Math::DualQuaternion<T>::rotation(Deg<T>(T(23.0)), Math::Vector3<T>::yAxis()),
+        {},
+        Math::DualQuaternion<T>::rotation(Deg<T>(T(-127.0)), Math::Vector3<T>{T(1.0), T(1.0), T(-1.0)}.normalized())*
+            Math::DualQuaternion<T>::translation({T(0.5), T(0.25), T(-7.0)})
+    };
+
+    Math::Matrix4<T> expected[3];
+    for(std::size_t i = 0; i != 3; ++i)
+        expected[i] = src[i].toMatrix();
+
+    Math::Matrix4<T> out[3];
+    transformationMatrixInto(
+        Corrade::Containers::stridedArrayView(src),
+        Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+template<class T> void MatrixBatchTest::normalMatrix() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::Matrix4<T> src[4];
+    Math::Matrix3x3<T> expected[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        src[i] = transformation(T(i) + T(0.5));
+        expected[i] = src[i].normalMatrix();
+    }
+
+    Math::Matrix3x3<T> out[4];
+    normalMatrixInto(
+        Corrade::Containers::stridedArrayView(src),
+        Corrade::Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Corrade::Containers::arrayView(out),
+        Corrade::Containers::arrayView(expected),
+        Corrade::TestSuite::Compare::Container);
+}
+
+void MatrixBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Matrix4 matrices[3]{};
+    const Vector3 vectors[3]{};
+    const Math::Quaternion<Float> rotations[3]{};
+    const Math::DualQuaternion<Float> dualQuaternions[3]{};
+    Matrix4 out[2];
+    Matrix3x3 outNormal[2];
+
+    std::ostringstream out_;
+    Error redirectError{&out_};
+    multiplyInto(Matrix4{}, Corrade::Containers::stridedArrayView(matrices), Corrade::Containers::stridedArrayView(out));
+    multiplyInto(Corrade::Containers::stridedArrayView(matrices), Matrix4{}, Corrade::Containers::stridedArrayView(out));
+    multiplyInto(Corrade::Containers::stridedArrayView(matrices), Corrade::Containers::stridedArrayView(matrices).prefix(2), Corrade::Containers::stridedArrayView(out));
+    multiplyInto(Corrade::Containers::stridedArrayView(matrices), Corrade::Containers::stridedArrayView(matrices), Corrade::Containers::stridedArrayView(out));
+    transformationMatrixInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(rotations).prefix(2), Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(out));
+    transformationMatrixInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(rotations), Corrade::Containers::stridedArrayView(vectors).prefix(2), Corrade::Containers::stridedArrayView(out));
+    transformationMatrixInto(Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(rotations), Corrade::Containers::stridedArrayView(vectors), Corrade::Containers::stridedArrayView(out));
+    transformationMatrixInto(Corrade::Containers::stridedArrayView(dualQuaternions), Corrade::Containers::stridedArrayView(out));
+    normalMatrixInto(Corrade::Containers::stridedArrayView(matrices), Corrade::Containers::stridedArrayView(outNormal));
+    CORRADE_COMPARE(out_.str(),
+        "Math::multiplyInto(): expected destination view size 3 but got 2\n"
+        "Math::multiplyInto(): expected destination view size 3 but got 2\n"
+        "Math::multiplyInto(): expected views of the same size but got 3 and 2\n"
+        "Math::multiplyInto(): expected destination view size 3 but got 2\n"
+        "Math::transformationMatrixInto(): expected views of the same size but got 3, 2 and 3\n"
+        "Math::transformationMatrixInto(): expected views of the same size but got 3, 3 and 2\n"
+        "Math::transformationMatrixInto(): expected destination view size 3 but got 2\n"
+        "Math::transformationMatrixInto(): expected destination view size 3 but got 2\n"
+        "Math::normalMatrixInto(): expected destination view size 3 but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBatchTest)
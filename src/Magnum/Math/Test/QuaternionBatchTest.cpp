@@ -0,0 +1,357 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct QuaternionBatchTest: Corrade::TestSuite::Tester {
+    explicit QuaternionBatchTest();
+
+    template<class T> void lerpShortestPath();
+    template<class T> void lerpShortestPathShared();
+    template<class T> void slerpShortestPath();
+    template<class T> void slerpShortestPathShared();
+    void slerpShortestPathPrecision();
+    template<class T> void slerpShortestPathNearlySame();
+    template<class T> void sclerpShortestPath();
+    template<class T> void sclerpShortestPathShared();
+    template<class T> void sclerpShortestPathSameRotation();
+    void inPlace();
+
+    void assertions();
+};
+
+QuaternionBatchTest::QuaternionBatchTest() {
+    addTests({&QuaternionBatchTest::lerpShortestPath<Float>,
+              &QuaternionBatchTest::lerpShortestPath<Double>,
+              &QuaternionBatchTest::lerpShortestPathShared<Float>,
+              &QuaternionBatchTest::lerpShortestPathShared<Double>,
+              &QuaternionBatchTest::slerpShortestPath<Float>,
+              &QuaternionBatchTest::slerpShortestPath<Double>,
+              &QuaternionBatchTest::slerpShortestPathShared<Float>,
+              &QuaternionBatchTest::slerpShortestPathShared<Double>,
+              &QuaternionBatchTest::slerpShortestPathPrecision,
+              &QuaternionBatchTest::slerpShortestPathNearlySame<Float>,
+              &QuaternionBatchTest::slerpShortestPathNearlySame<Double>,
+              &QuaternionBatchTest::sclerpShortestPath<Float>,
+              &QuaternionBatchTest::sclerpShortestPath<Double>,
+              &QuaternionBatchTest::sclerpShortestPathShared<Float>,
+              &QuaternionBatchTest::sclerpShortestPathShared<Double>,
+              &QuaternionBatchTest::sclerpShortestPathSameRotation<Float>,
+              &QuaternionBatchTest::sclerpShortestPathSameRotation<Double>,
+              &QuaternionBatchTest::inPlace,
+
+              &QuaternionBatchTest::assertions});
+}
+
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+typedef Math::Vector3<Float> Vector3;
+
+template<class T> struct TypeName {
+    static const char* name() { return "Float"; }
+};
+template<> struct TypeName<Double> {
+    static const char* name() { return "Double"; }
+};
+
+/* Two full blocks and a partial one */
+constexpr std::size_t Count = 19;
+
+/* Pairs of rotations with angles between them going over the whole range,
+   so roughly half of them need to be flipped for the shortest path */
+template<class T> Math::Quaternion<T> rotationA(std::size_t i) {
+    return Math::Quaternion<T>::rotation(Rad<T>(T(i)*T(0.7) + T(0.1)), Math::Vector3<T>{T(1), T(-2), T(i)*T(0.3) + T(0.5)}.normalized());
+}
+template<class T> Math::Quaternion<T> rotationB(std::size_t i) {
+    return Math::Quaternion<T>::rotation(Rad<T>(T(i)*T(-0.4) + T(1.3)), Math::Vector3<T>{T(i)*T(0.2) - T(1.5), T(0.5), T(1)}.normalized());
+}
+template<class T> Math::DualQuaternion<T> transformationA(std::size_t i) {
+    return Math::DualQuaternion<T>::translation({T(i), T(1) - T(i)*T(0.5), T(2)})*Math::DualQuaternion<T>{rotationA<T>(i)};
+}
+template<class T> Math::DualQuaternion<T> transformationB(std::size_t i) {
+    return Math::DualQuaternion<T>::translation({T(-3), T(i)*T(0.25), T(i) + T(1)})*Math::DualQuaternion<T>{rotationB<T>(i)};
+}
+template<class T> T phase(std::size_t i) {
+    return T(i % 7)/T(6);
+}
+
+template<class T> void QuaternionBatchTest::lerpShortestPath() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::Quaternion<T> a[Count], b[Count], out[Count];
+    T t[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = rotationA<T>(i);
+        b[i] = rotationB<T>(i);
+        t[i] = phase<T>(i);
+    }
+
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::lerpShortestPath(a[i], b[i], t[i]));
+    }
+}
+
+template<class T> void QuaternionBatchTest::lerpShortestPathShared() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::Quaternion<T> a[Count], b[Count], out[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = rotationA<T>(i);
+        b[i] = rotationB<T>(i);
+    }
+
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), T(0.35), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::lerpShortestPath(a[i], b[i], T(0.35)));
+    }
+}
+
+template<class T> void QuaternionBatchTest::slerpShortestPath() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::Quaternion<T> a[Count], b[Count], out[Count];
+    T t[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = rotationA<T>(i);
+        b[i] = rotationB<T>(i);
+        t[i] = phase<T>(i);
+    }
+
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::slerpShortestPath(a[i], b[i], t[i]));
+    }
+}
+
+template<class T> void QuaternionBatchTest::slerpShortestPathShared() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::Quaternion<T> a[Count], b[Count], out[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = rotationA<T>(i);
+        b[i] = rotationB<T>(i);
+    }
+
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), T(0.35), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::slerpShortestPath(a[i], b[i], T(0.35)));
+    }
+}
+
+void QuaternionBatchTest::slerpShortestPathPrecision() {
+    /* The float variant uses a series approximation, verify it against a
+       double-precision calculation over the whole range of angles and
+       phases, including angles close to 180° that get flipped */
+    enum: std::size_t { AngleCount = 181, PhaseCount = 21 };
+    Quaternion a[AngleCount*PhaseCount], b[AngleCount*PhaseCount], out[AngleCount*PhaseCount];
+    Float t[AngleCount*PhaseCount];
+    Math::Quaternion<Double> expected[AngleCount*PhaseCount];
+    for(std::size_t i = 0; i != AngleCount; ++i) {
+        const Math::Quaternion<Double> aDouble = Math::Quaternion<Double>::rotation(Rad<Double>(0.3), Math::Vector3<Double>::xAxis());
+        const Math::Quaternion<Double> bDouble = Math::Quaternion<Double>::rotation(Deg<Double>(Double(i)*2.0), Math::Vector3<Double>{1.0, 2.0, -0.5}.normalized())*aDouble;
+        for(std::size_t j = 0; j != PhaseCount; ++j) {
+            const std::size_t index = i*PhaseCount + j;
+            a[index] = Quaternion{aDouble};
+            b[index] = Quaternion{bDouble};
+            t[index] = Float(j)/Float(PhaseCount - 1);
+            expected[index] = Math::slerpShortestPath(aDouble, bDouble, Double(t[index]));
+        }
+    }
+
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+
+    Double maxError = 0.0;
+    for(std::size_t i = 0; i != AngleCount*PhaseCount; ++i) {
+        const Math::Vector4<Double> difference = Math::Vector4<Double>{Math::Vector3<Double>{out[i].vector()}, Double(out[i].scalar())} - Math::Vector4<Double>{expected[i].vector(), expected[i].scalar()};
+        maxError = Math::max(maxError, Math::abs(difference).max());
+    }
+    CORRADE_INFO("Max error:" << maxError);
+    CORRADE_COMPARE_AS(maxError, 5.0e-7,
+        Corrade::TestSuite::Compare::Less);
+}
+
+template<class T> void QuaternionBatchTest::slerpShortestPathNearlySame() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Same, negated and nearly the same quaternions, which fall back to a
+       linear interpolation in the single-value variant */
+    const Math::Quaternion<T> q = rotationA<T>(3);
+    const Math::Quaternion<T> a[]{q, q, q, -q};
+    const Math::Quaternion<T> b[]{q, -q, (q + Math::Quaternion<T>{{}, TypeTraits<T>::epsilon()*T(0.1)}).normalized(), q};
+    Math::Quaternion<T> out[4];
+
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), T(0.25), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::slerpShortestPath(a[i], b[i], T(0.25)));
+    }
+}
+
+template<class T> void QuaternionBatchTest::sclerpShortestPath() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::DualQuaternion<T> a[Count], b[Count], out[Count];
+    T t[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = transformationA<T>(i);
+        b[i] = transformationB<T>(i);
+        t[i] = phase<T>(i);
+    }
+
+    sclerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::sclerpShortestPath(a[i], b[i], t[i]));
+    }
+}
+
+template<class T> void QuaternionBatchTest::sclerpShortestPathShared() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Math::DualQuaternion<T> a[Count], b[Count], out[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = transformationA<T>(i);
+        b[i] = transformationB<T>(i);
+    }
+
+    sclerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), T(0.8), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::sclerpShortestPath(a[i], b[i], T(0.8)));
+    }
+}
+
+template<class T> void QuaternionBatchTest::sclerpShortestPathSameRotation() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Same or opposite rotation, in which case only the translation gets
+       interpolated, mixed with regular items in the same block */
+    const Math::Quaternion<T> q = rotationA<T>(5);
+    const Math::DualQuaternion<T> a[]{
+        Math::DualQuaternion<T>::translation({T(1), T(2), T(3)})*Math::DualQuaternion<T>{q},
+        transformationA<T>(2),
+        Math::DualQuaternion<T>::translation({T(-1), T(0), T(3)})*Math::DualQuaternion<T>{q},
+    };
+    const Math::DualQuaternion<T> b[]{
+        Math::DualQuaternion<T>::translation({T(5), T(-2), T(0)})*Math::DualQuaternion<T>{q},
+        transformationB<T>(2),
+        Math::DualQuaternion<T>::translation({T(1), T(4), T(1)})*Math::DualQuaternion<T>{-q},
+    };
+    Math::DualQuaternion<T> out[3];
+
+    sclerpShortestPathInto(Corrade::Containers::stridedArrayView(a), Corrade::Containers::stridedArrayView(b), T(0.25), Corrade::Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::sclerpShortestPath(a[i], b[i], T(0.25)));
+    }
+}
+
+void QuaternionBatchTest::inPlace() {
+    /* Interleaved data, with the output overwriting the first input */
+    struct Data {
+        DualQuaternion a;
+        Quaternion b;
+        DualQuaternion c;
+        Float t;
+    } data[Count];
+    Quaternion expected[Count];
+    DualQuaternion expectedDual[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        data[i].a = transformationA<Float>(i);
+        data[i].b = rotationB<Float>(i);
+        data[i].c = transformationB<Float>(i);
+        data[i].t = phase<Float>(i);
+        expected[i] = Math::slerpShortestPath(data[i].a.real(), data[i].b, data[i].t);
+        expectedDual[i] = Math::sclerpShortestPath(data[i].a, data[i].c, data[i].t);
+    }
+
+    Corrade::Containers::StridedArrayView1D<DualQuaternion> a{data, &data[0].a, Count, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<Quaternion> aReal{data, &data[0].a.real(), Count, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<const Quaternion> b{data, &data[0].b, Count, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<DualQuaternion> c{data, &data[0].c, Count, sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<const Float> t{data, &data[0].t, Count, sizeof(Data)};
+
+    /* Interpolating the dual quaternions first as the slerp overwrites the
+       real part of the first input */
+    sclerpShortestPathInto(a, c, t, c);
+    slerpShortestPathInto(aReal, b, t, aReal);
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].a.real(), expected[i]);
+        CORRADE_COMPARE(data[i].c, expectedDual[i]);
+    }
+}
+
+void QuaternionBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Quaternion quaternions[3];
+    const DualQuaternion dualQuaternions[3];
+    const Float t[3]{};
+    Quaternion out[2];
+    DualQuaternion outDual[2];
+
+    std::ostringstream out_;
+    Error redirectError{&out_};
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions).prefix(2), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(t).prefix(2), Corrade::Containers::stridedArrayView(out));
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions).prefix(2), 0.5f, Corrade::Containers::stridedArrayView(out));
+    lerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions), 0.5f, Corrade::Containers::stridedArrayView(out));
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions).prefix(2), Corrade::Containers::stridedArrayView(t), Corrade::Containers::stridedArrayView(out));
+    slerpShortestPathInto(Corrade::Containers::stridedArrayView(quaternions), Corrade::Containers::stridedArrayView(quaternions), 0.5f, Corrade::Containers::stridedArrayView(out));
+    sclerpShortestPathInto(Corrade::Containers::stridedArrayView(dualQuaternions), Corrade::Containers::stridedArrayView(dualQuaternions), Corrade::Containers::stridedArrayView(t).prefix(2), Corrade::Containers::stridedArrayView(outDual));
+    sclerpShortestPathInto(Corrade::Containers::stridedArrayView(dualQuaternions), Corrade::Containers::stridedArrayView(dualQuaternions), 0.5f, Corrade::Containers::stridedArrayView(outDual));
+    CORRADE_COMPARE(out_.str(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got 3, 2 and 3\n"
+        "Math::lerpShortestPathInto(): expected views of the same size but got 3, 3 and 2\n"
+        "Math::lerpShortestPathInto(): expected destination view size 3 but got 2\n"
+        "Math::lerpShortestPathInto(): expected views of the same size but got 3 and 2\n"
+        "Math::lerpShortestPathInto(): expected destination view size 3 but got 2\n"
+        "Math::slerpShortestPathInto(): expected views of the same size but got 3, 2 and 3\n"
+        "Math::slerpShortestPathInto(): expected destination view size 3 but got 2\n"
+        "Math::sclerpShortestPathInto(): expected views of the same size but got 3, 3 and 2\n"
+        "Math::sclerpShortestPathInto(): expected destination view size 3 but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::QuaternionBatchTest)
@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Skin.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/MatrixBatch.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Trade/SkinData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Same as in Math batch APIs, small enough for the gathered joint
+   transformations to stay on the stack */
+constexpr std::size_t BlockSize = 8;
+
+#ifndef CORRADE_NO_ASSERT
+bool checkJoints(const Trade::SkinData3D& skin, const std::size_t objectCount, const std::size_t paletteSize) {
+    const Containers::ArrayView<const UnsignedInt> joints = skin.joints();
+    CORRADE_ASSERT(paletteSize == joints.size(),
+        "MeshTools::skinningPaletteInto(): expected palette size" << joints.size() << "but got" << paletteSize, false);
+    for(std::size_t i = 0; i != joints.size(); ++i)
+        CORRADE_ASSERT(joints[i] < objectCount,
+            "MeshTools::skinningPaletteInto(): joint" << i << "references object" << joints[i] << "but only" << objectCount << "joint transformations were passed", false);
+    return true;
+}
+#endif
+
+inline void convertPalette(const Containers::StridedArrayView1D<const Matrix4>& src, const Containers::StridedArrayView1D<Matrix3x4>& dst) {
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const Matrix4& m = src[i];
+        dst[i] = Matrix3x4{m.row(0), m.row(1), m.row(2)};
+    }
+}
+
+inline void convertPalette(const Containers::StridedArrayView1D<const Matrix4>& src, const Containers::StridedArrayView1D<DualQuaternion>& dst) {
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = DualQuaternion::fromMatrix(src[i]);
+}
+
+/* Gathers the joint transformations for a block and multiplies them with
+   the inverse bind matrices, output is directly the destination */
+void paletteBlock(const UnsignedInt* const joints, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<const Matrix4>& inverseBindMatrices, const Containers::StridedArrayView1D<Matrix4>& dst) {
+    Matrix4 gathered[BlockSize];
+    const std::size_t count = dst.size();
+    for(std::size_t i = 0; i != count; ++i)
+        gathered[i] = jointTransformations[joints[i]];
+    Math::multiplyInto(Containers::StridedArrayView1D<const Matrix4>{Containers::arrayView(gathered).prefix(count)}, inverseBindMatrices, dst);
+}
+
+void paletteImplementation(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<Matrix4>& palette) {
+    const Containers::ArrayView<const UnsignedInt> joints = skin.joints();
+    const Containers::StridedArrayView1D<const Matrix4> inverseBindMatrices = skin.inverseBindMatrices();
+    for(std::size_t i = 0; i < joints.size(); i += BlockSize) {
+        const std::size_t end = Math::min(i + BlockSize, joints.size());
+        paletteBlock(joints + i, jointTransformations, inverseBindMatrices.slice(i, end), palette.slice(i, end));
+    }
+}
+
+/* For the packed outputs the block is calculated into a temporary first */
+template<class T> void paletteImplementation(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<T>& palette) {
+    const Containers::ArrayView<const UnsignedInt> joints = skin.joints();
+    const Containers::StridedArrayView1D<const Matrix4> inverseBindMatrices = skin.inverseBindMatrices();
+    Matrix4 block[BlockSize];
+    for(std::size_t i = 0; i < joints.size(); i += BlockSize) {
+        const std::size_t end = Math::min(i + BlockSize, joints.size());
+        const Containers::ArrayView<Matrix4> blockView = Containers::arrayView(block).prefix(end - i);
+        paletteBlock(joints + i, jointTransformations, inverseBindMatrices.slice(i, end), blockView);
+        convertPalette(blockView, palette.slice(i, end));
+    }
+}
+
+template<class T> void paletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<T>& palette) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkJoints(skin, jointTransformations.size(), palette.size())) return;
+    #endif
+    paletteImplementation(skin, jointTransformations, palette);
+}
+
+template<class T> void paletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<T>& palettes, const std::size_t threadCount) {
+    CORRADE_ASSERT(jointTransformations.size()[0] == palettes.size()[0],
+        "MeshTools::skinningPaletteInto(): expected" << jointTransformations.size()[0] << "palettes but got" << palettes.size()[0], );
+    /* All instances share the same skin and object count, so the joints are
+       checked just once and not from the worker threads */
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkJoints(skin, jointTransformations.size()[1], palettes.size()[1])) return;
+    #endif
+
+    const std::size_t count = palettes.size()[0];
+    Implementation::parallelFor(count, Implementation::parallelChunkCount(count, threadCount), [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            paletteImplementation(skin, jointTransformations[i], palettes[i]);
+    });
+}
+
+#ifndef CORRADE_NO_ASSERT
+bool checkSkinInputs(const char* const name, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const std::size_t srcSize, const std::size_t dstSize) {
+    CORRADE_ASSERT(jointIds.size()[0] == srcSize && weights.size()[0] == srcSize && dstSize == srcSize,
+        "MeshTools::" << Debug::nospace << name << Debug::nospace << "(): expected joint ID, weight and destination view size" << srcSize << "but got" << jointIds.size()[0] << Debug::nospace << "," << weights.size()[0] << "and" << dstSize, false);
+    CORRADE_ASSERT(jointIds.size()[1] == weights.size()[1],
+        "MeshTools::" << Debug::nospace << name << Debug::nospace << "(): expected" << jointIds.size()[1] << "weights per vertex but got" << weights.size()[1], false);
+    return true;
+}
+#endif
+
+/* Blended transformation of a single vertex */
+inline Matrix4 blendPalette(const char* const name, const Containers::StridedArrayView1D<const Matrix4>& palette, const Containers::StridedArrayView1D<const UnsignedInt>& jointIds, const Containers::StridedArrayView1D<const Float>& weights) {
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(name);
+    #endif
+    Matrix4 out{Math::ZeroInit};
+    for(std::size_t i = 0; i != jointIds.size(); ++i) {
+        const UnsignedInt id = jointIds[i];
+        CORRADE_ASSERT(id < palette.size(),
+            "MeshTools::" << Debug::nospace << name << Debug::nospace << "(): joint ID" << id << "out of range for" << palette.size() << "palette entries", {});
+        const Float weight = weights[i];
+        const Matrix4& m = palette[id];
+        for(std::size_t c = 0; c != 4; ++c)
+            out[c] += m[c]*weight;
+    }
+    return out;
+}
+
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<Matrix4>& palette) {
+    paletteInto(skin, jointTransformations, palette);
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<Matrix3x4>& palette) {
+    paletteInto(skin, jointTransformations, palette);
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<DualQuaternion>& palette) {
+    paletteInto(skin, jointTransformations, palette);
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<Matrix4>& palettes, const std::size_t threadCount) {
+    paletteInto(skin, jointTransformations, palettes, threadCount);
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<Matrix3x4>& palettes, const std::size_t threadCount) {
+    paletteInto(skin, jointTransformations, palettes, threadCount);
+}
+
+void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<DualQuaternion>& palettes, const std::size_t threadCount) {
+    paletteInto(skin, jointTransformations, palettes, threadCount);
+}
+
+void skinPointsInto(const Containers::StridedArrayView1D<const Matrix4>& palette, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3>& points, const Containers::StridedArrayView1D<Vector3>& dst) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkSkinInputs("skinPointsInto", jointIds, weights, points.size(), dst.size())) return;
+    #endif
+    for(std::size_t i = 0; i != points.size(); ++i)
+        dst[i] = blendPalette("skinPointsInto", palette, jointIds[i], weights[i]).transformPoint(points[i]);
+}
+
+void skinNormalsInto(const Containers::StridedArrayView1D<const Matrix4>& palette, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<Vector3>& dst) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkSkinInputs("skinNormalsInto", jointIds, weights, normals.size(), dst.size())) return;
+    #endif
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        dst[i] = (blendPalette("skinNormalsInto", palette, jointIds[i], weights[i]).normalMatrix()*normals[i]).normalized();
+}
+
+}}
@@ -0,0 +1,154 @@
+#ifndef Magnum_MeshTools_Skin_h
+#define Magnum_MeshTools_Skin_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::skinningPaletteInto(), @ref Magnum::MeshTools::skinPointsInto(), @ref Magnum::MeshTools::skinNormalsInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Calculate a skinning palette
+@param[in]  skin                    Skin
+@param[in]  jointTransformations    Absolute joint transformations, indexed
+    by object ID
+@param[out] palette                 Where to put the palette
+@m_since_latest
+
+For every joint @f$ i @f$ in @ref Trade::SkinData3D::joints() calculates
+@cpp jointTransformations[joints[i]]*inverseBindMatrices[i] @ce, i.e. the
+matrix that transforms a vertex from the bind pose to its current position.
+The @p jointTransformations are expected to be indexed by object ID, so a
+world transformation array calculated for the whole scene can be passed
+directly, and to be large enough to contain all joints in the skin. The
+@p palette view is expected to have the same size as
+@ref Trade::SkinData3D::joints().
+
+The products are calculated in blocks using @ref Math::multiplyInto(), so the
+gather of joint transformations is the only non-sequential memory access.
+@see @ref skinPointsInto(), @ref skinNormalsInto()
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<Matrix4>& palette);
+
+/**
+@brief Calculate a skinning palette with matrices packed into three rows
+@m_since_latest
+
+Same as @ref skinningPaletteInto(const Trade::SkinData3D&, const Containers::StridedArrayView1D<const Matrix4>&, const Containers::StridedArrayView1D<Matrix4>&),
+but saves a quarter of the memory by omitting the constant last row of each
+matrix. The @ref Matrix3x4 columns are the first three rows of the original
+matrix, which matches a @glsl mat3x4 @ce uniform layout where a vertex is
+transformed as @glsl vec4(position, 1.0)*palette[i] @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<Matrix3x4>& palette);
+
+/**
+@brief Calculate a skinning palette with dual quaternions
+@m_since_latest
+
+Same as @ref skinningPaletteInto(const Trade::SkinData3D&, const Containers::StridedArrayView1D<const Matrix4>&, const Containers::StridedArrayView1D<Matrix4>&),
+but converts the result to dual quaternions for use with dual quaternion
+skinning. Expects that the resulting transformations are rigid, see
+@ref DualQuaternion::fromMatrix() for details.
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView1D<const Matrix4>& jointTransformations, const Containers::StridedArrayView1D<DualQuaternion>& palette);
+
+/**
+@brief Calculate skinning palettes for multiple instances of a skin
+@param[in]  skin                    Skin
+@param[in]  jointTransformations    Absolute joint transformations, first
+    dimension being the instance and second indexed by object ID
+@param[out] palettes                Where to put the palettes, first dimension
+    being the instance and second the joint
+@param[in]  threadCount             Thread count. If @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@m_since_latest
+
+Equivalent to calling @ref skinningPaletteInto(const Trade::SkinData3D&, const Containers::StridedArrayView1D<const Matrix4>&, const Containers::StridedArrayView1D<Matrix4>&)
+for each instance, with the instances split into contiguous ranges processed
+in parallel. Expects that the first dimension of @p jointTransformations and
+@p palettes has the same size. On Emscripten the instances are always
+processed serially.
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<Matrix4>& palettes, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<Matrix3x4>& palettes, std::size_t threadCount = 0);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void skinningPaletteInto(const Trade::SkinData3D& skin, const Containers::StridedArrayView2D<const Matrix4>& jointTransformations, const Containers::StridedArrayView2D<DualQuaternion>& palettes, std::size_t threadCount = 0);
+
+/**
+@brief Skin points on the CPU
+@param[in]  palette     Skinning palette
+@param[in]  jointIds    Joint IDs, first dimension being the vertex and second
+    the influence
+@param[in]  weights     Joint weights, same layout as @p jointIds
+@param[in]  points      Points in the bind pose
+@param[out] dst         Where to put the skinned points
+@m_since_latest
+
+Reference linear blend skinning implementation, calculating
+@f$ \boldsymbol{p}' = \left(\sum_j w_j \boldsymbol{P}_{i_j}\right) \boldsymbol{p} @f$
+for every point. Useful for verifying GPU skinning or for processing a mesh
+once, such as for baking a pose or calculating bounds. Expects that
+@p jointIds, @p weights, @p points and @p dst have the same size in the first
+dimension, that @p jointIds and @p weights have the same size in the second
+dimension and that all joint IDs are in bounds of @p palette. The weights are
+used as-is, they're not normalized. The @p dst view is allowed to alias
+@p points.
+@see @ref skinningPaletteInto(), @ref Matrix4::transformPoint()
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinPointsInto(const Containers::StridedArrayView1D<const Matrix4>& palette, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3>& points, const Containers::StridedArrayView1D<Vector3>& dst);
+
+/**
+@brief Skin normals on the CPU
+@m_since_latest
+
+Like @ref skinPointsInto(), but transforms the normals with
+@ref Matrix4::normalMatrix() of the blended matrix and normalizes the result,
+so the output is correct also for non-uniformly scaled joints.
+@see @ref Math::Vector::normalized()
+*/
+MAGNUM_MESHTOOLS_EXPORT void skinNormalsInto(const Containers::StridedArrayView1D<const Matrix4>& palette, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3>& normals, const Containers::StridedArrayView1D<Vector3>& dst);
+
+}}
+
+#endif
@@ -0,0 +1,331 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Skin.h"
+#include "Magnum/Trade/SkinData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SkinTest: TestSuite::Tester {
+    explicit SkinTest();
+
+    void palette();
+    void paletteMatrix3x4();
+    void paletteDualQuaternion();
+    void paletteMultipleBlocks();
+    void paletteMultipleInstances();
+    void paletteInvalid();
+    void paletteMultipleInstancesInvalid();
+
+    void skinPoints();
+    void skinNormals();
+    void skinInvalid();
+};
+
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} MultipleInstancesData[]{
+    {"single thread", 1},
+    {"three threads", 3},
+    {"hardware concurrency", 0}
+};
+
+using namespace Math::Literals;
+
+SkinTest::SkinTest() {
+    addTests({&SkinTest::palette,
+              &SkinTest::paletteMatrix3x4,
+              &SkinTest::paletteDualQuaternion,
+              &SkinTest::paletteMultipleBlocks});
+
+    addInstancedTests({&SkinTest::paletteMultipleInstances},
+        Containers::arraySize(MultipleInstancesData));
+
+    addTests({&SkinTest::paletteInvalid,
+              &SkinTest::paletteMultipleInstancesInvalid,
+
+              &SkinTest::skinPoints,
+              &SkinTest::skinNormals,
+              &SkinTest::skinInvalid});
+}
+
+/* Rigid transformations, so they can be converted to dual quaternions as
+   well */
+const Matrix4 JointTransformations[]{
+    Matrix4::translation({1.0f, 2.0f, 3.0f}),
+    Matrix4::rotationZ(90.0_degf),
+    Matrix4::translation({0.0f, -1.0f, 0.0f})*Matrix4::rotationX(35.0_degf),
+    Matrix4::rotationY(-45.0_degf)*Matrix4::translation({2.0f, 0.0f, 0.5f})
+};
+
+Trade::SkinData3D skin() {
+    return Trade::SkinData3D{{3, 0, 2}, {
+        Matrix4::translation({0.0f, 0.0f, -1.0f}),
+        Matrix4::rotationY(15.0_degf),
+        Matrix4::translation({3.0f, 0.5f, 0.0f})*Matrix4::rotationZ(-60.0_degf)
+    }};
+}
+
+void SkinTest::palette() {
+    Trade::SkinData3D data = skin();
+
+    Matrix4 out[3];
+    skinningPaletteInto(data, JointTransformations, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView<Matrix4>({
+        JointTransformations[3]*data.inverseBindMatrices()[0],
+        JointTransformations[0]*data.inverseBindMatrices()[1],
+        JointTransformations[2]*data.inverseBindMatrices()[2]
+    }), TestSuite::Compare::Container);
+}
+
+void SkinTest::paletteMatrix3x4() {
+    Trade::SkinData3D data = skin();
+
+    Matrix4 expected[3];
+    skinningPaletteInto(data, JointTransformations, expected);
+
+    Matrix3x4 out[3];
+    skinningPaletteInto(data, JointTransformations, out);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(out[i], (Matrix3x4{expected[i].row(0), expected[i].row(1), expected[i].row(2)}));
+
+        /* Transforming a point with the transposed matrix gives the same
+           result */
+        const Vector3 point{1.0f, -2.0f, 0.5f};
+        CORRADE_COMPARE(out[i].transposed()*(Vector4{point, 1.0f}), expected[i].transformPoint(point));
+    }
+}
+
+void SkinTest::paletteDualQuaternion() {
+    Trade::SkinData3D data = skin();
+
+    Matrix4 expected[3];
+    skinningPaletteInto(data, JointTransformations, expected);
+
+    DualQuaternion out[3];
+    skinningPaletteInto(data, JointTransformations, out);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(out[i].toMatrix(), expected[i]);
+    }
+}
+
+void SkinTest::paletteMultipleBlocks() {
+    /* More joints than the internal block size and not divisible by it */
+    Containers::Array<UnsignedInt> joints{Containers::NoInit, 19};
+    Containers::Array<Matrix4> inverseBindMatrices{Containers::NoInit, 19};
+    for(std::size_t i = 0; i != joints.size(); ++i) {
+        joints[i] = (i*3)%4;
+        inverseBindMatrices[i] = Matrix4::translation(Vector3::xAxis(Float(i)));
+    }
+    Trade::SkinData3D data{std::move(joints), std::move(inverseBindMatrices)};
+
+    Matrix4 out[19];
+    skinningPaletteInto(data, JointTransformations, out);
+    for(std::size_t i = 0; i != 19; ++i) {
+        CORRADE_COMPARE(out[i], (JointTransformations[(i*3)%4]*data.inverseBindMatrices()[i]));
+    }
+}
+
+void SkinTest::paletteMultipleInstances() {
+    auto&& instanceData = MultipleInstancesData[testCaseInstanceId()];
+    setTestCaseDescription(instanceData.name);
+
+    Trade::SkinData3D data = skin();
+
+    /* Seven instances with four objects each, every instance moved a bit */
+    Matrix4 jointTransformations[7*4];
+    for(std::size_t i = 0; i != 7; ++i)
+        for(std::size_t j = 0; j != 4; ++j)
+            jointTransformations[i*4 + j] = Matrix4::translation(Vector3::yAxis(Float(i)))*JointTransformations[j];
+
+    Matrix4 out[7*3];
+    DualQuaternion outDualQuaternion[7*3];
+    skinningPaletteInto(data,
+        Containers::StridedArrayView2D<const Matrix4>{jointTransformations, {7, 4}},
+        Containers::StridedArrayView2D<Matrix4>{out, {7, 3}},
+        instanceData.threadCount);
+    skinningPaletteInto(data,
+        Containers::StridedArrayView2D<const Matrix4>{jointTransformations, {7, 4}},
+        Containers::StridedArrayView2D<DualQuaternion>{outDualQuaternion, {7, 3}},
+        instanceData.threadCount);
+
+    for(std::size_t i = 0; i != 7; ++i) {
+        Matrix4 expected[3];
+        skinningPaletteInto(data, Containers::arrayView(jointTransformations).slice(i*4, i*4 + 4), expected);
+        CORRADE_COMPARE_AS(Containers::arrayView(out).slice(i*3, i*3 + 3),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE(outDualQuaternion[i*3 + j].toMatrix(), expected[j]);
+    }
+}
+
+void SkinTest::paletteInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Trade::SkinData3D data = skin();
+
+    Matrix4 out[3];
+    Matrix4 outWrongSize[2];
+
+    std::ostringstream ss;
+    Error redirectError{&ss};
+    skinningPaletteInto(data, JointTransformations, outWrongSize);
+    skinningPaletteInto(data, Containers::arrayView(JointTransformations).prefix(3), out);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::skinningPaletteInto(): expected palette size 3 but got 2\n"
+        "MeshTools::skinningPaletteInto(): joint 0 references object 3 but only 3 joint transformations were passed\n");
+}
+
+void SkinTest::paletteMultipleInstancesInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Trade::SkinData3D data = skin();
+
+    Matrix4 jointTransformations[2*4];
+    Matrix4 out[3*3];
+    Matrix4 outWrongSize[2*2];
+
+    std::ostringstream ss;
+    Error redirectError{&ss};
+    skinningPaletteInto(data,
+        Containers::StridedArrayView2D<const Matrix4>{jointTransformations, {2, 4}},
+        Containers::StridedArrayView2D<Matrix4>{out, {3, 3}});
+    skinningPaletteInto(data,
+        Containers::StridedArrayView2D<const Matrix4>{jointTransformations, {2, 4}},
+        Containers::StridedArrayView2D<Matrix4>{outWrongSize, {2, 2}});
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::skinningPaletteInto(): expected 2 palettes but got 3\n"
+        "MeshTools::skinningPaletteInto(): expected palette size 3 but got 2\n");
+}
+
+void SkinTest::skinPoints() {
+    const Matrix4 palette[]{
+        Matrix4::translation({2.0f, 0.0f, 0.0f}),
+        Matrix4::translation({0.0f, 4.0f, 0.0f}),
+        Matrix4::scaling(Vector3{2.0f})
+    };
+    const UnsignedInt jointIds[]{
+        0, 1,
+        2, 0,
+        1, 1
+    };
+    const Float weights[]{
+        0.5f, 0.5f,
+        1.0f, 0.0f,
+        0.25f, 0.75f
+    };
+    Vector3 points[]{
+        {1.0f, 1.0f, 1.0f},
+        {1.0f, 2.0f, 3.0f},
+        {0.0f, 0.0f, -1.0f}
+    };
+
+    /* In-place, the destination is allowed to alias the source */
+    skinPointsInto(palette,
+        Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {3, 2}},
+        Containers::StridedArrayView2D<const Float>{weights, {3, 2}},
+        points, points);
+    CORRADE_COMPARE_AS(Containers::arrayView(points), Containers::arrayView<Vector3>({
+        {2.0f, 3.0f, 1.0f},
+        {2.0f, 4.0f, 6.0f},
+        {0.0f, 4.0f, -1.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void SkinTest::skinNormals() {
+    const Matrix4 palette[]{
+        Matrix4::rotationZ(90.0_degf),
+        Matrix4::scaling({1.0f, 4.0f, 1.0f})*Matrix4::translation({5.0f, 0.0f, 0.0f})
+    };
+    const UnsignedInt jointIds[]{0, 1};
+    const Float weights[]{1.0f, 1.0f};
+    const Vector3 normals[]{
+        {1.0f, 0.0f, 0.0f},
+        Vector3{1.0f, 1.0f, 0.0f}.normalized()
+    };
+
+    Vector3 out[2];
+    skinNormalsInto(palette,
+        Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {2, 1}},
+        Containers::StridedArrayView2D<const Float>{weights, {2, 1}},
+        normals, out);
+    CORRADE_COMPARE(out[0], (Vector3{0.0f, 1.0f, 0.0f}));
+    /* Non-uniform scale makes the normal lean away from the stretched axis,
+       the translation is ignored */
+    CORRADE_COMPARE(out[1], (Vector3{4.0f, 1.0f, 0.0f}.normalized()));
+}
+
+void SkinTest::skinInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Matrix4 palette[2];
+    const UnsignedInt jointIds[3*2]{};
+    const UnsignedInt jointIdsOutOfRange[]{0, 1, 1, 2, 0, 0};
+    const Float weights[3*2]{};
+    const Float weightsWrongCount[3*3]{};
+    const Vector3 points[3];
+    Vector3 out[3];
+    Vector3 outWrongSize[2];
+
+    std::ostringstream ss;
+    Error redirectError{&ss};
+    skinPointsInto(palette,
+        Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {3, 2}},
+        Containers::StridedArrayView2D<const Float>{weights, {3, 2}},
+        points, outWrongSize);
+    skinNormalsInto(palette,
+        Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {3, 2}},
+        Containers::StridedArrayView2D<const Float>{weightsWrongCount, {3, 3}},
+        points, out);
+    skinPointsInto(palette,
+        Containers::StridedArrayView2D<const UnsignedInt>{jointIdsOutOfRange, {3, 2}},
+        Containers::StridedArrayView2D<const Float>{weights, {3, 2}},
+        points, out);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::skinPointsInto(): expected joint ID, weight and destination view size 3 but got 3, 3 and 2\n"
+        "MeshTools::skinNormalsInto(): expected 2 weights per vertex but got 3\n"
+        "MeshTools::skinPointsInto(): joint ID 2 out of range for 2 palette entries\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SkinTest)
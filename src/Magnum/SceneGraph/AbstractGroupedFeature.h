@@ -100,6 +100,8 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
 
     private:
         FeatureGroup<dimensions, Derived, T>* _group;
+        /* Position in _group, for O(1) removal */
+        std::size_t _groupIndex;
 };
 
 /**
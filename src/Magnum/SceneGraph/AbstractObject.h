@@ -31,9 +31,11 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -74,7 +76,7 @@ class documentation or @ref compilation-speedup-hpp for more information.
 */
 template<UnsignedInt dimensions, class T> class AbstractObject
     #ifndef DOXYGEN_GENERATING_OUTPUT
-    : private Containers::LinkedList<AbstractFeature<dimensions, T>>
+    : private Containers::LinkedList<AbstractFeature<dimensions, T>>, public Implementation::PoolAllocated
     #endif
 {
     public:
@@ -185,6 +187,23 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, finalTransformationMatrix);
         }
 
+        /**
+         * @brief Calculate transformation matrices of given set of objects relative to this object into given storage
+         * @m_since_latest
+         *
+         * Same as @ref transformationMatrices(), but puts the result into
+         * @p transformationMatrices, which is expected to have the same size
+         * as @p objects. Doesn't allocate once the internal temporary storage
+         * is large enough, see @ref Object::transformationMatricesInto() for
+         * more information.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe
+         *      @ref Object::transformationMatricesInto() when possible.
+         */
+        void transformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType()) const {
+            doTransformationMatricesInto(objects, transformationMatrices, finalTransformationMatrix);
+        }
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -270,6 +289,7 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const = 0;
+        virtual void doTransformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
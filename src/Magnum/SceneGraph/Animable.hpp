@@ -29,7 +29,10 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Timeline.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
@@ -66,79 +69,111 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
+template<UnsignedInt dimensions, class T> bool AnimableGroup<dimensions, T>::stepState(Animable<dimensions, T>& animable, const Float time, const Float delta) {
+    /* The animation was stopped recently, just decrease count of running
+       animations if the animation was running before */
+    if(animable._previousState != AnimationState::Stopped && animable._currentState == AnimationState::Stopped) {
+        if(animable._previousState == AnimationState::Running)
+            --_runningCount;
+        animable._previousState = AnimationState::Stopped;
+        animable.animationStopped();
+        return false;
+
+    /* The animation was paused recently, set pause time to previous frame time */
+    } else if(animable._previousState == AnimationState::Running && animable._currentState == AnimationState::Paused) {
+        animable._previousState = AnimationState::Paused;
+        animable._pauseTime = time;
+        --_runningCount;
+        animable.animationPaused();
+        return false;
+
+    /* Skip the rest for not running animations */
+    } else if(animable._currentState != AnimationState::Running) {
+        CORRADE_INTERNAL_ASSERT(animable._previousState == animable._currentState);
+        return false;
+
+    /* The animation was started recently, set start time to previous frame
+       time, reset repeat count */
+    } else if(animable._previousState == AnimationState::Stopped) {
+        animable._previousState = AnimationState::Running;
+        animable._startTime = time;
+        animable._repeats = 0;
+        ++_runningCount;
+        animable.animationStarted();
+
+    /* The animation was resumed recently, add pause duration to start time */
+    } else if(animable._previousState == AnimationState::Paused) {
+        animable._previousState = AnimationState::Running;
+        animable._startTime += time - animable._pauseTime;
+        ++_runningCount;
+        animable.animationResumed();
+    }
+
+    CORRADE_INTERNAL_ASSERT(animable._previousState == AnimationState::Running);
+
+    /* Animation time exceeded duration */
+    if(animable._duration != 0.0f && time-animable._startTime > animable._duration) {
+        /* Not repeated or repeat count exceeded, stop */
+        if(!animable._repeated || animable._repeats + 1 == animable._repeatCount) {
+            animable._previousState = AnimationState::Stopped;
+            animable._currentState = AnimationState::Stopped;
+            --_runningCount;
+            animable.animationStopped();
+            return false;
+        }
+
+        /* Increase repeat count and add duration to startTime */
+        ++animable._repeats;
+        animable._startTime += animable._duration;
+    }
+
+    /* Animation is still running, perform animation step */
+    CORRADE_ASSERT(time - animable._startTime >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", false);
+    CORRADE_ASSERT(delta >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): negative delta passed", false);
+    return true;
+}
+
 template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
     if(!_runningCount && !wakeUp) return;
     wakeUp = false;
 
     for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
         Animable<dimensions, T>& animable = (*this)[i];
+        if(stepState(animable, time, delta))
+            animable.animationStep(time - animable._startTime, delta);
+    }
 
-        /* The animation was stopped recently, just decrease count of running
-           animations if the animation was running before */
-        if(animable._previousState != AnimationState::Stopped && animable._currentState == AnimationState::Stopped) {
-            if(animable._previousState == AnimationState::Running)
-                --_runningCount;
-            animable._previousState = AnimationState::Stopped;
-            animable.animationStopped();
-            continue;
-
-        /* The animation was paused recently, set pause time to previous frame time */
-        } else if(animable._previousState == AnimationState::Running && animable._currentState == AnimationState::Paused) {
-            animable._previousState = AnimationState::Paused;
-            animable._pauseTime = time;
-            --_runningCount;
-            animable.animationPaused();
-            continue;
-
-        /* Skip the rest for not running animations */
-        } else if(animable._currentState != AnimationState::Running) {
-            CORRADE_INTERNAL_ASSERT(animable._previousState == animable._currentState);
-            continue;
-
-        /* The animation was started recently, set start time to previous frame
-           time, reset repeat count */
-        } else if(animable._previousState == AnimationState::Stopped) {
-            animable._previousState = AnimationState::Running;
-            animable._startTime = time;
-            animable._repeats = 0;
-            ++_runningCount;
-            animable.animationStarted();
-
-        /* The animation was resumed recently, add pause duration to start time */
-        } else if(animable._previousState == AnimationState::Paused) {
-            animable._previousState = AnimationState::Running;
-            animable._startTime += time - animable._pauseTime;
-            ++_runningCount;
-            animable.animationResumed();
-        }
+    CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+}
 
-        CORRADE_INTERNAL_ASSERT(animable._previousState == AnimationState::Running);
-
-        /* Animation time exceeded duration */
-        if(animable._duration != 0.0f && time-animable._startTime > animable._duration) {
-            /* Not repeated or repeat count exceeded, stop */
-            if(!animable._repeated || animable._repeats + 1 == animable._repeatCount) {
-                animable._previousState = AnimationState::Stopped;
-                animable._currentState = AnimationState::Stopped;
-                --_runningCount;
-                animable.animationStopped();
-                continue;
-            }
-
-            /* Increase repeat count and add duration to startTime */
-            ++animable._repeats;
-            animable._startTime += animable._duration;
-        }
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta, const std::size_t threadCount) {
+    if(!_runningCount && !wakeUp) return;
+    wakeUp = false;
 
-        /* Animation is still running, perform animation step */
-        CORRADE_ASSERT(time - animable._startTime >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
-        CORRADE_ASSERT(delta >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable._startTime, delta);
+    /* Update the state serially first so the state change callbacks get
+       called in a deterministic order, gathering animables to step */
+    Containers::Array<Animable<dimensions, T>*> running{Containers::NoInit, AnimableGroup<dimensions, T>::size()};
+    std::size_t runningCount = 0;
+    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
+        Animable<dimensions, T>& animable = (*this)[i];
+        if(stepState(animable, time, delta))
+            running[runningCount++] = &animable;
     }
 
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+
+    /* Then step all running animables in parallel */
+    struct State {
+        Animable<dimensions, T>** animables;
+        Float time, delta;
+    } state{running.data(), time, delta};
+    Magnum::Implementation::parallelFor(runningCount, Magnum::Implementation::parallelChunkCount(runningCount, threadCount), [](void* state, std::size_t, std::size_t begin, std::size_t end) {
+        const State& s = *static_cast<const State*>(state);
+        for(std::size_t i = begin; i != end; ++i)
+            s.animables[i]->animationStep(s.time - s.animables[i]->_startTime, s.delta);
+    }, &state);
 }
 
 }}
@@ -68,7 +68,34 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          */
         void step(Float time, Float delta);
 
+        /**
+         * @brief Perform animation step on multiple threads
+         * @param time          Absolute time (e.g. @ref Timeline::previousFrameTime())
+         * @param delta         Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
+         * @param threadCount   Thread count. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         * @m_since_latest
+         *
+         * Equivalent to @ref step(Float, Float), except that
+         * @ref Animable::animationStep() of all running animables is called
+         * concurrently from up to @p threadCount threads, so it has to be
+         * safe to call it on different animables at the same time. The
+         * @ref Animable::animationStarted(), @ref Animable::animationStopped()
+         * "animationStopped()", @ref Animable::animationPaused() "animationPaused()"
+         * and @ref Animable::animationResumed() "animationResumed()"
+         * callbacks are all called from the calling thread in the order the
+         * animables are stored in the group, before any
+         * @ref Animable::animationStep() "animationStep()" gets called. On
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the animables are always
+         * stepped serially.
+         */
+        void step(Float time, Float delta, std::size_t threadCount);
+
     private:
+        /* Updates state of given animable, calling the state change
+           callbacks. Returns true if animationStep() should be called. */
+        bool stepState(Animable<dimensions, T>& animable, Float time, Float delta);
+
         std::size_t _runningCount;
         bool wakeUp;
 };
@@ -0,0 +1,458 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_h
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BoundingVolume, @ref Magnum::SceneGraph::BoundingVolumeHierarchy, alias @ref Magnum::SceneGraph::BasicBoundingVolume2D, @ref Magnum::SceneGraph::BasicBoundingVolume3D, @ref Magnum::SceneGraph::BasicBoundingVolumeHierarchy2D, @ref Magnum::SceneGraph::BasicBoundingVolumeHierarchy3D, typedef @ref Magnum::SceneGraph::BoundingVolume2D, @ref Magnum::SceneGraph::BoundingVolume3D, @ref Magnum::SceneGraph::BoundingVolumeHierarchy2D, @ref Magnum::SceneGraph::BoundingVolumeHierarchy3D
+ * @m_since_latest
+ */
+
+#include <vector>
+#include <functional>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Bounding volume
+@m_since_latest
+
+Attaches an axis-aligned bounding box to an object and puts it into a
+@ref BoundingVolumeHierarchy. The box is specified relative to the object,
+i.e. in the same space as for example vertices of a mesh drawn by a
+@ref Drawable attached to the same object, and its absolute position is
+updated automatically when the object transformation changes. See
+@ref BoundingVolumeHierarchy for more information.
+
+@section SceneGraph-BoundingVolume-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref BoundingVolumeHierarchy.hpp implementation file to
+avoid linker errors. See also @ref compilation-speedup-hpp for more
+information.
+
+-   @ref BoundingVolume2D
+-   @ref BoundingVolume3D
+
+@see @ref scenegraph, @ref BasicBoundingVolume2D, @ref BasicBoundingVolume3D,
+    @ref BoundingVolume2D, @ref BoundingVolume3D
+*/
+template<UnsignedInt dimensions, class T> class BoundingVolume: public AbstractFeature<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this bounding volume belongs to
+         * @param box       Bounding box relative to @p object
+         * @param hierarchy Hierarchy this bounding volume belongs to
+         *
+         * Adds the feature to the object and also to the hierarchy, if
+         * specified. Otherwise you can use
+         * @ref BoundingVolumeHierarchy::add().
+         */
+        explicit BoundingVolume(AbstractObject<dimensions, T>& object, const RangeTypeFor<dimensions, T>& box, BoundingVolumeHierarchy<dimensions, T>* hierarchy = nullptr);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the feature from the object and from the hierarchy, if it
+         * belongs to any.
+         */
+        ~BoundingVolume();
+
+        /**
+         * @brief Hierarchy containing this bounding volume
+         *
+         * If the bounding volume doesn't belong to any hierarchy, returns
+         * @cpp nullptr @ce.
+         */
+        BoundingVolumeHierarchy<dimensions, T>* hierarchy() { return _hierarchy; }
+
+        /** @overload */
+        const BoundingVolumeHierarchy<dimensions, T>* hierarchy() const { return _hierarchy; }
+
+        /** @brief Bounding box relative to the object */
+        RangeTypeFor<dimensions, T> box() const { return _box; }
+
+        /**
+         * @brief Set bounding box relative to the object
+         * @return Reference to self (for method chaining)
+         *
+         * The change is reflected in the hierarchy on next
+         * @ref BoundingVolumeHierarchy::update().
+         */
+        BoundingVolume<dimensions, T>& setBox(const RangeTypeFor<dimensions, T>& box);
+
+        /**
+         * @brief Absolute bounding box
+         *
+         * Axis-aligned box enclosing @ref box() transformed with absolute
+         * transformation of the object. Updated on
+         * @ref BoundingVolumeHierarchy::update() or when the object gets
+         * cleaned, until then it may be out of date.
+         */
+        RangeTypeFor<dimensions, T> absoluteBox() const { return _absoluteBox; }
+
+    private:
+        friend BoundingVolumeHierarchy<dimensions, T>;
+
+        void markDirty() override;
+        void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override;
+
+        BoundingVolumeHierarchy<dimensions, T>* _hierarchy;
+        RangeTypeFor<dimensions, T> _box;
+        RangeTypeFor<dimensions, T> _absoluteBox;
+        /* Leaf node in the hierarchy, -1 if not inserted yet */
+        Int _node;
+        /* Position in the hierarchy update list, -1 if not there */
+        Int _updateIndex;
+        /* Whether the absolute box needs to be recalculated */
+        bool _absoluteBoxDirty;
+};
+
+/**
+@brief Bounding volume hierarchy
+@m_since_latest
+
+A dynamic tree of axis-aligned bounding boxes over a set of
+@ref BoundingVolume features, allowing to find volumes intersecting a given
+range, sphere, ray or, in 3D, a frustum without checking every object in the
+scene. Useful for picking, proximity queries and culling in scenes with a
+large amount of moving objects.
+
+@section SceneGraph-BoundingVolumeHierarchy-usage Usage
+
+Attach a @ref BoundingVolume with a box relative to the object to each object
+that should be queryable and add it to the hierarchy, either via the
+constructor or using @ref add(). Objects in the hierarchy can be then queried
+using @ref intersectRange(), @ref intersectSphere(), @ref intersectRay() or
+@ref intersectFrustum():
+
+@snippet MagnumSceneGraph.cpp BoundingVolumeHierarchy-usage
+
+The returned volumes are in no particular order, except for
+@ref intersectRay() which sorts them by distance from the ray origin. The
+object or any other feature attached to it, such as a @ref Drawable, can be
+then reached via @ref BoundingVolume::object().
+
+@section SceneGraph-BoundingVolumeHierarchy-updates Incremental updates
+
+When an object transformation changes, @ref Object::setDirty() notifies the
+bounding volumes attached to it and all its children, which put themselves on
+a list of volumes to update. On next @ref update() --- which is done
+implicitly by all queries --- only the volumes on this list are processed.
+Their objects get cleaned together using
+@ref AbstractObject::setClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&),
+which means their transformations are calculated in a single pass with
+shared parent transformations calculated just once.
+
+Each leaf in the tree stores a box enlarged by @ref margin(). A volume that
+moved but stayed inside its enlarged box doesn't need any change in the tree,
+only volumes that moved outside are removed and inserted again. The insertion
+picks a place in the tree that increases the total surface area of the nodes
+the least and the tree is kept balanced using rotations, so the query cost
+stays logarithmic even after many updates.
+
+@section SceneGraph-BoundingVolumeHierarchy-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref BoundingVolumeHierarchy.hpp implementation file to
+avoid linker errors. See also @ref compilation-speedup-hpp for more
+information.
+
+-   @ref BoundingVolumeHierarchy2D
+-   @ref BoundingVolumeHierarchy3D
+
+@see @ref scenegraph, @ref BasicBoundingVolumeHierarchy2D,
+    @ref BasicBoundingVolumeHierarchy3D, @ref BoundingVolumeHierarchy2D,
+    @ref BoundingVolumeHierarchy3D
+*/
+template<UnsignedInt dimensions, class T> class BoundingVolumeHierarchy {
+    public:
+        /** @brief Vector type */
+        typedef VectorTypeFor<dimensions, T> VectorType;
+
+        /** @brief Range type */
+        typedef RangeTypeFor<dimensions, T> RangeType;
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty hierarchy.
+         */
+        explicit BoundingVolumeHierarchy();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Removes all volumes from the hierarchy, but doesn't delete them.
+         */
+        ~BoundingVolumeHierarchy();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy<dimensions, T>& operator=(const BoundingVolumeHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BoundingVolumeHierarchy<dimensions, T>& operator=(BoundingVolumeHierarchy<dimensions, T>&&) = delete;
+
+        /** @brief Count of volumes in the hierarchy */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the hierarchy is empty */
+        bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Height of the tree
+         *
+         * Count of levels of the tree, @cpp 0 @ce if it's empty. Reflects
+         * the state after last @ref update().
+         */
+        UnsignedInt height() const;
+
+        /**
+         * @brief Leaf margin
+         *
+         * Relative to size of each box, default is @cpp 0.1 @ce.
+         */
+        T margin() const { return _margin; }
+
+        /**
+         * @brief Set leaf margin
+         * @return Reference to self (for method chaining)
+         *
+         * Leaf boxes in the tree are enlarged on each side by @p margin
+         * times their size, so objects that move just a little don't need
+         * to be reinserted. Larger margin means cheaper updates but less
+         * precise tree for the queries. Affects only volumes inserted after
+         * this call. Expects that the margin is not negative.
+         */
+        BoundingVolumeHierarchy<dimensions, T>& setMargin(T margin);
+
+        /**
+         * @brief Add a bounding volume to the hierarchy
+         * @return Reference to self (for method chaining)
+         *
+         * If the volume is part of another hierarchy, it's removed from it.
+         * The volume is inserted into the tree on next @ref update().
+         */
+        BoundingVolumeHierarchy<dimensions, T>& add(BoundingVolume<dimensions, T>& volume);
+
+        /**
+         * @brief Remove a bounding volume from the hierarchy
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the volume is a part of this hierarchy.
+         */
+        BoundingVolumeHierarchy<dimensions, T>& remove(BoundingVolume<dimensions, T>& volume);
+
+        /**
+         * @brief Update the hierarchy
+         *
+         * Recalculates absolute boxes of all volumes that were added, had
+         * their box changed or whose objects got dirty since the last call
+         * and updates the tree accordingly. Called implicitly by
+         * all queries, so there's usually no need to call it directly. See
+         * @ref SceneGraph-BoundingVolumeHierarchy-updates for more
+         * information.
+         */
+        void update();
+
+        /**
+         * @brief Volumes intersecting a range
+         *
+         * Returns all volumes for which @ref BoundingVolume::absoluteBox()
+         * intersects or touches @p range. Calls @ref update() first.
+         */
+        std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> intersectRange(const RangeType& range);
+
+        /**
+         * @brief Volumes intersecting a sphere
+         *
+         * Returns all volumes for which @ref BoundingVolume::absoluteBox()
+         * intersects a sphere or, in 2D, a circle given by @p center and
+         * @p radius. Calls @ref update() first.
+         */
+        std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> intersectSphere(const VectorType& center, T radius);
+
+        /**
+         * @brief Volumes intersecting a ray
+         *
+         * Returns all volumes for which @ref BoundingVolume::absoluteBox()
+         * intersects a ray given by @p origin and @p direction, sorted by
+         * distance of the intersection from @p origin, with volumes that
+         * contain the origin being first. The @p direction doesn't need to
+         * be normalized. Calls @ref update() first.
+         */
+        std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> intersectRay(const VectorType& origin, const VectorType& direction);
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief Volumes intersecting a frustum
+         *
+         * Returns all volumes for which @ref BoundingVolume::absoluteBox()
+         * intersects @p frustum. Like
+         * @ref Math::Intersection::rangeFrustum(), the test is conservative
+         * and may return volumes that are outside of the frustum but close
+         * to its corners. Calls @ref update() first. Available only in 3D.
+         */
+        std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> intersectFrustum(const Math::Frustum<T>& frustum);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 3>::type> std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> intersectFrustum(const Math::Frustum<T>& frustum) {
+            return query([](const void* state, const RangeType& box) {
+                return Math::Intersection::rangeFrustum(box, *static_cast<const Math::Frustum<T>*>(state));
+            }, &frustum);
+        }
+        #endif
+
+    private:
+        friend BoundingVolume<dimensions, T>;
+
+        struct Node;
+
+        Int allocateNode();
+        void freeNode(Int node);
+        void insertLeaf(Int leaf);
+        void removeLeaf(Int leaf);
+        Int balance(Int node);
+        void queueUpdate(BoundingVolume<dimensions, T>& volume);
+        void dequeueUpdate(BoundingVolume<dimensions, T>& volume);
+        /* Returns volumes of all leafs for which the predicate passed on all
+           nodes on the path from root and on the absolute box. Not a
+           template so it can be compiled just once. */
+        std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> query(bool(*predicate)(const void*, const RangeType&), const void* state);
+
+        std::vector<Node> _nodes;
+        Int _root, _freeList;
+        std::size_t _size;
+        T _margin;
+
+        std::vector<BoundingVolume<dimensions, T>*> _updates;
+        /* Reused between update() and query() calls */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _updateObjects;
+        std::vector<Int> _stack;
+};
+
+/**
+@brief Bounding volume for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp BoundingVolume<2, T> @ce. See
+@ref BoundingVolume for more information.
+@see @ref BoundingVolume2D, @ref BasicBoundingVolume3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolume2D = BoundingVolume<2, T>;
+#endif
+
+/**
+@brief Bounding volume for two-dimensional float scenes
+@m_since_latest
+
+@see @ref BoundingVolume3D
+*/
+typedef BasicBoundingVolume2D<Float> BoundingVolume2D;
+
+/**
+@brief Bounding volume for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp BoundingVolume<3, T> @ce. See
+@ref BoundingVolume for more information.
+@see @ref BoundingVolume3D, @ref BasicBoundingVolume2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolume3D = BoundingVolume<3, T>;
+#endif
+
+/**
+@brief Bounding volume for three-dimensional float scenes
+@m_since_latest
+
+@see @ref BoundingVolume2D
+*/
+typedef BasicBoundingVolume3D<Float> BoundingVolume3D;
+
+/**
+@brief Bounding volume hierarchy for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp BoundingVolumeHierarchy<2, T> @ce. See
+@ref BoundingVolumeHierarchy for more information.
+@see @ref BoundingVolumeHierarchy2D, @ref BasicBoundingVolumeHierarchy3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for two-dimensional float scenes
+@m_since_latest
+
+@see @ref BoundingVolumeHierarchy3D
+*/
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+
+/**
+@brief Bounding volume hierarchy for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp BoundingVolumeHierarchy<3, T> @ce. See
+@ref BoundingVolumeHierarchy for more information.
+@see @ref BoundingVolumeHierarchy3D, @ref BasicBoundingVolumeHierarchy2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for three-dimensional float scenes
+@m_since_latest
+
+@see @ref BoundingVolumeHierarchy2D
+*/
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolume<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolume<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolumeHierarchy<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolumeHierarchy<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,476 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref BoundingVolumeHierarchy.h
+ * @m_since_latest
+ */
+
+#include <algorithm>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Cost of a node for the surface area heuristic. In 2D it's the perimeter,
+   in 3D the surface area, both halved as only relative values matter. */
+template<class T> T boundingVolumeCost(const Math::Range2D<T>& box) {
+    const Math::Vector2<T> size = box.size();
+    return size.x() + size.y();
+}
+template<class T> T boundingVolumeCost(const Math::Range3D<T>& box) {
+    const Math::Vector3<T> size = box.size();
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Unlike Math::join(), doesn't treat zero-sized ranges as empty, as points
+   are valid bounding boxes here */
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> boundingVolumeJoin(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+/* Unlike Math::intersects(), treats touching ranges as intersecting */
+template<UnsignedInt dimensions, class T> bool boundingVolumeOverlaps(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+    return (a.max() >= b.min()).all() && (a.min() <= b.max()).all();
+}
+
+/* Slab test, distance is set to the parameter of the entry point or zero if
+   the origin is inside */
+template<UnsignedInt dimensions, class T> bool boundingVolumeRay(const RangeTypeFor<dimensions, T>& box, const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, T& distance) {
+    T start = T(0);
+    T end = Math::Constants<T>::inf();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        if(direction[i] == T(0)) {
+            if(origin[i] < box.min()[i] || origin[i] > box.max()[i])
+                return false;
+            continue;
+        }
+
+        T t1 = (box.min()[i] - origin[i])/direction[i];
+        T t2 = (box.max()[i] - origin[i])/direction[i];
+        if(t1 > t2) std::swap(t1, t2);
+        start = Math::max(start, t1);
+        end = Math::min(end, t2);
+        if(start > end) return false;
+    }
+
+    distance = start;
+    return true;
+}
+
+}
+
+template<UnsignedInt dimensions, class T> struct BoundingVolumeHierarchy<dimensions, T>::Node {
+    /* Enlarged absolute box of the volume for leafs, union of children boxes
+       otherwise */
+    RangeType box;
+    /* Parent node or -1 for the root. For nodes on the free list it's the
+       next free node. */
+    Int parent;
+    /* Both -1 for leafs */
+    Int children[2];
+    /* 0 for leafs, -1 for nodes on the free list */
+    Int height;
+    BoundingVolume<dimensions, T>* volume;
+};
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>::BoundingVolume(AbstractObject<dimensions, T>& object, const RangeTypeFor<dimensions, T>& box, BoundingVolumeHierarchy<dimensions, T>* hierarchy): AbstractFeature<dimensions, T>(object), _hierarchy{}, _box{box}, _node{-1}, _updateIndex{-1}, _absoluteBoxDirty{true} {
+    AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::Absolute);
+    if(hierarchy) hierarchy->add(*this);
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>::~BoundingVolume() {
+    if(_hierarchy) _hierarchy->remove(*this);
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolume<dimensions, T>& BoundingVolume<dimensions, T>::setBox(const RangeTypeFor<dimensions, T>& box) {
+    _box = box;
+    _absoluteBoxDirty = true;
+    if(_hierarchy) _hierarchy->queueUpdate(*this);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolume<dimensions, T>::markDirty() {
+    _absoluteBoxDirty = true;
+    if(_hierarchy) _hierarchy->queueUpdate(*this);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolume<dimensions, T>::clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) {
+    /* Enclose the transformed box in an axis-aligned one */
+    const auto rotationScaling = absoluteTransformationMatrix.rotationScaling();
+    const VectorTypeFor<dimensions, T> halfSize = _box.size()/T(2);
+    VectorTypeFor<dimensions, T> extents;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        extents += VectorTypeFor<dimensions, T>{Math::abs(rotationScaling[i])}*halfSize[i];
+    const VectorTypeFor<dimensions, T> center = absoluteTransformationMatrix.transformPoint(_box.center());
+
+    _absoluteBox = {center - extents, center + extents};
+    _absoluteBoxDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::BoundingVolumeHierarchy(): _root{-1}, _freeList{-1}, _size{}, _margin{T(0.1)} {}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::~BoundingVolumeHierarchy() {
+    for(Node& node: _nodes) if(node.volume) {
+        node.volume->_hierarchy = nullptr;
+        node.volume->_node = -1;
+    }
+    for(BoundingVolume<dimensions, T>* volume: _updates) {
+        volume->_hierarchy = nullptr;
+        volume->_updateIndex = -1;
+    }
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt BoundingVolumeHierarchy<dimensions, T>::height() const {
+    return _root == -1 ? 0 : _nodes[_root].height + 1;
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>& BoundingVolumeHierarchy<dimensions, T>::setMargin(const T margin) {
+    CORRADE_ASSERT(margin >= T(0),
+        "SceneGraph::BoundingVolumeHierarchy::setMargin(): expected non-negative margin, got" << margin, *this);
+    _margin = margin;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>& BoundingVolumeHierarchy<dimensions, T>::add(BoundingVolume<dimensions, T>& volume) {
+    /* Remove from previous hierarchy */
+    if(volume._hierarchy)
+        volume._hierarchy->remove(volume);
+
+    /* The tree gets updated lazily */
+    volume._hierarchy = this;
+    ++_size;
+    queueUpdate(volume);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>& BoundingVolumeHierarchy<dimensions, T>::remove(BoundingVolume<dimensions, T>& volume) {
+    CORRADE_ASSERT(volume._hierarchy == this,
+        "SceneGraph::BoundingVolumeHierarchy::remove(): volume is not a part of this hierarchy", *this);
+
+    dequeueUpdate(volume);
+    if(volume._node != -1) {
+        removeLeaf(volume._node);
+        freeNode(volume._node);
+        volume._node = -1;
+    }
+
+    volume._hierarchy = nullptr;
+    --_size;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::queueUpdate(BoundingVolume<dimensions, T>& volume) {
+    if(volume._updateIndex != -1) return;
+    volume._updateIndex = _updates.size();
+    _updates.push_back(&volume);
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::dequeueUpdate(BoundingVolume<dimensions, T>& volume) {
+    if(volume._updateIndex == -1) return;
+
+    /* Swap with the last and remove that */
+    BoundingVolume<dimensions, T>* last = _updates.back();
+    _updates[volume._updateIndex] = last;
+    last->_updateIndex = volume._updateIndex;
+    _updates.pop_back();
+    volume._updateIndex = -1;
+}
+
+template<UnsignedInt dimensions, class T> Int BoundingVolumeHierarchy<dimensions, T>::allocateNode() {
+    Int node;
+    if(_freeList != -1) {
+        node = _freeList;
+        _freeList = _nodes[node].parent;
+    } else {
+        node = _nodes.size();
+        _nodes.emplace_back();
+    }
+
+    Node& n = _nodes[node];
+    n.parent = -1;
+    n.children[0] = n.children[1] = -1;
+    n.height = 0;
+    n.volume = nullptr;
+    return node;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::freeNode(const Int node) {
+    Node& n = _nodes[node];
+    n.parent = _freeList;
+    n.height = -1;
+    n.volume = nullptr;
+    _freeList = node;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::insertLeaf(const Int leaf) {
+    if(_root == -1) {
+        _root = leaf;
+        _nodes[leaf].parent = -1;
+        return;
+    }
+
+    /* Descend to the sibling that results in the smallest cost increase. The
+       cost of creating a new parent here is twice the area of the joined
+       box, going further down costs the area increase of this node, which
+       is inherited by all nodes below, plus what the child would cost. */
+    const RangeType leafBox = _nodes[leaf].box;
+    Int sibling = _root;
+    while(_nodes[sibling].height > 0) {
+        const Node& n = _nodes[sibling];
+        const T area = Implementation::boundingVolumeCost(n.box);
+        const T joinedArea = Implementation::boundingVolumeCost(Implementation::boundingVolumeJoin<dimensions, T>(n.box, leafBox));
+        const T cost = T(2)*joinedArea;
+        const T inheritanceCost = T(2)*(joinedArea - area);
+
+        T childCost[2];
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Node& child = _nodes[n.children[i]];
+            const T joinedChildArea = Implementation::boundingVolumeCost(Implementation::boundingVolumeJoin<dimensions, T>(child.box, leafBox));
+            childCost[i] = inheritanceCost + (child.height == 0 ? joinedChildArea : joinedChildArea - Implementation::boundingVolumeCost(child.box));
+        }
+
+        if(cost < childCost[0] && cost < childCost[1]) break;
+        sibling = n.children[childCost[0] < childCost[1] ? 0 : 1];
+    }
+
+    /* Create a new parent for the sibling and the leaf */
+    const Int oldParent = _nodes[sibling].parent;
+    const Int newParent = allocateNode();
+    Node& p = _nodes[newParent];
+    p.parent = oldParent;
+    p.box = Implementation::boundingVolumeJoin<dimensions, T>(leafBox, _nodes[sibling].box);
+    p.height = _nodes[sibling].height + 1;
+    p.children[0] = sibling;
+    p.children[1] = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+    if(oldParent == -1) _root = newParent;
+    else {
+        Node& o = _nodes[oldParent];
+        o.children[o.children[0] == sibling ? 0 : 1] = newParent;
+    }
+
+    /* Rebalance and refit the parents */
+    for(Int node = newParent; node != -1; node = _nodes[node].parent) {
+        node = balance(node);
+        Node& n = _nodes[node];
+        const Node& a = _nodes[n.children[0]];
+        const Node& b = _nodes[n.children[1]];
+        n.height = Math::max(a.height, b.height) + 1;
+        n.box = Implementation::boundingVolumeJoin<dimensions, T>(a.box, b.box);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::removeLeaf(const Int leaf) {
+    if(leaf == _root) {
+        _root = -1;
+        return;
+    }
+
+    /* Replace the parent with the sibling */
+    const Int parent = _nodes[leaf].parent;
+    const Int grandParent = _nodes[parent].parent;
+    const Int sibling = _nodes[parent].children[_nodes[parent].children[0] == leaf ? 1 : 0];
+    _nodes[sibling].parent = grandParent;
+    freeNode(parent);
+    if(grandParent == -1) {
+        _root = sibling;
+        return;
+    }
+
+    Node& g = _nodes[grandParent];
+    g.children[g.children[0] == parent ? 0 : 1] = sibling;
+
+    /* Rebalance and refit the rest */
+    for(Int node = grandParent; node != -1; node = _nodes[node].parent) {
+        node = balance(node);
+        Node& n = _nodes[node];
+        const Node& a = _nodes[n.children[0]];
+        const Node& b = _nodes[n.children[1]];
+        n.height = Math::max(a.height, b.height) + 1;
+        n.box = Implementation::boundingVolumeJoin<dimensions, T>(a.box, b.box);
+    }
+}
+
+template<UnsignedInt dimensions, class T> Int BoundingVolumeHierarchy<dimensions, T>::balance(const Int a) {
+    Node& nodeA = _nodes[a];
+    if(nodeA.height == 0) return a;
+
+    /* If one child is deeper than the other by more than one level, rotate
+       it up and move its shallower child under A */
+    const Int difference = _nodes[nodeA.children[1]].height - _nodes[nodeA.children[0]].height;
+    if(difference >= -1 && difference <= 1) return a;
+    const std::size_t up = difference > 1 ? 1 : 0;
+    const Int b = nodeA.children[up];
+    const Int c = nodeA.children[1 - up];
+    Node& nodeB = _nodes[b];
+    Node& nodeC = _nodes[c];
+
+    /* B takes the place of A */
+    nodeB.parent = nodeA.parent;
+    nodeA.parent = b;
+    if(nodeB.parent == -1) _root = b;
+    else {
+        Node& p = _nodes[nodeB.parent];
+        p.children[p.children[0] == a ? 0 : 1] = b;
+    }
+
+    /* The deeper child of B stays under it, the other one goes to A */
+    const Int d = nodeB.children[0];
+    const Int e = nodeB.children[1];
+    const bool keepD = _nodes[d].height > _nodes[e].height;
+    const Int keep = keepD ? d : e;
+    const Int move = keepD ? e : d;
+    nodeB.children[0] = a;
+    nodeB.children[1] = keep;
+    nodeA.children[up] = move;
+    _nodes[move].parent = a;
+
+    nodeA.box = Implementation::boundingVolumeJoin<dimensions, T>(nodeC.box, _nodes[move].box);
+    nodeA.height = Math::max(nodeC.height, _nodes[move].height) + 1;
+    nodeB.box = Implementation::boundingVolumeJoin<dimensions, T>(nodeA.box, _nodes[keep].box);
+    nodeB.height = Math::max(nodeA.height, _nodes[keep].height) + 1;
+    return b;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::update() {
+    if(_updates.empty()) return;
+
+    /* Clean all dirty objects at once, which calls clean() on the volumes
+       and recalculates their absolute boxes */
+    _updateObjects.clear();
+    for(BoundingVolume<dimensions, T>* volume: _updates)
+        if(volume->object().isDirty()) _updateObjects.push_back(volume->object());
+    if(!_updateObjects.empty())
+        AbstractObject<dimensions, T>::setClean(_updateObjects);
+
+    for(BoundingVolume<dimensions, T>* volume: _updates) {
+        /* The object was clean already, but the volume is new or its box
+           changed */
+        if(volume->_absoluteBoxDirty)
+            volume->clean(volume->object().absoluteTransformationMatrix());
+
+        /* If the volume is in the tree and didn't move outside of its
+           enlarged box, there's nothing to do. Otherwise (re)insert it. */
+        Int node = volume->_node;
+        if(node != -1) {
+            if(_nodes[node].box.contains(volume->_absoluteBox)) {
+                volume->_updateIndex = -1;
+                continue;
+            }
+            removeLeaf(node);
+        } else {
+            node = volume->_node = allocateNode();
+            _nodes[node].volume = volume;
+        }
+
+        const VectorType margin = volume->_absoluteBox.size()*_margin;
+        _nodes[node].box = {volume->_absoluteBox.min() - margin,
+                            volume->_absoluteBox.max() + margin};
+        _nodes[node].height = 0;
+        insertLeaf(node);
+        volume->_updateIndex = -1;
+    }
+
+    _updates.clear();
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> BoundingVolumeHierarchy<dimensions, T>::query(bool(*const predicate)(const void*, const RangeType&), const void* const state) {
+    update();
+
+    std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> out;
+    if(_root == -1) return out;
+
+    _stack.clear();
+    _stack.push_back(_root);
+    while(!_stack.empty()) {
+        const Node& node = _nodes[_stack.back()];
+        _stack.pop_back();
+        if(!predicate(state, node.box)) continue;
+
+        if(node.volume) {
+            if(predicate(state, node.volume->_absoluteBox))
+                out.push_back(*node.volume);
+        } else {
+            _stack.push_back(node.children[0]);
+            _stack.push_back(node.children[1]);
+        }
+    }
+
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> BoundingVolumeHierarchy<dimensions, T>::intersectRange(const RangeType& range) {
+    return query([](const void* state, const RangeType& box) {
+        return Implementation::boundingVolumeOverlaps<dimensions, T>(box, *static_cast<const RangeType*>(state));
+    }, &range);
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> BoundingVolumeHierarchy<dimensions, T>::intersectSphere(const VectorType& center, const T radius) {
+    const std::pair<VectorType, T> sphere{center, radius*radius};
+    return query([](const void* state, const RangeType& box) {
+        const auto& sphere = *static_cast<const std::pair<VectorType, T>*>(state);
+        /* Distance from the sphere center to the closest point of the box */
+        const VectorType distance = Math::max(Math::max(box.min() - sphere.first, sphere.first - box.max()), VectorType{});
+        return distance.dot() <= sphere.second;
+    }, &sphere);
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> BoundingVolumeHierarchy<dimensions, T>::intersectRay(const VectorType& origin, const VectorType& direction) {
+    const std::pair<VectorType, VectorType> ray{origin, direction};
+    std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> out = query([](const void* state, const RangeType& box) {
+        const auto& ray = *static_cast<const std::pair<VectorType, VectorType>*>(state);
+        T distance;
+        return Implementation::boundingVolumeRay<dimensions, T>(box, ray.first, ray.second, distance);
+    }, &ray);
+
+    /* Sort by distance. The hits were already verified above, so the
+       distance calculation doesn't fail here. */
+    std::vector<std::pair<T, std::size_t>> distances;
+    distances.reserve(out.size());
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        T distance{};
+        Implementation::boundingVolumeRay<dimensions, T>(out[i].get()._absoluteBox, origin, direction, distance);
+        distances.emplace_back(distance, i);
+    }
+    std::sort(distances.begin(), distances.end());
+
+    std::vector<std::reference_wrapper<BoundingVolume<dimensions, T>>> sorted;
+    sorted.reserve(out.size());
+    for(const std::pair<T, std::size_t>& distance: distances)
+        sorted.push_back(out[distance.second]);
+    return sorted;
+}
+
+}}
+
+#endif
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -186,6 +188,34 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void setViewport(const Vector2i& size);
 
+        /**
+         * @brief Whether frustum culling is enabled
+         * @m_since_latest
+         *
+         * @see @ref setFrustumCullingEnabled()
+         */
+        bool isFrustumCullingEnabled() const { return _frustumCulling; }
+
+        /**
+         * @brief Enable or disable frustum culling
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If enabled, @ref draw(DrawableGroup<dimensions, T>&) transforms
+         * @ref Drawable::boundingBox() of all drawables that have it set to
+         * the camera space, tests them against the view volume given by
+         * @ref projectionMatrix() and calls @ref Drawable::draw() only for the
+         * ones that are at least partially inside. The test is conservative,
+         * so a drawable may still get drawn even if it's not visible.
+         * Drawables without a bounding box are always drawn. Disabled by
+         * default. See @ref SceneGraph-Drawable-draw-order for more
+         * information.
+         */
+        Camera<dimensions, T>& setFrustumCullingEnabled(bool enabled) {
+            _frustumCulling = enabled;
+            return *this;
+        }
+
         /**
          * @brief Drawable transformations
          *
@@ -196,14 +226,48 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Calculate drawable transformations into given storage
+         * @m_since_latest
+         *
+         * Puts camera-relative transformations for given group of drawables
+         * into @p transformations, which is expected to have the same size
+         * as @p group, with transformation at index @cpp i @ce belonging to
+         * drawable @cpp group[i] @ce. Compared to
+         * @ref drawableTransformations() this doesn't allocate once the
+         * internal temporary storage is large enough, so it's suitable for
+         * calling every frame with storage reused across frames.
+         */
+        void drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::ArrayView<MatrixTypeFor<dimensions, T>>& transformations);
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. If
+         * @ref setFrustumCullingEnabled() "frustum culling" is enabled,
+         * drawables with a @ref Drawable::setBoundingBox() "bounding box"
+         * outside of the view volume are skipped. The temporary storage for
+         * transformations and culling is kept in the camera and reused, so
+         * once it's large enough for given group, this function doesn't
+         * allocate.
          * @see @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
          */
         void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw using a render queue
+         * @m_since_latest
+         *
+         * Compared to @ref draw(DrawableGroup<dimensions, T>&), the
+         * drawables are put into @p queue together with a key returned by
+         * @ref Drawable::sortKey(), then the queue is sorted and drawn. The
+         * queue is cleared first and its contents are kept after, so the
+         * draw order can be inspected. The queue shouldn't be reused from
+         * inside @ref Drawable::draw(). See @ref RenderQueue for more
+         * information.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, RenderQueue<dimensions, T>& queue);
+
         /**
          * @brief Draw given drawables with transformations
          *
@@ -220,6 +284,8 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         }
 
         void fixAspectRatio();
+        void drawInternal(DrawableGroup<dimensions, T>& group, RenderQueue<dimensions, T>* queue);
+        void cullInto(DrawableGroup<dimensions, T>& group, const Containers::ArrayView<const MatrixTypeFor<dimensions, T>>& transformations, const Containers::ArrayView<bool>& visible);
 
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
@@ -228,6 +294,19 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        /* Reused by draw() and drawableTransformationsInto() to avoid
+           allocations every frame */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _drawableObjects;
+        std::vector<MatrixTypeFor<dimensions, T>> _drawableTransformations;
+
+        /* Reused by draw() for frustum culling */
+        bool _frustumCulling;
+        std::vector<UnsignedInt> _cullingIndices;
+        std::vector<VectorTypeFor<dimensions, T>> _cullingCenters;
+        std::vector<VectorTypeFor<dimensions, T>> _cullingExtents;
+        Containers::Array<bool> _cullingResults;
+        Containers::Array<bool> _drawableVisibility;
 };
 
 /**
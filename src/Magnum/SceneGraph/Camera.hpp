@@ -29,9 +29,14 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/IntersectionBatch.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -53,9 +58,28 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* In 3D the camera-space boxes are tested against the frustum planes, as a
+   perspective projection can't be applied to an AABB directly */
+template<class T> void frustumCullInto(const Math::Matrix4<T>& projectionMatrix, const Containers::StridedArrayView1D<const Math::Vector3<T>>& centers, const Containers::StridedArrayView1D<const Math::Vector3<T>>& extents, const Containers::StridedArrayView1D<bool>& visible) {
+    Math::Intersection::aabbFrustumInto(centers, extents, Math::Frustum<T>::fromMatrix(projectionMatrix), visible);
+}
+
+/* In 2D the projection is always affine, so the boxes can be projected and
+   compared against the [-1, 1] square directly */
+template<class T> void frustumCullInto(const Math::Matrix3<T>& projectionMatrix, const Containers::StridedArrayView1D<const Math::Vector2<T>>& centers, const Containers::StridedArrayView1D<const Math::Vector2<T>>& extents, const Containers::StridedArrayView1D<bool>& visible) {
+    const Math::Matrix2x2<T> rotationScaling = projectionMatrix.rotationScaling();
+    const Math::Vector2<T> absX = Math::abs(rotationScaling[0]);
+    const Math::Vector2<T> absY = Math::abs(rotationScaling[1]);
+    for(std::size_t i = 0; i != visible.size(); ++i) {
+        const Math::Vector2<T> center = projectionMatrix.transformPoint(centers[i]);
+        const Math::Vector2<T> extent = absX*extents[i].x() + absY*extents[i].y();
+        visible[i] = (Math::abs(center) - extent <= Math::Vector2<T>{T(1)}).all();
+    }
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+}
+
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _frustumCulling{false} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -83,19 +107,14 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::setViewpor
 }
 
 template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group) {
+    #ifndef CORRADE_NO_ASSERT
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
+    #endif
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", {});
 
-    /* Compute camera matrix */
-    AbstractFeature<dimensions, T>::object().setClean();
-
     /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+    std::vector<MatrixTypeFor<dimensions, T>> transformations(group.size());
+    drawableTransformationsInto(group, {transformations.data(), transformations.size()});
 
     /* Combine drawable references and transformation matrices */
     std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> combined;
@@ -106,24 +125,112 @@ template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_w
     return combined;
 }
 
-template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::ArrayView<MatrixTypeFor<dimensions, T>>& transformations) {
+    CORRADE_ASSERT(transformations.size() == group.size(),
+        "SceneGraph::Camera::drawableTransformationsInto(): expected" << group.size() << "transformations but got" << transformations.size(), );
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
-    CORRADE_ASSERT(scene, "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+    CORRADE_ASSERT(scene, "SceneGraph::Camera::drawableTransformationsInto(): cannot draw when camera is not part of any scene", );
 
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera. The object list keeps its capacity between calls. */
+    _drawableObjects.clear();
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        _drawableObjects.push_back(group[i].object());
+    scene->transformationMatricesInto({_drawableObjects.data(), _drawableObjects.size()}, transformations, _cameraMatrix);
+}
 
-    /* Perform the drawing */
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+    drawInternal(group, nullptr);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, RenderQueue<dimensions, T>& queue) {
+    drawInternal(group, &queue);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawInternal(DrawableGroup<dimensions, T>& group, RenderQueue<dimensions, T>* const queue) {
+    #ifndef CORRADE_NO_ASSERT
+    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
+    #endif
+    CORRADE_ASSERT(scene, "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    /* Take over the reused storage for the duration of the draw, so drawing
+       the same camera again from inside Drawable::draw() doesn't overwrite
+       it but gets a fresh one instead */
+    std::vector<MatrixTypeFor<dimensions, T>> transformations = std::move(_drawableTransformations);
+    transformations.resize(group.size());
+    drawableTransformationsInto(group, {transformations.data(), transformations.size()});
+
+    /* Cull drawables outside of the view volume, if enabled. The visibility
+       storage is taken over for the same reason as above. */
+    const bool culling = _frustumCulling;
+    Containers::Array<bool> visible = std::move(_drawableVisibility);
+    if(culling) {
+        if(visible.size() < group.size())
+            visible = Containers::Array<bool>{Containers::NoInit, group.size()};
+        cullInto(group, {transformations.data(), transformations.size()}, visible.prefix(group.size()));
+    }
+
+    /* Perform the drawing directly */
+    if(!queue) {
+        for(std::size_t i = 0; i != transformations.size(); ++i)
+            if(!culling || visible[i]) group[i].draw(transformations[i], *this);
+
+        _drawableVisibility = std::move(visible);
+        _drawableTransformations = std::move(transformations);
+        return;
+    }
+
+    /* Or fill the queue. It has its own copy of the transformations, so the
+       storage can be given back before drawing. */
+    queue->clear();
     for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+        if(!culling || visible[i]) queue->add(group[i].sortKey(transformations[i], *this), transformations[i], group[i]);
+
+    _drawableVisibility = std::move(visible);
+    _drawableTransformations = std::move(transformations);
+
+    queue->sort().draw(*this);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::cullInto(DrawableGroup<dimensions, T>& group, const Containers::ArrayView<const MatrixTypeFor<dimensions, T>>& transformations, const Containers::ArrayView<bool>& visible) {
+    /* Gather camera-space bounding boxes of drawables that have them, the
+       rest is always visible. Rotated boxes are enclosed in a larger
+       axis-aligned box, so the test stays conservative. */
+    _cullingIndices.clear();
+    _cullingCenters.clear();
+    _cullingExtents.clear();
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        const Drawable<dimensions, T>& drawable = group[i];
+        if(!drawable.hasBoundingBox()) {
+            visible[i] = true;
+            continue;
+        }
+
+        const RangeTypeFor<dimensions, T> box = drawable.boundingBox();
+        const VectorTypeFor<dimensions, T> halfSize = box.size()/T(2);
+        const auto rotationScaling = transformations[i].rotationScaling();
+        VectorTypeFor<dimensions, T> extents;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            extents += VectorTypeFor<dimensions, T>{Math::abs(rotationScaling[j])}*halfSize[j];
+
+        _cullingIndices.push_back(i);
+        _cullingCenters.push_back(transformations[i].transformPoint(box.center()));
+        _cullingExtents.push_back(extents);
+    }
+
+    /* Test all boxes in a single batch and scatter the results back */
+    const std::size_t count = _cullingIndices.size();
+    if(_cullingResults.size() < count)
+        _cullingResults = Containers::Array<bool>{Containers::NoInit, count};
+    Implementation::frustumCullInto<T>(_projectionMatrix,
+        Containers::arrayView(_cullingCenters.data(), count),
+        Containers::arrayView(_cullingExtents.data(), count),
+        _cullingResults.prefix(count));
+    for(std::size_t i = 0; i != count; ++i)
+        visible[_cullingIndices[i]] = _cullingResults[i];
 }
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations) {
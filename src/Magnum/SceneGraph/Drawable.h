@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -114,7 +116,9 @@ parameters once for whole group instead of setting them again in each
 @section SceneGraph-Drawable-draw-order Custom draw order and object culling
 
 By default all contents of a drawable group are drawn, in the order they were
-added. In some cases you may want to draw them in a different order (for
+added until the first removal --- @ref FeatureGroup::remove() moves the last
+drawable in place of the removed one, so the order isn't preserved after that.
+In some cases you may want to draw them in a different order (for
 example to have correctly sorted transparent objects) or draw just a subset
 (for example to cull invisible objects away). That can be achieved using
 @ref Camera::drawableTransformations() in combination with
@@ -133,6 +137,21 @@ get used in any way except being passed to the draw function:
 
 @snippet MagnumSceneGraph.cpp Drawable-culling
 
+For the common case of culling against the camera frustum the above doesn't
+need to be done manually. Give the drawables a bounding box relative to the
+object they're attached to using @ref setBoundingBox() and enable
+@ref Camera::setFrustumCullingEnabled() --- @ref Camera::draw() then tests the
+transformed bounding boxes against the view volume in a single batch and calls
+@ref draw() only on the drawables that are at least partially visible.
+Drawables without a bounding box are always drawn:
+
+@snippet MagnumSceneGraph.cpp Drawable-culling-builtin
+
+To draw the drawables sorted by their render state in order to minimize
+state changes, implement @ref sortKey() and pass a @ref RenderQueue to
+@ref Camera::draw(DrawableGroup<dimensions, T>&, RenderQueue<dimensions, T>&).
+See the @ref RenderQueue documentation for more information.
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -187,6 +206,71 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        /**
+         * @brief Sort key
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         * @m_since_latest
+         *
+         * Used by @ref Camera::draw(DrawableGroup<dimensions, T>&, RenderQueue<dimensions, T>&)
+         * to order the drawables. The default implementation returns
+         * @cpp 0 @ce, meaning the drawables are drawn in the order they are
+         * in the group. See @ref RenderQueue for more information.
+         */
+        virtual UnsignedLong sortKey(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera);
+
+        /**
+         * @brief Whether the drawable has a bounding box
+         * @m_since_latest
+         *
+         * @see @ref setBoundingBox(), @ref resetBoundingBox()
+         */
+        bool hasBoundingBox() const { return _hasBoundingBox; }
+
+        /**
+         * @brief Bounding box
+         * @m_since_latest
+         *
+         * Relative to the object the drawable is attached to. If
+         * @ref hasBoundingBox() is @cpp false @ce, the value is unspecified.
+         */
+        RangeTypeFor<dimensions, T> boundingBox() const { return _boundingBox; }
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The @p box is relative to the object the drawable is attached to,
+         * i.e. in the same space as the mesh vertices. Used by
+         * @ref Camera::draw() to skip drawables outside of the view volume
+         * if @ref Camera::setFrustumCullingEnabled() "frustum culling" is
+         * enabled. See @ref SceneGraph-Drawable-draw-order for more
+         * information.
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+            _boundingBox = box;
+            _hasBoundingBox = true;
+            return *this;
+        }
+
+        /**
+         * @brief Reset bounding box
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The drawable is then always drawn, independently of whether
+         * frustum culling is enabled in the camera.
+         */
+        Drawable<dimensions, T>& resetBoundingBox() {
+            _hasBoundingBox = false;
+            return *this;
+        }
+
+    private:
+        RangeTypeFor<dimensions, T> _boundingBox;
+        bool _hasBoundingBox;
 };
 
 /**
@@ -33,7 +33,11 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _hasBoundingBox{false} {}
+
+template<UnsignedInt dimensions, class T> UnsignedLong Drawable<dimensions, T>::sortKey(const MatrixTypeFor<dimensions, T>&, Camera<dimensions, T>&) {
+    return 0;
+}
 
 }}
 
@@ -29,7 +29,10 @@
  * @brief Class @ref Magnum::SceneGraph::AbstractFeatureGroup, @ref Magnum::SceneGraph::FeatureGroup, alias @ref Magnum::SceneGraph::BasicFeatureGroup2D, @ref Magnum::SceneGraph::BasicFeatureGroup3D, @ref Magnum::SceneGraph::FeatureGroup2D, @ref Magnum::SceneGraph::FeatureGroup3D
  */
 
+#include <initializer_list>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/SceneGraph/SceneGraph.h"
@@ -65,7 +68,11 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
         virtual ~AbstractFeatureGroup();
 
         void add(AbstractFeature<dimensions, T>& feature);
-        void remove(AbstractFeature<dimensions, T>& feature);
+        /* Grows the capacity geometrically if it's less than size */
+        void reserve(std::size_t size);
+        /* Swaps the last feature into the place of the removed one, the
+           caller is responsible for updating its index */
+        void remove(std::size_t index);
 
         std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> _features;
 };
@@ -74,6 +81,20 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
 @brief Group of features
 
 See @ref AbstractGroupedFeature for more information.
+
+@section SceneGraph-FeatureGroup-order Feature order
+
+Features are stored in a contiguous array in the order they were added. Each
+feature remembers its position in the group, so both @ref add() and
+@ref remove() are @f$ \mathcal{O}(1) @f$ operations. The removal is done by
+moving the last feature in place of the removed one, which means the order of
+the remaining features is not preserved. The feature references themselves are
+stable, use those instead of indices if you need to refer to particular
+features across additions and removals. When adding or removing many features
+at once, prefer the @ref add(Containers::ArrayView<const Containers::Reference<Feature>>)
+and @ref remove(Containers::ArrayView<const Containers::Reference<Feature>>)
+overloads, which reserve the storage upfront.
+
 @see @ref scenegraph, @ref BasicFeatureGroup2D, @ref BasicFeatureGroup3D,
     @ref FeatureGroup2D, @ref FeatureGroup3D
 */
@@ -115,18 +136,53 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @return Reference to self (for method chaining)
          *
          * If the features is part of another group, it is removed from it.
+         * The feature is added to the end of the group.
          * @see @ref remove(), @ref AbstractGroupedFeature::AbstractGroupedFeature()
          */
         FeatureGroup<dimensions, Feature, T>& add(Feature& feature);
 
+        /**
+         * @brief Add features to the group
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Reserves space for all features and then calls @ref add(Feature&)
+         * for each item in @p features, in order.
+         */
+        FeatureGroup<dimensions, Feature, T>& add(Containers::ArrayView<const Containers::Reference<Feature>> features);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        FeatureGroup<dimensions, Feature, T>& add(std::initializer_list<Containers::Reference<Feature>> features);
+
         /**
          * @brief Remove a feature from the group
          * @return Reference to self (for method chaining)
          *
-         * The feature must be part of the group.
+         * The feature must be part of the group. The last feature in the
+         * group is moved to the position of the removed one.
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
+
+        /**
+         * @brief Remove features from the group
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref remove(Feature&) for each item in
+         * @p features, in order. All features are expected to be part of the
+         * group.
+         */
+        FeatureGroup<dimensions, Feature, T>& remove(Containers::ArrayView<const Containers::Reference<Feature>> features);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        FeatureGroup<dimensions, Feature, T>& remove(std::initializer_list<Containers::Reference<Feature>> features);
 };
 
 /**
@@ -183,20 +239,46 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
         feature._group->remove(feature);
 
     /* Crossreference the feature and group together */
+    feature._groupIndex = AbstractFeatureGroup<dimensions, T>::_features.size();
     AbstractFeatureGroup<dimensions, T>::add(feature);
     feature._group = this;
     return *this;
 }
 
+template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::add(const Containers::ArrayView<const Containers::Reference<Feature>> features) {
+    AbstractFeatureGroup<dimensions, T>::reserve(AbstractFeatureGroup<dimensions, T>::_features.size() + features.size());
+    for(Feature& feature: features) add(feature);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::add(const std::initializer_list<Containers::Reference<Feature>> features) {
+    return add(Containers::arrayView(features));
+}
+
 template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::remove(Feature& feature) {
     CORRADE_ASSERT(feature._group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", *this);
 
-    AbstractFeatureGroup<dimensions, T>::remove(feature);
+    /* Update index of the feature that got moved into the freed slot, if
+       any */
+    const std::size_t index = feature._groupIndex;
+    AbstractFeatureGroup<dimensions, T>::remove(index);
+    if(index < AbstractFeatureGroup<dimensions, T>::_features.size())
+        (*this)[index]._groupIndex = index;
+
     feature._group = nullptr;
     return *this;
 }
 
+template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::remove(const Containers::ArrayView<const Containers::Reference<Feature>> features) {
+    for(Feature& feature: features) remove(feature);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions, Feature, T>& FeatureGroup<dimensions, Feature, T>::remove(const std::initializer_list<Containers::Reference<Feature>> features) {
+    return remove(Containers::arrayView(features));
+}
+
 #if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
 extern template class MAGNUM_SCENEGRAPH_EXPORT AbstractFeatureGroup<2, Float>;
 extern template class MAGNUM_SCENEGRAPH_EXPORT AbstractFeatureGroup<3, Float>;
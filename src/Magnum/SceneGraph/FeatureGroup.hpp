@@ -29,8 +29,7 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FeatureGroup.h
  */
 
-#include <algorithm>
-
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -42,9 +41,16 @@ template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions,
     _features.push_back(feature);
 }
 
-template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(AbstractFeature<dimensions, T>& feature) {
-    _features.erase(std::find_if(_features.begin(), _features.end(),
-        [&feature](AbstractFeature<dimensions, T>& f) { return &f == &feature; }));
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::reserve(const std::size_t size) {
+    /* std::vector::reserve() allocates exactly the requested size, grow
+       geometrically to keep repeated bulk additions amortized linear */
+    if(_features.capacity() < size)
+        _features.reserve(Math::max(2*_features.capacity(), size));
+}
+
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(const std::size_t index) {
+    if(index + 1 != _features.size()) _features[index] = _features.back();
+    _features.pop_back();
 }
 
 }}
@@ -0,0 +1,363 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_h
+#define Magnum_SceneGraph_FlatHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatHierarchy, alias @ref Magnum::SceneGraph::BasicFlatHierarchy2D, @ref Magnum::SceneGraph::BasicFlatHierarchy3D, typedef @ref Magnum::SceneGraph::FlatHierarchy2D, @ref Magnum::SceneGraph::FlatHierarchy3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flat transformation hierarchy
+@m_since_latest
+
+A data-oriented alternative to the @ref Object / @ref Scene hierarchy. Instead
+of individually allocated objects linked with pointers, the hierarchy is a set
+of contiguous arrays --- parent indices, local transformations, world
+transformations and a bitfield of dirty objects --- ordered so that a parent
+always comes before all its children. Thanks to that, calculating world
+transformations of the whole hierarchy in @ref updateWorldTransformations() is
+a single linear pass over the arrays without any virtual calls or pointer
+chasing.
+
+@section SceneGraph-FlatHierarchy-usage Basic usage
+
+Objects are added with @ref addObject(), which takes index of a parent object
+returned from an earlier call, or @cpp -1 @ce for a root object. Local
+transformations are then updated with @ref setTransformation() and after a
+call to @ref updateWorldTransformations() the absolute transformations are
+available in @ref worldTransformations(). Only objects that were marked as
+dirty and their descendants get recalculated.
+
+@snippet MagnumSceneGraph.cpp FlatHierarchy-usage
+
+@section SceneGraph-FlatHierarchy-import Creating from imported data
+
+A hierarchy with arbitrarily ordered parent indices can be created using
+@ref FlatHierarchy(Containers::ArrayView<const Int>, Containers::ArrayView<const MatrixType>).
+The objects get reordered so parents are before children, the original IDs are
+then available through @ref objectIds() and @ref indices(). Alternatively, the
+hierarchy can be created directly from a list of @ref Trade::ObjectData2D or
+@ref Trade::ObjectData3D instances indexed by their object ID, such as
+returned from @ref Trade::AbstractImporter::object3D(). Objects that are not
+referenced as a child of any other object become roots, objects that failed to
+import are treated as roots with an identity transformation. The constructor is
+a template, so the @ref SceneGraph library itself doesn't depend on the
+@ref Trade library.
+
+@snippet MagnumSceneGraph-gl.cpp FlatHierarchy-import
+
+@section SceneGraph-FlatHierarchy-drawing Drawing
+
+Since there are no @ref Object instances, @ref Drawable features can't be
+attached to the hierarchy. Instead, the drawables are expected to be a list of
+object indices together with whatever data the application needs to render
+them. The @ref transformationsInto() function then calculates transformations
+of given objects relative to a camera, equivalently to what
+@ref Camera::draw() passes to @ref Drawable::draw(). The camera can be either
+a @ref Camera feature attached to a regular @ref Object or just a matrix.
+
+@snippet MagnumSceneGraph-gl.cpp FlatHierarchy-drawing
+
+@section SceneGraph-FlatHierarchy-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatHierarchy.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatHierarchy2D
+-   @ref FlatHierarchy3D
+
+@see @ref scenegraph, @ref BasicFlatHierarchy2D, @ref BasicFlatHierarchy3D,
+    @ref FlatHierarchy2D, @ref FlatHierarchy3D
+*/
+template<UnsignedInt dimensions, class T> class FlatHierarchy {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty hierarchy.
+         */
+        explicit FlatHierarchy();
+
+        /**
+         * @brief Construct from parent indices and local transformations
+         * @param parents           Parent object ID for each object or
+         *      @cpp -1 @ce for root objects
+         * @param transformations   Local transformation of each object
+         *
+         * Both views are expected to have the same size, parent IDs are
+         * expected to be in range and the parent relationship is expected to
+         * have no cycles. The objects are reordered so parents come before
+         * their children, the original object IDs can be then retrieved via
+         * @ref objectIds() and @ref indices(). All objects are marked as
+         * dirty.
+         */
+        explicit FlatHierarchy(Containers::ArrayView<const Int> parents, Containers::ArrayView<const MatrixType> transformations);
+
+        /**
+         * @brief Construct from imported object data
+         * @param objects   Objects indexed by their ID
+         *
+         * Expects that @p ObjectData has a @cpp children() @ce accessor
+         * returning a list of child object IDs and a @cpp transformation() @ce
+         * accessor returning a matrix convertible to @ref MatrixType, such as
+         * @ref Trade::ObjectData2D and @ref Trade::ObjectData3D. Object IDs
+         * are expected to be in range and each object is expected to be a
+         * child of at most one other object. Objects that are not a child of
+         * anything are roots, @cpp nullptr @ce objects are treated as roots
+         * with an identity transformation. See
+         * @ref FlatHierarchy(Containers::ArrayView<const Int>, Containers::ArrayView<const MatrixType>)
+         * for more information.
+         */
+        template<class ObjectData> explicit FlatHierarchy(Containers::ArrayView<const Containers::Pointer<ObjectData>> objects);
+
+        /** @overload */
+        template<class ObjectData> explicit FlatHierarchy(const Containers::Array<Containers::Pointer<ObjectData>>& objects): FlatHierarchy{Containers::ArrayView<const Containers::Pointer<ObjectData>>{objects}} {}
+
+        /** @brief Copying is not allowed */
+        FlatHierarchy(const FlatHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Move constructor */
+        FlatHierarchy(FlatHierarchy<dimensions, T>&&) noexcept;
+
+        ~FlatHierarchy();
+
+        /** @brief Copying is not allowed */
+        FlatHierarchy<dimensions, T>& operator=(const FlatHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Move assignment */
+        FlatHierarchy<dimensions, T>& operator=(FlatHierarchy<dimensions, T>&&) noexcept;
+
+        /** @brief Object count */
+        std::size_t size() const { return _parents.size(); }
+
+        /** @brief Whether the hierarchy is empty */
+        bool isEmpty() const { return _parents.empty(); }
+
+        /**
+         * @brief Parent indices
+         *
+         * Index of a parent for each object or @cpp -1 @ce for root objects.
+         * A parent index is always less than index of the object itself.
+         */
+        Containers::ArrayView<const Int> parents() const { return _parents; }
+
+        /**
+         * @brief Original object IDs
+         *
+         * For a hierarchy created from a list of parents or from imported
+         * object data contains the original object ID for each index. Objects
+         * added with @ref addObject() have the ID equal to their index.
+         * @see @ref indices()
+         */
+        Containers::ArrayView<const UnsignedInt> objectIds() const { return _objectIds; }
+
+        /**
+         * @brief Indices of objects
+         *
+         * Inverse of @ref objectIds() --- index in the hierarchy for each
+         * object ID.
+         */
+        Containers::ArrayView<const UnsignedInt> indices() const { return _indices; }
+
+        /**
+         * @brief Add an object
+         * @param parent            Parent object index or @cpp -1 @ce for a
+         *      root object
+         * @param transformation    Local transformation
+         * @return Index of the newly added object
+         *
+         * The @p parent is expected to be less than @ref size(). The object is
+         * marked as dirty.
+         */
+        UnsignedInt addObject(Int parent, const MatrixType& transformation = MatrixType{});
+
+        /** @brief Local transformations */
+        Containers::ArrayView<const MatrixType> transformations() const { return _transformations; }
+
+        /**
+         * @brief Local transformation of an object
+         *
+         * Expects that @p index is less than @ref size().
+         */
+        MatrixType transformation(UnsignedInt index) const;
+
+        /**
+         * @brief Set local transformation of an object
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p index is less than @ref size(). The object is marked
+         * as dirty.
+         */
+        FlatHierarchy<dimensions, T>& setTransformation(UnsignedInt index, const MatrixType& transformation);
+
+        /**
+         * @brief Whether an object is dirty
+         *
+         * Returns @cpp true @ce if the local transformation of given object
+         * changed since the last call to @ref updateWorldTransformations(). In
+         * particular, doesn't take into account the dirty state of parent
+         * objects. Expects that @p index is less than @ref size().
+         */
+        bool isDirty(UnsignedInt index) const;
+
+        /**
+         * @brief World transformations
+         *
+         * Absolute transformation of each object, valid as of the last call
+         * to @ref updateWorldTransformations().
+         */
+        Containers::ArrayView<const MatrixType> worldTransformations() const { return _worldTransformations; }
+
+        /**
+         * @brief World transformation of an object
+         *
+         * Valid as of the last call to @ref updateWorldTransformations().
+         * Expects that @p index is less than @ref size().
+         */
+        MatrixType worldTransformation(UnsignedInt index) const;
+
+        /**
+         * @brief Update world transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Recalculates @ref worldTransformations() of all dirty objects and
+         * their descendants in a single linear pass and resets the dirty
+         * state. If nothing is dirty, the function is a no-op.
+         */
+        FlatHierarchy<dimensions, T>& updateWorldTransformations();
+
+        /**
+         * @brief Calculate transformations relative to a camera
+         * @param cameraMatrix  Camera matrix, for example
+         *      @ref Camera::cameraMatrix()
+         * @param indices       Object indices
+         * @param out           Where to put the transformations
+         *
+         * Puts @cpp cameraMatrix*worldTransformation(indices[i]) @ce into
+         * @cpp out[i] @ce. The world transformations are used as of the last
+         * call to @ref updateWorldTransformations(). Expects that @p indices
+         * and @p out have the same size and all indices are less than
+         * @ref size().
+         */
+        void transformationsInto(const MatrixType& cameraMatrix, Containers::ArrayView<const UnsignedInt> indices, Containers::ArrayView<MatrixType> out) const;
+
+    private:
+        void create(Containers::ArrayView<const Int> parents, Containers::ArrayView<const MatrixType> transformations);
+
+        Containers::Array<Int> _parents;
+        Containers::Array<UnsignedInt> _objectIds;
+        Containers::Array<UnsignedInt> _indices;
+        Containers::Array<MatrixType> _transformations;
+        Containers::Array<MatrixType> _worldTransformations;
+        /* One bit per object, 32 objects per item */
+        Containers::Array<UnsignedInt> _dirty;
+        bool _anyDirty;
+};
+
+template<UnsignedInt dimensions, class T> template<class ObjectData> FlatHierarchy<dimensions, T>::FlatHierarchy(const Containers::ArrayView<const Containers::Pointer<ObjectData>> objects): FlatHierarchy{} {
+    Containers::Array<Int> parents{Containers::DirectInit, objects.size(), -1};
+    Containers::Array<MatrixType> transformations{Containers::ValueInit, objects.size()};
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        if(!objects[i]) continue;
+        transformations[i] = MatrixType{objects[i]->transformation()};
+        for(const UnsignedInt child: objects[i]->children()) {
+            CORRADE_ASSERT(child < objects.size(),
+                "SceneGraph::FlatHierarchy: child" << child << "of object" << i << "out of range for" << objects.size() << "objects", );
+            CORRADE_ASSERT(parents[child] == -1,
+                "SceneGraph::FlatHierarchy: object" << child << "is a child of both object" << parents[child] << "and" << i, );
+            parents[child] = i;
+        }
+    }
+
+    create(parents, transformations);
+}
+
+/**
+@brief Flat transformation hierarchy for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp FlatHierarchy<2, T> @ce. See
+@ref FlatHierarchy for more information.
+@see @ref FlatHierarchy2D, @ref BasicFlatHierarchy3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatHierarchy2D = FlatHierarchy<2, T>;
+#endif
+
+/**
+@brief Flat transformation hierarchy for two-dimensional float scenes
+@m_since_latest
+
+@see @ref FlatHierarchy3D
+*/
+typedef BasicFlatHierarchy2D<Float> FlatHierarchy2D;
+
+/**
+@brief Flat transformation hierarchy for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp FlatHierarchy<3, T> @ce. See
+@ref FlatHierarchy for more information.
+@see @ref FlatHierarchy3D, @ref BasicFlatHierarchy2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatHierarchy3D = FlatHierarchy<3, T>;
+#endif
+
+/**
+@brief Flat transformation hierarchy for three-dimensional float scenes
+@m_since_latest
+
+@see @ref FlatHierarchy2D
+*/
+typedef BasicFlatHierarchy3D<Float> FlatHierarchy3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatHierarchy<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatHierarchy<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_hpp
+#define Magnum_SceneGraph_FlatHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatHierarchy.h
+ * @m_since_latest
+ */
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>::FlatHierarchy(): _anyDirty{false} {}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>::FlatHierarchy(const Containers::ArrayView<const Int> parents, const Containers::ArrayView<const MatrixType> transformations): FlatHierarchy{} {
+    create(parents, transformations);
+}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>::FlatHierarchy(FlatHierarchy<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>::~FlatHierarchy() = default;
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>& FlatHierarchy<dimensions, T>::operator=(FlatHierarchy<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> void FlatHierarchy<dimensions, T>::create(const Containers::ArrayView<const Int> parents, const Containers::ArrayView<const MatrixType> transformations) {
+    CORRADE_ASSERT(parents.size() == transformations.size(),
+        "SceneGraph::FlatHierarchy: expected" << parents.size() << "transformations but got" << transformations.size(), );
+    const std::size_t count = parents.size();
+
+    /* Gather children of each object into a contiguous array, with
+       childOffsets[i] pointing to the first child of object i */
+    Containers::Array<UnsignedInt> childOffsets{Containers::ValueInit, count + 1};
+    for(std::size_t i = 0; i != count; ++i) {
+        const Int parent = parents[i];
+        CORRADE_ASSERT(parent >= -1 && parent < Int(count),
+            "SceneGraph::FlatHierarchy: parent" << parent << "of object" << i << "out of range for" << count << "objects", );
+        if(parent != -1) ++childOffsets[parent + 1];
+    }
+    for(std::size_t i = 0; i != count; ++i)
+        childOffsets[i + 1] += childOffsets[i];
+    Containers::Array<UnsignedInt> children{Containers::NoInit, childOffsets[count]};
+    {
+        Containers::Array<UnsignedInt> childCursors{Containers::NoInit, count};
+        std::memcpy(childCursors.data(), childOffsets.data(), count*sizeof(UnsignedInt));
+        for(std::size_t i = 0; i != count; ++i)
+            if(parents[i] != -1) children[childCursors[parents[i]]++] = i;
+    }
+
+    /* Order the objects breadth-first, starting with roots in their original
+       order. The output array serves as the queue as well. Objects that are
+       part of a cycle are never reached from any root. */
+    Containers::Array<UnsignedInt> objectIds{Containers::NoInit, count};
+    std::size_t end = 0;
+    for(std::size_t i = 0; i != count; ++i)
+        if(parents[i] == -1) objectIds[end++] = i;
+    for(std::size_t next = 0; next != end; ++next) {
+        const UnsignedInt id = objectIds[next];
+        for(std::size_t i = childOffsets[id], iMax = childOffsets[id + 1]; i != iMax; ++i)
+            objectIds[end++] = children[i];
+    }
+    CORRADE_ASSERT(end == count,
+        "SceneGraph::FlatHierarchy: only" << end << "out of" << count << "objects are reachable from a root, the hierarchy has a cycle", );
+
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, count};
+    for(std::size_t i = 0; i != count; ++i)
+        indices[objectIds[i]] = i;
+
+    _parents = Containers::Array<Int>{Containers::NoInit, count};
+    _transformations = Containers::Array<MatrixType>{Containers::NoInit, count};
+    for(std::size_t i = 0; i != count; ++i) {
+        const Int parent = parents[objectIds[i]];
+        _parents[i] = parent == -1 ? -1 : Int(indices[parent]);
+        new(&_transformations[i]) MatrixType{transformations[objectIds[i]]};
+    }
+    _worldTransformations = Containers::Array<MatrixType>{Containers::ValueInit, count};
+    _objectIds = std::move(objectIds);
+    _indices = std::move(indices);
+
+    /* Everything is dirty initially */
+    _dirty = Containers::Array<UnsignedInt>{Containers::DirectInit, (count + 31)/32, ~UnsignedInt{}};
+    _anyDirty = count != 0;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatHierarchy<dimensions, T>::addObject(const Int parent, const MatrixType& transformation) {
+    CORRADE_ASSERT(parent >= -1 && parent < Int(_parents.size()),
+        "SceneGraph::FlatHierarchy::addObject(): parent index" << parent << "out of range for" << _parents.size() << "objects", {});
+
+    const UnsignedInt index = _parents.size();
+    Containers::arrayAppend(_parents, parent);
+    Containers::arrayAppend(_objectIds, index);
+    Containers::arrayAppend(_indices, index);
+    Containers::arrayAppend(_transformations, transformation);
+    Containers::arrayAppend(_worldTransformations, transformation);
+    if(index % 32 == 0) Containers::arrayAppend(_dirty, UnsignedInt{});
+    _dirty[index >> 5] |= 1u << (index & 31);
+    _anyDirty = true;
+    return index;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatHierarchy<dimensions, T>::transformation(const UnsignedInt index) const -> MatrixType {
+    CORRADE_ASSERT(index < _parents.size(),
+        "SceneGraph::FlatHierarchy::transformation(): index" << index << "out of range for" << _parents.size() << "objects", {});
+    return _transformations[index];
+}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>& FlatHierarchy<dimensions, T>::setTransformation(const UnsignedInt index, const MatrixType& transformation) {
+    CORRADE_ASSERT(index < _parents.size(),
+        "SceneGraph::FlatHierarchy::setTransformation(): index" << index << "out of range for" << _parents.size() << "objects", *this);
+    _transformations[index] = transformation;
+    _dirty[index >> 5] |= 1u << (index & 31);
+    _anyDirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> bool FlatHierarchy<dimensions, T>::isDirty(const UnsignedInt index) const {
+    CORRADE_ASSERT(index < _parents.size(),
+        "SceneGraph::FlatHierarchy::isDirty(): index" << index << "out of range for" << _parents.size() << "objects", {});
+    return _dirty[index >> 5] & (1u << (index & 31));
+}
+
+template<UnsignedInt dimensions, class T> auto FlatHierarchy<dimensions, T>::worldTransformation(const UnsignedInt index) const -> MatrixType {
+    CORRADE_ASSERT(index < _parents.size(),
+        "SceneGraph::FlatHierarchy::worldTransformation(): index" << index << "out of range for" << _parents.size() << "objects", {});
+    return _worldTransformations[index];
+}
+
+template<UnsignedInt dimensions, class T> FlatHierarchy<dimensions, T>& FlatHierarchy<dimensions, T>::updateWorldTransformations() {
+    if(!_anyDirty) return *this;
+
+    /* Parents are always before children, so when we get to an object, its
+       parent is already up-to-date and marked as dirty if it changed. Dirty
+       state of a parent is then propagated to its children. */
+    UnsignedInt* const dirty = _dirty.data();
+    for(std::size_t i = 0, iMax = _parents.size(); i != iMax; ++i) {
+        const Int parent = _parents[i];
+        const UnsignedInt bit = 1u << (i & 31);
+        if(parent == -1) {
+            if(dirty[i >> 5] & bit)
+                _worldTransformations[i] = _transformations[i];
+        } else if((dirty[i >> 5] & bit) || (dirty[parent >> 5] & (1u << (parent & 31)))) {
+            _worldTransformations[i] = _worldTransformations[parent]*_transformations[i];
+            dirty[i >> 5] |= bit;
+        }
+    }
+
+    std::memset(dirty, 0, _dirty.size()*sizeof(UnsignedInt));
+    _anyDirty = false;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void FlatHierarchy<dimensions, T>::transformationsInto(const MatrixType& cameraMatrix, const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<MatrixType> out) const {
+    CORRADE_ASSERT(indices.size() == out.size(),
+        "SceneGraph::FlatHierarchy::transformationsInto(): expected" << indices.size() << "transformations but got" << out.size(), );
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        CORRADE_ASSERT(indices[i] < _parents.size(),
+            "SceneGraph::FlatHierarchy::transformationsInto(): index" << indices[i] << "out of range for" << _parents.size() << "objects", );
+        out[i] = cameraMatrix*_worldTransformations[indices[i]];
+    }
+}
+
+}}
+
+#endif
@@ -0,0 +1,451 @@
+#ifndef Magnum_SceneGraph_InstanceBatcher_h
+#define Magnum_SceneGraph_InstanceBatcher_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::InstanceBatcher, @ref Magnum::SceneGraph::InstancedDrawable, struct @ref Magnum::SceneGraph::InstanceData, @ref Magnum::SceneGraph::InstanceBatch, alias @ref Magnum::SceneGraph::BasicInstanceBatcher2D, @ref Magnum::SceneGraph::BasicInstanceBatcher3D, @ref Magnum::SceneGraph::BasicInstancedDrawable2D, @ref Magnum::SceneGraph::BasicInstancedDrawable3D, typedef @ref Magnum::SceneGraph::InstanceBatcher2D, @ref Magnum::SceneGraph::InstanceBatcher3D, @ref Magnum::SceneGraph::InstancedDrawable2D, @ref Magnum::SceneGraph::InstancedDrawable3D, @ref Magnum::SceneGraph::InstanceData2D, @ref Magnum::SceneGraph::InstanceData3D
+ * @m_since_latest
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Per-instance data
+@m_since_latest
+
+Layout of a single instance in @ref InstanceBatcher::instanceData(). See
+@ref InstanceData<2> and @ref InstanceData<3> for the concrete layouts.
+*/
+template<UnsignedInt dimensions> struct InstanceData;
+
+/**
+@brief Per-instance data for two-dimensional scenes
+@m_since_latest
+
+Tightly packed, matching @ref Shaders::Flat2D::TransformationMatrix and
+@ref Shaders::Flat2D::Color4 attributes.
+@see @ref InstanceData2D
+*/
+template<> struct InstanceData<2> {
+    /** @brief Transformation matrix relative to the camera */
+    Matrix3 transformationMatrix;
+
+    /** @brief Color */
+    Color4 color;
+};
+
+/**
+@brief Per-instance data for three-dimensional scenes
+@m_since_latest
+
+Tightly packed, matching @ref Shaders::Phong::TransformationMatrix,
+@ref Shaders::Phong::NormalMatrix and @ref Shaders::Phong::Color4
+attributes. For @ref Shaders::Flat3D the normal matrix can be skipped.
+@see @ref InstanceData3D
+*/
+template<> struct InstanceData<3> {
+    /** @brief Transformation matrix relative to the camera */
+    Matrix4 transformationMatrix;
+
+    /**
+     * @brief Normal matrix
+     *
+     * Calculated from @ref transformationMatrix using
+     * @ref Math::Matrix4::normalMatrix().
+     */
+    Matrix3x3 normalMatrix;
+
+    /** @brief Color */
+    Color4 color;
+};
+
+/**
+@brief Per-instance data for two-dimensional scenes
+@m_since_latest
+*/
+typedef InstanceData<2> InstanceData2D;
+
+/**
+@brief Per-instance data for three-dimensional scenes
+@m_since_latest
+*/
+typedef InstanceData<3> InstanceData3D;
+
+/**
+@brief Batch of instances
+@m_since_latest
+
+A contiguous range of @ref InstanceBatcher::instanceData() sharing the same
+shader and mesh.
+@see @ref InstanceBatcher::batches()
+*/
+struct InstanceBatch {
+    /** @brief Shader ID */
+    UnsignedInt shader;
+
+    /** @brief Mesh ID */
+    UnsignedInt mesh;
+
+    /** @brief Offset of the first instance */
+    std::size_t offset;
+
+    /** @brief Instance count */
+    std::size_t count;
+};
+
+namespace Implementation {
+    template<class T> inline void fillInstanceData(InstanceData<2>& out, const Math::Matrix3<T>& transformationMatrix, const Color4& color) {
+        out.transformationMatrix = Matrix3{transformationMatrix};
+        out.color = color;
+    }
+    template<class T> inline void fillInstanceData(InstanceData<3>& out, const Math::Matrix4<T>& transformationMatrix, const Color4& color) {
+        out.transformationMatrix = Matrix4{transformationMatrix};
+        out.normalMatrix = Matrix3x3{transformationMatrix.normalMatrix()};
+        out.color = color;
+    }
+}
+
+/**
+@brief Instance batcher
+@m_since_latest
+
+Aggregates many drawables sharing the same mesh and shader into batches of
+per-instance data, which can be then drawn with a single instanced draw call
+instead of one draw call per object. The batcher itself doesn't depend on any
+GPU API --- the shaders and meshes are identified by application-defined IDs,
+for example indices into an array of meshes, and the output is a contiguous
+array of @ref InstanceData that can be uploaded to a buffer directly.
+
+@section SceneGraph-InstanceBatcher-usage Usage
+
+The easiest way to fill the batcher is via @ref InstancedDrawable. Instead of
+drawing anything, its @ref Drawable::draw() adds the camera-relative
+transformation and a color to the batcher. After drawing the group with a
+camera, which also applies
+@ref Camera::setFrustumCullingEnabled() "frustum culling" if enabled,
+@ref sort() groups the instances into @ref batches() and each batch is then
+drawn with an instanced shader:
+
+@snippet MagnumSceneGraph-gl.cpp InstanceBatcher-usage
+
+Since the transformations are already relative to the camera, the shader
+transformation and normal matrix uniforms stay at identity. The instances can
+be also added directly with @ref add(), for example from a
+@ref FlatHierarchy.
+
+@section SceneGraph-InstanceBatcher-layout Instance data layout
+
+In 3D, the instance data contain a transformation matrix, a normal matrix and
+a color, matching what @ref Shaders::Phong expects with
+@ref Shaders::Phong::Flag::InstancedTransformation and
+@ref Shaders::Phong::Flag::VertexColor enabled. In 2D, the normal matrix is
+omitted. The data for a particular batch are available through
+@ref instanceData(std::size_t) const, all batches are also placed one after
+another in @ref instanceData() const, so it's possible to upload all of them
+into a single buffer and offset into it for each batch.
+
+Instances are sorted by the shader first and by the mesh second, so
+consecutive batches share the same shader where possible. The sort is stable,
+instances in a batch stay in the order in which they were added. All memory
+is reused between frames, so once the batcher is large enough for given
+amount of instances, it doesn't allocate.
+
+@section SceneGraph-InstanceBatcher-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref InstanceBatcher.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref InstanceBatcher2D
+-   @ref InstanceBatcher3D
+
+@see @ref scenegraph, @ref BasicInstanceBatcher2D, @ref BasicInstanceBatcher3D,
+    @ref InstanceBatcher2D, @ref InstanceBatcher3D, @ref RenderQueue
+*/
+template<UnsignedInt dimensions, class T> class InstanceBatcher {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty batcher.
+         */
+        explicit InstanceBatcher();
+
+        /** @brief Copying is not allowed */
+        InstanceBatcher(const InstanceBatcher<dimensions, T>&) = delete;
+
+        /** @brief Move constructor */
+        InstanceBatcher(InstanceBatcher<dimensions, T>&&) noexcept;
+
+        ~InstanceBatcher();
+
+        /** @brief Copying is not allowed */
+        InstanceBatcher<dimensions, T>& operator=(const InstanceBatcher<dimensions, T>&) = delete;
+
+        /** @brief Move assignment */
+        InstanceBatcher<dimensions, T>& operator=(InstanceBatcher<dimensions, T>&&) noexcept;
+
+        /** @brief Count of added instances */
+        std::size_t instanceCount() const { return _keys.size(); }
+
+        /** @brief Whether the batcher is empty */
+        bool isEmpty() const { return _keys.empty(); }
+
+        /**
+         * @brief Clear the batcher
+         * @return Reference to self (for method chaining)
+         *
+         * Removes all instances and batches, keeps the allocated memory for
+         * reuse.
+         */
+        InstanceBatcher<dimensions, T>& clear();
+
+        /**
+         * @brief Add an instance
+         * @return Reference to self (for method chaining)
+         *
+         * The @p transformationMatrix is expected to be relative to the
+         * camera, same as what @ref Drawable::draw() gets. The normal matrix
+         * in 3D is calculated from it. Invalidates the @ref batches() until
+         * @ref sort() is called again.
+         */
+        InstanceBatcher<dimensions, T>& add(UnsignedInt shader, UnsignedInt mesh, const MatrixType& transformationMatrix, const Color4& color = Color4{1.0f});
+
+        /**
+         * @brief Sort the instances into batches
+         * @return Reference to self (for method chaining)
+         *
+         * Sorts the instances by shader and mesh and fills @ref batches().
+         */
+        InstanceBatcher<dimensions, T>& sort();
+
+        /**
+         * @brief Batches
+         *
+         * Filled by @ref sort(), empty before it's called and after
+         * @ref add() or @ref clear().
+         */
+        Containers::ArrayView<const InstanceBatch> batches() const {
+            return {_batches.data(), _batches.size()};
+        }
+
+        /**
+         * @brief Instance data
+         *
+         * In the order the instances were added or, after @ref sort(), with
+         * all batches placed one after another.
+         */
+        Containers::ArrayView<const InstanceData<dimensions>> instanceData() const {
+            return {_instances.data(), _instances.size()};
+        }
+
+        /**
+         * @brief Instance data for given batch
+         *
+         * Expects that @p batch is less than size of @ref batches().
+         */
+        Containers::ArrayView<const InstanceData<dimensions>> instanceData(std::size_t batch) const;
+
+    private:
+        std::vector<UnsignedLong> _keys;
+        std::vector<InstanceData<dimensions>> _instances;
+        std::vector<InstanceBatch> _batches;
+
+        /* Reused by sort() */
+        std::vector<Implementation::RenderQueueEntry> _entries, _entriesScratch;
+        std::vector<InstanceData<dimensions>> _instancesScratch;
+};
+
+/**
+@brief Instance batcher for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp InstanceBatcher<2, T> @ce. See
+@ref InstanceBatcher for more information.
+@see @ref InstanceBatcher2D, @ref BasicInstanceBatcher3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceBatcher2D = InstanceBatcher<2, T>;
+#endif
+
+/**
+@brief Instance batcher for two-dimensional float scenes
+@m_since_latest
+
+@see @ref InstanceBatcher3D
+*/
+typedef BasicInstanceBatcher2D<Float> InstanceBatcher2D;
+
+/**
+@brief Instance batcher for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp InstanceBatcher<3, T> @ce. See
+@ref InstanceBatcher for more information.
+@see @ref InstanceBatcher3D, @ref BasicInstanceBatcher2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceBatcher3D = InstanceBatcher<3, T>;
+#endif
+
+/**
+@brief Instance batcher for three-dimensional float scenes
+@m_since_latest
+
+@see @ref InstanceBatcher2D
+*/
+typedef BasicInstanceBatcher3D<Float> InstanceBatcher3D;
+
+/**
+@brief Instanced drawable
+@m_since_latest
+
+A @ref Drawable that doesn't draw anything by itself but instead adds its
+transformation and color to an @ref InstanceBatcher. See its documentation for
+more information.
+
+@section SceneGraph-InstancedDrawable-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref InstanceBatcher.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref InstancedDrawable2D
+-   @ref InstancedDrawable3D
+
+@see @ref scenegraph, @ref BasicInstancedDrawable2D,
+    @ref BasicInstancedDrawable3D, @ref InstancedDrawable2D,
+    @ref InstancedDrawable3D
+*/
+template<UnsignedInt dimensions, class T> class InstancedDrawable: public Drawable<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object        Object this drawable belongs to
+         * @param batcher       Batcher to add the instance to when drawn
+         * @param shader        Shader ID
+         * @param mesh          Mesh ID
+         * @param color         Instance color
+         * @param drawables     Group this drawable belongs to
+         */
+        explicit InstancedDrawable(AbstractObject<dimensions, T>& object, InstanceBatcher<dimensions, T>& batcher, UnsignedInt shader, UnsignedInt mesh, const Color4& color = Color4{1.0f}, DrawableGroup<dimensions, T>* drawables = nullptr);
+
+        /** @brief Batcher the instance is added to */
+        InstanceBatcher<dimensions, T>& batcher() const { return _batcher; }
+
+        /** @brief Shader ID */
+        UnsignedInt shader() const { return _shader; }
+
+        /** @brief Mesh ID */
+        UnsignedInt mesh() const { return _mesh; }
+
+        /** @brief Instance color */
+        Color4 color() const { return _color; }
+
+        /**
+         * @brief Set instance color
+         * @return Reference to self (for method chaining)
+         */
+        InstancedDrawable<dimensions, T>& setColor(const Color4& color) {
+            _color = color;
+            return *this;
+        }
+
+    private:
+        /* Adds the instance to the batcher */
+        void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) override;
+
+        InstanceBatcher<dimensions, T>& _batcher;
+        UnsignedInt _shader, _mesh;
+        Color4 _color;
+};
+
+/**
+@brief Instanced drawable for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp InstancedDrawable<2, T> @ce. See
+@ref InstancedDrawable for more information.
+@see @ref InstancedDrawable2D, @ref BasicInstancedDrawable3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstancedDrawable2D = InstancedDrawable<2, T>;
+#endif
+
+/**
+@brief Instanced drawable for two-dimensional float scenes
+@m_since_latest
+
+@see @ref InstancedDrawable3D
+*/
+typedef BasicInstancedDrawable2D<Float> InstancedDrawable2D;
+
+/**
+@brief Instanced drawable for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp InstancedDrawable<3, T> @ce. See
+@ref InstancedDrawable for more information.
+@see @ref InstancedDrawable3D, @ref BasicInstancedDrawable2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstancedDrawable3D = InstancedDrawable<3, T>;
+#endif
+
+/**
+@brief Instanced drawable for three-dimensional float scenes
+@m_since_latest
+
+@see @ref InstancedDrawable2D
+*/
+typedef BasicInstancedDrawable3D<Float> InstancedDrawable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstanceBatcher<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstanceBatcher<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstancedDrawable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstancedDrawable<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef Magnum_SceneGraph_InstanceBatcher_hpp
+#define Magnum_SceneGraph_InstanceBatcher_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref InstanceBatcher.h
+ * @m_since_latest
+ */
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/InstanceBatcher.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>::InstanceBatcher() = default;
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>::InstanceBatcher(InstanceBatcher<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>::~InstanceBatcher() = default;
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>& InstanceBatcher<dimensions, T>::operator=(InstanceBatcher<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>& InstanceBatcher<dimensions, T>::clear() {
+    _keys.clear();
+    _instances.clear();
+    _batches.clear();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>& InstanceBatcher<dimensions, T>::add(const UnsignedInt shader, const UnsignedInt mesh, const MatrixType& transformationMatrix, const Color4& color) {
+    _keys.push_back(UnsignedLong(shader) << 32 | mesh);
+    _instances.emplace_back();
+    Implementation::fillInstanceData(_instances.back(), transformationMatrix, color);
+    _batches.clear();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> InstanceBatcher<dimensions, T>& InstanceBatcher<dimensions, T>::sort() {
+    const std::size_t size = _keys.size();
+    _entries.resize(size);
+    for(std::size_t i = 0; i != size; ++i)
+        _entries[i] = {_keys[i], UnsignedInt(i)};
+
+    /* Same stable radix sort as used by RenderQueue */
+    Implementation::renderQueueSort(_entries, _entriesScratch);
+
+    /* Gather the instance data into the scratch storage, which then becomes
+       the main one, and split it into batches on key changes */
+    _instancesScratch.resize(size);
+    _batches.clear();
+    for(std::size_t i = 0; i != size; ++i) {
+        const Implementation::RenderQueueEntry& entry = _entries[i];
+        _keys[i] = entry.key;
+        _instancesScratch[i] = _instances[entry.index];
+
+        if(!i || entry.key != _keys[i - 1])
+            _batches.push_back({UnsignedInt(entry.key >> 32), UnsignedInt(entry.key & 0xffffffffu), i, 0});
+        ++_batches.back().count;
+    }
+    _instances.swap(_instancesScratch);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Containers::ArrayView<const InstanceData<dimensions>> InstanceBatcher<dimensions, T>::instanceData(const std::size_t batch) const {
+    CORRADE_ASSERT(batch < _batches.size(),
+        "SceneGraph::InstanceBatcher::instanceData(): index" << batch << "out of range for" << _batches.size() << "batches", {});
+    return {_instances.data() + _batches[batch].offset, _batches[batch].count};
+}
+
+template<UnsignedInt dimensions, class T> InstancedDrawable<dimensions, T>::InstancedDrawable(AbstractObject<dimensions, T>& object, InstanceBatcher<dimensions, T>& batcher, const UnsignedInt shader, const UnsignedInt mesh, const Color4& color, DrawableGroup<dimensions, T>* const drawables): Drawable<dimensions, T>{object, drawables}, _batcher(batcher), _shader{shader}, _mesh{mesh}, _color{color} {}
+
+template<UnsignedInt dimensions, class T> void InstancedDrawable<dimensions, T>::draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>&) {
+    _batcher.add(_shader, _mesh, transformationMatrix, _color);
+}
+
+}}
+
+#endif
@@ -74,6 +74,10 @@ and @ref previousSibling().
 
 @snippet MagnumSceneGraph.cpp Object-children
 
+Objects and their features are by default allocated on the heap one by one.
+If you create and destroy large amounts of them, it's possible to allocate
+them from an @ref ObjectPool instead.
+
 @section SceneGraph-Object-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into the @ref SceneGraph
@@ -284,6 +288,19 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& finalTransformationMatrix = MatrixType()) const;
 
+        /**
+         * @brief Calculate transformation matrices of given set of objects relative to this object into given storage
+         * @m_since_latest
+         *
+         * Same as @ref transformationMatrices(), but puts the result into
+         * @p transformationMatrices, which is expected to have the same size
+         * as @p objects. Temporary storage is kept in the scene and reused
+         * between calls, so once it's large enough for given set of objects,
+         * this function doesn't allocate.
+         * @see @ref transformationsInto()
+         */
+        void transformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType()) const;
+
         /**
          * @brief Transformations of given group of objects relative to this object
          *
@@ -303,6 +320,25 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Calculate transformations of given group of objects relative to this object into given storage
+         * @m_since_latest
+         *
+         * Same as @ref transformations(), but puts the result into
+         * @p transformations, which is expected to have the same size as
+         * @p objects. Temporary storage is kept in the scene and reused
+         * between calls, so once it's large enough for given set of objects,
+         * this function doesn't allocate.
+         * @see @ref transformationMatricesInto()
+         */
+        void transformationsInto(const Containers::ArrayView<const std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayView<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            ) const;
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -324,6 +360,33 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* `objects` passed by copy intentionally (to avoid copy internally) */
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
+        /**
+         * @brief Clean absolute transformations of given set of objects on multiple threads
+         * @param objects       Objects to clean
+         * @param threadCount   Thread count. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         * @m_since_latest
+         *
+         * Equivalent to @ref setClean(std::vector<std::reference_wrapper<Object<Transformation>>>),
+         * except that the objects are cleaned from up to @p threadCount
+         * threads. The objects are processed level by level --- first all
+         * dirty objects that don't have a dirty parent, then their dirty
+         * children and so on, with each level finished before the next one
+         * starts. Thus @ref AbstractFeature::clean() and
+         * @ref AbstractFeature::cleanInverted() "cleanInverted()" of a parent
+         * object are always called before the ones of its children. Features
+         * of a single object are cleaned in order on the same thread, but
+         * features of different objects on the same level can be cleaned
+         * concurrently, so it has to be safe to call them on different
+         * objects at the same time. Levels with just a few objects are
+         * processed on the calling thread, which makes this function best
+         * suited for wide hierarchies. On
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the objects are always
+         * cleaned serially.
+         */
+        /* `objects` passed by copy intentionally (to avoid copy internally) */
+        static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects, std::size_t threadCount);
+
         /** @copydoc AbstractObject::isDirty() */
         bool isDirty() const { return !!(flags & Flag::Dirty); }
 
@@ -387,8 +450,12 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
+        /* Calculates transformations of objectCount objects returned by
+           objects(i) into scratch memory in the scene, returns a view on it
+           or an empty view on error */
+        template<class ObjectAt> Containers::ArrayView<const typename Transformation::DataType> computeTransformations(std::size_t objectCount, const ObjectAt& objects, const typename Transformation::DataType& finalTransformation) const;
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
@@ -399,7 +466,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
 };
 
@@ -30,8 +30,9 @@
  */
 
 #include <algorithm>
-#include <stack>
+#include <iterator>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -43,7 +44,7 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flags(Flag::Dirty) {
     setParent(parent);
 }
 
@@ -137,12 +138,24 @@ template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
-    /* Collect all parents, compute base transformation */
-    std::stack<Object<Transformation>*> objects;
+    /* Collect all parents, compute base transformation. Hierarchies are
+       usually shallow, so the parents are collected into an array on stack
+       and only deeper chains spill to heap, to avoid allocations when a
+       moving camera gets cleaned every frame. */
+    Object<Transformation>* shallowObjects[16];
+    std::vector<Object<Transformation>*> deepObjects;
+    std::size_t objectCount = 0;
     typename Transformation::DataType absoluteTransformation;
     Object<Transformation>* p = static_cast<Object<Transformation>*>(this);
     for(;;) {
-        objects.push(p);
+        if(objectCount < Containers::arraySize(shallowObjects))
+            shallowObjects[objectCount] = p;
+        else {
+            if(objectCount == Containers::arraySize(shallowObjects))
+                deepObjects.assign(std::begin(shallowObjects), std::end(shallowObjects));
+            deepObjects.push_back(p);
+        }
+        ++objectCount;
 
         p = p->parent();
 
@@ -158,9 +171,9 @@ template<class Transformation> void Object<Transformation>::setClean() {
     }
 
     /* Clean features on every collected object, going down from root object */
-    while(!objects.empty()) {
-        Object<Transformation>* o = objects.top();
-        objects.pop();
+    Object<Transformation>* const* const objects = objectCount <= Containers::arraySize(shallowObjects) ? shallowObjects : deepObjects.data();
+    for(std::size_t i = objectCount; i; --i) {
+        Object<Transformation>* o = objects[i - 1];
 
         /* Compose transformation and clean object */
         absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, o->transformation());
@@ -171,23 +184,74 @@ template<class Transformation> void Object<Transformation>::setClean() {
 }
 
 template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+    const Containers::ArrayView<const typename Transformation::DataType> transformations = computeTransformations(objects.size(), [&objects](std::size_t i) -> Object<Transformation>& {
+        return static_cast<Object<Transformation>&>(objects[i].get());
+    }, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix));
+    if(transformations.size() != objects.size()) return {};
+
+    std::vector<MatrixType> transformationMatrices(transformations.size());
+    for(std::size_t i = 0; i != transformations.size(); ++i)
+        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
 
-    return transformationMatrices(std::move(castObjects), finalTransformationMatrix);
+    return transformationMatrices;
 }
 
-template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<typename Transformation::DataType> transformations = this->transformations(std::move(objects), Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix));
-    std::vector<MatrixType> transformationMatrices(transformations.size());
-    for(std::size_t i = 0; i != objects.size(); ++i)
+template<class Transformation> void Object<Transformation>::doTransformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::Object::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+
+    /** @todo Ensure this doesn't crash, somehow */
+    const Containers::ArrayView<const typename Transformation::DataType> transformations = computeTransformations(objects.size(), [&objects](std::size_t i) -> Object<Transformation>& {
+        return static_cast<Object<Transformation>&>(objects[i].get());
+    }, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix));
+    if(transformations.size() != objects.size()) return;
+
+    for(std::size_t i = 0; i != transformations.size(); ++i)
         transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+}
 
+template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    std::vector<MatrixType> transformationMatrices(objects.size());
+    transformationMatricesInto({objects.data(), objects.size()}, {transformationMatrices.data(), transformationMatrices.size()}, finalTransformationMatrix);
     return transformationMatrices;
 }
 
+template<class Transformation> void Object<Transformation>::transformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayView<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::Object::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+
+    const Containers::ArrayView<const typename Transformation::DataType> transformations = computeTransformations(objects.size(), [&objects](std::size_t i) -> Object<Transformation>& {
+        return objects[i].get();
+    }, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix));
+    if(transformations.size() != objects.size()) return;
+
+    for(std::size_t i = 0; i != transformations.size(); ++i)
+        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+}
+
+template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
+    const Containers::ArrayView<const typename Transformation::DataType> transformations = computeTransformations(objects.size(), [&objects](std::size_t i) -> Object<Transformation>& {
+        return objects[i].get();
+    }, finalTransformation);
+    if(transformations.size() != objects.size()) return {};
+
+    return std::vector<typename Transformation::DataType>(transformations.begin(), transformations.end());
+}
+
+template<class Transformation> void Object<Transformation>::transformationsInto(const Containers::ArrayView<const std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayView<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation) const {
+    CORRADE_ASSERT(transformations.size() == objects.size(),
+        "SceneGraph::Object::transformationsInto(): expected" << objects.size() << "transformations but got" << transformations.size(), );
+
+    const Containers::ArrayView<const typename Transformation::DataType> result = computeTransformations(objects.size(), [&objects](std::size_t i) -> Object<Transformation>& {
+        return objects[i].get();
+    }, finalTransformation);
+    if(result.size() != objects.size()) return;
+
+    for(std::size_t i = 0; i != result.size(); ++i)
+        transformations[i] = result[i];
+}
+
 /*
 Computing absolute transformations for given list of objects
 
@@ -199,82 +263,134 @@ divided into two groups:
  - "non-joints", i.e. paths between joints
 
 Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
+computed and concatenated together, parents first. Resulting transformations
+for joints which were originally in `object` list is then returned.
+
+Every object is walked through at most once in each of the passes and the
+concatenation uses an explicit stack instead of recursion, so the whole
+operation is linear in the size of the involved subtree and doesn't overflow
+the call stack on deep hierarchies. The joint list, parent joint indices, the
+stack and the joint transformations are kept in the scene and reused by
+subsequent calls, so once they're large enough no allocations happen. The
+returned view points into the scene and is valid only until the next call.
 */
-template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+template<class Transformation> template<class ObjectAt> Containers::ArrayView<const typename Transformation::DataType> Object<Transformation>::computeTransformations(const std::size_t objectCount, const ObjectAt& objects, const typename Transformation::DataType& finalTransformation) const {
+    CORRADE_ASSERT(objectCount < 0xFFFFFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+
+    #ifndef CORRADE_NO_ASSERT
+    /* Scene object */
+    const Scene<Transformation>* scene = this->scene();
+    #endif
 
-    /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+
+    /* Scratch memory reused between calls */
+    const Scene<Transformation>& self = static_cast<const Scene<Transformation>&>(*this);
+    std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects = self._jointObjects;
+    std::vector<UnsignedInt>& parentJoints = self._parentJoints;
+    std::vector<UnsignedInt>& stack = self._jointStack;
+    std::vector<typename Transformation::DataType>& jointTransformations = self._jointTransformations;
 
     /* Mark all original objects as joints and create initial list of joints
        from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
+    jointObjects.clear();
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>& object = objects(i);
+        jointObjects.push_back(object);
+
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(object.counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
-        objects[i].get().flags |= Flag::Joint;
+        object.counter = UnsignedInt(i);
+        object.flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
-    #ifndef CORRADE_NO_ASSERT
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
-    #endif
+    /* Mark all objects up the hierarchy as visited. Each path is walked only
+       until it reaches an object that was already visited by some previous
+       path, which makes that object a joint. */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        /* Already visited (duplicate occurence), continue to next */
+        if(jointObjects[i].get().flags & Flag::Visited) continue;
 
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+        for(Object<Transformation>* o = &jointObjects[i].get(); ; ) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+            Object<Transformation>* parent = o->parent();
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
-
-        Object<Transformation>* parent = it->get().parent();
-
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is a joint or already visited, done. If not already
+               marked as joint, mark it as such and add it to list of joint
+               objects */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_ASSERT(jointObjects.size() < 0xFFFFFFFFu,
+                        "SceneGraph::Object::transformations(): too large scene", {});
+                    CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                    parent->counter = UnsignedInt(jointObjects.size());
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
     /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    jointTransformations.resize(jointObjects.size());
+    parentJoints.resize(jointObjects.size());
+
+    /* Compute transformations of all joints relative to their parent joint,
+       cleaning visited marks of non-joint objects on the way. The visited
+       mark of the joint itself stays until its absolute transformation is
+       known. Duplicate occurences are handled at the end. */
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
+        Object<Transformation>& joint = jointObjects[i].get();
+        if(joint.counter != i) continue;
+
+        typename Transformation::DataType transformation = joint.transformation();
+        Object<Transformation>* parent = joint.parent();
+        while(parent && !(parent->flags & Flag::Joint)) {
+            CORRADE_INTERNAL_ASSERT(parent->flags & Flag::Visited);
+            parent->flags &= ~Flag::Visited;
+            transformation = Implementation::Transformation<Transformation>::compose(parent->transformation(), transformation);
+            parent = parent->parent();
+        }
+
+        jointTransformations[i] = transformation;
+        parentJoints[i] = parent ? parent->counter : 0xFFFFFFFFu;
+    }
 
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, finalTransformation);
+    /* Concatenate the transformations, parent joints first. For every joint
+       that's not done yet, put the chain of its not yet done parent joints on
+       a stack and then unwind it. */
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
+        if(jointObjects[i].get().counter != i || !(jointObjects[i].get().flags & Flag::Visited)) continue;
+
+        stack.clear();
+        UnsignedInt joint = UnsignedInt(i);
+        while(joint != 0xFFFFFFFFu && (jointObjects[joint].get().flags & Flag::Visited)) {
+            stack.push_back(joint);
+            joint = parentJoints[joint];
+        }
+
+        const typename Transformation::DataType* parentTransformation = joint == 0xFFFFFFFFu ? &finalTransformation : &jointTransformations[joint];
+        for(auto it = stack.rbegin(); it != stack.rend(); ++it) {
+            jointTransformations[*it] = Implementation::Transformation<Transformation>::compose(*parentTransformation, jointTransformations[*it]);
+            jointObjects[*it].get().flags &= ~Flag::Visited;
+            parentTransformation = &jointTransformations[*it];
+        }
+    }
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
@@ -287,51 +403,17 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     for(auto i: jointObjects) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
+        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFFFFFu || i.get().flags & Flag::Joint);
+        CORRADE_INTERNAL_ASSERT(!(i.get().flags & Flag::Visited));
         i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        i.get().counter = 0xFFFFFFFFu;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
-}
-
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
-
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
-
-    /* Initialize transformation */
-    jointTransformations[joint] = o.get().transformation();
-
-    /* Go up until next joint or root */
-    for(;;) {
-        /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o.get().flags & Flag::Visited);
-        o.get().flags &= ~Flag::Visited;
-
-        Object<Transformation>* parent = o.get().parent();
-
-        /* Root object, compose transformation with final, done */
-        if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o.get().isScene());
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(finalTransformation, jointTransformations[joint]));
-
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, finalTransformation), jointTransformations[joint]));
-
-        /* Else compose transformation with parent, go up the hierarchy */
-        } else {
-            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
-            o = *parent;
-        }
-    }
+    /* Return only transformations of requested objects. The scratch joint
+       list is cleared so it doesn't keep references to objects that might get
+       destroyed in the meantime, the capacity is kept. */
+    jointObjects.clear();
+    return {jointTransformations.data(), objectCount};
 }
 
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
@@ -382,6 +464,109 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     }
 }
 
+template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const std::size_t threadCount) {
+    /* Remove all clean objects from the list */
+    auto firstClean = std::remove_if(objects.begin(), objects.end(), [](Object<Transformation>& o) { return !o.isDirty(); });
+    objects.erase(firstClean, objects.end());
+
+    /* No dirty objects left, done */
+    if(objects.empty()) return;
+
+    CORRADE_ASSERT(objects[0].get().scene(), "Object::setClean(): objects must be part of some scene", );
+
+    /* Gather a list of unique objects together with their non-clean parents.
+       Objects in the list are marked as visited and their counter is set to
+       their position in the list. */
+    std::vector<Object<Transformation>*> list;
+    list.reserve(objects.size());
+    for(Object<Transformation>& o: objects) {
+        Object<Transformation>* p = &o;
+        while(p && !(p->flags & Flag::Visited) && p->isDirty()) {
+            p->flags |= Flag::Visited;
+            p->counter = list.size();
+            list.push_back(p);
+            p = p->parent();
+        }
+    }
+
+    /* Calculate depth of every object relative to the topmost dirty parent.
+       The walk up stops at first object that has the level already
+       calculated, so this is linear in the object count. */
+    const std::size_t count = list.size();
+    std::vector<UnsignedInt> levels(count, 0xFFFFFFFFu);
+    std::vector<UnsignedInt> stack;
+    UnsignedInt levelCount = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        if(levels[i] != 0xFFFFFFFFu) continue;
+
+        UnsignedInt level = 0;
+        for(std::size_t j = i; ; ) {
+            stack.push_back(j);
+            const Object<Transformation>* const parent = list[j]->parent();
+            if(!parent || !(parent->flags & Flag::Visited)) break;
+            if(levels[parent->counter] != 0xFFFFFFFFu) {
+                level = levels[parent->counter] + 1;
+                break;
+            }
+            j = parent->counter;
+        }
+
+        for(; !stack.empty(); stack.pop_back())
+            levels[stack.back()] = level++;
+        levelCount = std::max(levelCount, level);
+    }
+
+    /* Sort the objects by level */
+    std::vector<UnsignedInt> levelOffsets(levelCount + 1);
+    for(const UnsignedInt level: levels) ++levelOffsets[level + 1];
+    for(std::size_t i = 0; i != levelCount; ++i)
+        levelOffsets[i + 1] += levelOffsets[i];
+    std::vector<UnsignedInt> sorted(count);
+    {
+        std::vector<UnsignedInt> levelCursors{levelOffsets.begin(), levelOffsets.end() - 1};
+        for(std::size_t i = 0; i != count; ++i)
+            sorted[levelCursors[levels[i]]++] = i;
+    }
+
+    /* Go level by level, calculating the absolute transformation of each
+       object from its parent and cleaning it. Objects on the same level don't
+       depend on each other so they can be processed in parallel, and each
+       object only modifies its own state. */
+    std::vector<typename Transformation::DataType> transformations(count);
+    struct State {
+        Object<Transformation>* const* list;
+        const UnsignedInt* sorted;
+        typename Transformation::DataType* transformations;
+    } state{list.data(), nullptr, transformations.data()};
+    for(std::size_t i = 0; i != levelCount; ++i) {
+        state.sorted = sorted.data() + levelOffsets[i];
+        const std::size_t levelSize = levelOffsets[i + 1] - levelOffsets[i];
+
+        /* Small levels aren't worth dispatching to the worker threads */
+        Magnum::Implementation::parallelFor(levelSize, Magnum::Implementation::parallelChunkCount(levelSize, levelSize < 64 ? 1 : threadCount), [](void* state, std::size_t, std::size_t begin, std::size_t end) {
+            const State& s = *static_cast<const State*>(state);
+            for(std::size_t j = begin; j != end; ++j) {
+                const UnsignedInt index = s.sorted[j];
+                Object<Transformation>& o = *s.list[index];
+                const Object<Transformation>* const parent = o.parent();
+                if(!parent)
+                    s.transformations[index] = o.transformation();
+                else if(parent->flags & Flag::Visited)
+                    s.transformations[index] = Implementation::Transformation<Transformation>::compose(s.transformations[parent->counter], o.transformation());
+                else
+                    s.transformations[index] = Implementation::Transformation<Transformation>::compose(parent->absoluteTransformation(), o.transformation());
+                o.setCleanInternal(s.transformations[index]);
+            }
+        }, &state);
+    }
+
+    /* Cleanup all marks */
+    for(Object<Transformation>* o: list) {
+        o->flags &= ~Flag::Visited;
+        o->counter = 0xFFFFFFFFu;
+    }
+}
+
 template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
     /* "Lazy storage" for transformation matrix and inverted transformation matrix */
     CachedTransformations cached;
@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjectPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace SceneGraph {
+
+namespace {
+    /* Allocation granularity, matching the alignment the system allocator
+       guarantees on 64-bit platforms */
+    constexpr std::size_t Granularity = 16;
+
+    /* Head of the list of all live pools. Objects and features can be
+       deleted from any thread, so the list and slab ranges of all pools in it
+       are guarded by the mutex. The pool count is there to skip the locking
+       entirely if no pool exists. */
+    std::mutex poolsMutex;
+    ObjectPool* pools = nullptr;
+    std::atomic<std::size_t> poolCount{0};
+}
+
+ObjectPool::ObjectPool(const std::size_t slabSize): _slabSize{slabSize}, _previous{} {
+    {
+        std::lock_guard<std::mutex> lock{poolsMutex};
+        _next = pools;
+        if(_next) _next->_previous = this;
+        pools = this;
+        ++poolCount;
+    }
+
+    CORRADE_ASSERT(slabSize >= Granularity,
+        "SceneGraph::ObjectPool: expected slab size to be at least" << Granularity << "bytes but got" << slabSize, );
+}
+
+ObjectPool::~ObjectPool() {
+    std::lock_guard<std::mutex> lock{poolsMutex};
+    if(_previous) _previous->_next = _next;
+    else pools = _next;
+    if(_next) _next->_previous = _previous;
+    --poolCount;
+}
+
+ObjectPool* ObjectPool::find(const void* const memory) {
+    /* Without any pool there's nothing to look up */
+    if(!poolCount) return nullptr;
+
+    std::lock_guard<std::mutex> lock{poolsMutex};
+    const char* const pointer = static_cast<const char*>(memory);
+    for(ObjectPool* pool = pools; pool; pool = pool->_next) {
+        /* Find the last slab starting at or before the pointer */
+        auto found = std::upper_bound(pool->_slabRanges.begin(), pool->_slabRanges.end(), pointer,
+            [](const char* a, const std::pair<const char*, const char*>& b) {
+                return a < b.first;
+            });
+        if(found != pool->_slabRanges.begin() && pointer < (--found)->second)
+            return pool;
+    }
+
+    return nullptr;
+}
+
+void* ObjectPool::allocateSlab(const std::size_t size) {
+    _slabs.emplace_back(Containers::NoInit, size);
+    const std::pair<const char*, const char*> range{_slabs.back().begin(), _slabs.back().end()};
+    std::lock_guard<std::mutex> lock{poolsMutex};
+    _slabRanges.insert(std::upper_bound(_slabRanges.begin(), _slabRanges.end(), range), range);
+    return _slabs.back().data();
+}
+
+void* ObjectPool::allocate(const std::size_t size) {
+    CORRADE_ASSERT(size,
+        "SceneGraph::ObjectPool::allocate(): expected non-zero size", nullptr);
+
+    const std::size_t sizeClass = (size + Granularity - 1)/Granularity;
+    const std::size_t roundedSize = sizeClass*Granularity;
+    ++_allocationCount;
+
+    /* Reuse previously freed memory of the same size class, if any */
+    if(sizeClass < _freeLists.size() && _freeLists[sizeClass]) {
+        void* const memory = _freeLists[sizeClass];
+        _freeLists[sizeClass] = *static_cast<void**>(memory);
+        return memory;
+    }
+
+    /* Large allocations get a dedicated slab, the current one stays */
+    if(roundedSize > _slabSize) return allocateSlab(roundedSize);
+
+    /* Not enough space in the current slab, allocate a new one. The unused
+       remainder of the previous one is wasted. */
+    if(std::size_t(_end - _current) < roundedSize) {
+        _current = static_cast<char*>(allocateSlab(_slabSize));
+        _end = _current + _slabSize;
+    }
+
+    void* const memory = _current;
+    _current += roundedSize;
+    return memory;
+}
+
+void ObjectPool::deallocate(void* const memory, const std::size_t size) {
+    CORRADE_ASSERT(memory && size,
+        "SceneGraph::ObjectPool::deallocate(): expected non-null memory and non-zero size", );
+    CORRADE_INTERNAL_ASSERT(_allocationCount);
+
+    const std::size_t sizeClass = (size + Granularity - 1)/Granularity;
+    if(sizeClass >= _freeLists.size()) _freeLists.resize(sizeClass + 1);
+    *static_cast<void**>(memory) = _freeLists[sizeClass];
+    _freeLists[sizeClass] = memory;
+    --_allocationCount;
+}
+
+void ObjectPool::abandon() {
+    CORRADE_INTERNAL_ASSERT(_allocationCount);
+    --_allocationCount;
+}
+
+namespace Implementation {
+
+void* PoolAllocated::operator new(const std::size_t size) {
+    return ::operator new(size);
+}
+
+void* PoolAllocated::operator new(const std::size_t size, ObjectPool& pool) {
+    return pool.allocate(size);
+}
+
+void PoolAllocated::operator delete(void* const pointer, const std::size_t size) {
+    if(!pointer) return;
+
+    if(ObjectPool* const pool = ObjectPool::find(pointer)) {
+        pool->deallocate(pointer, size);
+        return;
+    }
+
+    ::operator delete(pointer);
+}
+
+void PoolAllocated::operator delete(void*, ObjectPool& pool) {
+    pool.abandon();
+}
+
+}
+
+}}
@@ -0,0 +1,205 @@
+#ifndef Magnum_SceneGraph_ObjectPool_h
+#define Magnum_SceneGraph_ObjectPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::ObjectPool
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Base of AbstractObject and AbstractFeature making it possible to
+       allocate them with new(pool). The delete operator is the sized one, so
+       it gets the size of the most derived class from the virtual
+       destructor, and the pool is found by an address lookup, so neither
+       pool nor heap allocations need any header. As these are static
+       members, they're not ambiguous even if a class derives both from an
+       object and a feature. */
+    struct MAGNUM_SCENEGRAPH_EXPORT PoolAllocated {
+        static void* operator new(std::size_t size);
+        static void* operator new(std::size_t size, ObjectPool& pool);
+        /* The class-specific operators hide the global placement new, so it
+           has to be provided as well for construction in external storage */
+        static void* operator new(std::size_t, void* pointer) noexcept { return pointer; }
+        static void operator delete(void* pointer, std::size_t size);
+        /* Called if a constructor throws */
+        static void operator delete(void* pointer, ObjectPool& pool);
+        static void operator delete(void*, void*) noexcept {}
+    };
+}
+
+/**
+@brief Pool allocator for objects and features
+@m_since_latest
+
+Allocates @ref Object and feature instances from large contiguous slabs
+instead of a separate heap allocation for each. Objects and features are
+allocated from the pool using a placement-new syntax, otherwise they're used
+and deleted the same way as heap-allocated ones, including being deleted
+together with their parent object:
+
+@snippet MagnumSceneGraph.cpp ObjectPool-usage
+
+Allocations are done by bumping a pointer in the current slab, so objects and
+features created one after another --- such as a freshly created child, its
+features and its own children --- are placed next to each other in memory.
+Deallocation puts the memory into a free list for given size, from where it's
+reused by subsequent allocations of the same size. Deleting an object
+subtree thus still calls destructors of all objects and features in it, but
+returning their memory is a constant-time operation without going through the
+system allocator, and the slabs themselves are freed all at once when the pool
+is destroyed.
+
+The pool is meant to be used one per scene. It has to outlive all objects and
+features allocated from it, so it's recommended to declare it before the
+@ref Scene. Objects and features allocated from the pool can be freely mixed
+with heap-allocated ones in the same hierarchy. When an object or a feature is
+deleted, the pool it came from is found by checking its address against slabs
+of all live pools. Objects and features created with a plain @cpp new @ce
+don't have any extra memory overhead, and while no pool exists, deleting them
+goes directly to the system allocator.
+
+The lookup is guarded by a global lock, so pools can be created and destroyed
+and objects and features deleted from multiple threads. Allocations and
+deallocations from the same pool are however not thread-safe, a scene using a
+pool should be modified only from one thread at a time.
+@see @ref scenegraph
+*/
+class MAGNUM_SCENEGRAPH_EXPORT ObjectPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param slabSize      Size of a single slab in bytes
+         *
+         * No memory is allocated until the first allocation happens.
+         */
+        explicit ObjectPool(std::size_t slabSize = 65536);
+
+        /** @brief Copying is not allowed */
+        ObjectPool(const ObjectPool&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Allocations from the pool reference it, so it can't be moved.
+         */
+        ObjectPool(ObjectPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all slabs. All objects and features allocated from the pool
+         * are expected to be deleted at this point.
+         */
+        ~ObjectPool();
+
+        /** @brief Copying is not allowed */
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool& operator=(ObjectPool&&) = delete;
+
+        /** @brief Size of a single slab in bytes */
+        std::size_t slabSize() const { return _slabSize; }
+
+        /**
+         * @brief Count of allocated slabs
+         *
+         * Includes also dedicated slabs for allocations larger than
+         * @ref slabSize().
+         */
+        std::size_t slabCount() const { return _slabs.size(); }
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const { return _allocationCount; }
+
+        /**
+         * @brief Allocate memory
+         *
+         * The returned memory is aligned to at least 16 bytes. If there's a
+         * previously deallocated memory of the same size class, it's reused,
+         * otherwise the memory is taken from the current slab. If it doesn't
+         * have enough space, a new slab is allocated. Allocations larger than
+         * @ref slabSize() get a dedicated slab. Expects that @p size is
+         * non-zero. You don't need to call this function directly, use the
+         * @cpp new(pool) @ce syntax shown in the class documentation
+         * instead.
+         * @see @ref deallocate()
+         */
+        void* allocate(std::size_t size);
+
+        /**
+         * @brief Deallocate memory
+         *
+         * Expects that @p memory was allocated from this pool with the same
+         * @p size. The memory is put into a free list for reuse by subsequent
+         * allocations, it's released only when the pool is destroyed.
+         */
+        void deallocate(void* memory, std::size_t size);
+
+    private:
+        friend struct Implementation::PoolAllocated;
+
+        /* Returns a live pool containing given memory or nullptr if it's not
+           from any pool. Locks the global pool list. */
+        static ObjectPool* find(const void* memory);
+
+        void* allocateSlab(std::size_t size);
+
+        /* Used if a constructor throws, where the size isn't known. The
+           memory isn't reused, only released together with the slab. */
+        void abandon();
+
+        std::size_t _slabSize;
+        std::size_t _allocationCount{};
+        char* _current{};
+        char* _end{};
+        std::vector<Containers::Array<char>> _slabs;
+        /* Begin and end of each slab, sorted by address for the lookup in
+           find() */
+        std::vector<std::pair<const char*, const char*>> _slabRanges;
+        /* Intrusive list of all live pools, guarded by a global mutex */
+        ObjectPool* _previous;
+        ObjectPool* _next;
+        /* Heads of singly-linked free lists for each 16-byte size class, the
+           link is stored in the first bytes of the free memory */
+        std::vector<void*> _freeLists;
+};
+
+}}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderQueue.h"
+
+#include <utility>
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+void renderQueueSort(std::vector<RenderQueueEntry>& entries, std::vector<RenderQueueEntry>& scratch) {
+    const std::size_t size = entries.size();
+    if(size < 2) return;
+    scratch.resize(size);
+
+    /* Histograms of all eight digits in a single pass */
+    std::size_t counts[8][256]{};
+    for(const RenderQueueEntry& entry: entries)
+        for(std::size_t digit = 0; digit != 8; ++digit)
+            ++counts[digit][(entry.key >> (digit*8)) & 0xff];
+
+    RenderQueueEntry* src = entries.data();
+    RenderQueueEntry* dst = scratch.data();
+    for(std::size_t digit = 0; digit != 8; ++digit) {
+        /* If all keys have the same value of this digit, the pass wouldn't
+           change anything. This skips the unused high bits and bits that are
+           the same in all keys, such as a single shader. */
+        std::size_t* const digitCounts = counts[digit];
+        const std::size_t shift = digit*8;
+        if(digitCounts[(src[0].key >> shift) & 0xff] == size) continue;
+
+        /* Turn the counts into offsets */
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t count = digitCounts[i];
+            digitCounts[i] = offset;
+            offset += count;
+        }
+
+        /* Scatter, which preserves order of entries with the same digit */
+        for(std::size_t i = 0; i != size; ++i)
+            dst[digitCounts[(src[i].key >> shift) & 0xff]++] = src[i];
+
+        std::swap(src, dst);
+    }
+
+    /* Odd amount of passes, the result is in the scratch memory */
+    if(src != entries.data()) entries.swap(scratch);
+}
+
+}}}
@@ -0,0 +1,289 @@
+#ifndef Magnum_SceneGraph_RenderQueue_h
+#define Magnum_SceneGraph_RenderQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::RenderQueue, alias @ref Magnum::SceneGraph::BasicRenderQueue2D, @ref Magnum::SceneGraph::BasicRenderQueue3D, typedef @ref Magnum::SceneGraph::RenderQueue2D, @ref Magnum::SceneGraph::RenderQueue3D
+ * @m_since_latest
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    struct RenderQueueEntry {
+        UnsignedLong key;
+        UnsignedInt index;
+    };
+
+    /* Stable LSD radix sort by the key, the result is in entries again.
+       Defined in RenderQueue.cpp. */
+    MAGNUM_SCENEGRAPH_EXPORT void renderQueueSort(std::vector<RenderQueueEntry>& entries, std::vector<RenderQueueEntry>& scratch);
+}
+
+/**
+@brief Render queue
+@m_since_latest
+
+Collects drawables together with their transformations and a 64-bit sort key
+and draws them sorted by the key. The key is meant to encode the render state
+the drawable needs --- shader, material, mesh --- and optionally its depth, so
+drawing in the sorted order groups drawables with the same state together and
+the amount of redundant shader, texture and buffer rebinds is minimized.
+
+@section SceneGraph-RenderQueue-usage Usage
+
+The key for each drawable is provided by @ref Drawable::sortKey(), which is
+called with the camera-relative transformation from
+@ref Camera::draw(DrawableGroup<dimensions, T>&, RenderQueue<dimensions, T>&).
+The camera then fills the queue with drawables that passed
+@ref Camera::setFrustumCullingEnabled() "frustum culling", sorts it and calls
+@ref Drawable::draw() on each in the sorted order. The @ref key() and
+@ref depthKey() helpers can be used to pack the state into the key, with the
+most significant state in the highest bits:
+
+@snippet MagnumSceneGraph.cpp RenderQueue-usage
+
+The default @ref Drawable::sortKey() implementation returns @cpp 0 @ce for
+all drawables. The sort is stable, so drawables with equal keys are drawn in
+the order they are in the group. Drawables for which the depth is the
+most important, such as transparent objects, can put the inverted depth into
+the highest bits to be drawn back-to-front.
+
+@section SceneGraph-RenderQueue-custom Custom dispatch
+
+The queue can be also filled manually using @ref add() and after @ref sort()
+the contents are available through @ref keys(), @ref transformations() and
+@ref drawables(), in a sorted order. That allows the application to decide
+what to do with the drawables itself, for example to detect state changes
+between consecutive keys, or to record the draw order in tests without any
+GPU access.
+
+The sort is a least-significant-digit radix sort with 8-bit digits, which
+has a linear complexity in the number of drawables. Digits that are the same
+for all keys, such as unused high bits, are skipped. All memory is reused
+between frames, so once the queue is large enough for given amount of
+drawables, it doesn't allocate.
+
+@section SceneGraph-RenderQueue-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref RenderQueue.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref RenderQueue2D
+-   @ref RenderQueue3D
+
+@see @ref scenegraph, @ref BasicRenderQueue2D, @ref BasicRenderQueue3D,
+    @ref RenderQueue2D, @ref RenderQueue3D
+*/
+template<UnsignedInt dimensions, class T> class RenderQueue {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /**
+         * @brief Pack a sort key
+         *
+         * Puts @p shader into the highest 16 bits of the key, followed by
+         * @p material, @p mesh and @p depth in the lowest 16 bits.
+         * @see @ref depthKey()
+         */
+        constexpr static UnsignedLong key(UnsignedShort shader, UnsignedShort material, UnsignedShort mesh, UnsignedShort depth) {
+            return UnsignedLong(shader) << 48 | UnsignedLong(material) << 32 | UnsignedLong(mesh) << 16 | UnsignedLong(depth);
+        }
+
+        /**
+         * @brief Quantize depth for a sort key
+         *
+         * Maps @p depth in range @f$ [0, d_{max}] @f$ to the full 16-bit
+         * range, values outside of the range are clamped. For front-to-back
+         * order use the value directly, for back-to-front subtract it from
+         * @cpp 0xffff @ce.
+         * @see @ref key()
+         */
+        static UnsignedShort depthKey(T depth, T maxDepth);
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty queue.
+         */
+        explicit RenderQueue();
+
+        /** @brief Copying is not allowed */
+        RenderQueue(const RenderQueue<dimensions, T>&) = delete;
+
+        /** @brief Move constructor */
+        RenderQueue(RenderQueue<dimensions, T>&&) noexcept;
+
+        ~RenderQueue();
+
+        /** @brief Copying is not allowed */
+        RenderQueue<dimensions, T>& operator=(const RenderQueue<dimensions, T>&) = delete;
+
+        /** @brief Move assignment */
+        RenderQueue<dimensions, T>& operator=(RenderQueue<dimensions, T>&&) noexcept;
+
+        /** @brief Count of drawables in the queue */
+        std::size_t size() const { return _keys.size(); }
+
+        /** @brief Whether the queue is empty */
+        bool isEmpty() const { return _keys.empty(); }
+
+        /**
+         * @brief Clear the queue
+         * @return Reference to self (for method chaining)
+         *
+         * Keeps the allocated memory for reuse.
+         */
+        RenderQueue<dimensions, T>& clear();
+
+        /**
+         * @brief Add a drawable to the queue
+         * @return Reference to self (for method chaining)
+         *
+         * The @p transformation is expected to be relative to the camera the
+         * queue is drawn with, same as what @ref Drawable::draw() gets.
+         */
+        RenderQueue<dimensions, T>& add(UnsignedLong key, const MatrixType& transformation, Drawable<dimensions, T>& drawable);
+
+        /**
+         * @brief Sort the queue
+         * @return Reference to self (for method chaining)
+         *
+         * Sorts the drawables by their key in an ascending order. The sort
+         * is stable, drawables with the same key keep the order in which
+         * they were added.
+         */
+        RenderQueue<dimensions, T>& sort();
+
+        /**
+         * @brief Sort keys
+         *
+         * In the order the drawables were added or, after @ref sort(), in a
+         * sorted order.
+         */
+        Containers::ArrayView<const UnsignedLong> keys() const {
+            return {_keys.data(), _keys.size()};
+        }
+
+        /**
+         * @brief Drawable transformations
+         *
+         * In the same order as @ref keys().
+         */
+        Containers::ArrayView<const MatrixType> transformations() const {
+            return {_transformations.data(), _transformations.size()};
+        }
+
+        /**
+         * @brief Drawables
+         *
+         * In the same order as @ref keys().
+         */
+        Containers::ArrayView<Drawable<dimensions, T>* const> drawables() const {
+            return {_drawables.data(), _drawables.size()};
+        }
+
+        /**
+         * @brief Draw the queue
+         *
+         * Calls @ref Drawable::draw() for all drawables in the current order.
+         * Call @ref sort() before to draw them sorted. The queue shouldn't be
+         * modified from inside the @ref Drawable::draw() calls.
+         */
+        void draw(Camera<dimensions, T>& camera);
+
+    private:
+        std::vector<UnsignedLong> _keys;
+        std::vector<MatrixType> _transformations;
+        std::vector<Drawable<dimensions, T>*> _drawables;
+
+        /* Reused by sort() */
+        std::vector<Implementation::RenderQueueEntry> _entries, _entriesScratch;
+        std::vector<MatrixType> _transformationsScratch;
+        std::vector<Drawable<dimensions, T>*> _drawablesScratch;
+};
+
+/**
+@brief Render queue for two-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp RenderQueue<2, T> @ce. See
+@ref RenderQueue for more information.
+@see @ref RenderQueue2D, @ref BasicRenderQueue3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicRenderQueue2D = RenderQueue<2, T>;
+#endif
+
+/**
+@brief Render queue for two-dimensional float scenes
+@m_since_latest
+
+@see @ref RenderQueue3D
+*/
+typedef BasicRenderQueue2D<Float> RenderQueue2D;
+
+/**
+@brief Render queue for three-dimensional scenes
+@m_since_latest
+
+Convenience alternative to @cpp RenderQueue<3, T> @ce. See
+@ref RenderQueue for more information.
+@see @ref RenderQueue3D, @ref BasicRenderQueue2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicRenderQueue3D = RenderQueue<3, T>;
+#endif
+
+/**
+@brief Render queue for three-dimensional float scenes
+@m_since_latest
+
+@see @ref RenderQueue2D
+*/
+typedef BasicRenderQueue3D<Float> RenderQueue3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT RenderQueue<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT RenderQueue<3, Float>;
+#endif
+
+}}
+
+#endif
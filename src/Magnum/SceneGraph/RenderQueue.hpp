@@ -0,0 +1,95 @@
+#ifndef Magnum_SceneGraph_RenderQueue_hpp
+#define Magnum_SceneGraph_RenderQueue_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref RenderQueue.h
+ * @m_since_latest
+ */
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> UnsignedShort RenderQueue<dimensions, T>::depthKey(const T depth, const T maxDepth) {
+    return UnsignedShort(Math::clamp(depth/maxDepth, T(0), T(1))*T(0xffff) + T(0.5));
+}
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>::RenderQueue() = default;
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>::RenderQueue(RenderQueue<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>::~RenderQueue() = default;
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>& RenderQueue<dimensions, T>::operator=(RenderQueue<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>& RenderQueue<dimensions, T>::clear() {
+    _keys.clear();
+    _transformations.clear();
+    _drawables.clear();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>& RenderQueue<dimensions, T>::add(const UnsignedLong key, const MatrixType& transformation, Drawable<dimensions, T>& drawable) {
+    _keys.push_back(key);
+    _transformations.push_back(transformation);
+    _drawables.push_back(&drawable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>& RenderQueue<dimensions, T>::sort() {
+    const std::size_t size = _keys.size();
+    _entries.resize(size);
+    for(std::size_t i = 0; i != size; ++i)
+        _entries[i] = {_keys[i], UnsignedInt(i)};
+
+    Implementation::renderQueueSort(_entries, _entriesScratch);
+
+    /* Reorder the data. The transformations and drawables are gathered into
+       the scratch storage, which then becomes the main one. */
+    _transformationsScratch.resize(size);
+    _drawablesScratch.resize(size);
+    for(std::size_t i = 0; i != size; ++i) {
+        const Implementation::RenderQueueEntry& entry = _entries[i];
+        _keys[i] = entry.key;
+        _transformationsScratch[i] = _transformations[entry.index];
+        _drawablesScratch[i] = _drawables[entry.index];
+    }
+    _transformations.swap(_transformationsScratch);
+    _drawables.swap(_drawablesScratch);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void RenderQueue<dimensions, T>::draw(Camera<dimensions, T>& camera) {
+    for(std::size_t i = 0; i != _drawables.size(); ++i)
+        _drawables[i]->draw(_transformations[i], camera);
+}
+
+}}
+
+#endif
@@ -52,7 +52,18 @@ template<class Transformation> class Scene: public Object<Transformation> {
         explicit Scene() = default;
 
     private:
+        friend Object<Transformation>;
+
         bool isScene() const override final { return true; }
+
+        /* Scratch memory for Object::transformations(), reused between calls
+           to avoid allocations. The function already modifies markers on the
+           objects, so it can't be called concurrently on the same scene
+           either way. */
+        mutable std::vector<std::reference_wrapper<Object<Transformation>>> _jointObjects;
+        mutable std::vector<UnsignedInt> _parentJoints;
+        mutable std::vector<UnsignedInt> _jointStack;
+        mutable std::vector<typename Transformation::DataType> _jointTransformations;
 };
 
 }}
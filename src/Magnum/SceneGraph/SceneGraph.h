@@ -94,6 +94,18 @@ template<class T> using BasicAnimableGroup3D = AnimableGroup<3, T>;
 typedef BasicAnimableGroup2D<Float> AnimableGroup2D;
 typedef BasicAnimableGroup3D<Float> AnimableGroup3D;
 
+template<UnsignedInt, class> class BoundingVolume;
+template<class T> using BasicBoundingVolume2D = BoundingVolume<2, T>;
+template<class T> using BasicBoundingVolume3D = BoundingVolume<3, T>;
+typedef BasicBoundingVolume2D<Float> BoundingVolume2D;
+typedef BasicBoundingVolume3D<Float> BoundingVolume3D;
+
+template<UnsignedInt, class> class BoundingVolumeHierarchy;
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+
 template<UnsignedInt, class> class Camera;
 template<class T> using BasicCamera2D = Camera<2, T>;
 template<class T> using BasicCamera3D = Camera<3, T>;
@@ -123,12 +135,42 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<UnsignedInt, class> class FlatHierarchy;
+template<class T> using BasicFlatHierarchy2D = FlatHierarchy<2, T>;
+template<class T> using BasicFlatHierarchy3D = FlatHierarchy<3, T>;
+typedef BasicFlatHierarchy2D<Float> FlatHierarchy2D;
+typedef BasicFlatHierarchy3D<Float> FlatHierarchy3D;
+
+template<UnsignedInt> struct InstanceData;
+typedef InstanceData<2> InstanceData2D;
+typedef InstanceData<3> InstanceData3D;
+struct InstanceBatch;
+
+template<UnsignedInt, class> class InstanceBatcher;
+template<class T> using BasicInstanceBatcher2D = InstanceBatcher<2, T>;
+template<class T> using BasicInstanceBatcher3D = InstanceBatcher<3, T>;
+typedef BasicInstanceBatcher2D<Float> InstanceBatcher2D;
+typedef BasicInstanceBatcher3D<Float> InstanceBatcher3D;
+
+template<UnsignedInt, class> class InstancedDrawable;
+template<class T> using BasicInstancedDrawable2D = InstancedDrawable<2, T>;
+template<class T> using BasicInstancedDrawable3D = InstancedDrawable<3, T>;
+typedef BasicInstancedDrawable2D<Float> InstancedDrawable2D;
+typedef BasicInstancedDrawable3D<Float> InstancedDrawable3D;
+
+template<UnsignedInt, class> class RenderQueue;
+template<class T> using BasicRenderQueue2D = RenderQueue<2, T>;
+template<class T> using BasicRenderQueue3D = RenderQueue<3, T>;
+typedef BasicRenderQueue2D<Float> RenderQueue2D;
+typedef BasicRenderQueue3D<Float> RenderQueue3D;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
 typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
 template<class Transformation> class Object;
+class ObjectPool;
 
 template<class> class BasicRigidMatrixTransformation2D;
 template<class> class BasicRigidMatrixTransformation3D;
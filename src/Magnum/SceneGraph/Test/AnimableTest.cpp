@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <memory>
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
@@ -47,6 +49,7 @@ struct AnimableTest: TestSuite::Tester {
     template<class T> void pause();
 
     void deleteWhileRunning();
+    void stepParallel();
 
     void debug();
 };
@@ -66,6 +69,7 @@ AnimableTest::AnimableTest() {
               &AnimableTest::pause<Double>,
 
               &AnimableTest::deleteWhileRunning,
+              &AnimableTest::stepParallel,
 
               &AnimableTest::debug});
 }
@@ -399,6 +403,62 @@ void AnimableTest::deleteWhileRunning() {
     CORRADE_COMPARE(group.runningCount(), 0);
 }
 
+void AnimableTest::stepParallel() {
+    class LoggingAnimable: public SceneGraph::Animable3D {
+        public:
+            explicit LoggingAnimable(Object3D<Float>& object, AnimableGroup3D& group, std::string& log, Int id): SceneGraph::Animable3D{object, &group}, time{-1.0f}, delta{0.0f}, _log(log), _id{id} {
+                /* Every third animation is stopped, the rest gets a varying
+                   duration so they stop at different times */
+                setDuration(0.5f*(id % 7));
+                if(id % 3) setState(AnimationState::Running);
+            }
+
+            Float time, delta;
+
+        protected:
+            void animationStep(Float t, Float d) override {
+                time = t;
+                delta = d;
+            }
+
+            void animationStarted() override {
+                _log += std::to_string(_id) + " started;";
+            }
+
+            void animationStopped() override {
+                _log += std::to_string(_id) + " stopped;";
+            }
+
+        private:
+            std::string& _log;
+            Int _id;
+    };
+
+    Object3D<Float> object;
+    AnimableGroup3D serialGroup, parallelGroup;
+    std::string serialLog, parallelLog;
+    std::vector<std::unique_ptr<LoggingAnimable>> serial, parallel;
+    for(Int i = 0; i != 50; ++i) {
+        serial.emplace_back(new LoggingAnimable{object, serialGroup, serialLog, i});
+        parallel.emplace_back(new LoggingAnimable{object, parallelGroup, parallelLog, i});
+    }
+
+    for(Float time: {1.0f, 1.5f, 2.25f, 3.0f, 4.0f}) {
+        serialGroup.step(time, 0.5f);
+        parallelGroup.step(time, 0.5f, 4);
+    }
+
+    CORRADE_COMPARE(parallelGroup.runningCount(), serialGroup.runningCount());
+    /* The state change callbacks should be called in the same order */
+    CORRADE_VERIFY(!parallelLog.empty());
+    CORRADE_COMPARE(parallelLog, serialLog);
+    for(std::size_t i = 0; i != serial.size(); ++i) {
+        CORRADE_COMPARE(parallel[i]->state(), serial[i]->state());
+        CORRADE_COMPARE(parallel[i]->time, serial[i]->time);
+        CORRADE_COMPARE(parallel[i]->delta, serial[i]->delta);
+    }
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running << AnimationState(0xbe);
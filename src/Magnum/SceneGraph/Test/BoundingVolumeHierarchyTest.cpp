@@ -0,0 +1,525 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct BoundingVolumeHierarchyTest: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyTest();
+
+    void construct();
+    void addRemove();
+    void addToOtherHierarchy();
+    void removeNotInHierarchy();
+    void destructVolume();
+    void destructHierarchy();
+
+    void absoluteBox();
+    void setBox();
+    void setMarginInvalid();
+
+    void update();
+    void updateChildren();
+
+    void intersectRange();
+    void intersectRange2D();
+    void intersectSphere();
+    void intersectRay();
+    void intersectRay2D();
+    void intersectFrustum();
+
+    void many();
+};
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addTests({&BoundingVolumeHierarchyTest::construct,
+              &BoundingVolumeHierarchyTest::addRemove,
+              &BoundingVolumeHierarchyTest::addToOtherHierarchy,
+              &BoundingVolumeHierarchyTest::removeNotInHierarchy,
+              &BoundingVolumeHierarchyTest::destructVolume,
+              &BoundingVolumeHierarchyTest::destructHierarchy,
+
+              &BoundingVolumeHierarchyTest::absoluteBox,
+              &BoundingVolumeHierarchyTest::setBox,
+              &BoundingVolumeHierarchyTest::setMarginInvalid,
+
+              &BoundingVolumeHierarchyTest::update,
+              &BoundingVolumeHierarchyTest::updateChildren,
+
+              &BoundingVolumeHierarchyTest::intersectRange,
+              &BoundingVolumeHierarchyTest::intersectRange2D,
+              &BoundingVolumeHierarchyTest::intersectSphere,
+              &BoundingVolumeHierarchyTest::intersectRay,
+              &BoundingVolumeHierarchyTest::intersectRay2D,
+              &BoundingVolumeHierarchyTest::intersectFrustum,
+
+              &BoundingVolumeHierarchyTest::many});
+}
+
+using namespace Math::Literals;
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+const Range3D UnitBox{Vector3{-1.0f}, Vector3{1.0f}};
+
+/* Returns objects of the volumes for easier comparison */
+template<UnsignedInt dimensions> std::vector<AbstractObject<dimensions, Float>*> objects(const std::vector<std::reference_wrapper<BoundingVolume<dimensions, Float>>>& volumes) {
+    std::vector<AbstractObject<dimensions, Float>*> out;
+    for(BoundingVolume<dimensions, Float>& volume: volumes)
+        out.push_back(&volume.object());
+    return out;
+}
+
+/* Sorts objects to have a predictable order */
+template<UnsignedInt dimensions> std::vector<AbstractObject<dimensions, Float>*> sortedObjects(const std::vector<std::reference_wrapper<BoundingVolume<dimensions, Float>>>& volumes) {
+    std::vector<AbstractObject<dimensions, Float>*> out = objects(volumes);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+void BoundingVolumeHierarchyTest::construct() {
+    BoundingVolumeHierarchy3D hierarchy;
+    CORRADE_VERIFY(hierarchy.isEmpty());
+    CORRADE_COMPARE(hierarchy.size(), 0);
+    CORRADE_COMPARE(hierarchy.height(), 0);
+    CORRADE_COMPARE(hierarchy.margin(), 0.1f);
+    CORRADE_VERIFY(hierarchy.intersectRange(UnitBox).empty());
+}
+
+void BoundingVolumeHierarchyTest::addRemove() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    BoundingVolumeHierarchy3D hierarchy;
+
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox};
+    CORRADE_COMPARE(volumeA.hierarchy(), &hierarchy);
+    CORRADE_VERIFY(!volumeB.hierarchy());
+    CORRADE_COMPARE(hierarchy.size(), 1);
+
+    hierarchy.add(volumeB);
+    CORRADE_COMPARE(volumeB.hierarchy(), &hierarchy);
+    CORRADE_COMPARE(hierarchy.size(), 2);
+    CORRADE_COMPARE(hierarchy.intersectRange(UnitBox).size(), 2);
+    CORRADE_COMPARE(hierarchy.height(), 2);
+
+    hierarchy.remove(volumeA);
+    CORRADE_VERIFY(!volumeA.hierarchy());
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE(hierarchy.height(), 1);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange(UnitBox)),
+        (std::vector<AbstractObject3D*>{&b}),
+        TestSuite::Compare::Container);
+
+    /* Removing before the volume got inserted into the tree */
+    hierarchy.add(volumeA)
+        .remove(volumeA);
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange(UnitBox)),
+        (std::vector<AbstractObject3D*>{&b}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::addToOtherHierarchy() {
+    Scene3D scene;
+    Object3D a{&scene};
+    BoundingVolumeHierarchy3D first, second;
+    BoundingVolume3D volume{a, UnitBox, &first};
+    CORRADE_COMPARE(first.intersectRange(UnitBox).size(), 1);
+
+    second.add(volume);
+    CORRADE_COMPARE(volume.hierarchy(), &second);
+    CORRADE_COMPARE(first.size(), 0);
+    CORRADE_COMPARE(second.size(), 1);
+    CORRADE_VERIFY(first.intersectRange(UnitBox).empty());
+    CORRADE_COMPARE(second.intersectRange(UnitBox).size(), 1);
+}
+
+void BoundingVolumeHierarchyTest::removeNotInHierarchy() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Scene3D scene;
+    Object3D a{&scene};
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volume{a, UnitBox};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.remove(volume);
+    CORRADE_COMPARE(out.str(), "SceneGraph::BoundingVolumeHierarchy::remove(): volume is not a part of this hierarchy\n");
+}
+
+void BoundingVolumeHierarchyTest::destructVolume() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+    Object3D a{&scene};
+    new BoundingVolume3D{a, UnitBox, &hierarchy};
+    CORRADE_COMPARE(hierarchy.intersectRange(UnitBox).size(), 1);
+
+    {
+        Object3D b{&scene};
+        new BoundingVolume3D{b, UnitBox, &hierarchy};
+        CORRADE_COMPARE(hierarchy.intersectRange(UnitBox).size(), 2);
+    }
+
+    /* Deleting the object deleted the volume and removed it */
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange(UnitBox)),
+        (std::vector<AbstractObject3D*>{&a}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::destructHierarchy() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    BoundingVolume3D* volumeA;
+    BoundingVolume3D* volumeB;
+    {
+        BoundingVolumeHierarchy3D hierarchy;
+        volumeA = new BoundingVolume3D{a, UnitBox, &hierarchy};
+        hierarchy.update();
+        /* This one is not inserted in the tree yet */
+        volumeB = new BoundingVolume3D{b, UnitBox, &hierarchy};
+    }
+
+    CORRADE_VERIFY(!volumeA->hierarchy());
+    CORRADE_VERIFY(!volumeB->hierarchy());
+}
+
+void BoundingVolumeHierarchyTest::absoluteBox() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    parent.scale({2.0f, 1.0f, 1.0f});
+    Object3D a{&parent};
+    a.rotateZ(90.0_degf)
+     .translate({0.0f, 3.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volume{a, {{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}}, &hierarchy};
+    CORRADE_COMPARE(volume.box(), (Range3D{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}}));
+    hierarchy.update();
+
+    /* Rotated so X becomes Y and Y becomes -X, then scaled in X */
+    CORRADE_COMPARE(volume.absoluteBox(), (Range3D{{-4.0f, 3.0f, 0.0f}, {0.0f, 4.0f, 3.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::setBox() {
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate({5.0f, 0.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volume{a, UnitBox, &hierarchy};
+    CORRADE_VERIFY(hierarchy.intersectRange(UnitBox).empty());
+
+    /* The object is clean at this point, the change should still be
+       picked up */
+    CORRADE_VERIFY(!a.isDirty());
+    volume.setBox({{-6.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}});
+    CORRADE_COMPARE(hierarchy.intersectRange(UnitBox).size(), 1);
+    CORRADE_COMPARE(volume.absoluteBox(), (Range3D{{-1.0f, -1.0f, -1.0f}, {6.0f, 1.0f, 1.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::setMarginInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    BoundingVolumeHierarchy3D hierarchy;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.setMargin(-0.5f);
+    CORRADE_COMPARE(out.str(), "SceneGraph::BoundingVolumeHierarchy::setMargin(): expected non-negative margin, got -0.5\n");
+}
+
+void BoundingVolumeHierarchyTest::update() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    b.translate({10.0f, 0.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+    hierarchy.update();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+
+    /* Small move inside the margin, the absolute box is still updated */
+    a.translate({0.1f, 0.0f, 0.0f});
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{1.05f, -1.0f, -1.0f}, {1.15f, 1.0f, 1.0f}})),
+        (std::vector<AbstractObject3D*>{&a}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_COMPARE(volumeA.absoluteBox(), (Range3D{{-0.9f, -1.0f, -1.0f}, {1.1f, 1.0f, 1.0f}}));
+
+    /* Large move, gets reinserted */
+    a.translate({20.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE_AS(sortedObjects(hierarchy.intersectRange({{-2.0f, -2.0f, -2.0f}, {2.0f, 2.0f, 2.0f}})),
+        (std::vector<AbstractObject3D*>{}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{19.0f, -2.0f, -2.0f}, {22.0f, 2.0f, 2.0f}})),
+        (std::vector<AbstractObject3D*>{&a}),
+        TestSuite::Compare::Container);
+
+    /* Object cleaned by something else before the update, the change should
+       still be picked up */
+    b.translate({0.0f, 20.0f, 0.0f});
+    b.setClean();
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{9.0f, 19.0f, -1.0f}, {11.0f, 21.0f, 1.0f}})),
+        (std::vector<AbstractObject3D*>{&b}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::updateChildren() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    Object3D a{&parent}, b{&parent};
+    a.translate({-2.0f, 0.0f, 0.0f});
+    b.translate({2.0f, 0.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+    CORRADE_COMPARE(hierarchy.intersectRange({{-10.0f, -10.0f, 90.0f}, {10.0f, 10.0f, 110.0f}}).size(), 0);
+
+    /* Moving the parent moves the children */
+    parent.translate({0.0f, 0.0f, 100.0f});
+    CORRADE_COMPARE(hierarchy.intersectRange({{-10.0f, -10.0f, 90.0f}, {10.0f, 10.0f, 110.0f}}).size(), 2);
+    CORRADE_COMPARE(volumeA.absoluteBox(), (Range3D{{-3.0f, -1.0f, 99.0f}, {-1.0f, 1.0f, 101.0f}}));
+    CORRADE_COMPARE(volumeB.absoluteBox(), (Range3D{{1.0f, -1.0f, 99.0f}, {3.0f, 1.0f, 101.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::intersectRange() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({-5.0f, 0.0f, 0.0f});
+    c.translate({5.0f, 0.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+    BoundingVolume3D volumeC{c, UnitBox, &hierarchy};
+
+    CORRADE_COMPARE_AS(sortedObjects(hierarchy.intersectRange({{-5.0f, -0.5f, -0.5f}, {0.0f, 0.5f, 0.5f}})),
+        sortedObjects<3>({volumeA, volumeB}),
+        TestSuite::Compare::Container);
+
+    /* Touching counts as intersecting */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{6.0f, 1.0f, 1.0f}, {7.0f, 2.0f, 2.0f}})),
+        (std::vector<AbstractObject3D*>{&c}),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(hierarchy.intersectRange({{2.0f, 2.0f, 2.0f}, {3.0f, 3.0f, 3.0f}}).empty());
+}
+
+void BoundingVolumeHierarchyTest::intersectRange2D() {
+    Scene2D scene;
+    Object2D a{&scene}, b{&scene};
+    a.translate({-5.0f, 0.0f});
+    b.rotate(45.0_degf);
+
+    BoundingVolumeHierarchy2D hierarchy;
+    BoundingVolume2D volumeA{a, {Vector2{-1.0f}, Vector2{1.0f}}, &hierarchy};
+    BoundingVolume2D volumeB{b, {Vector2{-1.0f}, Vector2{1.0f}}, &hierarchy};
+
+    /* The rotated box is enclosed in a larger one */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{1.2f, 1.2f}, {2.0f, 2.0f}})),
+        (std::vector<AbstractObject2D*>{&b}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRange({{-7.0f, -1.0f}, {-6.0f, 1.0f}})),
+        (std::vector<AbstractObject2D*>{&a}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::intersectSphere() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    a.translate({3.0f, 0.0f, 0.0f});
+    b.translate({3.0f, 3.0f, 0.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+
+    /* Reaches the closest face of A but not the closest corner of B, which
+       is at distance sqrt(8) */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectSphere({}, 2.5f)),
+        (std::vector<AbstractObject3D*>{&a}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(hierarchy.intersectSphere({}, 2.9f).size(), 2);
+    CORRADE_VERIFY(hierarchy.intersectSphere({}, 1.9f).empty());
+}
+
+void BoundingVolumeHierarchyTest::intersectRay() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene}, d{&scene};
+    a.translate({0.0f, 0.0f, -20.0f});
+    b.translate({0.0f, 0.0f, -10.0f});
+    c.translate({0.0f, 5.0f, -5.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    /* Added in a different order than the distance to verify sorting */
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeC{c, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+    BoundingVolume3D volumeD{d, UnitBox, &hierarchy};
+
+    /* D contains the origin, so it's first */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRay({}, {0.0f, 0.0f, -1.0f})),
+        (std::vector<AbstractObject3D*>{&d, &b, &a}),
+        TestSuite::Compare::Container);
+
+    /* Ray in the other direction from a point in front of all of them */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRay({0.0f, 0.0f, -30.0f}, {0.0f, 0.0f, 0.5f})),
+        (std::vector<AbstractObject3D*>{&a, &b, &d}),
+        TestSuite::Compare::Container);
+
+    /* Diagonal ray, going through C first and B then */
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRay({0.0f, 10.0f, 0.0f}, {0.0f, -1.0f, -1.0f})),
+        (std::vector<AbstractObject3D*>{&c, &b}),
+        TestSuite::Compare::Container);
+
+    /* Pointing away */
+    CORRADE_VERIFY(hierarchy.intersectRay({0.0f, 0.0f, 5.0f}, {0.0f, 1.0f, 0.0f}).empty());
+}
+
+void BoundingVolumeHierarchyTest::intersectRay2D() {
+    Scene2D scene;
+    Object2D a{&scene}, b{&scene};
+    a.translate({10.0f, 0.0f});
+    b.translate({5.0f, 0.5f});
+
+    BoundingVolumeHierarchy2D hierarchy;
+    BoundingVolume2D volumeA{a, {Vector2{-1.0f}, Vector2{1.0f}}, &hierarchy};
+    BoundingVolume2D volumeB{b, {Vector2{-1.0f}, Vector2{1.0f}}, &hierarchy};
+
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRay({}, {1.0f, 0.0f})),
+        (std::vector<AbstractObject2D*>{&b, &a}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectRay({0.0f, -0.75f}, {1.0f, 0.0f})),
+        (std::vector<AbstractObject2D*>{&a}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::intersectFrustum() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({0.0f, 0.0f, -5.0f});
+    b.translate({0.0f, 0.0f, 5.0f});
+    c.translate({10.0f, 0.0f, -5.0f});
+
+    BoundingVolumeHierarchy3D hierarchy;
+    BoundingVolume3D volumeA{a, UnitBox, &hierarchy};
+    BoundingVolume3D volumeB{b, UnitBox, &hierarchy};
+    BoundingVolume3D volumeC{c, UnitBox, &hierarchy};
+
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.1f, 100.0f));
+    CORRADE_COMPARE_AS(objects(hierarchy.intersectFrustum(frustum)),
+        (std::vector<AbstractObject3D*>{&a}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::many() {
+    Scene3D scene;
+    BoundingVolumeHierarchy3D hierarchy;
+
+    /* Deterministic pseudo-random positions */
+    UnsignedInt seed = 1;
+    auto random = [&seed]() {
+        seed = seed*1103515245u + 12345u;
+        return Float((seed >> 16) & 0x7fff)/Float(0x7fff);
+    };
+
+    std::vector<Object3D*> objectList;
+    std::vector<BoundingVolume3D*> volumes;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        Object3D* object = new Object3D{&scene};
+        object->translate({random()*100.0f, random()*100.0f, random()*100.0f});
+        objectList.push_back(object);
+        volumes.push_back(new BoundingVolume3D{*object, {Vector3{-0.5f}, Vector3{random() + 0.5f}}, &hierarchy});
+    }
+
+    /* Compares the query result with a brute-force search */
+    auto check = [&](const Range3D& range) {
+        std::vector<AbstractObject3D*> expected;
+        for(BoundingVolume3D* volume: volumes) {
+            const Range3D box = volume->absoluteBox();
+            if((box.max() >= range.min()).all() && (box.min() <= range.max()).all())
+                expected.push_back(&volume->object());
+        }
+        std::sort(expected.begin(), expected.end());
+        return expected;
+    };
+
+    const Range3D range{{20.0f, 30.0f, 40.0f}, {50.0f, 60.0f, 70.0f}};
+    std::vector<AbstractObject3D*> actual = sortedObjects(hierarchy.intersectRange(range));
+    CORRADE_COMPARE(hierarchy.size(), 1000);
+    CORRADE_VERIFY(!actual.empty());
+    CORRADE_COMPARE_AS(actual, check(range), TestSuite::Compare::Container);
+
+    /* The tree should be reasonably balanced, for 1000 leafs the ideal
+       height is 11 */
+    CORRADE_COMPARE_AS(hierarchy.height(), 20, TestSuite::Compare::LessOrEqual);
+
+    /* Move half of the objects a little and a quarter a lot, remove some */
+    for(std::size_t i = 0; i < 1000; i += 2)
+        objectList[i]->translate({random() - 0.5f, random() - 0.5f, random() - 0.5f});
+    for(std::size_t i = 1; i < 1000; i += 4)
+        objectList[i]->translate({random()*50.0f - 25.0f, random()*50.0f - 25.0f, random()*50.0f - 25.0f});
+    for(std::size_t i = 999; i > 900; i -= 3) {
+        delete objectList[i];
+        volumes.erase(volumes.begin() + i);
+    }
+
+    actual = sortedObjects(hierarchy.intersectRange(range));
+    CORRADE_COMPARE(hierarchy.size(), volumes.size());
+    CORRADE_VERIFY(!actual.empty());
+    CORRADE_COMPARE_AS(actual, check(range), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.height(), 20, TestSuite::Compare::LessOrEqual);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::BoundingVolumeHierarchyTest)
@@ -53,6 +53,11 @@ struct CameraTest: TestSuite::Tester {
 
     template<class T> void draw();
     template<class T> void drawOrdered();
+    template<class T> void drawableTransformationsInto();
+    template<class T> void drawRepeated();
+    template<class T> void drawNested();
+    template<class T> void drawCulled2D();
+    template<class T> void drawCulled3D();
 };
 
 CameraTest::CameraTest() {
@@ -77,11 +82,22 @@ CameraTest::CameraTest() {
         &CameraTest::draw<Float>,
         &CameraTest::draw<Double>,
         &CameraTest::drawOrdered<Float>,
-        &CameraTest::drawOrdered<Double>});
+        &CameraTest::drawOrdered<Double>,
+        &CameraTest::drawableTransformationsInto<Float>,
+        &CameraTest::drawableTransformationsInto<Double>,
+        &CameraTest::drawRepeated<Float>,
+        &CameraTest::drawRepeated<Double>,
+        &CameraTest::drawNested<Float>,
+        &CameraTest::drawNested<Double>,
+        &CameraTest::drawCulled2D<Float>,
+        &CameraTest::drawCulled2D<Double>,
+        &CameraTest::drawCulled3D<Float>,
+        &CameraTest::drawCulled3D<Double>});
 }
 
 template<class T> using Object2D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Object3D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<T>>;
+template<class T> using Scene2D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Scene3D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<T>>;
 
 template<class T> void CameraTest::fixAspectRatio() {
@@ -302,6 +318,281 @@ template<class T> void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void CameraTest::drawableTransformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            using SceneGraph::BasicDrawable3D<T>::BasicDrawable3D;
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {}
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+
+    Object3D<T> first{&scene};
+    first.scale(Math::Vector3<T>{T(5.0)});
+    new Drawable{first, &group};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::yAxis(T(3.0)));
+    new Drawable{second, &group};
+
+    Object3D<T> third{&second};
+    third.translate(Math::Vector3<T>::zAxis(T(-1.5)));
+    new Drawable{third, &group};
+
+    BasicCamera3D<T> camera{third};
+
+    Math::Matrix4<T> transformations[3];
+    camera.drawableTransformationsInto(group, transformations);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations), Containers::arrayView<Math::Matrix4<T>>({
+        Math::Matrix4<T>::translation({T(0.0), T(-3.0), T(1.5)})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(5.0))),
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(1.5))),
+        Math::Matrix4<T>{}
+    }), TestSuite::Compare::Container);
+
+    /* Reusing the storage after the camera moves gives updated results */
+    third.translate(Math::Vector3<T>::xAxis(T(2.0)));
+    camera.drawableTransformationsInto(group, transformations);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations), Containers::arrayView<Math::Matrix4<T>>({
+        Math::Matrix4<T>::translation({T(-2.0), T(-3.0), T(1.5)})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(5.0))),
+        Math::Matrix4<T>::translation({T(-2.0), T(0.0), T(1.5)}),
+        Math::Matrix4<T>{}
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawRepeated() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Math::Matrix4<T>> transformations;
+
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::xAxis(T(1.0)));
+    new Drawable{first, &group, transformations};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::yAxis(T(2.0)));
+    new Drawable{second, &group, transformations};
+
+    BasicCamera3D<T> camera{scene};
+    camera.draw(group);
+
+    /* Draw again with one drawable less and one moved, the reused internal
+       storage shouldn't leak anything from the previous frame */
+    delete &group[1];
+    first.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    camera.draw(group);
+
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))),
+        Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(2.0))),
+        Math::Matrix4<T>::translation({T(1.0), T(0.0), T(3.0)})
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawNested() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, BasicDrawableGroup3D<T>* nested, std::vector<Math::Matrix4<T>>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _nested{nested}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>& camera) override {
+                _result.push_back(transformationMatrix);
+                /* Drawing with the same camera from inside a draw shouldn't
+                   clobber the transformations of the outer draw */
+                if(_nested) camera.draw(*_nested);
+            }
+
+        private:
+            BasicDrawableGroup3D<T>* _nested;
+            std::vector<Math::Matrix4<T>>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    BasicDrawableGroup3D<T> nested;
+    Scene3D<T> scene;
+    std::vector<Math::Matrix4<T>> transformations;
+
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::xAxis(T(1.0)));
+    new Drawable{first, &group, &nested, transformations};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::yAxis(T(2.0)));
+    new Drawable{second, &group, nullptr, transformations};
+
+    Object3D<T> third{&scene};
+    third.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    new Drawable{third, &nested, nullptr, transformations};
+
+    BasicCamera3D<T> camera{scene};
+    camera.draw(group);
+
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))),
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))),
+        Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(2.0)))
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawCulled2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable2D<T> {
+        public:
+            Drawable(AbstractBasicObject2D<T>& object, BasicDrawableGroup2D<T>* group, Int id, std::vector<Int>& result): SceneGraph::BasicDrawable2D<T>{object, group}, _id{id}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix3<T>&, BasicCamera2D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            Int _id;
+            std::vector<Int>& _result;
+    };
+
+    BasicDrawableGroup2D<T> group;
+    Scene2D<T> scene;
+    std::vector<Int> drawn;
+    const Math::Range2D<T> box{Math::Vector2<T>{T(-0.5)}, Math::Vector2<T>{T(0.5)}};
+
+    /* Inside */
+    Object2D<T> first{&scene};
+    (new Drawable{first, &group, 0, drawn})->setBoundingBox(box);
+
+    /* Outside */
+    Object2D<T> second{&scene};
+    second.translate({T(5.0), T(0.0)});
+    (new Drawable{second, &group, 1, drawn})->setBoundingBox(box);
+
+    /* Outside if it wouldn't be rotated, the rotated box reaches inside */
+    Object2D<T> third{&scene};
+    third.rotate(Math::Deg<T>{T(45.0)})
+        .translate({T(1.6), T(0.0)});
+    (new Drawable{third, &group, 2, drawn})->setBoundingBox(box);
+
+    /* Outside but without a bounding box */
+    Object2D<T> fourth{&scene};
+    fourth.translate({T(0.0), T(-5.0)});
+    new Drawable{fourth, &group, 3, drawn};
+
+    BasicCamera2D<T> camera{scene};
+    camera.setProjectionMatrix(Math::Matrix3<T>::projection(Math::Vector2<T>{T(2.0)}));
+    CORRADE_VERIFY(!camera.isFrustumCullingEnabled());
+
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    drawn.clear();
+    camera.setFrustumCullingEnabled(true);
+    CORRADE_VERIFY(camera.isFrustumCullingEnabled());
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawCulled3D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, Int id, std::vector<Int>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _id{id}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            Int _id;
+            std::vector<Int>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+    const Math::Range3D<T> box{Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}};
+
+    /* In front of the camera */
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::zAxis(T(-5.0)));
+    Drawable* firstDrawable = new Drawable{first, &group, 0, drawn};
+    firstDrawable->setBoundingBox(box);
+
+    /* Behind the camera */
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::zAxis(T(5.0)));
+    Drawable* secondDrawable = new Drawable{second, &group, 1, drawn};
+    secondDrawable->setBoundingBox(box);
+
+    /* Too far to the right, but scaled so it reaches inside */
+    Object3D<T> third{&scene};
+    third.scale(Math::Vector3<T>{T(2.0)})
+        .translate({T(8.0), T(0.0), T(-5.0)});
+    (new Drawable{third, &group, 2, drawn})->setBoundingBox(box);
+
+    /* Too far to the right */
+    Object3D<T> fourth{&scene};
+    fourth.translate({T(8.0), T(0.0), T(-5.0)});
+    (new Drawable{fourth, &group, 3, drawn})->setBoundingBox(box);
+
+    /* Beyond the far plane */
+    Object3D<T> fifth{&scene};
+    fifth.translate(Math::Vector3<T>::zAxis(T(-150.0)));
+    (new Drawable{fifth, &group, 4, drawn})->setBoundingBox(box);
+
+    /* Behind the camera but without a bounding box */
+    Object3D<T> sixth{&scene};
+    sixth.translate(Math::Vector3<T>::zAxis(T(5.0)));
+    new Drawable{sixth, &group, 5, drawn};
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>{T(90.0)}, T(1.0), T(0.1), T(100.0)))
+        .setFrustumCullingEnabled(true);
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2, 5}),
+        TestSuite::Compare::Container);
+
+    /* Resetting the bounding box makes the drawable always drawn */
+    drawn.clear();
+    secondDrawable->resetBoundingBox();
+    CORRADE_VERIFY(!secondDrawable->hasBoundingBox());
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 5}),
+        TestSuite::Compare::Container);
+
+    /* Moving the camera back brings more into the view and pushes the last
+       one further beyond the far plane */
+    drawn.clear();
+    cameraObject.translate(Math::Vector3<T>::zAxis(T(20.0)));
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3, 5}),
+        TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
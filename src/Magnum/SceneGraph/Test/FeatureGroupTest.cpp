@@ -0,0 +1,238 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
+#include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FeatureGroupTest: TestSuite::Tester {
+    explicit FeatureGroupTest();
+
+    void add();
+    void addFromOtherGroup();
+    void remove();
+    void removeLast();
+    void removeNotInGroup();
+    void addRemoveMany();
+    void destructFeature();
+    void destructGroup();
+};
+
+FeatureGroupTest::FeatureGroupTest() {
+    addTests({&FeatureGroupTest::add,
+              &FeatureGroupTest::addFromOtherGroup,
+              &FeatureGroupTest::remove,
+              &FeatureGroupTest::removeLast,
+              &FeatureGroupTest::removeNotInGroup,
+              &FeatureGroupTest::addRemoveMany,
+              &FeatureGroupTest::destructFeature,
+              &FeatureGroupTest::destructGroup});
+}
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct Feature: AbstractGroupedFeature3D<Feature> {
+    explicit Feature(Object3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+};
+
+typedef FeatureGroup3D<Feature> Group;
+
+void FeatureGroupTest::add() {
+    Scene3D scene;
+    Group group;
+    CORRADE_VERIFY(group.isEmpty());
+
+    Feature a{scene, &group};
+    Feature b{scene};
+    CORRADE_COMPARE(a.group(), &group);
+    CORRADE_COMPARE(b.group(), nullptr);
+
+    group.add(b);
+    CORRADE_VERIFY(!group.isEmpty());
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &b);
+    CORRADE_COMPARE(b.group(), &group);
+}
+
+void FeatureGroupTest::addFromOtherGroup() {
+    Scene3D scene;
+    Group group1, group2;
+
+    Feature a{scene, &group1};
+    Feature b{scene, &group1};
+    Feature c{scene, &group1};
+
+    group2.add(a);
+    CORRADE_COMPARE(a.group(), &group2);
+    CORRADE_COMPARE(group2.size(), 1);
+    CORRADE_COMPARE(group1.size(), 2);
+    CORRADE_COMPARE(&group1[0], &c);
+    CORRADE_COMPARE(&group1[1], &b);
+}
+
+void FeatureGroupTest::remove() {
+    Scene3D scene;
+    Group group;
+
+    Feature a{scene, &group};
+    Feature b{scene, &group};
+    Feature c{scene, &group};
+    Feature d{scene, &group};
+
+    /* The last one is moved into the place of the removed one */
+    group.remove(b);
+    CORRADE_COMPARE(b.group(), nullptr);
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &d);
+    CORRADE_COMPARE(&group[2], &c);
+
+    /* The moved feature has its position updated, so it can be removed
+       again */
+    group.remove(d);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &c);
+
+    group.remove(a)
+         .remove(c);
+    CORRADE_VERIFY(group.isEmpty());
+
+    /* Adding back works */
+    group.add(b);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &b);
+}
+
+void FeatureGroupTest::removeLast() {
+    Scene3D scene;
+    Group group;
+
+    Feature a{scene, &group};
+    Feature b{scene, &group};
+
+    group.remove(b);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &a);
+}
+
+void FeatureGroupTest::removeNotInGroup() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Scene3D scene;
+    Group group1, group2;
+    Feature a{scene, &group1};
+    Feature b{scene};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    group2.remove(a);
+    group2.remove(b);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group\n"
+        "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group\n");
+    CORRADE_COMPARE(a.group(), &group1);
+}
+
+void FeatureGroupTest::addRemoveMany() {
+    Scene3D scene;
+    Group group1, group2;
+
+    Feature a{scene};
+    Feature b{scene, &group2};
+    Feature c{scene};
+    Feature d{scene};
+
+    const Containers::Reference<Feature> features[]{a, b, c};
+    group1.add(features)
+          .add({d});
+    CORRADE_VERIFY(group2.isEmpty());
+    CORRADE_COMPARE(group1.size(), 4);
+    CORRADE_COMPARE(&group1[0], &a);
+    CORRADE_COMPARE(&group1[1], &b);
+    CORRADE_COMPARE(&group1[2], &c);
+    CORRADE_COMPARE(&group1[3], &d);
+    CORRADE_COMPARE(b.group(), &group1);
+
+    group1.remove({a, c});
+    CORRADE_COMPARE(a.group(), nullptr);
+    CORRADE_COMPARE(c.group(), nullptr);
+    CORRADE_COMPARE(group1.size(), 2);
+    CORRADE_COMPARE(&group1[0], &d);
+    CORRADE_COMPARE(&group1[1], &b);
+}
+
+void FeatureGroupTest::destructFeature() {
+    Scene3D scene;
+    Group group;
+
+    Feature a{scene, &group};
+    Feature c{scene, &group};
+    {
+        Feature b{scene};
+        group.add(b);
+        /* Move a to the end so b is not the last one */
+        group.remove(a).add(a);
+        CORRADE_COMPARE(&group[0], &b);
+        CORRADE_COMPARE(&group[2], &a);
+    }
+
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &c);
+
+    /* Positions are still consistent */
+    group.remove(c);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &a);
+}
+
+void FeatureGroupTest::destructGroup() {
+    Scene3D scene;
+    Feature a{scene};
+    {
+        Group group;
+        group.add(a);
+    }
+
+    CORRADE_COMPARE(a.group(), nullptr);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupTest)
@@ -0,0 +1,437 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatHierarchyTest: TestSuite::Tester {
+    explicit FlatHierarchyTest();
+
+    void constructEmpty();
+    void constructMove();
+
+    void addObject();
+    void addObjectInvalidParent();
+
+    void update();
+    void updateDirty();
+    void updateNothingDirty();
+    void update2D();
+
+    void constructParents();
+    void constructParentsInvalid();
+    void constructObjectData();
+    void constructObjectDataInvalid();
+
+    void indexOutOfRange();
+
+    void transformationsInto();
+    void transformationsIntoInvalid();
+};
+
+FlatHierarchyTest::FlatHierarchyTest() {
+    addTests({&FlatHierarchyTest::constructEmpty,
+              &FlatHierarchyTest::constructMove,
+
+              &FlatHierarchyTest::addObject,
+              &FlatHierarchyTest::addObjectInvalidParent,
+
+              &FlatHierarchyTest::update,
+              &FlatHierarchyTest::updateDirty,
+              &FlatHierarchyTest::updateNothingDirty,
+              &FlatHierarchyTest::update2D,
+
+              &FlatHierarchyTest::constructParents,
+              &FlatHierarchyTest::constructParentsInvalid,
+              &FlatHierarchyTest::constructObjectData,
+              &FlatHierarchyTest::constructObjectDataInvalid,
+
+              &FlatHierarchyTest::indexOutOfRange,
+
+              &FlatHierarchyTest::transformationsInto,
+              &FlatHierarchyTest::transformationsIntoInvalid});
+}
+
+using namespace Math::Literals;
+
+void FlatHierarchyTest::constructEmpty() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_VERIFY(hierarchy.isEmpty());
+    CORRADE_COMPARE(hierarchy.size(), 0);
+    CORRADE_COMPARE(hierarchy.parents().size(), 0);
+    CORRADE_COMPARE(hierarchy.transformations().size(), 0);
+    CORRADE_COMPARE(hierarchy.worldTransformations().size(), 0);
+
+    /* Shouldn't crash on an empty hierarchy */
+    hierarchy.updateWorldTransformations();
+}
+
+void FlatHierarchyTest::constructMove() {
+    FlatHierarchy3D a;
+    a.addObject(-1, Matrix4::translation(Vector3::xAxis()));
+    a.addObject(0, Matrix4::translation(Vector3::yAxis()));
+
+    FlatHierarchy3D b{std::move(a)};
+    CORRADE_COMPARE(b.size(), 2);
+    b.updateWorldTransformations();
+    CORRADE_COMPARE(b.worldTransformation(1), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    FlatHierarchy3D c;
+    c.addObject(-1);
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_COMPARE(c.worldTransformation(1), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<FlatHierarchy3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<FlatHierarchy3D>::value);
+}
+
+void FlatHierarchyTest::addObject() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_COMPARE(hierarchy.addObject(-1), 0);
+    CORRADE_COMPARE(hierarchy.addObject(0, Matrix4::scaling(Vector3{2.0f})), 1);
+    CORRADE_COMPARE(hierarchy.addObject(-1), 2);
+    CORRADE_COMPARE(hierarchy.addObject(1), 3);
+
+    CORRADE_VERIFY(!hierarchy.isEmpty());
+    CORRADE_COMPARE(hierarchy.size(), 4);
+    CORRADE_COMPARE_AS(hierarchy.parents(), (Containers::arrayView<Int>({
+        -1, 0, -1, 1
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.objectIds(), (Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.indices(), (Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hierarchy.transformation(1), Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(hierarchy.transformation(3), Matrix4{});
+
+    /* All newly added objects are dirty */
+    CORRADE_VERIFY(hierarchy.isDirty(0));
+    CORRADE_VERIFY(hierarchy.isDirty(1));
+    CORRADE_VERIFY(hierarchy.isDirty(2));
+    CORRADE_VERIFY(hierarchy.isDirty(3));
+}
+
+void FlatHierarchyTest::addObjectInvalidParent() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.addObject(1);
+    hierarchy.addObject(-2);
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy::addObject(): parent index 1 out of range for 1 objects\n"
+        "SceneGraph::FlatHierarchy::addObject(): parent index -2 out of range for 1 objects\n");
+}
+
+void FlatHierarchyTest::update() {
+    FlatHierarchy3D hierarchy;
+    /* More than 32 objects to test more than one item of the dirty bitfield */
+    for(std::size_t i = 0; i != 40; ++i)
+        hierarchy.addObject(Int(i) - 1, Matrix4::translation(Vector3::xAxis()));
+    hierarchy.addObject(-1, Matrix4::scaling(Vector3{3.0f}));
+    hierarchy.addObject(40, Matrix4::translation(Vector3::yAxis()));
+
+    hierarchy.updateWorldTransformations();
+    for(std::size_t i = 0; i != 40; ++i) {
+        CORRADE_COMPARE(hierarchy.worldTransformation(i), Matrix4::translation(Vector3::xAxis()*Float(i + 1)));
+        CORRADE_VERIFY(!hierarchy.isDirty(i));
+    }
+    CORRADE_COMPARE(hierarchy.worldTransformation(40), Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(41), Matrix4::scaling(Vector3{3.0f})*Matrix4::translation(Vector3::yAxis()));
+    CORRADE_COMPARE(hierarchy.worldTransformations().size(), 42);
+    CORRADE_COMPARE(hierarchy.worldTransformations()[41], hierarchy.worldTransformation(41));
+}
+
+void FlatHierarchyTest::updateDirty() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1, Matrix4::translation(Vector3::xAxis()));     /* 0 */
+    hierarchy.addObject(0, Matrix4::translation(Vector3::yAxis()));      /* 1 */
+    hierarchy.addObject(0, Matrix4::translation(Vector3::zAxis()));      /* 2 */
+    hierarchy.addObject(1, Matrix4::translation(Vector3::xAxis()));      /* 3 */
+    hierarchy.addObject(-1, Matrix4::translation(Vector3::yAxis()));     /* 4 */
+    hierarchy.updateWorldTransformations();
+
+    hierarchy.setTransformation(1, Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_VERIFY(!hierarchy.isDirty(0));
+    CORRADE_VERIFY(hierarchy.isDirty(1));
+    CORRADE_VERIFY(!hierarchy.isDirty(2));
+    /* Children of a dirty object are not reported as dirty */
+    CORRADE_VERIFY(!hierarchy.isDirty(3));
+    CORRADE_VERIFY(!hierarchy.isDirty(4));
+
+    /* World transformations are not updated until explicitly asked to */
+    CORRADE_COMPARE(hierarchy.worldTransformation(1), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(3), Matrix4::translation({2.0f, 1.0f, 0.0f}));
+
+    hierarchy.updateWorldTransformations();
+    CORRADE_VERIFY(!hierarchy.isDirty(1));
+    CORRADE_COMPARE(hierarchy.worldTransformation(0), Matrix4::translation({1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(1), Matrix4::translation({1.0f, 0.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(2), Matrix4::translation({1.0f, 0.0f, 1.0f}));
+    /* Descendant of the dirty object got updated as well */
+    CORRADE_COMPARE(hierarchy.worldTransformation(3), Matrix4::translation({3.0f, 0.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(4), Matrix4::translation({0.0f, 1.0f, 0.0f}));
+
+    /* Changing a root propagates to everything below */
+    hierarchy.setTransformation(0, Matrix4{});
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(1), Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(2), Matrix4::translation({0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(hierarchy.worldTransformation(3), Matrix4::translation({2.0f, 0.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+}
+
+void FlatHierarchyTest::updateNothingDirty() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1, Matrix4::translation(Vector3::xAxis()));
+    hierarchy.addObject(0, Matrix4::translation(Vector3::yAxis()));
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(1), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    /* Calling it again does nothing */
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(1), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+}
+
+void FlatHierarchyTest::update2D() {
+    FlatHierarchy2D hierarchy;
+    hierarchy.addObject(-1, Matrix3::rotation(90.0_degf));
+    hierarchy.addObject(0, Matrix3::translation(Vector2::xAxis()));
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(1).translation(), Vector2::yAxis());
+}
+
+void FlatHierarchyTest::constructParents() {
+    /* 4 -> 2 -> 0, 3 -> 1, 5 is a root as well */
+    const Int parents[]{2, 3, 4, -1, -1, -1};
+    const Matrix4 transformations[]{
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::xAxis(2.0f)),
+        Matrix4::translation(Vector3::xAxis(4.0f)),
+        Matrix4::translation(Vector3::xAxis(8.0f)),
+        Matrix4::translation(Vector3::xAxis(16.0f)),
+        Matrix4::translation(Vector3::xAxis(32.0f))
+    };
+
+    FlatHierarchy3D hierarchy{parents, transformations};
+    CORRADE_COMPARE(hierarchy.size(), 6);
+
+    /* Roots first in their original order, then their children breadth
+       first */
+    CORRADE_COMPARE_AS(hierarchy.objectIds(), (Containers::arrayView<UnsignedInt>({
+        3, 4, 5, 1, 2, 0
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.indices(), (Containers::arrayView<UnsignedInt>({
+        5, 3, 4, 0, 1, 2
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.parents(), (Containers::arrayView<Int>({
+        -1, -1, -1, 0, 1, 4
+    })), TestSuite::Compare::Container);
+
+    /* Parents are always before children */
+    for(std::size_t i = 0; i != hierarchy.size(); ++i) {
+        CORRADE_VERIFY(hierarchy.parents()[i] < Int(i));
+    }
+
+    for(std::size_t i = 0; i != hierarchy.size(); ++i) {
+        CORRADE_VERIFY(hierarchy.isDirty(i));
+        CORRADE_COMPARE(hierarchy.transformation(hierarchy.indices()[i]), transformations[i]);
+    }
+
+    hierarchy.updateWorldTransformations();
+    const Float expected[]{21.0f, 10.0f, 20.0f, 8.0f, 16.0f, 32.0f};
+    for(std::size_t i = 0; i != hierarchy.size(); ++i) {
+        CORRADE_COMPARE(hierarchy.worldTransformation(hierarchy.indices()[i]), Matrix4::translation(Vector3::xAxis(expected[i])));
+    }
+
+    /* Adding an object after gives it an ID equal to its index */
+    CORRADE_COMPARE(hierarchy.addObject(hierarchy.indices()[0]), 6);
+    CORRADE_COMPARE(hierarchy.objectIds()[6], 6);
+    CORRADE_COMPARE(hierarchy.indices()[6], 6);
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(6), Matrix4::translation(Vector3::xAxis(21.0f)));
+}
+
+void FlatHierarchyTest::constructParentsInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Int parents[]{-1, 0, 3};
+    const Int parentsNegative[]{-1, -2, 0};
+    const Int parentsCycle[]{-1, 2, 3, 1};
+    const Matrix4 transformations[4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    FlatHierarchy3D{parents, Containers::arrayView(transformations).prefix(2)};
+    FlatHierarchy3D{parents, Containers::arrayView(transformations).prefix(3)};
+    FlatHierarchy3D{parentsNegative, Containers::arrayView(transformations).prefix(3)};
+    FlatHierarchy3D{parentsCycle, transformations};
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy: expected 3 transformations but got 2\n"
+        "SceneGraph::FlatHierarchy: parent 3 of object 2 out of range for 3 objects\n"
+        "SceneGraph::FlatHierarchy: parent -2 of object 1 out of range for 3 objects\n"
+        "SceneGraph::FlatHierarchy: only 1 out of 4 objects are reachable from a root, the hierarchy has a cycle\n");
+}
+
+/* Mimics the interface of Trade::ObjectData3D, to avoid a dependency on the
+   Trade library */
+struct ObjectData {
+    explicit ObjectData(std::vector<UnsignedInt> children, const Matrix4& transformation): _children{std::move(children)}, _transformation{transformation} {}
+
+    const std::vector<UnsignedInt>& children() const { return _children; }
+    Matrix4 transformation() const { return _transformation; }
+
+    std::vector<UnsignedInt> _children;
+    Matrix4 _transformation;
+};
+
+void FlatHierarchyTest::constructObjectData() {
+    /* 2 -> 0 -> 1, 3 failed to import, 4 is a root */
+    Containers::Array<Containers::Pointer<ObjectData>> objects{5};
+    objects[0].reset(new ObjectData{{1}, Matrix4::translation(Vector3::yAxis(1.0f))});
+    objects[1].reset(new ObjectData{{}, Matrix4::translation(Vector3::yAxis(2.0f))});
+    objects[2].reset(new ObjectData{{0}, Matrix4::translation(Vector3::yAxis(4.0f))});
+    objects[4].reset(new ObjectData{{}, Matrix4::translation(Vector3::yAxis(8.0f))});
+
+    FlatHierarchy3D hierarchy{objects};
+    CORRADE_COMPARE(hierarchy.size(), 5);
+    CORRADE_COMPARE_AS(hierarchy.objectIds(), (Containers::arrayView<UnsignedInt>({
+        2, 3, 4, 0, 1
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(hierarchy.parents(), (Containers::arrayView<Int>({
+        -1, -1, -1, 0, 3
+    })), TestSuite::Compare::Container);
+
+    hierarchy.updateWorldTransformations();
+    CORRADE_COMPARE(hierarchy.worldTransformation(hierarchy.indices()[1]), Matrix4::translation(Vector3::yAxis(7.0f)));
+    CORRADE_COMPARE(hierarchy.worldTransformation(hierarchy.indices()[3]), Matrix4{});
+    CORRADE_COMPARE(hierarchy.worldTransformation(hierarchy.indices()[4]), Matrix4::translation(Vector3::yAxis(8.0f)));
+}
+
+void FlatHierarchyTest::constructObjectDataInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<Containers::Pointer<ObjectData>> outOfRange{2};
+    outOfRange[0].reset(new ObjectData{{1, 2}, Matrix4{}});
+    Containers::Array<Containers::Pointer<ObjectData>> twoParents{3};
+    twoParents[0].reset(new ObjectData{{2}, Matrix4{}});
+    twoParents[1].reset(new ObjectData{{2}, Matrix4{}});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    FlatHierarchy3D{outOfRange};
+    FlatHierarchy3D{twoParents};
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy: child 2 of object 0 out of range for 2 objects\n"
+        "SceneGraph::FlatHierarchy: object 2 is a child of both object 0 and 1\n");
+}
+
+void FlatHierarchyTest::indexOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1);
+    hierarchy.addObject(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.transformation(2);
+    hierarchy.setTransformation(2, {});
+    hierarchy.isDirty(2);
+    hierarchy.worldTransformation(2);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy::transformation(): index 2 out of range for 2 objects\n"
+        "SceneGraph::FlatHierarchy::setTransformation(): index 2 out of range for 2 objects\n"
+        "SceneGraph::FlatHierarchy::isDirty(): index 2 out of range for 2 objects\n"
+        "SceneGraph::FlatHierarchy::worldTransformation(): index 2 out of range for 2 objects\n");
+}
+
+void FlatHierarchyTest::transformationsInto() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1, Matrix4::translation(Vector3::xAxis()));
+    hierarchy.addObject(0, Matrix4::translation(Vector3::yAxis()));
+    hierarchy.addObject(-1, Matrix4::translation(Vector3::zAxis()));
+    hierarchy.updateWorldTransformations();
+
+    const Matrix4 camera = Matrix4::translation(Vector3::zAxis(-5.0f));
+    const UnsignedInt indices[]{2, 1, 2};
+    Matrix4 out[3];
+    hierarchy.transformationsInto(camera, indices, out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), (Containers::arrayView<Matrix4>({
+        Matrix4::translation({0.0f, 0.0f, -4.0f}),
+        Matrix4::translation({1.0f, 1.0f, -5.0f}),
+        Matrix4::translation({0.0f, 0.0f, -4.0f})
+    })), TestSuite::Compare::Container);
+}
+
+void FlatHierarchyTest::transformationsIntoInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addObject(-1);
+    hierarchy.addObject(0);
+
+    const UnsignedInt indices[]{1, 2};
+    Matrix4 out[3];
+
+    std::ostringstream o;
+    Error redirectError{&o};
+    hierarchy.transformationsInto({}, indices, out);
+    hierarchy.transformationsInto({}, indices, Containers::arrayView(out).prefix(2));
+    CORRADE_COMPARE(o.str(),
+        "SceneGraph::FlatHierarchy::transformationsInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::FlatHierarchy::transformationsInto(): index 2 out of range for 2 objects\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatHierarchyTest)
@@ -0,0 +1,345 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/InstanceBatcher.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation2D.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
+#include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct InstanceBatcherTest: TestSuite::Tester {
+    explicit InstanceBatcherTest();
+
+    void instanceDataLayout();
+
+    void construct();
+    void constructMove();
+
+    template<class T> void add2D();
+    template<class T> void add3D();
+
+    void sort();
+    void sortEmpty();
+    void sortTwice();
+    void addAfterSort();
+    void clear();
+    void instanceDataOutOfRange();
+
+    void drawable2D();
+    void drawable3D();
+    void drawableCulled();
+};
+
+InstanceBatcherTest::InstanceBatcherTest() {
+    addTests({&InstanceBatcherTest::instanceDataLayout,
+
+              &InstanceBatcherTest::construct,
+              &InstanceBatcherTest::constructMove,
+
+              &InstanceBatcherTest::add2D<Float>,
+              &InstanceBatcherTest::add2D<Double>,
+              &InstanceBatcherTest::add3D<Float>,
+              &InstanceBatcherTest::add3D<Double>,
+
+              &InstanceBatcherTest::sort,
+              &InstanceBatcherTest::sortEmpty,
+              &InstanceBatcherTest::sortTwice,
+              &InstanceBatcherTest::addAfterSort,
+              &InstanceBatcherTest::clear,
+              &InstanceBatcherTest::instanceDataOutOfRange,
+
+              &InstanceBatcherTest::drawable2D,
+              &InstanceBatcherTest::drawable3D,
+              &InstanceBatcherTest::drawableCulled});
+}
+
+using namespace Math::Literals;
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+void InstanceBatcherTest::instanceDataLayout() {
+    /* Has to be tightly packed to be usable for instanced shader attributes
+       without specifying gaps */
+    CORRADE_COMPARE(sizeof(InstanceData2D), sizeof(Matrix3) + sizeof(Color4));
+    CORRADE_COMPARE(sizeof(InstanceData3D), sizeof(Matrix4) + sizeof(Matrix3x3) + sizeof(Color4));
+}
+
+void InstanceBatcherTest::construct() {
+    InstanceBatcher3D batcher;
+    CORRADE_VERIFY(batcher.isEmpty());
+    CORRADE_COMPARE(batcher.instanceCount(), 0);
+    CORRADE_VERIFY(batcher.batches().empty());
+    CORRADE_VERIFY(batcher.instanceData().empty());
+}
+
+void InstanceBatcherTest::constructMove() {
+    InstanceBatcher3D a;
+    a.add(3, 5, Matrix4::translation(Vector3::xAxis()))
+     .sort();
+
+    InstanceBatcher3D b{std::move(a)};
+    CORRADE_COMPARE(b.instanceCount(), 1);
+    CORRADE_COMPARE(b.batches().size(), 1);
+
+    InstanceBatcher3D c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.instanceCount(), 1);
+    CORRADE_COMPARE(c.instanceData()[0].transformationMatrix, Matrix4::translation(Vector3::xAxis()));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<InstanceBatcher3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<InstanceBatcher3D>::value);
+}
+
+template<class T> void InstanceBatcherTest::add2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    InstanceBatcher<2, T> batcher;
+    batcher.add(0, 0, Math::Matrix3<T>::translation({T(1.0), T(2.0)}), 0xff3366cc_rgbaf)
+           .add(0, 0, Math::Matrix3<T>::scaling({T(2.0), T(3.0)}));
+    CORRADE_COMPARE(batcher.instanceCount(), 2);
+    CORRADE_COMPARE(batcher.instanceData()[0].transformationMatrix, Matrix3::translation({1.0f, 2.0f}));
+    CORRADE_COMPARE(batcher.instanceData()[0].color, 0xff3366cc_rgbaf);
+    CORRADE_COMPARE(batcher.instanceData()[1].transformationMatrix, Matrix3::scaling({2.0f, 3.0f}));
+    /* White by default */
+    CORRADE_COMPARE(batcher.instanceData()[1].color, 0xffffffff_rgbaf);
+}
+
+template<class T> void InstanceBatcherTest::add3D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const Math::Matrix4<T> transformation = Math::Matrix4<T>::translation({T(1.0), T(2.0), T(3.0)})*Math::Matrix4<T>::rotationX(Math::Deg<T>(T(90.0)))*Math::Matrix4<T>::scaling({T(2.0), T(4.0), T(8.0)});
+
+    InstanceBatcher<3, T> batcher;
+    batcher.add(0, 0, transformation, 0xff3366cc_rgbaf);
+    CORRADE_COMPARE(batcher.instanceCount(), 1);
+    CORRADE_COMPARE(batcher.instanceData()[0].transformationMatrix, Matrix4{transformation});
+    CORRADE_COMPARE(batcher.instanceData()[0].normalMatrix, Matrix4{transformation}.normalMatrix());
+    CORRADE_COMPARE(batcher.instanceData()[0].color, 0xff3366cc_rgbaf);
+}
+
+void InstanceBatcherTest::sort() {
+    InstanceBatcher2D batcher;
+    /* Shader 1 mesh 0, shader 0 mesh 2, shader 1 mesh 0, shader 0 mesh 1,
+       shader 0 mesh 2. The translation encodes the order in which they were
+       added. */
+    batcher.add(1, 0, Matrix3::translation(Vector2::xAxis(0.0f)))
+           .add(0, 2, Matrix3::translation(Vector2::xAxis(1.0f)))
+           .add(1, 0, Matrix3::translation(Vector2::xAxis(2.0f)))
+           .add(0, 1, Matrix3::translation(Vector2::xAxis(3.0f)))
+           .add(0, 2, Matrix3::translation(Vector2::xAxis(4.0f)))
+           .sort();
+
+    Containers::ArrayView<const InstanceBatch> batches = batcher.batches();
+    CORRADE_COMPARE(batches.size(), 3);
+    CORRADE_COMPARE(batches[0].shader, 0);
+    CORRADE_COMPARE(batches[0].mesh, 1);
+    CORRADE_COMPARE(batches[0].offset, 0);
+    CORRADE_COMPARE(batches[0].count, 1);
+    CORRADE_COMPARE(batches[1].shader, 0);
+    CORRADE_COMPARE(batches[1].mesh, 2);
+    CORRADE_COMPARE(batches[1].offset, 1);
+    CORRADE_COMPARE(batches[1].count, 2);
+    CORRADE_COMPARE(batches[2].shader, 1);
+    CORRADE_COMPARE(batches[2].mesh, 0);
+    CORRADE_COMPARE(batches[2].offset, 3);
+    CORRADE_COMPARE(batches[2].count, 2);
+
+    /* Instances in a batch keep the order in which they were added */
+    Containers::ArrayView<const InstanceData2D> data = batcher.instanceData();
+    CORRADE_COMPARE(data.size(), 5);
+    CORRADE_COMPARE(data[0].transformationMatrix.translation().x(), 3.0f);
+    CORRADE_COMPARE(data[1].transformationMatrix.translation().x(), 1.0f);
+    CORRADE_COMPARE(data[2].transformationMatrix.translation().x(), 4.0f);
+    CORRADE_COMPARE(data[3].transformationMatrix.translation().x(), 0.0f);
+    CORRADE_COMPARE(data[4].transformationMatrix.translation().x(), 2.0f);
+
+    Containers::ArrayView<const InstanceData2D> batch1 = batcher.instanceData(1);
+    CORRADE_COMPARE(batch1.size(), 2);
+    CORRADE_COMPARE(batch1.data(), data.data() + 1);
+}
+
+void InstanceBatcherTest::sortEmpty() {
+    InstanceBatcher3D batcher;
+    batcher.sort();
+    CORRADE_VERIFY(batcher.batches().empty());
+}
+
+void InstanceBatcherTest::sortTwice() {
+    InstanceBatcher2D batcher;
+    batcher.add(0xffffffffu, 7, Matrix3::translation(Vector2::xAxis(0.0f)))
+           .add(0, 0xffffffffu, Matrix3::translation(Vector2::xAxis(1.0f)))
+           .sort()
+           .sort();
+
+    /* Full 32-bit IDs survive, sorting again doesn't change anything */
+    CORRADE_COMPARE(batcher.batches().size(), 2);
+    CORRADE_COMPARE(batcher.batches()[0].shader, 0);
+    CORRADE_COMPARE(batcher.batches()[0].mesh, 0xffffffffu);
+    CORRADE_COMPARE(batcher.batches()[1].shader, 0xffffffffu);
+    CORRADE_COMPARE(batcher.batches()[1].mesh, 7);
+    CORRADE_COMPARE(batcher.instanceData()[0].transformationMatrix.translation().x(), 1.0f);
+    CORRADE_COMPARE(batcher.instanceData()[1].transformationMatrix.translation().x(), 0.0f);
+}
+
+void InstanceBatcherTest::addAfterSort() {
+    InstanceBatcher2D batcher;
+    batcher.add(0, 0, {})
+           .sort();
+    CORRADE_COMPARE(batcher.batches().size(), 1);
+
+    /* Batches are invalidated */
+    batcher.add(0, 1, {});
+    CORRADE_VERIFY(batcher.batches().empty());
+
+    batcher.sort();
+    CORRADE_COMPARE(batcher.batches().size(), 2);
+}
+
+void InstanceBatcherTest::clear() {
+    InstanceBatcher2D batcher;
+    batcher.add(0, 0, {})
+           .sort()
+           .clear();
+    CORRADE_VERIFY(batcher.isEmpty());
+    CORRADE_VERIFY(batcher.batches().empty());
+    CORRADE_VERIFY(batcher.instanceData().empty());
+}
+
+void InstanceBatcherTest::instanceDataOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    InstanceBatcher2D batcher;
+    batcher.add(0, 0, {})
+           .add(0, 1, {})
+           .sort();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batcher.instanceData(2);
+    CORRADE_COMPARE(out.str(), "SceneGraph::InstanceBatcher::instanceData(): index 2 out of range for 2 batches\n");
+}
+
+void InstanceBatcherTest::drawable2D() {
+    Scene2D scene;
+    DrawableGroup2D drawables;
+    InstanceBatcher2D batcher;
+
+    Object2D a{&scene}, b{&scene};
+    a.translate({1.0f, 0.0f});
+    b.translate({0.0f, 1.0f});
+    InstancedDrawable2D da{a, batcher, 0, 3, 0xff0000_rgbf, &drawables};
+    InstancedDrawable2D db{b, batcher, 0, 3, 0x00ff00_rgbf, &drawables};
+    CORRADE_COMPARE(&da.batcher(), &batcher);
+    CORRADE_COMPARE(da.shader(), 0);
+    CORRADE_COMPARE(da.mesh(), 3);
+    CORRADE_COMPARE(da.color(), 0xff0000_rgbf);
+
+    Object2D cameraObject{&scene};
+    cameraObject.translate({-1.0f, 0.0f});
+    Camera2D camera{cameraObject};
+    camera.draw(drawables);
+    batcher.sort();
+
+    /* One batch, transformations relative to the camera */
+    CORRADE_COMPARE(batcher.batches().size(), 1);
+    CORRADE_COMPARE(batcher.batches()[0].count, 2);
+    CORRADE_COMPARE(batcher.instanceData()[0].transformationMatrix, Matrix3::translation({2.0f, 0.0f}));
+    CORRADE_COMPARE(batcher.instanceData()[0].color, 0xff0000_rgbf);
+    CORRADE_COMPARE(batcher.instanceData()[1].transformationMatrix, Matrix3::translation({1.0f, 1.0f}));
+    CORRADE_COMPARE(batcher.instanceData()[1].color, 0x00ff00_rgbf);
+}
+
+void InstanceBatcherTest::drawable3D() {
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    InstanceBatcher3D batcher;
+
+    /* Interleaved meshes, ending up in two batches */
+    for(std::size_t i = 0; i != 4; ++i) {
+        Object3D* object = new Object3D{&scene};
+        object->translate(Vector3::xAxis(Float(i)));
+        new InstancedDrawable3D{*object, batcher, 0, UnsignedInt(i % 2), Color4{1.0f}, &drawables};
+    }
+    static_cast<InstancedDrawable3D&>(drawables[3]).setColor(0x3366ff_rgbf);
+
+    Camera3D camera{scene};
+    camera.draw(drawables);
+    batcher.sort();
+
+    CORRADE_COMPARE(batcher.batches().size(), 2);
+    CORRADE_COMPARE(batcher.batches()[0].mesh, 0);
+    CORRADE_COMPARE(batcher.batches()[0].count, 2);
+    CORRADE_COMPARE(batcher.batches()[1].mesh, 1);
+    CORRADE_COMPARE(batcher.batches()[1].count, 2);
+    CORRADE_COMPARE(batcher.instanceData(0)[1].transformationMatrix, Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(batcher.instanceData(1)[1].transformationMatrix, Matrix4::translation(Vector3::xAxis(3.0f)));
+    CORRADE_COMPARE(batcher.instanceData(1)[1].normalMatrix, Matrix3x3{Math::IdentityInit});
+    CORRADE_COMPARE(batcher.instanceData(1)[1].color, 0x3366ff_rgbf);
+
+    /* Drawing again without clearing appends */
+    camera.draw(drawables);
+    CORRADE_COMPARE(batcher.instanceCount(), 8);
+    batcher.clear();
+    camera.draw(drawables);
+    CORRADE_COMPARE(batcher.instanceCount(), 4);
+}
+
+void InstanceBatcherTest::drawableCulled() {
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    InstanceBatcher3D batcher;
+
+    Object3D a{&scene}, b{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    b.translate(Vector3::zAxis(5.0f));
+    InstancedDrawable3D da{a, batcher, 0, 0, Color4{1.0f}, &drawables};
+    InstancedDrawable3D db{b, batcher, 0, 0, Color4{1.0f}, &drawables};
+    da.setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+    db.setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* Only the visible instance gets added */
+    Camera3D camera{scene};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg{90.0f}, 1.0f, 0.1f, 100.0f))
+        .setFrustumCullingEnabled(true)
+        .draw(drawables);
+    CORRADE_COMPARE(batcher.instanceCount(), 1);
+    CORRADE_COMPARE(batcher.instanceData()[0].transformationMatrix, Matrix4::translation(Vector3::zAxis(-5.0f)));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InstanceBatcherTest)
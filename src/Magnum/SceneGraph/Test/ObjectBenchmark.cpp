@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
+#include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void transformations();
+    void transformationsLeaves();
+    void setClean();
+    void setCleanThreaded();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+const struct {
+    const char* name;
+    std::size_t objectCount;
+} BenchmarkData[]{
+    {"10k objects", 10000},
+    {"100k objects", 100000},
+    {"1M objects", 1000000}
+};
+
+ObjectBenchmark::ObjectBenchmark() {
+    addInstancedBenchmarks({&ObjectBenchmark::transformations,
+                            &ObjectBenchmark::transformationsLeaves,
+                            &ObjectBenchmark::setClean,
+                            &ObjectBenchmark::setCleanThreaded}, 5,
+        Containers::arraySize(BenchmarkData));
+}
+
+/* A balanced tree with eight children per object, which makes all
+   non-leaf objects joints */
+std::vector<std::reference_wrapper<Object3D>> populate(Scene3D& scene, std::size_t count) {
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    objects.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        Object3D& parent = i ? objects[(i - 1)/8].get() : scene;
+        Object3D* object = new Object3D{&parent};
+        object->translate(Vector3::xAxis(Float(i%8)))
+            .rotateY(Deg(Float(i%360)));
+        objects.push_back(*object);
+    }
+    return objects;
+}
+
+void ObjectBenchmark::transformations() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populate(scene, data.objectCount);
+
+    std::vector<Matrix4> transformations;
+    CORRADE_BENCHMARK(1)
+        transformations = scene.transformations(objects);
+
+    CORRADE_COMPARE(transformations.size(), data.objectCount);
+    CORRADE_COMPARE(transformations[0], objects[0].get().absoluteTransformation());
+    CORRADE_COMPARE(transformations.back(), objects.back().get().absoluteTransformation());
+}
+
+void ObjectBenchmark::transformationsLeaves() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populate(scene, data.objectCount);
+
+    /* Only the leaves, which is the usual case for drawables. The inner
+       objects become joints during the traversal. */
+    std::vector<std::reference_wrapper<Object3D>> leaves;
+    for(Object3D& object: objects)
+        if(object.children().isEmpty()) leaves.push_back(object);
+
+    std::vector<Matrix4> transformations;
+    CORRADE_BENCHMARK(1)
+        transformations = scene.transformations(leaves);
+
+    CORRADE_COMPARE(transformations.size(), leaves.size());
+    CORRADE_COMPARE(transformations.back(), leaves.back().get().absoluteTransformation());
+}
+
+/* A feature caching the absolute transformation, which is what makes the
+   clean pass non-trivial */
+struct CachingFeature: AbstractFeature3D {
+    explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+        setCachedTransformations(CachedTransformation::Absolute);
+    }
+
+    void clean(const Matrix4& absoluteTransformation) override {
+        position = absoluteTransformation.translation();
+    }
+
+    Vector3 position;
+};
+
+/* A wide and shallow hierarchy, a root with everything else as its direct
+   children */
+std::vector<std::reference_wrapper<Object3D>> populateWide(Scene3D& scene, std::size_t count) {
+    Object3D* root = new Object3D{&scene};
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    objects.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        Object3D* object = new Object3D{root};
+        object->translate(Vector3::xAxis(Float(i%8)))
+            .rotateY(Deg(Float(i%360)));
+        new CachingFeature{*object};
+        objects.push_back(*object);
+    }
+    return objects;
+}
+
+void ObjectBenchmark::setClean() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populateWide(scene, data.objectCount);
+
+    CORRADE_BENCHMARK(1) {
+        objects[0].get().parent()->setDirty();
+        Object3D::setClean(objects);
+    }
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+void ObjectBenchmark::setCleanThreaded() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populateWide(scene, data.objectCount);
+
+    CORRADE_BENCHMARK(1) {
+        objects[0].get().parent()->setDirty();
+        Object3D::setClean(objects, 0);
+    }
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
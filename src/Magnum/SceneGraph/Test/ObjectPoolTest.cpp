@@ -0,0 +1,394 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
+#include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/ObjectPool.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct ObjectPoolTest: TestSuite::Tester {
+    explicit ObjectPoolTest();
+
+    void construct();
+    void constructInvalidSlabSize();
+
+    void allocate();
+    void allocateReuse();
+    void allocateNewSlab();
+    void allocateLarge();
+    void allocateZeroSize();
+
+    void objects();
+    void objectsAdjacent();
+    void objectsMixedWithHeap();
+    void objectFeatureMultipleInheritance();
+    void objectsMultiplePools();
+    void objectsExternalStorage();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void objectsMultipleThreads();
+    #endif
+};
+
+ObjectPoolTest::ObjectPoolTest() {
+    addTests({&ObjectPoolTest::construct,
+              &ObjectPoolTest::constructInvalidSlabSize,
+
+              &ObjectPoolTest::allocate,
+              &ObjectPoolTest::allocateReuse,
+              &ObjectPoolTest::allocateNewSlab,
+              &ObjectPoolTest::allocateLarge,
+              &ObjectPoolTest::allocateZeroSize,
+
+              &ObjectPoolTest::objects,
+              &ObjectPoolTest::objectsAdjacent,
+              &ObjectPoolTest::objectsMixedWithHeap,
+              &ObjectPoolTest::objectFeatureMultipleInheritance,
+              &ObjectPoolTest::objectsMultiplePools,
+              &ObjectPoolTest::objectsExternalStorage,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &ObjectPoolTest::objectsMultipleThreads
+              #endif
+              });
+}
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct Feature: AbstractFeature3D {
+    explicit Feature(AbstractObject3D& object, Int& destructed): AbstractFeature3D{object}, destructed(destructed) {}
+    ~Feature() { ++destructed; }
+
+    Int& destructed;
+};
+
+struct ObjectFeature: Object3D, AbstractFeature3D {
+    explicit ObjectFeature(Object3D* parent): Object3D{parent}, AbstractFeature3D{static_cast<Object3D&>(*this)} {}
+};
+
+void ObjectPoolTest::construct() {
+    ObjectPool pool{1024};
+    CORRADE_COMPARE(pool.slabSize(), 1024);
+    CORRADE_COMPARE(pool.slabCount(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+
+    CORRADE_VERIFY(!std::is_copy_constructible<ObjectPool>{});
+    CORRADE_VERIFY(!std::is_move_constructible<ObjectPool>{});
+}
+
+void ObjectPoolTest::constructInvalidSlabSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ObjectPool pool{8};
+    CORRADE_COMPARE(out.str(), "SceneGraph::ObjectPool: expected slab size to be at least 16 bytes but got 8\n");
+}
+
+void ObjectPoolTest::allocate() {
+    ObjectPool pool{1024};
+
+    char* a = static_cast<char*>(pool.allocate(24));
+    char* b = static_cast<char*>(pool.allocate(1));
+    char* c = static_cast<char*>(pool.allocate(16));
+    CORRADE_COMPARE(pool.slabCount(), 1);
+    CORRADE_COMPARE(pool.allocationCount(), 3);
+
+    /* Bump-allocated one after another, rounded to 16 bytes */
+    CORRADE_COMPARE(b - a, 32);
+    CORRADE_COMPARE(c - b, 16);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % 16, 0);
+
+    pool.deallocate(a, 24);
+    pool.deallocate(b, 1);
+    pool.deallocate(c, 16);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectPoolTest::allocateReuse() {
+    ObjectPool pool{1024};
+
+    void* a = pool.allocate(32);
+    void* b = pool.allocate(32);
+    void* c = pool.allocate(48);
+    pool.deallocate(a, 32);
+    pool.deallocate(b, 32);
+
+    /* A different size class doesn't reuse the freed memory */
+    void* d = pool.allocate(48);
+    CORRADE_VERIFY(d != a);
+    CORRADE_VERIFY(d != b);
+
+    /* The same size class does, in LIFO order. Sizes that round up to the
+       same class are treated the same. */
+    CORRADE_COMPARE(pool.allocate(32), b);
+    CORRADE_COMPARE(pool.allocate(17), a);
+    CORRADE_COMPARE(pool.allocationCount(), 4);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+
+    pool.deallocate(a, 32);
+    pool.deallocate(b, 32);
+    pool.deallocate(c, 48);
+    pool.deallocate(d, 48);
+}
+
+void ObjectPoolTest::allocateNewSlab() {
+    ObjectPool pool{64};
+
+    void* a = pool.allocate(48);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+
+    /* Doesn't fit into the remaining 16 bytes */
+    void* b = pool.allocate(32);
+    CORRADE_COMPARE(pool.slabCount(), 2);
+
+    /* Fits into the remainder of the second slab */
+    void* c = pool.allocate(32);
+    CORRADE_COMPARE(pool.slabCount(), 2);
+    CORRADE_COMPARE(static_cast<char*>(c) - static_cast<char*>(b), 32);
+
+    pool.deallocate(a, 48);
+    pool.deallocate(b, 32);
+    pool.deallocate(c, 32);
+}
+
+void ObjectPoolTest::allocateLarge() {
+    ObjectPool pool{64};
+
+    void* a = pool.allocate(16);
+    void* b = pool.allocate(100);
+    CORRADE_COMPARE(pool.slabCount(), 2);
+
+    /* The current slab is still used for small allocations after */
+    void* c = pool.allocate(16);
+    CORRADE_COMPARE(pool.slabCount(), 2);
+    CORRADE_COMPARE(static_cast<char*>(c) - static_cast<char*>(a), 16);
+
+    /* Freed large allocations are reused as well */
+    pool.deallocate(b, 100);
+    CORRADE_COMPARE(pool.allocate(112), b);
+    CORRADE_COMPARE(pool.slabCount(), 2);
+
+    pool.deallocate(a, 16);
+    pool.deallocate(b, 112);
+    pool.deallocate(c, 16);
+}
+
+void ObjectPoolTest::allocateZeroSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ObjectPool pool;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.allocate(0);
+    pool.deallocate(nullptr, 16);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::ObjectPool::allocate(): expected non-zero size\n"
+        "SceneGraph::ObjectPool::deallocate(): expected non-null memory and non-zero size\n");
+}
+
+void ObjectPoolTest::objects() {
+    ObjectPool pool;
+    Scene3D scene;
+    Int destructed = 0;
+
+    Object3D* a = new(pool) Object3D{&scene};
+    Object3D* b = new(pool) Object3D{a};
+    new(pool) Object3D{b};
+    new(pool) Feature{*a, destructed};
+    new(pool) Feature{*b, destructed};
+    CORRADE_COMPARE(pool.allocationCount(), 5);
+    CORRADE_COMPARE(a->children().first(), b);
+
+    /* Deleting a subtree returns everything to the pool */
+    delete a;
+    CORRADE_COMPARE(destructed, 2);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    CORRADE_VERIFY(scene.children().isEmpty());
+
+    /* The memory gets reused, no new slabs */
+    const std::size_t slabCount = pool.slabCount();
+    Object3D* c = new(pool) Object3D{&scene};
+    new(pool) Object3D{c};
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+    CORRADE_COMPARE(pool.slabCount(), slabCount);
+
+    /* The rest gets deleted together with the scene */
+}
+
+void ObjectPoolTest::objectsAdjacent() {
+    ObjectPool pool;
+    Scene3D scene;
+    Int destructed = 0;
+
+    Object3D* parent = new(pool) Object3D{&scene};
+    Feature* feature = new(pool) Feature{*parent, destructed};
+    Object3D* child = new(pool) Object3D{parent};
+
+    /* Each allocation is rounded to 16 bytes, with no header */
+    const std::ptrdiff_t objectSize = (sizeof(Object3D) + 15)/16*16;
+    const std::ptrdiff_t featureSize = (sizeof(Feature) + 15)/16*16;
+    CORRADE_COMPARE(reinterpret_cast<char*>(feature) - reinterpret_cast<char*>(parent), objectSize);
+    CORRADE_COMPARE(reinterpret_cast<char*>(child) - reinterpret_cast<char*>(feature), featureSize);
+}
+
+void ObjectPoolTest::objectsMixedWithHeap() {
+    ObjectPool pool;
+    Scene3D scene;
+    Int destructed = 0;
+
+    /* Heap parent with pool children and the other way around */
+    Object3D* a = new Object3D{&scene};
+    new(pool) Object3D{a};
+    new(pool) Feature{*a, destructed};
+    Object3D* b = new(pool) Object3D{&scene};
+    new Object3D{b};
+    new Feature{*b, destructed};
+    CORRADE_COMPARE(pool.allocationCount(), 3);
+
+    delete a;
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+    delete b;
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    CORRADE_COMPARE(destructed, 2);
+}
+
+void ObjectPoolTest::objectFeatureMultipleInheritance() {
+    ObjectPool pool;
+    Scene3D scene;
+
+    /* The operators are not ambiguous even though they're inherited twice */
+    ObjectFeature* a = new(pool) ObjectFeature{&scene};
+    ObjectFeature* b = new ObjectFeature{a};
+    new(pool) ObjectFeature{b};
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+
+    delete a;
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectPoolTest::objectsMultiplePools() {
+    /* Small slabs so each pool has more than one */
+    ObjectPool a{256};
+    Scene3D scene;
+    Int destructed = 0;
+
+    Object3D* objectA = new(a) Object3D{&scene};
+    for(std::size_t i = 0; i != 10; ++i) new(a) Object3D{objectA};
+
+    Object3D* objectB;
+    {
+        ObjectPool b{256};
+        objectB = new(b) Object3D{&scene};
+        for(std::size_t i = 0; i != 10; ++i) new(b) Feature{*objectB, destructed};
+        CORRADE_COMPARE(a.allocationCount(), 11);
+        CORRADE_COMPARE(b.allocationCount(), 11);
+
+        /* Each deletion goes back to the pool it came from */
+        delete objectA;
+        CORRADE_COMPARE(a.allocationCount(), 0);
+        CORRADE_COMPARE(b.allocationCount(), 11);
+
+        delete objectB;
+        CORRADE_COMPARE(b.allocationCount(), 0);
+        CORRADE_COMPARE(destructed, 10);
+    }
+
+    /* The other pool is gone, a heap allocation is correctly freed */
+    delete new Object3D{&scene};
+    CORRADE_COMPARE(a.allocationCount(), 0);
+}
+
+void ObjectPoolTest::objectsExternalStorage() {
+    Scene3D scene;
+    Int destructed = 0;
+
+    /* The class-specific allocation operators shouldn't hide the global
+       placement new */
+    alignas(Object3D) char objectStorage[sizeof(Object3D)];
+    alignas(Feature) char featureStorage[sizeof(Feature)];
+    Object3D* object = new(objectStorage) Object3D{&scene};
+    Feature* feature = new(featureStorage) Feature{*object, destructed};
+    CORRADE_COMPARE(static_cast<void*>(object), objectStorage);
+    CORRADE_COMPARE(static_cast<void*>(feature), featureStorage);
+    CORRADE_COMPARE(scene.children().first(), object);
+    CORRADE_COMPARE(object->features().first(), static_cast<AbstractFeature3D*>(feature));
+
+    /* Destructing in reverse order without deallocating, the feature removes
+       itself from the object and the object from the scene */
+    feature->~Feature();
+    CORRADE_COMPARE(destructed, 1);
+    CORRADE_VERIFY(object->features().isEmpty());
+    object->~Object3D();
+    CORRADE_VERIFY(scene.children().isEmpty());
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ObjectPoolTest::objectsMultipleThreads() {
+    /* Pools get created and destroyed on one thread while unrelated heap
+       objects get deleted on another, which looks up the pools. Meant to be
+       run through ThreadSanitizer to verify there are no races. */
+    std::size_t poolAllocations = 0;
+    std::thread t{[&poolAllocations]() {
+        for(std::size_t i = 0; i != 100; ++i) {
+            ObjectPool pool{256};
+            Scene3D scene;
+            for(std::size_t j = 0; j != 10; ++j) new(pool) Object3D{&scene};
+            poolAllocations += pool.allocationCount();
+        }
+    }};
+
+    Int destructed = 0;
+    for(std::size_t i = 0; i != 100; ++i) {
+        Scene3D scene;
+        Object3D* object = new Object3D{&scene};
+        for(std::size_t j = 0; j != 10; ++j) new Feature{*object, destructed};
+        delete object;
+    }
+
+    t.join();
+    CORRADE_COMPARE(poolAllocations, 1000);
+    CORRADE_COMPARE(destructed, 1000);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectPoolTest)
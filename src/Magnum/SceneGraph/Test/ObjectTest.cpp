@@ -23,9 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <sstream>
 #include <Corrade/Containers/Pointer.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
@@ -51,9 +53,14 @@ struct ObjectTest: TestSuite::Tester {
     template<class T> void transformationsRelative();
     template<class T> void transformationsOrphan();
     template<class T> void transformationsDuplicate();
+    template<class T> void transformationsLarge();
+    template<class T> void transformationsDeep();
+    template<class T> void transformationsInto();
+    template<class T> void transformationsIntoInvalidSize();
     template<class T> void setClean();
     template<class T> void setCleanListHierarchy();
     template<class T> void setCleanListBulk();
+    template<class T> void setCleanListParallel();
 
     template<class T> void rangeBasedForChildren();
     template<class T> void rangeBasedForFeatures();
@@ -86,12 +93,22 @@ ObjectTest::ObjectTest() {
         &ObjectTest::transformationsOrphan<Double>,
         &ObjectTest::transformationsDuplicate<Float>,
         &ObjectTest::transformationsDuplicate<Double>,
+        &ObjectTest::transformationsLarge<Float>,
+        &ObjectTest::transformationsLarge<Double>,
+        &ObjectTest::transformationsDeep<Float>,
+        &ObjectTest::transformationsDeep<Double>,
+        &ObjectTest::transformationsInto<Float>,
+        &ObjectTest::transformationsInto<Double>,
+        &ObjectTest::transformationsIntoInvalidSize<Float>,
+        &ObjectTest::transformationsIntoInvalidSize<Double>,
         &ObjectTest::setClean<Float>,
         &ObjectTest::setClean<Double>,
         &ObjectTest::setCleanListHierarchy<Float>,
         &ObjectTest::setCleanListHierarchy<Double>,
         &ObjectTest::setCleanListBulk<Float>,
         &ObjectTest::setCleanListBulk<Double>,
+        &ObjectTest::setCleanListParallel<Float>,
+        &ObjectTest::setCleanListParallel<Double>,
 
         &ObjectTest::rangeBasedForChildren<Float>,
         &ObjectTest::rangeBasedForChildren<Double>,
@@ -393,6 +410,121 @@ template<class T> void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+template<class T> void ObjectTest::transformationsLarge() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* More than 65535 objects, which used to be the limit. Each has a
+       sibling so all parents become joints. */
+    Scene3D<T> s;
+    std::vector<std::reference_wrapper<Object3D<T>>> objects;
+    for(std::size_t i = 0; i != 35000; ++i) {
+        Object3D<T>* parent = new Object3D<T>{&s};
+        parent->translate(Math::Vector3<T>::xAxis(T(i)));
+        Object3D<T>* a = new Object3D<T>{parent};
+        a->translate(Math::Vector3<T>::yAxis(T(1.0)));
+        Object3D<T>* b = new Object3D<T>{parent};
+        b->translate(Math::Vector3<T>::zAxis(T(1.0)));
+        objects.push_back(*a);
+        objects.push_back(*b);
+    }
+
+    std::vector<Math::Matrix4<T>> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 70000);
+    CORRADE_COMPARE(transformations[0], Math::Matrix4<T>::translation({T(0.0), T(1.0), T(0.0)}));
+    CORRADE_COMPARE(transformations[69999], Math::Matrix4<T>::translation({T(34999.0), T(0.0), T(1.0)}));
+
+    /* Calling it again with reused internal state gives the same result */
+    CORRADE_COMPARE(s.transformations(objects), transformations);
+}
+
+template<class T> void ObjectTest::transformationsDeep() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* A long chain with every object being a joint, the joint
+       transformations used to be concatenated recursively. Not too long as
+       setParent() and object destruction is linear in the depth. */
+    Scene3D<T> s;
+    std::vector<std::reference_wrapper<Object3D<T>>> objects;
+    Object3D<T>* parent = &s;
+    for(std::size_t i = 0; i != 5000; ++i) {
+        parent = new Object3D<T>{parent};
+        parent->translate(Math::Vector3<T>::xAxis(T(1.0)));
+        objects.push_back(*parent);
+    }
+
+    /* Reverse order, so the deepest object is processed first */
+    std::reverse(objects.begin(), objects.end());
+
+    std::vector<Math::Matrix4<T>> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 5000);
+    CORRADE_COMPARE(transformations[0], Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(5000.0))));
+    CORRADE_COMPARE(transformations[2500], Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(2500.0))));
+    CORRADE_COMPARE(transformations[4999], Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))));
+
+    /* Cleaning the deepest object goes through the whole chain, which is
+       more than what fits into the on-stack array in setClean() */
+    CORRADE_VERIFY(objects[2500].get().isDirty());
+    objects[0].get().setClean();
+    CORRADE_VERIFY(!objects[0].get().isDirty());
+    CORRADE_VERIFY(!objects[2500].get().isDirty());
+    CORRADE_VERIFY(!objects[4999].get().isDirty());
+}
+
+template<class T> void ObjectTest::transformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{T(30.0)});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+    Object3D<T> third(&first);
+    third.translate(Math::Vector3<T>::xAxis(T(5.0)));
+
+    Math::Matrix4<T> initial = Math::Matrix4<T>::rotationX(Math::Deg<T>{90.0}).inverted();
+    const std::reference_wrapper<Object3D<T>> objects[]{second, third, second};
+    const std::vector<Math::Matrix4<T>> expected = s.transformations({second, third, second}, initial);
+
+    Math::Matrix4<T> transformations[3];
+    s.transformationsInto(objects, transformations, initial);
+    CORRADE_COMPARE_AS((std::vector<Math::Matrix4<T>>{transformations, transformations + 3}),
+        expected,
+        TestSuite::Compare::Container);
+
+    /* Type-erased variant, the transformation is a matrix already so it
+       should give the same result */
+    const std::reference_wrapper<AbstractBasicObject3D<T>> abstractObjects[]{second, third, second};
+    Math::Matrix4<T> transformationMatrices[3];
+    static_cast<AbstractBasicObject3D<T>&>(s).transformationMatricesInto(abstractObjects, transformationMatrices, initial);
+    CORRADE_COMPARE_AS((std::vector<Math::Matrix4<T>>{transformationMatrices, transformationMatrices + 3}),
+        expected,
+        TestSuite::Compare::Container);
+}
+
+template<class T> void ObjectTest::transformationsIntoInvalidSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    const std::reference_wrapper<Object3D<T>> objects[]{first, first};
+    const std::reference_wrapper<AbstractBasicObject3D<T>> abstractObjects[]{first, first};
+    Math::Matrix4<T> transformations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformationsInto(objects, transformations);
+    s.transformationMatricesInto(objects, transformations);
+    static_cast<AbstractBasicObject3D<T>&>(s).transformationMatricesInto(abstractObjects, transformations);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::transformationsInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 transformations but got 3\n");
+}
+
 template<class T> void ObjectTest::setClean() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -579,6 +711,73 @@ template<class T> void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0))));
 }
 
+template<class T> void ObjectTest::setCleanListParallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Verify it doesn't crash when passed empty list */
+    Object3D<T>::setClean({}, 4);
+
+    /* Remembers whether the parent was already clean at the time the feature
+       got cleaned */
+    class OrderedCachingObject: public CachingObject<T> {
+        public:
+            explicit OrderedCachingObject(Object3D<T>* parent): CachingObject<T>{parent} {}
+
+            bool parentClean = false;
+
+        private:
+            void clean(const Math::Matrix4<T>& absoluteTransformation) override {
+                CachingObject<T>::clean(absoluteTransformation);
+                parentClean = !this->parent()->isDirty();
+            }
+    };
+
+    /* A wide level that gets split across threads, with some of the children
+       having further children */
+    Scene3D<T> scene;
+    Object3D<T> clean{&scene};
+    clean.translate(Math::Vector3<T>::xAxis(T(2.0)));
+    clean.setClean();
+    Object3D<T> a{&clean};
+    a.rotateZ(Math::Deg<T>(T(90.0)));
+    std::vector<OrderedCachingObject*> children;
+    for(std::size_t i = 0; i != 300; ++i) {
+        children.push_back(new OrderedCachingObject{&a});
+        children.back()->translate(Math::Vector3<T>::xAxis(T(i)));
+        if(i % 3 == 0) {
+            children.push_back(new OrderedCachingObject{children.back()});
+            children.back()->scale(Math::Vector3<T>{T(2.0)});
+        }
+    }
+    CORRADE_VERIFY(!clean.isDirty());
+    CORRADE_VERIFY(a.isDirty());
+
+    /* Pass only the leaf objects and some duplicates */
+    std::vector<std::reference_wrapper<Object3D<T>>> objects;
+    for(OrderedCachingObject* o: children)
+        if(o->children().isEmpty()) objects.push_back(*o);
+    objects.push_back(*children[0]->children().first());
+    objects.push_back(clean);
+    Object3D<T>::setClean(objects, 4);
+
+    CORRADE_VERIFY(!a.isDirty());
+    for(OrderedCachingObject* o: children) {
+        CORRADE_VERIFY(!o->isDirty());
+        CORRADE_VERIFY(o->parentClean);
+        CORRADE_COMPARE(o->cleanedAbsoluteTransformation, o->absoluteTransformationMatrix());
+    }
+    CORRADE_COMPARE(children[2]->cleanedAbsoluteTransformation.translation(), (Math::Vector3<T>{T(2.0), T(1.0), T(0.0)}));
+
+    /* The marks used internally should be cleaned up so the serial
+       transformation calculation works afterwards */
+    CORRADE_COMPARE(scene.transformations({*children[1]})[0], children[1]->absoluteTransformation());
+
+    /* The object transformation gets updated in the next call */
+    a.translate(Math::Vector3<T>::yAxis(T(1.0)));
+    Object3D<T>::setClean(objects, 4);
+    CORRADE_COMPARE(children[2]->cleanedAbsoluteTransformation.translation(), (Math::Vector3<T>{T(2.0), T(2.0), T(0.0)}));
+}
+
 template<class T> void ObjectTest::rangeBasedForChildren() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
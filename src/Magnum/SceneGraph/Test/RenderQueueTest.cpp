@@ -0,0 +1,364 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct RenderQueueTest: TestSuite::Tester {
+    explicit RenderQueueTest();
+
+    void key();
+    void depthKey();
+
+    void construct();
+    void constructMove();
+    void addClear();
+
+    void sort();
+    void sortStable();
+    void sortEmpty();
+    void sortFullKeys();
+
+    void draw();
+    void cameraDraw();
+    void cameraDrawDefaultKey();
+    void cameraDrawCulled();
+};
+
+RenderQueueTest::RenderQueueTest() {
+    addTests({&RenderQueueTest::key,
+              &RenderQueueTest::depthKey,
+
+              &RenderQueueTest::construct,
+              &RenderQueueTest::constructMove,
+              &RenderQueueTest::addClear,
+
+              &RenderQueueTest::sort,
+              &RenderQueueTest::sortStable,
+              &RenderQueueTest::sortEmpty,
+              &RenderQueueTest::sortFullKeys,
+
+              &RenderQueueTest::draw,
+              &RenderQueueTest::cameraDraw,
+              &RenderQueueTest::cameraDrawDefaultKey,
+              &RenderQueueTest::cameraDrawCulled});
+}
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+/* Records the draw order, with a key derived from the object position to
+   test Drawable::sortKey() */
+struct RecordingDrawable: Drawable3D {
+    explicit RecordingDrawable(Object3D& object, DrawableGroup3D* group, Int id, std::vector<Int>& drawn, UnsignedShort shader = 0): Drawable3D{object, group}, id{id}, shader{shader}, drawn(drawn) {}
+
+    UnsignedLong sortKey(const Matrix4& transformationMatrix, Camera3D&) override {
+        return RenderQueue3D::key(shader, 0, 0, RenderQueue3D::depthKey(-transformationMatrix.translation().z(), 100.0f));
+    }
+
+    void draw(const Matrix4&, Camera3D&) override {
+        drawn.push_back(id);
+    }
+
+    Int id;
+    UnsignedShort shader;
+    std::vector<Int>& drawn;
+};
+
+/* Uses the default sortKey() */
+struct DefaultDrawable: Drawable3D {
+    explicit DefaultDrawable(Object3D& object, DrawableGroup3D* group, Int id, std::vector<Int>& drawn): Drawable3D{object, group}, id{id}, drawn(drawn) {}
+
+    void draw(const Matrix4&, Camera3D&) override {
+        drawn.push_back(id);
+    }
+
+    Int id;
+    std::vector<Int>& drawn;
+};
+
+void RenderQueueTest::key() {
+    CORRADE_COMPARE(RenderQueue3D::key(0x1234, 0x5678, 0x9abc, 0xdef0), 0x123456789abcdef0ull);
+
+    /* Usable in a constant expression */
+    constexpr UnsignedLong key = RenderQueue2D::key(1, 0, 0, 0);
+    CORRADE_COMPARE(key, 0x0001000000000000ull);
+}
+
+void RenderQueueTest::depthKey() {
+    CORRADE_COMPARE(RenderQueue3D::depthKey(0.0f, 100.0f), 0);
+    CORRADE_COMPARE(RenderQueue3D::depthKey(50.0f, 100.0f), 0x8000);
+    CORRADE_COMPARE(RenderQueue3D::depthKey(100.0f, 100.0f), 0xffff);
+
+    /* Clamped */
+    CORRADE_COMPARE(RenderQueue3D::depthKey(-1.0f, 100.0f), 0);
+    CORRADE_COMPARE(RenderQueue3D::depthKey(150.0f, 100.0f), 0xffff);
+}
+
+void RenderQueueTest::construct() {
+    RenderQueue3D queue;
+    CORRADE_VERIFY(queue.isEmpty());
+    CORRADE_COMPARE(queue.size(), 0);
+    CORRADE_VERIFY(queue.keys().empty());
+    CORRADE_VERIFY(queue.transformations().empty());
+    CORRADE_VERIFY(queue.drawables().empty());
+}
+
+void RenderQueueTest::constructMove() {
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<Int> drawn;
+    DefaultDrawable drawable{object, nullptr, 0, drawn};
+
+    RenderQueue3D a;
+    a.add(7, Matrix4::translation(Vector3::xAxis()), drawable);
+
+    RenderQueue3D b{std::move(a)};
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.keys()[0], 7);
+
+    RenderQueue3D c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.drawables()[0], &drawable);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<RenderQueue3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<RenderQueue3D>::value);
+}
+
+void RenderQueueTest::addClear() {
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<Int> drawn;
+    DefaultDrawable a{object, nullptr, 0, drawn};
+    DefaultDrawable b{object, nullptr, 1, drawn};
+
+    RenderQueue3D queue;
+    queue.add(3, Matrix4::translation(Vector3::xAxis()), a)
+         .add(1, Matrix4::translation(Vector3::yAxis()), b);
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_COMPARE_AS(queue.keys(), (Containers::arrayView<UnsignedLong>({3, 1})),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(queue.transformations()[1], Matrix4::translation(Vector3::yAxis()));
+    CORRADE_COMPARE(queue.drawables()[0], &a);
+    CORRADE_COMPARE(queue.drawables()[1], &b);
+
+    queue.clear();
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+void RenderQueueTest::sort() {
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<Int> drawn;
+    DefaultDrawable drawable{object, nullptr, 0, drawn};
+
+    /* Deterministic pseudo-random keys in the lower 24 bits, index in the
+       transformation to check the data got reordered together with them */
+    UnsignedInt seed = 7;
+    std::vector<UnsignedLong> keys;
+    RenderQueue3D queue;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        seed = seed*1103515245u + 12345u;
+        keys.push_back(seed >> 8);
+        queue.add(keys.back(), Matrix4::translation(Vector3::xAxis(Float(i))), drawable);
+    }
+
+    std::vector<std::size_t> expected(keys.size());
+    for(std::size_t i = 0; i != expected.size(); ++i) expected[i] = i;
+    std::stable_sort(expected.begin(), expected.end(), [&keys](std::size_t a, std::size_t b) {
+        return keys[a] < keys[b];
+    });
+
+    queue.sort();
+    CORRADE_COMPARE(queue.size(), 1000);
+    for(std::size_t i = 0; i != expected.size(); ++i) {
+        CORRADE_COMPARE(queue.keys()[i], keys[expected[i]]);
+        CORRADE_COMPARE(queue.transformations()[i].translation().x(), Float(expected[i]));
+    }
+}
+
+void RenderQueueTest::sortStable() {
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<Int> drawn;
+    DefaultDrawable a{object, nullptr, 0, drawn};
+    DefaultDrawable b{object, nullptr, 1, drawn};
+    DefaultDrawable c{object, nullptr, 2, drawn};
+    DefaultDrawable d{object, nullptr, 3, drawn};
+
+    RenderQueue3D queue;
+    queue.add(RenderQueue3D::key(2, 0, 0, 0), {}, a)
+         .add(RenderQueue3D::key(1, 0, 0, 0), {}, b)
+         .add(RenderQueue3D::key(2, 0, 0, 0), {}, c)
+         .add(RenderQueue3D::key(1, 0, 0, 0), {}, d)
+         .sort();
+    CORRADE_COMPARE_AS(queue.drawables(), (Containers::arrayView<Drawable3D*>({&b, &d, &a, &c})),
+        TestSuite::Compare::Container);
+}
+
+void RenderQueueTest::sortEmpty() {
+    RenderQueue3D queue;
+    queue.sort();
+    CORRADE_VERIFY(queue.isEmpty());
+}
+
+void RenderQueueTest::sortFullKeys() {
+    Scene3D scene;
+    Object3D object{&scene};
+    std::vector<Int> drawn;
+    DefaultDrawable a{object, nullptr, 0, drawn};
+    DefaultDrawable b{object, nullptr, 1, drawn};
+    DefaultDrawable c{object, nullptr, 2, drawn};
+
+    /* Keys differing in all bytes, including the highest bit */
+    RenderQueue3D queue;
+    queue.add(0xffffffffffffffffull, {}, a)
+         .add(0x0102030405060708ull, {}, b)
+         .add(0x8000000000000000ull, {}, c)
+         .sort();
+    CORRADE_COMPARE_AS(queue.keys(), (Containers::arrayView<UnsignedLong>({
+        0x0102030405060708ull, 0x8000000000000000ull, 0xffffffffffffffffull})),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(queue.drawables(), (Containers::arrayView<Drawable3D*>({&b, &c, &a})),
+        TestSuite::Compare::Container);
+}
+
+void RenderQueueTest::draw() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Camera3D camera{object};
+    std::vector<Int> drawn;
+    DefaultDrawable a{object, nullptr, 0, drawn};
+    DefaultDrawable b{object, nullptr, 1, drawn};
+
+    RenderQueue3D queue;
+    queue.add(1, {}, a)
+         .add(0, {}, b)
+         .draw(camera);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1}),
+        TestSuite::Compare::Container);
+
+    drawn.clear();
+    queue.sort().draw(camera);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{1, 0}),
+        TestSuite::Compare::Container);
+}
+
+void RenderQueueTest::cameraDraw() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    /* Two shaders, each with a near and a far object, added interleaved */
+    Object3D a{&scene}, b{&scene}, c{&scene}, d{&scene};
+    a.translate(Vector3::zAxis(-50.0f));
+    b.translate(Vector3::zAxis(-10.0f));
+    c.translate(Vector3::zAxis(-20.0f));
+    d.translate(Vector3::zAxis(-5.0f));
+    new RecordingDrawable{a, &group, 0, drawn, 1};
+    new RecordingDrawable{b, &group, 1, drawn, 0};
+    new RecordingDrawable{c, &group, 2, drawn, 1};
+    new RecordingDrawable{d, &group, 3, drawn, 0};
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    RenderQueue3D queue;
+    camera.draw(group, queue);
+
+    /* Grouped by shader first, then front-to-back */
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{3, 1, 2, 0}),
+        TestSuite::Compare::Container);
+
+    /* The queue contents are kept for inspection */
+    CORRADE_COMPARE(queue.size(), 4);
+    CORRADE_COMPARE(queue.keys()[0], RenderQueue3D::key(0, 0, 0, RenderQueue3D::depthKey(5.0f, 100.0f)));
+    CORRADE_COMPARE(queue.transformations()[0], Matrix4::translation(Vector3::zAxis(-5.0f)));
+    CORRADE_COMPARE(queue.drawables()[0], &group[3]);
+
+    /* Drawing again with a moved camera clears the queue first. Objects
+       behind the camera get clamped to zero depth and keep the original
+       order. */
+    drawn.clear();
+    cameraObject.translate(Vector3::zAxis(-30.0f));
+    camera.draw(group, queue);
+    CORRADE_COMPARE(queue.size(), 4);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{1, 3, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
+void RenderQueueTest::cameraDrawDefaultKey() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    new DefaultDrawable{a, &group, 0, drawn};
+    new DefaultDrawable{b, &group, 1, drawn};
+    new DefaultDrawable{c, &group, 2, drawn};
+
+    /* Same order as without the queue */
+    Camera3D camera{scene};
+    RenderQueue3D queue;
+    camera.draw(group, queue);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void RenderQueueTest::cameraDrawCulled() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    std::vector<Int> drawn;
+
+    Object3D a{&scene}, b{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    b.translate(Vector3::zAxis(5.0f));
+    (new RecordingDrawable{a, &group, 0, drawn})->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+    (new RecordingDrawable{b, &group, 1, drawn})->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* Only the visible drawables get to the queue */
+    Camera3D camera{scene};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg{90.0f}, 1.0f, 0.1f, 100.0f))
+        .setFrustumCullingEnabled(true);
+    RenderQueue3D queue;
+    camera.draw(group, queue);
+    CORRADE_COMPARE(queue.size(), 1);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0}),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::RenderQueueTest)
@@ -25,14 +25,18 @@
 
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
 #include "Magnum/SceneGraph/Animable.hpp"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.hpp"
 #include "Magnum/SceneGraph/Camera.hpp"
 #include "Magnum/SceneGraph/Drawable.hpp"
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatHierarchy.hpp"
+#include "Magnum/SceneGraph/InstanceBatcher.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
 #include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/RenderQueue.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation2D.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation3D.hpp"
 #include "Magnum/SceneGraph/TranslationTransformation.h"
@@ -66,12 +70,28 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Animable<3, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP AnimableGroup<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP AnimableGroup<3, Float>;
 
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolume<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolume<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolumeHierarchy<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolumeHierarchy<3, Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<3, Float>;
 
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
 
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstanceBatcher<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstanceBatcher<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstancedDrawable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstancedDrawable<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP RenderQueue<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP RenderQueue<3, Float>;
+
 /* These have rotation(const Complex&) and rotation(const Quaternion&) defined
    in a hpp to avoid dragging in Complex / Quaternion for every user */
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicMatrixTransformation2D<Float>;
@@ -62,7 +62,7 @@ namespace Magnum { namespace Trade {
 std::string AbstractImporter::pluginInterface() {
     return
 /* [interface] */
-"cz.mosra.magnum.Trade.AbstractImporter/0.3.3"
+"cz.mosra.magnum.Trade.AbstractImporter/0.3.4"
 /* [interface] */
     ;
 }
@@ -89,12 +89,24 @@ std::vector<std::string> AbstractImporter::pluginSearchPaths() {
 }
 #endif
 
+struct AbstractImporter::OpenedFile {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Directory::MapDeleter> mapped;
+    #endif
+    /* Used if mapping is not available or failed */
+    Containers::Array<char> data;
+};
+
 AbstractImporter::AbstractImporter() = default;
 
 AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& manager): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager} {}
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const std::string& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
+/* The subclass destructor is expected to close the file, the memory it
+   referenced is released only after */
+AbstractImporter::~AbstractImporter() = default;
+
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
         "Trade::AbstractImporter::setFlags(): can't be set while a file is opened", );
@@ -131,6 +143,23 @@ void AbstractImporter::doOpenData(Containers::ArrayView<const char>) {
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::openData(): feature advertised but not implemented", );
 }
 
+bool AbstractImporter::openMemory(Containers::ArrayView<const void> memory) {
+    CORRADE_ASSERT(features() & (ImporterFeature::OpenMemory|ImporterFeature::OpenData),
+        "Trade::AbstractImporter::openMemory(): feature not supported", {});
+
+    /* If the importer can't reference the memory, it'll copy what it needs
+       in doOpenData(), which is fine as well */
+    close();
+    const Containers::ArrayView<const char> data{static_cast<const char*>(memory.data()), memory.size()};
+    if(doFeatures() & ImporterFeature::OpenMemory) doOpenMemory(data);
+    else doOpenData(data);
+    return isOpened();
+}
+
+void AbstractImporter::doOpenMemory(Containers::ArrayView<const char>) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::openMemory(): feature advertised but not implemented", );
+}
+
 bool AbstractImporter::openState(const void* state, const std::string& filePath) {
     CORRADE_ASSERT(features() & ImporterFeature::OpenState,
         "Trade::AbstractImporter::openState(): feature not supported", {});
@@ -181,11 +210,23 @@ bool AbstractImporter::openFile(const std::string& filename) {
 }
 
 void AbstractImporter::doOpenFile(const std::string& filename) {
-    CORRADE_ASSERT(features() & ImporterFeature::OpenData, "Trade::AbstractImporter::openFile(): not implemented", );
+    CORRADE_ASSERT(features() & (ImporterFeature::OpenData|ImporterFeature::OpenMemory), "Trade::AbstractImporter::openFile(): not implemented", );
+
+    /* If callbacks are set and the importer can work only with memory that
+       outlives the call, ask the callback to keep the data around. The Close
+       policy is just a hint so it's not sent after, as it'd require
+       remembering the filename until close(). */
+    if(_fileCallback && !(features() & ImporterFeature::OpenData)) {
+        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadPermanent, _fileCallbackUserData);
+        if(!data) {
+            Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+            return;
+        }
+        doOpenMemory(*data);
 
     /* If callbacks are set, use them. This is the same implementation as in
        openFile(), see the comment there for details. */
-    if(_fileCallback) {
+    } else if(_fileCallback) {
         const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
@@ -201,7 +242,30 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
             return;
         }
 
-        doOpenData(Utility::Directory::read(filename));
+        /* If the importer can reference the memory directly, map the file
+           instead of copying it to a temporary buffer and keep the mapping
+           until close() */
+        if(features() & ImporterFeature::OpenMemory) {
+            Containers::Pointer<OpenedFile> file{Containers::InPlaceInit};
+            Containers::ArrayView<const char> data;
+            #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+            file->mapped = Utility::Directory::mapRead(filename);
+            if(file->mapped.data()) data = file->mapped;
+            /* If the file can't be mapped (such as when it's empty), read it
+               instead */
+            else
+            #endif
+            {
+                file->data = Utility::Directory::read(filename);
+                data = file->data;
+            }
+
+            doOpenMemory(data);
+
+            /* If the opening failed, the memory is released right away */
+            if(isOpened()) _openedFile = std::move(file);
+
+        } else doOpenData(Utility::Directory::read(filename));
     }
 }
 
@@ -210,6 +274,10 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Release the memory only after the importer doesn't reference it
+       anymore */
+    _openedFile = nullptr;
 }
 
 Int AbstractImporter::defaultScene() const {
@@ -1071,6 +1139,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         _c(OpenData)
         _c(OpenState)
         _c(FileCallback)
+        _c(OpenMemory)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1082,7 +1151,8 @@ Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFeatures{}", {
         ImporterFeature::OpenData,
         ImporterFeature::OpenState,
-        ImporterFeature::FileCallback});
+        ImporterFeature::FileCallback,
+        ImporterFeature::OpenMemory});
 }
 
 Debug& operator<<(Debug& debug, const ImporterFlag value) {
@@ -30,6 +30,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -64,7 +65,21 @@ enum class ImporterFeature: UnsignedByte {
      * See @ref Trade-AbstractImporter-usage-callbacks and particular importer
      * documentation for more information.
      */
-    FileCallback = 1 << 2
+    FileCallback = 1 << 2,
+
+    /**
+     * Opening files from memory that's guaranteed to stay in scope until the
+     * importer is closed, using @ref AbstractImporter::openMemory(). Besides
+     * that, the default @ref AbstractImporter::openFile() implementation
+     * memory-maps the file instead of copying it to a temporary buffer if
+     * this feature is supported. The importer can then reference the memory
+     * directly instead of making a copy, and the imported data can point to
+     * it with @ref DataFlag::ExternallyOwned.
+     *
+     * See @ref Trade-AbstractImporter-usage-memory for more information.
+     * @m_since_latest
+     */
+    OpenMemory = 1 << 3
 };
 
 /**
@@ -199,6 +214,27 @@ The input file callback signature is the same for @ref Trade::AbstractImporter,
 @ref ShaderTools::AbstractConverter and @ref Text::AbstractFont to allow code
 reuse.
 
+@subsection Trade-AbstractImporter-usage-memory Zero-copy import from memory
+
+The memory passed to @ref openData() is not expected to be alive after the
+function exits, so the importer has to copy everything it needs to reference
+later. Importers that advertise @ref ImporterFeature::OpenMemory can instead
+open memory using @ref openMemory(), which is guaranteed to stay in scope
+until the importer is closed, and reference it directly. Data imported from
+such memory can then point into it, in which case their data flags contain
+@ref DataFlag::ExternallyOwned instead of @ref DataFlag::Owned.
+
+For such importers, the default @ref openFile() implementation maps the file
+into memory using @ref Utility::Directory::mapRead() instead of reading it
+into a temporary buffer, and keeps the mapping until the file is closed. On
+large files this avoids both the copy and the need to have the whole file in
+memory twice --- only the parts that actually get accessed are paged in. On
+platforms where memory mapping isn't available, such as
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", the file is read into a buffer
+owned by the importer instead.
+
+@snippet MagnumTrade.cpp AbstractImporter-usage-memory
+
 @subsection Trade-AbstractImporter-usage-state Internal importer state
 
 Some importers, especially ones that make use of well-known external libraries,
@@ -266,11 +302,19 @@ file is kept open. If the file gets closed or the importer instance deleted,
 the state pointers become dangling, and that's fine as long as you don't access
 them.
 
+Similarly, data with @ref DataFlag::ExternallyOwned that were imported from
+memory opened @ref Trade-AbstractImporter-usage-memory "using openMemory() or a memory-mapped file"
+are valid only as long as the memory is. For @ref openMemory() that's until
+the memory passed to it goes out of scope, for memory-mapped files until the
+file gets closed or the importer instance deleted. If you need the data to
+outlive that, make a copy.
+
 @section Trade-AbstractImporter-subclassing Subclassing
 
 The plugin needs to implement the @ref doFeatures(), @ref doIsOpened()
-functions, at least one of @ref doOpenData() / @ref doOpenFile() /
-@ref doOpenState() functions, function @ref doClose() and one or more tuples of
+functions, at least one of @ref doOpenData() / @ref doOpenMemory() /
+@ref doOpenFile() / @ref doOpenState() functions, function @ref doClose() and
+one or more tuples of
 data access functions, based on what features are supported in given format.
 
 In order to support @ref ImporterFeature::FileCallback, the importer needs to
@@ -290,11 +334,16 @@ import.
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
 
--   The @ref doOpenData(), @ref doOpenFile() and @ref doOpenState() functions
-    are called after the previous file was closed, function @ref doClose() is
-    called only if there is any file opened.
+-   The @ref doOpenData(), @ref doOpenMemory(), @ref doOpenFile() and
+    @ref doOpenState() functions are called after the previous file was
+    closed, function @ref doClose() is called only if there is any file
+    opened.
 -   The @ref doOpenData() function is called only if
     @ref ImporterFeature::OpenData is supported.
+-   The @ref doOpenMemory() function is called only if
+    @ref ImporterFeature::OpenMemory is supported. Memory passed to it is
+    guaranteed to stay in scope until @ref doClose() is called. If the
+    opening fails, the memory is released right after the function exits.
 -   The @ref doOpenState() function is called only if
     @ref ImporterFeature::OpenState is supported.
 -   The @ref doSetFileCallback() function is called only if
@@ -376,6 +425,8 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         ImporterFeatures features() const { return doFeatures(); }
 
@@ -493,10 +544,30 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * data. Available only if @ref ImporterFeature::OpenData is supported.
          * Returns @cpp true @ce on success, @cpp false @ce otherwise. The
          * @p data is not expected to be alive after the function exits.
-         * @see @ref features(), @ref openFile()
+         * @see @ref features(), @ref openMemory(), @ref openFile()
          */
         bool openData(Containers::ArrayView<const char> data);
 
+        /**
+         * @brief Open memory
+         * @m_since_latest
+         *
+         * Closes previous file, if it was opened, and tries to open given
+         * memory. Available only if @ref ImporterFeature::OpenMemory or
+         * @ref ImporterFeature::OpenData is supported. Returns
+         * @cpp true @ce on success, @cpp false @ce otherwise.
+         *
+         * Unlike with @ref openData(), the @p memory is expected to stay in
+         * scope until the importer is closed, is destructed or another file
+         * is opened. If @ref ImporterFeature::OpenMemory is supported, the
+         * importer can reference it directly instead of making a copy and the
+         * imported data can point into it with @ref DataFlag::ExternallyOwned.
+         * Otherwise the call is equivalent to @ref openData(). See
+         * @ref Trade-AbstractImporter-usage-memory for more information.
+         * @see @ref features(), @ref openFile()
+         */
+        bool openMemory(Containers::ArrayView<const void> memory);
+
         /**
          * @brief Open already loaded state
          * @param state     Pointer to importer-specific state
@@ -524,7 +595,13 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * callback to load the file and passes the memory view to
          * @ref openData() instead. See @ref setFileCallback() for more
          * information.
-         * @see @ref features(), @ref openData()
+         *
+         * If @ref ImporterFeature::OpenMemory is supported and no file
+         * callbacks are set, the default implementation memory-maps the file
+         * instead of reading it and the mapping is kept until the file is
+         * closed. See @ref Trade-AbstractImporter-usage-memory for more
+         * information.
+         * @see @ref features(), @ref openData(), @ref openMemory()
          */
         bool openFile(const std::string& filename);
 
@@ -533,7 +610,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          *
          * On particular implementations an explicit call to this function may
          * result in freed memory. This call is also done automatically when
-         * the importer gets destructed or when another file is opened.
+         * the importer gets destructed or when another file is opened. If the
+         * file was memory-mapped by @ref openFile(), the mapping is released
+         * as well and all data with @ref DataFlag::ExternallyOwned imported
+         * from it become dangling.
          */
         void close();
 
@@ -1423,9 +1503,14 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /**
          * @brief Implementation for @ref openFile()
          *
-         * If @ref ImporterFeature::OpenData is supported, default
-         * implementation opens the file and calls @ref doOpenData() with its
-         * contents. It is allowed to call this function from your
+         * If @ref ImporterFeature::OpenMemory is supported, default
+         * implementation memory-maps the file and calls @ref doOpenMemory()
+         * with the mapped memory, which is kept until the file is closed. On
+         * platforms without memory mapping support, or if the mapping fails,
+         * the file is read into a buffer that's kept until the file is closed
+         * instead. Otherwise, if @ref ImporterFeature::OpenData is supported,
+         * default implementation opens the file and calls @ref doOpenData()
+         * with its contents. It is allowed to call this function from your
          * @ref doOpenFile() implementation --- in particular, this
          * implementation will also correctly handle callbacks set through
          * @ref setFileCallback().
@@ -1433,7 +1518,11 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * This function is not called when file callbacks are set through
          * @ref setFileCallback() and @ref ImporterFeature::FileCallback is not
          * supported --- instead, file is loaded though the callback and data
-         * passed through to @ref doOpenData().
+         * passed through to @ref doOpenData(). If callbacks are set,
+         * @ref ImporterFeature::FileCallback is supported and the importer
+         * supports only @ref ImporterFeature::OpenMemory, the file is loaded
+         * with @ref InputFileCallbackPolicy::LoadPermanent and passed to
+         * @ref doOpenMemory().
          */
         virtual void doOpenFile(const std::string& filename);
 
@@ -1473,6 +1562,15 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref openData() */
         virtual void doOpenData(Containers::ArrayView<const char> data);
 
+        /**
+         * @brief Implementation for @ref openMemory()
+         * @m_since_latest
+         *
+         * The @p memory is guaranteed to stay in scope until @ref doClose()
+         * is called, so the implementation can reference it directly.
+         */
+        virtual void doOpenMemory(Containers::ArrayView<const char> memory);
+
         /** @brief Implementation for @ref openState() */
         virtual void doOpenState(const void* state, const std::string& filePath);
 
@@ -2069,6 +2167,11 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         ImporterFlags _flags;
 
+        /* Memory-mapped or read file kept alive for doOpenMemory() until
+           close(), defined in the cpp to avoid including Directory.h */
+        struct OpenedFile;
+        Containers::Pointer<OpenedFile> _openedFile;
+
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
 
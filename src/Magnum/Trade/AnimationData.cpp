@@ -25,8 +25,16 @@
 
 #include "AnimationData.h"
 
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Animation/Compression.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Half.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
@@ -143,6 +151,9 @@ template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermite2D, Math:
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermite3D, Math::Vector3<Float>>(Animation::Interpolation) -> Math::Vector3<Float>(*)(const CubicHermite3D&, const CubicHermite3D&, Float);
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermiteComplex, Complex>(Animation::Interpolation) -> Complex(*)(const CubicHermiteComplex&, const CubicHermiteComplex&, Float);
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermiteQuaternion, Quaternion>(Animation::Interpolation) -> Quaternion(*)(const CubicHermiteQuaternion&, const CubicHermiteQuaternion&, Float);
+template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<Vector2h, Vector2>(Animation::Interpolation) -> Vector2(*)(const Vector2h&, const Vector2h&, Float);
+template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<Vector3h, Vector3>(Animation::Interpolation) -> Vector3(*)(const Vector3h&, const Vector3h&, Float);
+template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<Animation::CompressedQuaternion, Quaternion>(Animation::Interpolation) -> Quaternion(*)(const Animation::CompressedQuaternion&, const Animation::CompressedQuaternion&, Float);
 
 Debug& operator<<(Debug& debug, const AnimationTrackType value) {
     debug << "Trade::AnimationTrackType" << Debug::nospace;
@@ -174,6 +185,9 @@ Debug& operator<<(Debug& debug, const AnimationTrackType value) {
         _c(CubicHermite3D)
         _c(CubicHermiteComplex)
         _c(CubicHermiteQuaternion)
+        _c(Vector2h)
+        _c(Vector3h)
+        _c(CompressedQuaternion)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -205,4 +219,271 @@ Debug& operator<<(Debug& debug, const AnimationTrackTargetType value) {
 }
 #endif
 
+namespace {
+
+/* Fixed-size part of a serialized animation, followed by the track table and
+   the keyframe data. The layout is the same on 32-bit and 64-bit
+   platforms. */
+struct SerializedAnimation {
+    DataChunkHeader header;
+    Range1D duration;
+    UnsignedInt trackCount;
+    UnsignedInt reserved;
+    UnsignedLong dataSize;
+};
+
+static_assert(sizeof(SerializedAnimation) == 48, "improper size of SerializedAnimation");
+
+/* Key and value offsets are relative to the beginning of the keyframe data,
+   strides can be negative. The interpolator function pointer is recreated
+   from the interpolation. */
+struct SerializedAnimationTrack {
+    AnimationTrackType type, resultType;
+    AnimationTrackTargetType targetType;
+    Animation::Interpolation interpolation;
+    Animation::Extrapolation before, after;
+    UnsignedShort reserved;
+    UnsignedInt target;
+    UnsignedInt size;
+    Int keysStride, valuesStride;
+    UnsignedLong keysOffset, valuesOffset;
+};
+
+static_assert(sizeof(SerializedAnimationTrack) == 40, "improper size of SerializedAnimationTrack");
+
+template<class V, class R> AnimationTrackData deserializeTrack(const SerializedAnimationTrack& track, const char* const data) {
+    /* The bounds are checked by the caller, the views are created with an
+       unbounded size so negative strides don't trip up the view
+       assertions */
+    return AnimationTrackData{track.type, track.resultType, track.targetType, track.target,
+        Animation::TrackView<const Float, const V, R>{
+            Containers::StridedArrayView1D<const Float>{{data, ~std::size_t{}}, reinterpret_cast<const Float*>(data + track.keysOffset), track.size, track.keysStride},
+            Containers::StridedArrayView1D<const V>{{data, ~std::size_t{}}, reinterpret_cast<const V*>(data + track.valuesOffset), track.size, track.valuesStride},
+            track.interpolation, animationInterpolatorFor<V, R>(track.interpolation), track.before, track.after}};
+}
+
+struct AnimationTrackTypeInfo {
+    AnimationTrackType resultType;
+    std::size_t size;
+    AnimationTrackData(*deserialize)(const SerializedAnimationTrack&, const char*);
+};
+
+AnimationTrackTypeInfo animationTrackTypeInfo(const AnimationTrackType type) {
+    switch(type) {
+        #define _c(type, V, R) case AnimationTrackType::type: return {Implementation::animationTypeFor<R>(), sizeof(V), deserializeTrack<V, R>};
+        _c(Bool, bool, bool)
+        _c(Float, Float, Float)
+        _c(UnsignedInt, UnsignedInt, UnsignedInt)
+        _c(Int, Int, Int)
+        _c(BoolVector2, Math::BoolVector<2>, Math::BoolVector<2>)
+        _c(BoolVector3, Math::BoolVector<3>, Math::BoolVector<3>)
+        _c(BoolVector4, Math::BoolVector<4>, Math::BoolVector<4>)
+        _c(Vector2, Vector2, Vector2)
+        _c(Vector2ui, Vector2ui, Vector2ui)
+        _c(Vector2i, Vector2i, Vector2i)
+        _c(Vector3, Vector3, Vector3)
+        _c(Vector3ui, Vector3ui, Vector3ui)
+        _c(Vector3i, Vector3i, Vector3i)
+        _c(Vector4, Vector4, Vector4)
+        _c(Vector4ui, Vector4ui, Vector4ui)
+        _c(Vector4i, Vector4i, Vector4i)
+        _c(Complex, Complex, Complex)
+        _c(Quaternion, Quaternion, Quaternion)
+        _c(DualQuaternion, DualQuaternion, DualQuaternion)
+        _c(CubicHermite1D, CubicHermite1D, Float)
+        _c(CubicHermite2D, CubicHermite2D, Vector2)
+        _c(CubicHermite3D, CubicHermite3D, Vector3)
+        _c(CubicHermiteComplex, CubicHermiteComplex, Complex)
+        _c(CubicHermiteQuaternion, CubicHermiteQuaternion, Quaternion)
+        _c(Vector2h, Vector2h, Vector2)
+        _c(Vector3h, Vector3h, Vector3)
+        _c(CompressedQuaternion, Animation::CompressedQuaternion, Quaternion)
+        #undef _c
+    }
+
+    return {};
+}
+
+/* Interpolations for which animationInterpolatorFor() has a function. Spline
+   interpolation is only for cubic Hermite splines. */
+bool isAnimationInterpolationSupported(const AnimationTrackType type, const Animation::Interpolation interpolation) {
+    if(interpolation == Animation::Interpolation::Constant ||
+       interpolation == Animation::Interpolation::Linear)
+        return true;
+    if(interpolation == Animation::Interpolation::Spline)
+        return type == AnimationTrackType::CubicHermite1D ||
+               type == AnimationTrackType::CubicHermite2D ||
+               type == AnimationTrackType::CubicHermite3D ||
+               type == AnimationTrackType::CubicHermiteComplex ||
+               type == AnimationTrackType::CubicHermiteQuaternion;
+    return false;
+}
+
+/* Checks that a view of given element size and count starting at offset
+   with given stride fits into size bytes. Done in 64-bit to avoid overflows
+   on 32-bit platforms. The count and stride are 32-bit, so this can't
+   overflow. */
+bool isAnimationTrackViewContained(const UnsignedLong offset, const UnsignedInt count, const Int stride, const std::size_t typeSize, const std::size_t size) {
+    if(offset > size) return false;
+    if(!count) return true;
+    const Long last = Long(count - 1)*stride;
+    return Long(offset) + Math::min(last, Long{}) >= 0 &&
+           Long(offset) + Math::max(last, Long{}) + Long(typeSize) <= Long(size);
+}
+
+Containers::Optional<AnimationData> animationDataDeserialize(const Containers::ArrayView<const void> data, const bool copy) {
+    const DataChunkHeader* const header = Implementation::dataChunkHeaderDeserialize(data, DataChunkType::Animation, sizeof(SerializedAnimation), "Trade::AnimationData::deserialize():");
+    if(!header) return {};
+
+    /* 64-bit math to avoid overflows with bogus counts */
+    const SerializedAnimation& animation = *reinterpret_cast<const SerializedAnimation*>(header);
+    const UnsignedLong dataOffset = sizeof(SerializedAnimation) + UnsignedLong(animation.trackCount)*sizeof(SerializedAnimationTrack);
+    if(dataOffset > header->size || animation.dataSize > header->size - dataOffset) {
+        Error{} << "Trade::AnimationData::deserialize():" << animation.trackCount << "tracks and data of" << animation.dataSize << "bytes don't fit into a chunk of" << header->size << "bytes";
+        return {};
+    }
+
+    const char* const begin = static_cast<const char*>(data.data());
+    const Containers::ArrayView<const SerializedAnimationTrack> serializedTracks{reinterpret_cast<const SerializedAnimationTrack*>(begin + sizeof(SerializedAnimation)), animation.trackCount};
+    const Containers::ArrayView<const char> keyframeData{begin + dataOffset, std::size_t(animation.dataSize)};
+
+    /* Check the tracks. The TrackView constructors and interpolatorFor()
+       would assert on these, which is not desirable for external data. */
+    for(std::size_t i = 0; i != serializedTracks.size(); ++i) {
+        const SerializedAnimationTrack& track = serializedTracks[i];
+        const AnimationTrackTypeInfo info = animationTrackTypeInfo(track.type);
+        if(!info.deserialize) {
+            Error{} << "Trade::AnimationData::deserialize(): invalid type" << track.type << "of track" << i;
+            return {};
+        }
+        if(track.resultType != info.resultType) {
+            Error{} << "Trade::AnimationData::deserialize(): invalid result type" << track.resultType << "for" << track.type << "track" << i;
+            return {};
+        }
+        if(UnsignedByte(track.targetType) > UnsignedByte(AnimationTrackTargetType::Scaling3D) && UnsignedByte(track.targetType) < UnsignedByte(AnimationTrackTargetType::Custom)) {
+            Error{} << "Trade::AnimationData::deserialize(): invalid target type" << track.targetType << "of track" << i;
+            return {};
+        }
+        if(!isAnimationInterpolationSupported(track.type, track.interpolation)) {
+            Error{} << "Trade::AnimationData::deserialize(): unsupported interpolation" << track.interpolation << "of" << track.type << "track" << i;
+            return {};
+        }
+        if(UnsignedByte(track.before) > UnsignedByte(Animation::Extrapolation::DefaultConstructed)) {
+            Error{} << "Trade::AnimationData::deserialize(): invalid before extrapolation" << track.before << "of track" << i;
+            return {};
+        }
+        if(UnsignedByte(track.after) > UnsignedByte(Animation::Extrapolation::DefaultConstructed)) {
+            Error{} << "Trade::AnimationData::deserialize(): invalid after extrapolation" << track.after << "of track" << i;
+            return {};
+        }
+        if(!isAnimationTrackViewContained(track.keysOffset, track.size, track.keysStride, sizeof(Float), keyframeData.size())) {
+            Error{} << "Trade::AnimationData::deserialize(): keys of track" << i << "are not contained in data of" << keyframeData.size() << "bytes";
+            return {};
+        }
+        if(!isAnimationTrackViewContained(track.valuesOffset, track.size, track.valuesStride, info.size, keyframeData.size())) {
+            Error{} << "Trade::AnimationData::deserialize(): values of track" << i << "are not contained in data of" << keyframeData.size() << "bytes";
+            return {};
+        }
+    }
+
+    Containers::Array<char> ownedData;
+    if(copy) {
+        ownedData = Containers::Array<char>{Containers::NoInit, keyframeData.size()};
+        if(!keyframeData.empty())
+            std::memcpy(ownedData.data(), keyframeData.data(), keyframeData.size());
+    }
+
+    /* Only the track table gets allocated, the views point into the
+       keyframe data */
+    const char* const trackData = copy ? ownedData.data() : keyframeData.data();
+    Containers::Array<AnimationTrackData> tracks{serializedTracks.size()};
+    for(std::size_t i = 0; i != serializedTracks.size(); ++i)
+        tracks[i] = animationTrackTypeInfo(serializedTracks[i].type).deserialize(serializedTracks[i], trackData);
+
+    if(copy)
+        return AnimationData{std::move(ownedData), std::move(tracks), animation.duration};
+    return AnimationData{DataFlag::ExternallyOwned, keyframeData, std::move(tracks), animation.duration};
+}
+
+}
+
+Containers::Optional<AnimationData> AnimationData::deserialize(const Containers::ArrayView<const void> data) {
+    return animationDataDeserialize(data, false);
+}
+
+std::size_t AnimationData::serializedSize() const {
+    return Implementation::dataChunkAlign(sizeof(SerializedAnimation) + _tracks.size()*sizeof(SerializedAnimationTrack) + _data.size());
+}
+
+std::size_t AnimationData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::AnimationData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() >= size,
+        "Trade::AnimationData::serializeInto(): expected at least" << size << "bytes but got" << out.size(), {});
+
+    Implementation::dataChunkHeaderSerializeInto(out, DataChunkType::Animation, size);
+    SerializedAnimation& animation = *reinterpret_cast<SerializedAnimation*>(out.data());
+    animation.duration = _duration;
+    animation.trackCount = _tracks.size();
+    animation.dataSize = _data.size();
+
+    SerializedAnimationTrack* const tracks = reinterpret_cast<SerializedAnimationTrack*>(out.data() + sizeof(SerializedAnimation));
+    for(std::size_t i = 0; i != _tracks.size(); ++i) {
+        const AnimationTrackData& trackData = _tracks[i];
+        const Animation::TrackViewStorage<const Float>& view = trackData._view;
+        CORRADE_ASSERT(isAnimationInterpolationSupported(trackData._type, view.interpolation()),
+            "Trade::AnimationData::serializeInto(): can't serialize" << view.interpolation() << "interpolation of" << trackData._type << "track" << i, {});
+        /* Casting to 64-bit types to avoid always-true comparison warnings
+           on 32-bit platforms */
+        CORRADE_ASSERT(UnsignedLong(view.size()) <= 0xffffffffull &&
+            (view.size() <= 1 || (Math::abs(Long(view.keys().stride())) <= 0x7fffffffll && Math::abs(Long(view.values().stride())) <= 0x7fffffffll)),
+            "Trade::AnimationData::serializeInto(): track" << i << "is too large to be serialized", {});
+
+        SerializedAnimationTrack& track = tracks[i];
+        track.type = trackData._type;
+        track.resultType = trackData._resultType;
+        track.targetType = trackData._targetType;
+        track.interpolation = view.interpolation();
+        track.before = view.before();
+        track.after = view.after();
+        track.target = trackData._target;
+        track.size = view.size();
+
+        /* Empty tracks have everything zero, strides of single-keyframe
+           tracks are not important */
+        if(!view.size()) continue;
+        const std::ptrdiff_t keysOffset = reinterpret_cast<const char*>(view.keys().data()) - _data.data();
+        const std::ptrdiff_t valuesOffset = static_cast<const char*>(view.values().data()) - _data.data();
+        if(view.size() > 1) {
+            track.keysStride = view.keys().stride();
+            track.valuesStride = view.values().stride();
+        }
+        CORRADE_ASSERT(keysOffset >= 0 && valuesOffset >= 0 &&
+            isAnimationTrackViewContained(keysOffset, track.size, track.keysStride, sizeof(Float), _data.size()) &&
+            isAnimationTrackViewContained(valuesOffset, track.size, track.valuesStride, animationTrackTypeInfo(trackData._type).size, _data.size()),
+            "Trade::AnimationData::serializeInto(): track" << i << "is not contained in the data array", {});
+        track.keysOffset = keysOffset;
+        track.valuesOffset = valuesOffset;
+    }
+
+    if(!_data.empty())
+        std::memcpy(out.data() + sizeof(SerializedAnimation) + _tracks.size()*sizeof(SerializedAnimationTrack), _data.data(), _data.size());
+
+    return size;
+}
+
+Containers::Array<char> AnimationData::serialize() const {
+    /* Everything including padding is overwritten in serializeInto() */
+    Containers::Array<char> out{Containers::NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
+namespace Implementation {
+    Containers::Optional<AnimationData> animationDataDeserializeCopy(const Containers::ArrayView<const void> data) {
+        return animationDataDeserialize(data, true);
+    }
+}
+
 }}
@@ -115,7 +115,36 @@ enum class AnimationTrackType: UnsignedByte {
      * @ref Magnum::CubicHermiteQuaternion "CubicHermiteQuaternion". Usually
      * used for spline-interpolated @ref AnimationTrackTargetType::Rotation3D.
      */
-    CubicHermiteQuaternion
+    CubicHermiteQuaternion,
+
+    /**
+     * @ref Magnum::Vector2h "Vector2h". Usually used for compressed
+     * @ref AnimationTrackTargetType::Translation2D and
+     * @ref AnimationTrackTargetType::Scaling2D, with
+     * @ref Magnum::Vector2 "Vector2" as the result type.
+     * @see @ref Animation::compress()
+     * @m_since_latest
+     */
+    Vector2h,
+
+    /**
+     * @ref Magnum::Vector3h "Vector3h". Usually used for compressed
+     * @ref AnimationTrackTargetType::Translation3D and
+     * @ref AnimationTrackTargetType::Scaling3D, with
+     * @ref Magnum::Vector3 "Vector3" as the result type.
+     * @see @ref Animation::compress()
+     * @m_since_latest
+     */
+    Vector3h,
+
+    /**
+     * @ref Animation::CompressedQuaternion. Usually used for compressed
+     * @ref AnimationTrackTargetType::Rotation3D, with
+     * @ref Magnum::Quaternion "Quaternion" as the result type.
+     * @see @ref Animation::compress()
+     * @m_since_latest
+     */
+    CompressedQuaternion
 };
 
 /** @debugoperatorenum{AnimationTrackType} */
@@ -305,6 +334,23 @@ animation:
 
 @snippet MagnumTrade.cpp AnimationData-usage-mutable
 
+@section Trade-AnimationData-serialization Zero-copy serialization
+
+Similarly to @ref Trade-MeshData-serialization "MeshData", the animation can be
+saved into a binary blob using @ref serialize() and loaded back with
+@ref deserialize() without copying the keyframe data. The blob is a data chunk
+described by @ref DataChunkHeader with @ref DataChunkType::Animation,
+containing a table of track descriptions followed by @ref data(). Since the
+tracks contain interpolator function pointers, which can't be saved, only the
+@ref Animation::TrackViewStorage::interpolation() "interpolation" of each
+track is stored and the interpolator is recreated from it using
+@ref animationInterpolatorFor() during deserialization. Thus tracks with
+@ref Animation::Interpolation::Custom can't be serialized, and tracks that
+use a different interpolator than what @ref animationInterpolatorFor()
+returns for their interpolation will use the default one after
+deserialization. The track table is small and gets allocated, the keyframe
+data are referenced directly.
+
 @experimental
 */
 class MAGNUM_TRADE_EXPORT AnimationData {
@@ -577,6 +623,60 @@ class MAGNUM_TRADE_EXPORT AnimationData {
          */
         const void* importerState() const { return _importerState; }
 
+        /**
+         * @brief Deserialize an animation
+         * @m_since_latest
+         *
+         * Expects that @p data is a @ref DataChunkType::Animation chunk
+         * created by @ref serialize() or @ref serializeInto() on a platform
+         * with the same endianness and pointer size, aligned to 8 bytes. The
+         * returned instance references keyframe data in @p data directly,
+         * with @ref dataFlags() being @ref DataFlag::ExternallyOwned, and
+         * thus @p data is expected to stay in scope for as long as the
+         * instance is used. The track array is allocated and the
+         * interpolators are recreated using @ref animationInterpolatorFor().
+         * Prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} if the data are not
+         * valid. See @ref Trade-AnimationData-serialization for more
+         * information.
+         * @see @ref dataChunkHeaderDeserialize()
+         */
+        static Containers::Optional<AnimationData> deserialize(Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Size of serialized data
+         * @m_since_latest
+         *
+         * Size of a data chunk created by @ref serialize() or
+         * @ref serializeInto(), in bytes. Always a multiple of 8.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize to a pre-allocated view
+         * @m_since_latest
+         *
+         * Expects that @p out is aligned to 8 bytes and at least
+         * @ref serializedSize() large, that no track uses
+         * @ref Animation::Interpolation::Custom or
+         * @ref Animation::Interpolation::Spline for a type that isn't a
+         * cubic Hermite spline and that keys and values of all tracks are
+         * contained in @ref data(). Returns the amount of bytes written,
+         * which is equal to @ref serializedSize(). See
+         * @ref Trade-AnimationData-serialization for more information.
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize to a newly allocated array
+         * @m_since_latest
+         *
+         * Allocates a new array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it. See
+         * @ref Trade-AnimationData-serialization for more information.
+         */
+        Containers::Array<char> serialize() const;
+
     private:
         /* For custom deleter checks. Not done in the constructors here because
            the restriction is pointless when used outside of plugin
@@ -602,6 +702,10 @@ plugin binary to avoid dangling function pointers on plugin unload.
 template<class V, class R = Animation::ResultOf<V>> MAGNUM_TRADE_EXPORT auto animationInterpolatorFor(Animation::Interpolation interpolation) -> R(*)(const V&, const V&, Float);
 
 namespace Implementation {
+    /* Used internally by BlobImporter to get an instance owning a copy of
+       the keyframe data */
+    MAGNUM_TRADE_EXPORT Containers::Optional<AnimationData> animationDataDeserializeCopy(Containers::ArrayView<const void> data);
+
     /* LCOV_EXCL_START */
     template<class> constexpr AnimationTrackType animationTypeFor();
     template<> constexpr AnimationTrackType animationTypeFor<bool>() { return AnimationTrackType::Bool; }
@@ -646,6 +750,10 @@ namespace Implementation {
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermite3D>() { return AnimationTrackType::CubicHermite3D; }
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermiteComplex>() { return AnimationTrackType::CubicHermiteComplex; }
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermiteQuaternion>() { return AnimationTrackType::CubicHermiteQuaternion; }
+
+    template<> constexpr AnimationTrackType animationTypeFor<Vector2h>() { return AnimationTrackType::Vector2h; }
+    template<> constexpr AnimationTrackType animationTypeFor<Vector3h>() { return AnimationTrackType::Vector3h; }
+    template<> constexpr AnimationTrackType animationTypeFor<Animation::CompressedQuaternion>() { return AnimationTrackType::CompressedQuaternion; }
     /* LCOV_EXCL_STOP */
 }
 
@@ -25,7 +25,12 @@
 
 #include "Data.h"
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/DebugStl.h>
 
 namespace Magnum { namespace Trade {
 
@@ -37,6 +42,7 @@ Debug& operator<<(Debug& debug, const DataFlag value) {
         #define _c(v) case DataFlag::v: return debug << "::" #v;
         _c(Owned)
         _c(Mutable)
+        _c(ExternallyOwned)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -47,11 +53,115 @@ Debug& operator<<(Debug& debug, const DataFlag value) {
 Debug& operator<<(Debug& debug, const DataFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::DataFlags{}", {
         DataFlag::Owned,
-        DataFlag::Mutable});
+        DataFlag::Mutable,
+        DataFlag::ExternallyOwned});
+}
+
+Debug& operator<<(Debug& debug, const DataChunkType value) {
+    debug << "Trade::DataChunkType" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case DataChunkType::v: return debug << "::" #v;
+        _c(Mesh)
+        _c(Image1D)
+        _c(Image2D)
+        _c(Image3D)
+        _c(Material)
+        _c(Animation)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << reinterpret_cast<void*>(UnsignedInt(value)) << Debug::nospace << ")";
+}
+
+namespace {
+
+const DataChunkHeader* dataChunkHeaderDeserializeInternal(const Containers::ArrayView<const void> data, const char* const prefix) {
+    if(reinterpret_cast<std::uintptr_t>(data.data()) % 8) {
+        Error{} << prefix << "data not aligned to 8 bytes";
+        return nullptr;
+    }
+
+    if(data.size() < sizeof(DataChunkHeader)) {
+        Error{} << prefix << "expected at least" << sizeof(DataChunkHeader) << "bytes for a header but got" << data.size();
+        return nullptr;
+    }
+
+    const DataChunkHeader& header = *static_cast<const DataChunkHeader*>(data.data());
+    if(std::memcmp(header.signature, "BLOB", 4) != 0) {
+        Error{} << prefix << "invalid signature" << std::string{header.signature, 4};
+        return nullptr;
+    }
+
+    if(header.version != 0) {
+        Error{} << prefix << "unsupported header version" << header.version;
+        return nullptr;
+    }
+
+    if(header.byteOrderMark != 0xfeff) {
+        Error{} << prefix << "expected a" << (Utility::Endianness::isBigEndian() ? "big-endian" : "little-endian") << "chunk but got a" << (Utility::Endianness::isBigEndian() ? "little-endian" : "big-endian") << "one";
+        return nullptr;
+    }
+
+    if(header.pointerSize != sizeof(std::size_t)) {
+        Error{} << prefix << "expected a" << sizeof(std::size_t)*8 << Debug::nospace << "-bit chunk but got a" << header.pointerSize*8 << Debug::nospace << "-bit one";
+        return nullptr;
+    }
+
+    if(header.size < sizeof(DataChunkHeader) || header.size > data.size()) {
+        Error{} << prefix << "expected a chunk of at least" << sizeof(DataChunkHeader) << "and at most" << data.size() << "bytes but got" << header.size;
+        return nullptr;
+    }
+
+    return &header;
+}
+
+}
+
+const DataChunkHeader* dataChunkHeaderDeserialize(const Containers::ArrayView<const void> data) {
+    return dataChunkHeaderDeserializeInternal(data, "Trade::dataChunkHeaderDeserialize():");
 }
 
 namespace Implementation {
     void nonOwnedArrayDeleter(char*, std::size_t) { /* does nothing */ }
+
+    void dataChunkHeaderSerializeInto(const Containers::ArrayView<char> out, const DataChunkType type, const std::size_t size) {
+        CORRADE_INTERNAL_ASSERT(out.size() >= size && size % 8 == 0);
+
+        /* Zero-fill everything first so padding between the data arrays
+           doesn't contain garbage */
+        std::memset(out.data(), 0, size);
+        DataChunkHeader& header = *reinterpret_cast<DataChunkHeader*>(out.data());
+        std::memcpy(header.signature, "BLOB", 4);
+        header.pointerSize = sizeof(std::size_t);
+        header.byteOrderMark = 0xfeff;
+        header.type = type;
+        header.size = size;
+    }
+
+    const DataChunkHeader* dataChunkHeaderDeserialize(const Containers::ArrayView<const void> data, const DataChunkType type, const std::size_t minSize, const char* const prefix) {
+        const DataChunkHeader* const header = dataChunkHeaderDeserializeInternal(data, prefix);
+        if(!header) return nullptr;
+
+        if(header->type != type) {
+            Error{} << prefix << "expected a" << type << "chunk but got" << header->type;
+            return nullptr;
+        }
+
+        if(header->typeVersion != 0) {
+            Error{} << prefix << "unsupported" << type << "version" << header->typeVersion;
+            return nullptr;
+        }
+
+        if(header->size < minSize) {
+            Error{} << prefix << "expected at least" << minSize << "bytes for a" << type << "chunk but got" << header->size;
+            return nullptr;
+        }
+
+        return header;
+    }
 }
 
 }}
@@ -26,11 +26,12 @@
 */
 
 /** @file
- * @brief Enum @ref Magnum::Trade::DataFlag, enum set @ref Magnum::Trade::DataFlags
+ * @brief Enum @ref Magnum::Trade::DataFlag, @ref Magnum::Trade::DataChunkType, enum set @ref Magnum::Trade::DataFlags, struct @ref Magnum::Trade::DataChunkHeader, function @ref Magnum::Trade::dataChunkHeaderDeserialize()
  * @m_since{2020,06}
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Trade/visibility.h"
@@ -57,9 +58,22 @@ enum class DataFlag: UnsignedByte {
      * Data is mutable. If this flag is not set, the instance might be for
      * example referencing a readonly memory-mapped file or a constant memory.
      */
-    Mutable = 2 << 0
+    Mutable = 2 << 0,
 
-    /** @todo owned by importer, owned by the GPU, ... */
+    /**
+     * Data is owned by someone else and is guaranteed to stay in scope only
+     * for a limited time. Used for data imported from memory opened through
+     * @ref AbstractImporter::openMemory() or from a memory-mapped file opened
+     * through @ref AbstractImporter::openFile(), see
+     * @ref Trade-AbstractImporter-usage-memory for more information. In the
+     * latter case the data are valid only until the importer is closed,
+     * another file is opened or the importer is destroyed. Mutually
+     * exclusive with @ref DataFlag::Owned.
+     * @m_since_latest
+     */
+    ExternallyOwned = 1 << 2
+
+    /** @todo owned by the GPU, ... */
 };
 
 /**
@@ -85,9 +99,138 @@ CORRADE_ENUMSET_OPERATORS(DataFlags)
 */
 MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, DataFlags value);
 
+/**
+@brief Data chunk type
+@m_since_latest
+
+Type of data stored in a serialized data chunk, saved in
+@ref DataChunkHeader::type. The values are four-character codes.
+@see @ref Trade-DataChunkHeader-format
+*/
+enum class DataChunkType: UnsignedInt {
+    /** Serialized @ref MeshData, see @ref MeshData::serialize() */
+    Mesh = Utility::Endianness::fourCC('M', 'e', 's', 'h'),
+
+    /** Serialized @ref ImageData1D, see @ref ImageData::serialize() */
+    Image1D = Utility::Endianness::fourCC('I', 'm', 'g', '1'),
+
+    /** Serialized @ref ImageData2D, see @ref ImageData::serialize() */
+    Image2D = Utility::Endianness::fourCC('I', 'm', 'g', '2'),
+
+    /** Serialized @ref ImageData3D, see @ref ImageData::serialize() */
+    Image3D = Utility::Endianness::fourCC('I', 'm', 'g', '3'),
+
+    /** Serialized @ref MaterialData, see @ref MaterialData::serialize() */
+    Material = Utility::Endianness::fourCC('M', 't', 'r', 'l'),
+
+    /** Serialized @ref AnimationData, see @ref AnimationData::serialize() */
+    Animation = Utility::Endianness::fourCC('A', 'n', 'i', 'm')
+};
+
+/**
+@debugoperatorenum{DataChunkType}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, DataChunkType value);
+
+/**
+@brief Data chunk header
+@m_since_latest
+
+Header of a serialized data chunk produced by @ref MeshData::serialize(),
+@ref ImageData::serialize(), @ref MaterialData::serialize() or
+@ref AnimationData::serialize().
+
+@section Trade-DataChunkHeader-format Data chunk format
+
+A data chunk consists of this header, followed by a fixed-size description
+of the data and then by the actual data arrays --- for example the attribute
+table, index and vertex data of a mesh. The data arrays are stored in the
+same layout as in memory, each beginning at an offset aligned to 8 bytes and
+the total chunk size being padded to a multiple of 8 bytes. Thus, as long as
+the chunk itself starts at an 8-byte-aligned address, such as at the
+beginning of a memory-mapped file, the data can be referenced directly
+without any parsing or copying. Chunks can be also concatenated together
+and iterated using @ref size.
+
+As the data are stored in the native layout, the chunk can only be
+deserialized on a platform with the same endianness and the same pointer
+size. This is checked by @ref dataChunkHeaderDeserialize() using
+@ref byteOrderMark and @ref pointerSize.
+*/
+struct DataChunkHeader {
+    /** @brief Signature, always the characters `BLOB` */
+    char signature[4];
+
+    /** @brief Header version, currently @cpp 0 @ce */
+    UnsignedByte version;
+
+    /**
+     * @brief Pointer size
+     *
+     * Size of @ref std::size_t on the platform the chunk was serialized on,
+     * in bytes.
+     */
+    UnsignedByte pointerSize;
+
+    /**
+     * @brief Byte order mark
+     *
+     * Always @cpp 0xfeff @ce written in the byte order of the platform the
+     * chunk was serialized on. On a platform with a different endianness it
+     * reads as @cpp 0xfffe @ce.
+     */
+    UnsignedShort byteOrderMark;
+
+    /** @brief Chunk type */
+    DataChunkType type;
+
+    /**
+     * @brief Chunk type version
+     *
+     * Version of the data layout of given @ref type, currently
+     * @cpp 0 @ce for all types.
+     */
+    UnsignedShort typeVersion;
+
+    /** @brief Reserved, always @cpp 0 @ce */
+    UnsignedShort reserved;
+
+    /**
+     * @brief Chunk size
+     *
+     * Size of the whole chunk including the header, in bytes. Always a
+     * multiple of 8.
+     */
+    UnsignedLong size;
+};
+
+static_assert(sizeof(DataChunkHeader) == 24, "improper size of DataChunkHeader");
+
+/**
+@brief Check and deserialize a data chunk header
+@m_since_latest
+
+Checks that @p data is aligned to 8 bytes, is large enough to contain the
+header and the header has a valid signature, version, is serialized for the
+same pointer size and endianness as the current platform and the @ref DataChunkHeader::size
+fits into @p data. On success returns a pointer to the header, which is
+pointing to the beginning of @p data. The rest of the chunk can be then
+deserialized based on @ref DataChunkHeader::type. On failure prints a
+message to @relativeref{Magnum,Error} and returns @cpp nullptr @ce.
+*/
+MAGNUM_TRADE_EXPORT const DataChunkHeader* dataChunkHeaderDeserialize(Containers::ArrayView<const void> data);
+
 namespace Implementation {
     /* Used internally by MeshData */
     MAGNUM_TRADE_EXPORT void nonOwnedArrayDeleter(char*, std::size_t);
+
+    /* Used internally by *Data::serialize() and *Data::deserialize() */
+    constexpr std::size_t dataChunkAlign(std::size_t size) {
+        return (size + 7) & ~std::size_t(7);
+    }
+    MAGNUM_TRADE_EXPORT void dataChunkHeaderSerializeInto(Containers::ArrayView<char> out, DataChunkType type, std::size_t size);
+    MAGNUM_TRADE_EXPORT const DataChunkHeader* dataChunkHeaderDeserialize(Containers::ArrayView<const void> data, DataChunkType type, std::size_t minSize, const char* prefix);
 }
 
 }}
@@ -25,10 +25,14 @@
 
 #include "ImageData.h"
 
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Implementation/ImageProperties.h"
 
 namespace Magnum { namespace Trade {
@@ -214,6 +218,171 @@ template<UnsignedInt dimensions> Containers::Array<char> ImageData<dimensions>::
     return data;
 }
 
+namespace {
+
+/* Fixed-size part of a serialized image, followed by the data aligned to 8
+   bytes. For compressed images the alignment and pixel size is unused,
+   for uncompressed the compressed block properties. Sizes of dimensions that
+   the image doesn't have are zero. */
+struct SerializedImage {
+    DataChunkHeader header;
+    UnsignedByte compressed;
+    UnsignedByte reserved[3];
+    UnsignedInt format;
+    UnsignedInt formatExtra;
+    UnsignedInt pixelSize;
+    Int size[3];
+    Int alignment;
+    Int rowLength;
+    Int imageHeight;
+    Int skip[3];
+    Int compressedBlockSize[3];
+    Int compressedBlockDataSize;
+    UnsignedInt reserved2;
+    UnsignedLong dataSize;
+};
+
+static_assert(sizeof(SerializedImage) == 104, "improper size of SerializedImage");
+
+constexpr DataChunkType ImageDataChunkTypes[]{
+    DataChunkType::Image1D,
+    DataChunkType::Image2D,
+    DataChunkType::Image3D
+};
+
+/* Adapter for Magnum::Implementation::imageDataSizeFor() */
+struct SerializedImageProperties {
+    PixelStorage storage() const { return _storage; }
+    UnsignedInt pixelSize() const { return _pixelSize; }
+
+    PixelStorage _storage;
+    UnsignedInt _pixelSize;
+};
+
+}
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> ImageData<dimensions>::deserialize(const Containers::ArrayView<const void> data) {
+    const DataChunkHeader* const header = Implementation::dataChunkHeaderDeserialize(data, ImageDataChunkTypes[dimensions - 1], sizeof(SerializedImage), "Trade::ImageData::deserialize():");
+    if(!header) return {};
+
+    const SerializedImage& image = *reinterpret_cast<const SerializedImage*>(header);
+    if(image.dataSize > header->size - sizeof(SerializedImage)) {
+        Error{} << "Trade::ImageData::deserialize(): data of" << image.dataSize << "bytes don't fit into a chunk of" << header->size << "bytes";
+        return {};
+    }
+    const Containers::ArrayView<const char> imageData{static_cast<const char*>(data.data()) + sizeof(SerializedImage), std::size_t(image.dataSize)};
+
+    /* All sizes have to be non-negative and the unused dimensions zero, the
+       PixelStorage setters would assert otherwise */
+    const Vector3i size{image.size[0], image.size[1], image.size[2]};
+    const Vector3i skip{image.skip[0], image.skip[1], image.skip[2]};
+    if((size < Vector3i{}).any() || (skip < Vector3i{}).any() || image.rowLength < 0 || image.imageHeight < 0 || (dimensions < 3 && size.z()) || (dimensions < 2 && size.y())) {
+        Error{} << "Trade::ImageData::deserialize(): invalid size" << size << "or storage parameters";
+        return {};
+    }
+
+    if(image.compressed) {
+        const Vector3i blockSize{image.compressedBlockSize[0], image.compressedBlockSize[1], image.compressedBlockSize[2]};
+        if((blockSize < Vector3i{}).any() || image.compressedBlockDataSize < 0) {
+            Error{} << "Trade::ImageData::deserialize(): invalid compressed block size" << blockSize << "or data size" << image.compressedBlockDataSize;
+            return {};
+        }
+
+        CompressedPixelStorage storage;
+        storage.setRowLength(image.rowLength)
+            .setImageHeight(image.imageHeight)
+            .setSkip(skip)
+            .setCompressedBlockSize(blockSize)
+            .setCompressedBlockDataSize(image.compressedBlockDataSize);
+        return ImageData<dimensions>{storage, CompressedPixelFormat(image.format), Math::Vector<dimensions, Int>::pad(size), DataFlag::ExternallyOwned, imageData};
+    }
+
+    if(image.alignment != 1 && image.alignment != 2 && image.alignment != 4 && image.alignment != 8) {
+        Error{} << "Trade::ImageData::deserialize(): invalid alignment" << image.alignment;
+        return {};
+    }
+
+    if(!image.pixelSize || image.pixelSize > 256) {
+        Error{} << "Trade::ImageData::deserialize(): invalid pixel size" << image.pixelSize;
+        return {};
+    }
+
+    /* Check that the data are large enough, the constructor would assert
+       otherwise. First a rough upper bound of all intermediate values to
+       avoid overflows with bogus sizes, then the actual size. */
+    const Double bound =
+        (Double(Math::max(image.rowLength, size.x()) + skip.x())*image.pixelSize + 8)*
+        (Math::max(image.imageHeight, size.y()) + skip.y() + 1.0)*
+        (size.z() + skip.z() + 1.0);
+    if(bound >= Double(~std::size_t{} >> 2)) {
+        Error{} << "Trade::ImageData::deserialize(): image of size" << size << "is too large";
+        return {};
+    }
+
+    PixelStorage storage;
+    storage.setAlignment(image.alignment)
+        .setRowLength(image.rowLength)
+        .setImageHeight(image.imageHeight)
+        .setSkip(skip);
+    const std::size_t dataSize = Magnum::Implementation::imageDataSizeFor(SerializedImageProperties{storage, image.pixelSize}, Math::Vector<dimensions, Int>::pad(size));
+    if(dataSize > imageData.size()) {
+        Error{} << "Trade::ImageData::deserialize(): expected at least" << dataSize << "bytes of data for an image of size" << size << "but got" << imageData.size();
+        return {};
+    }
+
+    return ImageData<dimensions>{storage, PixelFormat(image.format), image.formatExtra, image.pixelSize, Math::Vector<dimensions, Int>::pad(size), DataFlag::ExternallyOwned, imageData};
+}
+
+template<UnsignedInt dimensions> std::size_t ImageData<dimensions>::serializedSize() const {
+    return Implementation::dataChunkAlign(sizeof(SerializedImage) + _data.size());
+}
+
+template<UnsignedInt dimensions> std::size_t ImageData<dimensions>::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::ImageData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() >= size,
+        "Trade::ImageData::serializeInto(): expected at least" << size << "bytes but got" << out.size(), {});
+
+    Implementation::dataChunkHeaderSerializeInto(out, ImageDataChunkTypes[dimensions - 1], size);
+    SerializedImage& image = *reinterpret_cast<SerializedImage*>(out.data());
+    const Vector3i imageSize = Vector3i::pad(_size);
+    for(std::size_t i = 0; i != 3; ++i) image.size[i] = imageSize[i];
+    image.dataSize = _data.size();
+    if(_compressed) {
+        image.compressed = 1;
+        image.format = UnsignedInt(_compressedFormat);
+        image.rowLength = _compressedStorage.rowLength();
+        image.imageHeight = _compressedStorage.imageHeight();
+        for(std::size_t i = 0; i != 3; ++i) {
+            image.skip[i] = _compressedStorage.skip()[i];
+            image.compressedBlockSize[i] = _compressedStorage.compressedBlockSize()[i];
+        }
+        image.compressedBlockDataSize = _compressedStorage.compressedBlockDataSize();
+    } else {
+        image.format = UnsignedInt(_format);
+        image.formatExtra = _formatExtra;
+        image.pixelSize = _pixelSize;
+        image.alignment = _storage.alignment();
+        image.rowLength = _storage.rowLength();
+        image.imageHeight = _storage.imageHeight();
+        for(std::size_t i = 0; i != 3; ++i)
+            image.skip[i] = _storage.skip()[i];
+    }
+
+    if(!_data.empty())
+        std::memcpy(out.data() + sizeof(SerializedImage), _data.data(), _data.size());
+
+    return size;
+}
+
+template<UnsignedInt dimensions> Containers::Array<char> ImageData<dimensions>::serialize() const {
+    /* Everything including padding is overwritten in serializeInto() */
+    Containers::Array<char> out{Containers::NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TRADE_EXPORT ImageData<1>;
 template class MAGNUM_TRADE_EXPORT ImageData<2>;
@@ -100,6 +100,17 @@ first. The following snippet flips the R and B channels of the imported image:
 
 @snippet MagnumTrade.cpp ImageData-usage-mutable
 
+@section Trade-ImageData-serialization Zero-copy serialization
+
+Similarly to @ref Trade-MeshData-serialization "MeshData", the image can be
+saved into a binary blob using @ref serialize(), containing the storage
+parameters, format and the pixel data in the same layout as in memory. The
+@ref deserialize() function then creates an instance that directly references
+the blob instead of copying the data. The blob is a data chunk described by
+@ref DataChunkHeader with @ref DataChunkType::Image1D,
+@relativeref{DataChunkType,Image2D} or @relativeref{DataChunkType,Image3D}
+based on the dimension count.
+
 @see @ref ImageData1D, @ref ImageData2D, @ref ImageData3D,
     @ref Image-pixel-views
 */
@@ -670,6 +681,56 @@ template<UnsignedInt dimensions> class ImageData {
          */
         const void* importerState() const { return _importerState; }
 
+        /**
+         * @brief Deserialize an image
+         * @m_since_latest
+         *
+         * Expects that @p data is a @ref DataChunkType::Image1D,
+         * @relativeref{DataChunkType,Image2D} or
+         * @relativeref{DataChunkType,Image3D} chunk matching the dimension
+         * count, created by @ref serialize() or @ref serializeInto() on a
+         * platform with the same endianness and pointer size, aligned to 8
+         * bytes. The returned instance references @p data directly, with
+         * @ref dataFlags() being @ref DataFlag::ExternallyOwned, and thus
+         * @p data is expected to stay in scope for as long as the instance
+         * is used. Prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} if the data are not
+         * valid. See @ref Trade-ImageData-serialization for more information.
+         * @see @ref dataChunkHeaderDeserialize()
+         */
+        static Containers::Optional<ImageData<dimensions>> deserialize(Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Size of serialized data
+         * @m_since_latest
+         *
+         * Size of a data chunk created by @ref serialize() or
+         * @ref serializeInto(), in bytes. Always a multiple of 8.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize to a pre-allocated view
+         * @m_since_latest
+         *
+         * Expects that @p out is aligned to 8 bytes and at least
+         * @ref serializedSize() large. Returns the amount of bytes written,
+         * which is equal to @ref serializedSize(). The remaining space can be
+         * used for further chunks. See @ref Trade-ImageData-serialization for
+         * more information.
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize to a newly allocated array
+         * @m_since_latest
+         *
+         * Allocates a new array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it. See @ref Trade-ImageData-serialization
+         * for more information.
+         */
+        Containers::Array<char> serialize() const;
+
     private:
         /* For custom deleter checks. Not done in the constructors here because
            the restriction is pointless when used outside of plugin
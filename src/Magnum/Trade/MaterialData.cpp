@@ -25,6 +25,7 @@
 
 #include "MaterialData.h"
 
+#include <cstdint>
 #include <cstring>
 #include <algorithm>
 #include <Corrade/Containers/EnumSet.hpp>
@@ -276,6 +277,132 @@ MaterialData::MaterialData(const MaterialTypes types, DataFlags, const Container
     #endif
 }
 
+namespace {
+
+/* Fixed-size part of a serialized material, followed by the attributes and
+   layer offsets. The attribute array is at an 8-byte-aligned offset, which is
+   what MaterialAttributeData needs. */
+struct SerializedMaterial {
+    DataChunkHeader header;
+    UnsignedInt types;
+    UnsignedInt attributeCount;
+    UnsignedInt layerCount;
+    UnsignedInt reserved;
+};
+
+static_assert(sizeof(SerializedMaterial) == 40, "improper size of SerializedMaterial");
+
+}
+
+Containers::Optional<MaterialData> MaterialData::deserialize(const Containers::ArrayView<const void> data) {
+    const DataChunkHeader* const header = Implementation::dataChunkHeaderDeserialize(data, DataChunkType::Material, sizeof(SerializedMaterial), "Trade::MaterialData::deserialize():");
+    if(!header) return {};
+
+    /* 64-bit math to avoid overflows with bogus counts */
+    const SerializedMaterial& material = *reinterpret_cast<const SerializedMaterial*>(header);
+    if(sizeof(SerializedMaterial) + UnsignedLong(material.attributeCount)*sizeof(MaterialAttributeData) + UnsignedLong(material.layerCount)*sizeof(UnsignedInt) > header->size) {
+        Error{} << "Trade::MaterialData::deserialize():" << material.attributeCount << "attributes and" << material.layerCount << "layers don't fit into a chunk of" << header->size << "bytes";
+        return {};
+    }
+
+    const Containers::ArrayView<const MaterialAttributeData> attributes{reinterpret_cast<const MaterialAttributeData*>(static_cast<const char*>(data.data()) + sizeof(SerializedMaterial)), material.attributeCount};
+    const Containers::ArrayView<const UnsignedInt> layers{reinterpret_cast<const UnsignedInt*>(attributes.end()), material.layerCount};
+
+    /* Check everything the constructor would assert on, and the attribute
+       contents as the accessors rely on those being valid */
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const MaterialAttributeData& attribute = attributes[i];
+        const MaterialAttributeType type = attribute._data.type;
+        if(type == MaterialAttributeType{} || UnsignedByte(type) > UnsignedByte(MaterialAttributeType::TextureSwizzle) || type == MaterialAttributeType::Pointer || type == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MaterialData::deserialize(): invalid type" << type << "of attribute" << i;
+            return {};
+        }
+
+        /* The name has to be non-empty and null-terminated before the value
+           starts. String values have the size stored in the last byte and
+           are null-terminated as well. */
+        std::size_t nameCapacity;
+        if(type == MaterialAttributeType::String) {
+            const std::size_t valueSize = attribute._data.s.size;
+            if(valueSize + 4 > Implementation::MaterialAttributeDataSize || attribute._data.data[Implementation::MaterialAttributeDataSize - 2]) {
+                Error{} << "Trade::MaterialData::deserialize(): invalid string value of attribute" << i;
+                return {};
+            }
+            nameCapacity = Implementation::MaterialAttributeDataSize - valueSize - 3;
+        } else nameCapacity = Implementation::MaterialAttributeDataSize - materialAttributeTypeSize(type) - 1;
+
+        const void* const nameEnd = std::memchr(attribute._data.data + 1, '\0', nameCapacity);
+        if(!nameEnd || nameEnd == attribute._data.data + 1) {
+            Error{} << "Trade::MaterialData::deserialize(): invalid name of attribute" << i;
+            return {};
+        }
+    }
+
+    UnsignedInt begin = 0;
+    for(std::size_t i = 0; i != layers.size(); ++i) {
+        const UnsignedInt end = layers[i];
+        if(end < begin || end > attributes.size()) {
+            Error{} << "Trade::MaterialData::deserialize(): invalid range (" << Debug::nospace << begin << Debug::nospace << "," << end << Debug::nospace << ") for layer" << i << "with" << attributes.size() << "attributes in total";
+            return {};
+        }
+
+        for(std::size_t j = begin + 1; j < end; ++j) if(!(attributes[j - 1].name() < attributes[j].name())) {
+            Error{} << "Trade::MaterialData::deserialize(): attributes in layer" << i << "are not sorted or contain duplicates";
+            return {};
+        }
+
+        begin = end;
+    }
+
+    /* Without layers the attributes form an implicit base layer */
+    if(layers.empty()) for(std::size_t j = 1; j < attributes.size(); ++j) if(!(attributes[j - 1].name() < attributes[j].name())) {
+        Error{} << "Trade::MaterialData::deserialize(): attributes are not sorted or contain duplicates";
+        return {};
+    }
+
+    /* Empty layer data have to be null in order to be treated as an implicit
+       base layer */
+    return MaterialData{MaterialType(material.types), DataFlag::ExternallyOwned, attributes, DataFlag::ExternallyOwned, layers.empty() ? nullptr : layers};
+}
+
+std::size_t MaterialData::serializedSize() const {
+    return Implementation::dataChunkAlign(sizeof(SerializedMaterial) + _data.size()*sizeof(MaterialAttributeData) + _layerOffsets.size()*sizeof(UnsignedInt));
+}
+
+std::size_t MaterialData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::MaterialData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() >= size,
+        "Trade::MaterialData::serializeInto(): expected at least" << size << "bytes but got" << out.size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        CORRADE_ASSERT(_data[i]._data.type != MaterialAttributeType::Pointer && _data[i]._data.type != MaterialAttributeType::MutablePointer,
+            "Trade::MaterialData::serializeInto(): can't serialize a" << _data[i]._data.type << "attribute" << _data[i].name(), {});
+    #endif
+
+    Implementation::dataChunkHeaderSerializeInto(out, DataChunkType::Material, size);
+    SerializedMaterial& material = *reinterpret_cast<SerializedMaterial*>(out.data());
+    material.types = UnsignedInt(_types);
+    material.attributeCount = _data.size();
+    material.layerCount = _layerOffsets.size();
+
+    char* const attributes = out.data() + sizeof(SerializedMaterial);
+    if(!_data.empty())
+        std::memcpy(attributes, _data.data(), _data.size()*sizeof(MaterialAttributeData));
+    if(!_layerOffsets.empty())
+        std::memcpy(attributes + _data.size()*sizeof(MaterialAttributeData), _layerOffsets.data(), _layerOffsets.size()*sizeof(UnsignedInt));
+
+    return size;
+}
+
+Containers::Array<char> MaterialData::serialize() const {
+    /* Everything including padding is overwritten in serializeInto() */
+    Containers::Array<char> out{Containers::NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
 MaterialData::MaterialData(MaterialData&&) noexcept = default;
 
 MaterialData::~MaterialData() = default;
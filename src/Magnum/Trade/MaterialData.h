@@ -1632,6 +1632,17 @@ precision.
     correction matrix is just 3x4 values with the bottom row being always
     @f$ \begin{pmatrix} 0 & 0 & 0 & 1 \end{pmatrix} @f$. This restriction might
     get lifted eventually.
+
+@section Trade-MaterialData-serialization Zero-copy serialization
+
+Because the attributes are fixed-size and self-contained, the material can be
+saved into a binary blob using @ref serialize() and loaded back with
+@ref deserialize() without copying or parsing anything, similarly to
+@ref Trade-MeshData-serialization "MeshData". The blob is a data chunk
+described by @ref DataChunkHeader with @ref DataChunkType::Material, containing
+the attribute array followed by layer offsets. Attributes of
+@ref MaterialAttributeType::Pointer and
+@relativeref{MaterialAttributeType,MutablePointer} types can't be serialized.
 */
 class MAGNUM_TRADE_EXPORT MaterialData {
     public:
@@ -2572,6 +2583,56 @@ class MAGNUM_TRADE_EXPORT MaterialData {
          */
         const void* importerState() const { return _importerState; }
 
+        /**
+         * @brief Deserialize a material
+         * @m_since_latest
+         *
+         * Expects that @p data is a @ref DataChunkType::Material chunk
+         * created by @ref serialize() or @ref serializeInto() on a platform
+         * with the same endianness and pointer size, aligned to 8 bytes. The
+         * returned instance references @p data directly and thus @p data is
+         * expected to stay in scope for as long as the instance is used.
+         * Prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} if the data are not
+         * valid. See @ref Trade-MaterialData-serialization for more
+         * information.
+         * @see @ref dataChunkHeaderDeserialize()
+         */
+        static Containers::Optional<MaterialData> deserialize(Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Size of serialized data
+         * @m_since_latest
+         *
+         * Size of a data chunk created by @ref serialize() or
+         * @ref serializeInto(), in bytes. Always a multiple of 8.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize to a pre-allocated view
+         * @m_since_latest
+         *
+         * Expects that @p out is aligned to 8 bytes and at least
+         * @ref serializedSize() large and that the material doesn't contain
+         * any @ref MaterialAttributeType::Pointer or
+         * @relativeref{MaterialAttributeType,MutablePointer} attributes.
+         * Returns the amount of bytes written, which is equal to
+         * @ref serializedSize(). See @ref Trade-MaterialData-serialization
+         * for more information.
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize to a newly allocated array
+         * @m_since_latest
+         *
+         * Allocates a new array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it. See
+         * @ref Trade-MaterialData-serialization for more information.
+         */
+        Containers::Array<char> serialize() const;
+
     private:
         /* For custom deleter checks. Not done in the constructors here because
            the restriction is pointless when used outside of plugin
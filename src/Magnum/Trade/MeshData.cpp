@@ -25,12 +25,17 @@
 
 #include "MeshData.h"
 
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Algorithms.h>
 #ifndef CORRADE_NO_ASSERT
 #include <Corrade/Utility/Format.h>
 #endif
 
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
 
@@ -806,6 +811,197 @@ Containers::Array<char> MeshData::releaseVertexData() {
     return out;
 }
 
+namespace {
+
+/* Fixed-size part of a serialized mesh, followed by the attribute table and
+   index and vertex data, each aligned to 8 bytes. The layout is the same on
+   32-bit and 64-bit platforms, only the size of the attribute table
+   differs. */
+struct SerializedMesh {
+    DataChunkHeader header;
+    UnsignedInt vertexCount;
+    UnsignedInt indexCount;
+    MeshPrimitive primitive;
+    MeshIndexType indexType;
+    UnsignedByte reserved;
+    UnsignedShort attributeCount;
+    UnsignedLong indexOffset;
+    UnsignedLong indexDataSize;
+    UnsignedLong vertexDataSize;
+};
+
+static_assert(sizeof(SerializedMesh) == 64, "improper size of SerializedMesh");
+
+constexpr UnsignedInt VertexFormatCount = 0
+    #define _c(format) + 1
+    #include "Magnum/Implementation/vertexFormatMapping.hpp"
+    #undef _c
+    ;
+
+}
+
+Containers::Optional<MeshData> MeshData::deserialize(const Containers::ArrayView<const void> data) {
+    const DataChunkHeader* const header = Implementation::dataChunkHeaderDeserialize(data, DataChunkType::Mesh, sizeof(SerializedMesh), "Trade::MeshData::deserialize():");
+    if(!header) return {};
+
+    const SerializedMesh& mesh = *reinterpret_cast<const SerializedMesh*>(header);
+    const char* const begin = static_cast<const char*>(data.data());
+
+    /* Check that all arrays fit into the chunk. Done one by one to avoid
+       overflows with bogus sizes. */
+    const std::size_t attributeOffset = sizeof(SerializedMesh);
+    const std::size_t indexDataOffset = Implementation::dataChunkAlign(attributeOffset + mesh.attributeCount*sizeof(MeshAttributeData));
+    if(indexDataOffset > header->size || mesh.indexDataSize > header->size - indexDataOffset) {
+        Error{} << "Trade::MeshData::deserialize(): index data of" << mesh.indexDataSize << "bytes and" << mesh.attributeCount << "attributes don't fit into a chunk of" << header->size << "bytes";
+        return {};
+    }
+    const std::size_t vertexDataOffset = Implementation::dataChunkAlign(indexDataOffset + mesh.indexDataSize);
+    if(vertexDataOffset > header->size || mesh.vertexDataSize > header->size - vertexDataOffset) {
+        Error{} << "Trade::MeshData::deserialize(): vertex data of" << mesh.vertexDataSize << "bytes don't fit into a chunk of" << header->size << "bytes";
+        return {};
+    }
+    const Containers::ArrayView<const char> indexData{begin + indexDataOffset, std::size_t(mesh.indexDataSize)};
+    const Containers::ArrayView<const char> vertexData{begin + vertexDataOffset, std::size_t(mesh.vertexDataSize)};
+
+    /* Check the index view */
+    MeshIndexData indices;
+    if(mesh.indexType != MeshIndexType{}) {
+        if(UnsignedByte(mesh.indexType) > UnsignedByte(MeshIndexType::UnsignedInt)) {
+            Error{} << "Trade::MeshData::deserialize(): invalid index type" << mesh.indexType;
+            return {};
+        }
+        /* No overflow possible here, index count is 32-bit */
+        const std::size_t indexSize = std::size_t(mesh.indexCount)*meshIndexTypeSize(mesh.indexType);
+        if(mesh.indexOffset > indexData.size() || indexSize > indexData.size() - mesh.indexOffset) {
+            Error{} << "Trade::MeshData::deserialize(): indices of" << indexSize << "bytes at offset" << mesh.indexOffset << "don't fit into index data of" << indexData.size() << "bytes";
+            return {};
+        }
+        indices = MeshIndexData{mesh.indexType, indexData.slice(std::size_t(mesh.indexOffset), std::size_t(mesh.indexOffset) + indexSize)};
+    } else if(mesh.indexCount) {
+        Error{} << "Trade::MeshData::deserialize(): index count specified for a non-indexed mesh";
+        return {};
+    }
+    if(!mesh.indexCount && mesh.indexDataSize) {
+        Error{} << "Trade::MeshData::deserialize(): index data specified for a mesh with no indices";
+        return {};
+    }
+
+    if(mesh.vertexCount == ImplicitVertexCount) {
+        Error{} << "Trade::MeshData::deserialize(): invalid vertex count" << mesh.vertexCount;
+        return {};
+    }
+
+    /* Check the attributes. The MeshAttributeData and MeshData constructors
+       would assert on these, which is not desirable for external data. */
+    const Containers::ArrayView<const MeshAttributeData> attributes{reinterpret_cast<const MeshAttributeData*>(begin + attributeOffset), mesh.attributeCount};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const MeshAttributeData& attribute = attributes[i];
+        if(!attribute._isOffsetOnly) {
+            Error{} << "Trade::MeshData::deserialize(): attribute" << i << "is not offset-only";
+            return {};
+        }
+        if(attribute._format == VertexFormat{} || (!isVertexFormatImplementationSpecific(attribute._format) && UnsignedInt(attribute._format) > VertexFormatCount)) {
+            Error{} << "Trade::MeshData::deserialize(): invalid format" << attribute._format << "of attribute" << i;
+            return {};
+        }
+        /* ObjectId is the last builtin attribute */
+        if(attribute._name == MeshAttribute{} || (!isMeshAttributeCustom(attribute._name) && UnsignedShort(attribute._name) > UnsignedShort(MeshAttribute::ObjectId))) {
+            Error{} << "Trade::MeshData::deserialize(): invalid name" << attribute._name << "of attribute" << i;
+            return {};
+        }
+        if(!Implementation::isVertexFormatCompatibleWithAttribute(attribute._name, attribute._format)) {
+            Error{} << "Trade::MeshData::deserialize():" << attribute._format << "is not a valid format for" << attribute._name << "attribute" << i;
+            return {};
+        }
+        if(attribute._arraySize && !Implementation::isAttributeArrayAllowed(attribute._name)) {
+            Error{} << "Trade::MeshData::deserialize():" << attribute._name << "attribute" << i << "can't be an array";
+            return {};
+        }
+        if(attribute._arraySize && isVertexFormatImplementationSpecific(attribute._format)) {
+            Error{} << "Trade::MeshData::deserialize(): array attribute" << i << "can't have an implementation-specific format";
+            return {};
+        }
+        if(attribute._vertexCount != mesh.vertexCount) {
+            Error{} << "Trade::MeshData::deserialize(): attribute" << i << "has" << attribute._vertexCount << "vertices but" << mesh.vertexCount << "expected";
+            return {};
+        }
+        if(!mesh.vertexCount) continue;
+
+        /* For implementation-specific formats we don't know the size so use
+           0 to check at least partially, same as in the constructor */
+        const std::size_t typeSize =
+            isVertexFormatImplementationSpecific(attribute._format) ? 0 :
+            vertexFormatSize(attribute._format)*Math::max(attribute._arraySize, UnsignedShort(1));
+        /* Done in 64-bit to avoid overflows on 32-bit platforms. The vertex
+           count is 32-bit and the stride 16-bit, so this can't overflow. */
+        const Long offset = attribute._data.offset;
+        const Long last = Long(mesh.vertexCount - 1)*attribute._stride;
+        if(attribute._data.offset > vertexData.size() ||
+           offset + Math::min(last, Long{}) < 0 ||
+           offset + Math::max(last, Long{}) + Long(typeSize) > Long(vertexData.size())) {
+            Error{} << "Trade::MeshData::deserialize(): attribute" << i << "is not contained in vertex data of" << vertexData.size() << "bytes";
+            return {};
+        }
+    }
+
+    return MeshData{mesh.primitive,
+        DataFlag::ExternallyOwned, indexData, indices,
+        DataFlag::ExternallyOwned, vertexData,
+        meshAttributeDataNonOwningArray(attributes), mesh.vertexCount};
+}
+
+std::size_t MeshData::serializedSize() const {
+    const std::size_t indexDataOffset = Implementation::dataChunkAlign(sizeof(SerializedMesh) + _attributes.size()*sizeof(MeshAttributeData));
+    const std::size_t vertexDataOffset = Implementation::dataChunkAlign(indexDataOffset + _indexData.size());
+    return Implementation::dataChunkAlign(vertexDataOffset + _vertexData.size());
+}
+
+std::size_t MeshData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::MeshData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() >= size,
+        "Trade::MeshData::serializeInto(): expected at least" << size << "bytes but got" << out.size(), {});
+    CORRADE_ASSERT(_attributes.size() <= 0xffff,
+        "Trade::MeshData::serializeInto(): can't serialize more than 65535 attributes, got" << _attributes.size(), {});
+
+    Implementation::dataChunkHeaderSerializeInto(out, DataChunkType::Mesh, size);
+    SerializedMesh& mesh = *reinterpret_cast<SerializedMesh*>(out.data());
+    mesh.vertexCount = _vertexCount;
+    mesh.indexCount = _indexCount;
+    mesh.primitive = _primitive;
+    mesh.indexType = _indexType;
+    mesh.attributeCount = UnsignedShort(_attributes.size());
+    mesh.indexOffset = _indexType == MeshIndexType{} ? 0 : _indices - _indexData.data();
+    mesh.indexDataSize = _indexData.size();
+    mesh.vertexDataSize = _vertexData.size();
+
+    /* Attributes are saved as offset-only so they don't need any pointer
+       fixups when deserializing. Constructing them in-place instead of
+       copying so the padding bytes stay zero-filled. */
+    char* const attributes = out.data() + sizeof(SerializedMesh);
+    for(std::size_t i = 0; i != _attributes.size(); ++i) {
+        const MeshAttributeData& attribute = _attributes[i];
+        new(attributes + i*sizeof(MeshAttributeData)) MeshAttributeData{attribute._name, attribute._format, attributeOffset(i), _vertexCount, attribute._stride, attribute._arraySize};
+    }
+
+    const std::size_t indexDataOffset = Implementation::dataChunkAlign(sizeof(SerializedMesh) + _attributes.size()*sizeof(MeshAttributeData));
+    const std::size_t vertexDataOffset = Implementation::dataChunkAlign(indexDataOffset + _indexData.size());
+    if(!_indexData.empty())
+        std::memcpy(out.data() + indexDataOffset, _indexData.data(), _indexData.size());
+    if(!_vertexData.empty())
+        std::memcpy(out.data() + vertexDataOffset, _vertexData.data(), _vertexData.size());
+
+    return size;
+}
+
+Containers::Array<char> MeshData::serialize() const {
+    /* Everything including padding is overwritten in serializeInto() */
+    Containers::Array<char> out{Containers::NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
 Debug& operator<<(Debug& debug, const MeshAttribute value) {
     debug << "Trade::MeshAttribute" << Debug::nospace;
 
@@ -693,6 +693,26 @@ you can also supply implementation-specific values that are not available in
 the generic @ref MeshPrimitive enum, similarly see also
 @ref Trade-MeshAttributeData-custom-vertex-format for details on
 implementation-specific @ref VertexFormat values.
+
+@section Trade-MeshData-serialization Zero-copy serialization
+
+Using @ref serialize() the mesh can be saved into a binary blob containing
+the index and vertex data together with the attribute table, in the same
+layout as in memory. The @ref deserialize() function then creates an
+instance that directly references the blob instead of parsing it or copying
+the data out --- which is useful for example for assets processed offline
+and then loaded at runtime from a memory-mapped file:
+
+@snippet MagnumTrade.cpp MeshData-serialization
+
+The blob is a data chunk described by @ref DataChunkHeader with
+@ref DataChunkType::Mesh and is only readable on platforms with the same
+endianness and pointer size. Attributes are stored as
+@ref Trade-MeshAttributeData-usage-offset-only "offset-only", so no pointer
+fixups are needed during deserialization. The
+@ref BlobSceneConverter "BlobSceneConverter" and
+@ref BlobImporter "BlobImporter" plugins provide a way to write and read such
+blobs through the generic plugin interfaces.
 @see @ref AbstractImporter::mesh()
 */
 class MAGNUM_TRADE_EXPORT MeshData {
@@ -1764,6 +1784,58 @@ class MAGNUM_TRADE_EXPORT MeshData {
          */
         const void* importerState() const { return _importerState; }
 
+        /**
+         * @brief Deserialize a mesh
+         * @m_since_latest
+         *
+         * Expects that @p data is a @ref DataChunkType::Mesh chunk created
+         * by @ref serialize() or @ref serializeInto() on a platform with the
+         * same endianness and pointer size, aligned to 8 bytes. The returned
+         * instance references @p data directly, with both
+         * @ref indexDataFlags() and @ref vertexDataFlags() being
+         * @ref DataFlag::ExternallyOwned, and thus @p data is expected to
+         * stay in scope for as long as the instance is used. Only the
+         * chunk header and the attribute table is checked, so this function
+         * executes in a time proportional to the attribute count and not the
+         * data size. Prints a message to @relativeref{Magnum,Error} and
+         * returns @relativeref{Corrade,Containers::NullOpt} if the data are
+         * not valid. See @ref Trade-MeshData-serialization for more
+         * information.
+         * @see @ref dataChunkHeaderDeserialize()
+         */
+        static Containers::Optional<MeshData> deserialize(Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Size of serialized data
+         * @m_since_latest
+         *
+         * Size of a data chunk created by @ref serialize() or
+         * @ref serializeInto(), in bytes. Always a multiple of 8.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize to a pre-allocated view
+         * @m_since_latest
+         *
+         * Expects that @p out is aligned to 8 bytes and at least
+         * @ref serializedSize() large. Returns the amount of bytes written,
+         * which is equal to @ref serializedSize(). The remaining space can be
+         * used for further chunks. See @ref Trade-MeshData-serialization for
+         * more information.
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize to a newly allocated array
+         * @m_since_latest
+         *
+         * Allocates a new array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it. See @ref Trade-MeshData-serialization
+         * for more information.
+         */
+        Containers::Array<char> serialize() const;
+
     private:
         /* For custom deleter checks. Not done in the constructors here because
            the restriction is pointless when used outside of plugin
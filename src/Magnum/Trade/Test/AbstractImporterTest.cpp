@@ -71,10 +71,17 @@ struct AbstractImporterTest: TestSuite::Tester {
     void openData();
     void openFileAsData();
     void openFileAsDataNotFound();
+    void openMemory();
+    void openMemoryAsData();
+    void openFileAsMemory();
+    void openFileAsMemoryFailed();
+    void openFileAsMemoryNotFound();
 
     void openFileNotImplemented();
     void openDataNotSupported();
     void openDataNotImplemented();
+    void openMemoryNotSupported();
+    void openMemoryNotImplemented();
     void openStateNotSupported();
     void openStateNotImplemented();
 
@@ -88,6 +95,7 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFileCallbackOpenFileDirectly();
     void setFileCallbackOpenFileThroughBaseImplementation();
     void setFileCallbackOpenFileThroughBaseImplementationFailed();
+    void setFileCallbackOpenFileThroughBaseImplementationAsMemory();
     void setFileCallbackOpenFileAsData();
     void setFileCallbackOpenFileAsDataFailed();
 
@@ -294,10 +302,17 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::openData,
               &AbstractImporterTest::openFileAsData,
               &AbstractImporterTest::openFileAsDataNotFound,
+              &AbstractImporterTest::openMemory,
+              &AbstractImporterTest::openMemoryAsData,
+              &AbstractImporterTest::openFileAsMemory,
+              &AbstractImporterTest::openFileAsMemoryFailed,
+              &AbstractImporterTest::openFileAsMemoryNotFound,
 
               &AbstractImporterTest::openFileNotImplemented,
               &AbstractImporterTest::openDataNotSupported,
               &AbstractImporterTest::openDataNotImplemented,
+              &AbstractImporterTest::openMemoryNotSupported,
+              &AbstractImporterTest::openMemoryNotImplemented,
               &AbstractImporterTest::openStateNotSupported,
               &AbstractImporterTest::openStateNotImplemented,
 
@@ -311,6 +326,7 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFileCallbackOpenFileDirectly,
               &AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementation,
               &AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationFailed,
+              &AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationAsMemory,
               &AbstractImporterTest::setFileCallbackOpenFileAsData,
               &AbstractImporterTest::setFileCallbackOpenFileAsDataFailed,
 
@@ -643,6 +659,131 @@ void AbstractImporterTest::openFileAsDataNotFound() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file nonexistent.bin\n");
 }
 
+void AbstractImporterTest::openMemory() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenMemory; }
+        bool doIsOpened() const override { return memory.data(); }
+        void doClose() override { memory = nullptr; }
+
+        void doOpenMemory(Containers::ArrayView<const char> data) override {
+            memory = data;
+        }
+
+        Containers::ArrayView<const char> memory;
+    } importer;
+
+    /* The memory should be passed through without a copy */
+    CORRADE_VERIFY(!importer.isOpened());
+    const char a5 = '\xa5';
+    CORRADE_VERIFY(importer.openMemory({&a5, 1}));
+    CORRADE_VERIFY(importer.isOpened());
+    CORRADE_COMPARE(importer.memory.data(), &a5);
+    CORRADE_COMPARE(importer.memory.size(), 1);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AbstractImporterTest::openMemoryAsData() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xa5');
+        }
+
+        bool _opened = false;
+    } importer;
+
+    /* openMemory() should call doOpenData() if OpenMemory isn't supported */
+    CORRADE_VERIFY(!importer.isOpened());
+    const char a5 = '\xa5';
+    CORRADE_VERIFY(importer.openMemory({&a5, 1}));
+    CORRADE_VERIFY(importer.isOpened());
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AbstractImporterTest::openFileAsMemory() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenMemory|ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return memory.data(); }
+        void doClose() override { memory = nullptr; }
+
+        void doOpenData(Containers::ArrayView<const char>) override {
+            openDataCalled = true;
+        }
+
+        void doOpenMemory(Containers::ArrayView<const char> data) override {
+            memory = data;
+        }
+
+        Containers::ArrayView<const char> memory;
+        bool openDataCalled = false;
+    } importer;
+
+    /* doOpenFile() should call doOpenMemory() and keep the memory alive until
+       close() */
+    CORRADE_VERIFY(!importer.isOpened());
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+    CORRADE_COMPARE(importer.memory.size(), 1);
+    CORRADE_COMPARE(importer.memory[0], '\xa5');
+
+    /* Opening it again should release the previous memory first */
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_COMPARE(importer.memory.size(), 1);
+    CORRADE_COMPARE(importer.memory[0], '\xa5');
+    CORRADE_VERIFY(!importer.openDataCalled);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AbstractImporterTest::openFileAsMemoryFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenMemory; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        void doOpenMemory(Containers::ArrayView<const char> data) override {
+            called = data.size() == 1 && data[0] == '\xa5';
+        }
+
+        bool called = false;
+    } importer;
+
+    /* The memory gets released right away, nothing to check for that except
+       for ASan / Valgrind not complaining */
+    CORRADE_VERIFY(!importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.called);
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AbstractImporterTest::openFileAsMemoryNotFound() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenMemory; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenMemory(Containers::ArrayView<const char>) override {
+            _opened = true;
+        }
+
+        bool _opened = false;
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.openFile("nonexistent.bin"));
+    CORRADE_VERIFY(!importer.isOpened());
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file nonexistent.bin\n");
+}
+
 void AbstractImporterTest::openFileNotImplemented() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -697,6 +838,42 @@ void AbstractImporterTest::openDataNotImplemented() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openData(): feature advertised but not implemented\n");
 }
 
+void AbstractImporterTest::openMemoryNotSupported() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenState; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.openMemory(nullptr));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openMemory(): feature not supported\n");
+}
+
+void AbstractImporterTest::openMemoryNotImplemented() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenMemory; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.openMemory(nullptr));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openMemory(): feature advertised but not implemented\n");
+}
+
 void AbstractImporterTest::openStateNotSupported() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -983,6 +1160,42 @@ void AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationFaile
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file file.dat\n");
 }
 
+void AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationAsMemory() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::FileCallback|ImporterFeature::OpenMemory; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenMemory(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xb0');
+        }
+
+        bool _opened = false;
+    } importer;
+
+    struct State {
+        const char data = '\xb0';
+        bool loaded = false;
+        bool calledNotSureWhy = false;
+    } state;
+
+    /* The memory has to stay alive until close(), so LoadPermanent is
+       expected to be used */
+    importer.setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(filename == "file.dat" && policy == InputFileCallbackPolicy::LoadPermanent) {
+            state.loaded = true;
+            return Containers::arrayView(&state.data, 1);
+        }
+
+        state.calledNotSureWhy = true;
+        return {};
+    }, state);
+
+    CORRADE_VERIFY(importer.openFile("file.dat"));
+    CORRADE_VERIFY(state.loaded);
+    CORRADE_VERIFY(!state.calledNotSureWhy);
+}
+
 void AbstractImporterTest::setFileCallbackOpenFileAsData() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -24,8 +24,11 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/Quaternion.h"
@@ -63,6 +66,68 @@ struct AnimationDataTest: TestSuite::Tester {
 
     void debugAnimationTrackType();
     void debugAnimationTrackTargetType();
+
+    void serialize();
+    void serializeEmpty();
+    void serializeIntoNotAligned();
+    void serializeIntoTooSmall();
+    void serializeCustomInterpolation();
+    void serializeTrackNotContained();
+    void deserializeCopy();
+    void deserializeInvalid();
+};
+
+/* Fields are accessed by their byte offset in the serialized animation, the
+   fixed-size part after the 24-byte DataChunkHeader and the track table are
+   private */
+template<class T> T& serializedAnimationField(Containers::ArrayView<char> data, std::size_t offset) {
+    return *reinterpret_cast<T*>(data.data() + offset);
+}
+
+const struct {
+    const char* name;
+    void(*modify)(Containers::ArrayView<char>);
+    const char* message;
+} DeserializeInvalidData[]{
+    {"wrong chunk type", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<DataChunkType>(data, 8) = DataChunkType::Mesh;
+        }, "expected a Trade::DataChunkType::Animation chunk but got Trade::DataChunkType::Mesh"},
+    {"tracks out of range", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<UnsignedInt>(data, 32) = 1000;
+        }, "1000 tracks and data of 48 bytes don't fit into a chunk of {} bytes"},
+    {"data out of range", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<UnsignedLong>(data, 40) = 1000;
+        }, "1 tracks and data of 1000 bytes don't fit into a chunk of {} bytes"},
+    {"invalid type", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<AnimationTrackType>(data, 48) = AnimationTrackType(0x7f);
+        }, "invalid type Trade::AnimationTrackType(0x7f) of track 0"},
+    {"invalid result type", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<AnimationTrackType>(data, 49) = AnimationTrackType::Quaternion;
+        }, "invalid result type Trade::AnimationTrackType::Quaternion for Trade::AnimationTrackType::Vector3 track 0"},
+    {"invalid target type", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<AnimationTrackTargetType>(data, 50) = AnimationTrackTargetType(0x7f);
+        }, "invalid target type Trade::AnimationTrackTargetType(0x7f) of track 0"},
+    {"custom interpolation", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Animation::Interpolation>(data, 51) = Animation::Interpolation::Custom;
+        }, "unsupported interpolation Animation::Interpolation::Custom of Trade::AnimationTrackType::Vector3 track 0"},
+    {"spline interpolation of a non-spline type", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Animation::Interpolation>(data, 51) = Animation::Interpolation::Spline;
+        }, "unsupported interpolation Animation::Interpolation::Spline of Trade::AnimationTrackType::Vector3 track 0"},
+    {"invalid before extrapolation", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Animation::Extrapolation>(data, 52) = Animation::Extrapolation(0x7f);
+        }, "invalid before extrapolation Animation::Extrapolation(0x7f) of track 0"},
+    {"invalid after extrapolation", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Animation::Extrapolation>(data, 53) = Animation::Extrapolation(0x7f);
+        }, "invalid after extrapolation Animation::Extrapolation(0x7f) of track 0"},
+    {"keys not contained", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<UnsignedLong>(data, 72) = 40;
+        }, "keys of track 0 are not contained in data of 48 bytes"},
+    {"keys not contained with a negative stride", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Int>(data, 64) = -16;
+        }, "keys of track 0 are not contained in data of 48 bytes"},
+    {"values not contained", [](Containers::ArrayView<char> data) {
+            serializedAnimationField<Int>(data, 68) = 20;
+        }, "values of track 0 are not contained in data of 48 bytes"}
 };
 
 struct {
@@ -103,7 +168,18 @@ AnimationDataTest::AnimationDataTest() {
               &AnimationDataTest::release,
 
               &AnimationDataTest::debugAnimationTrackType,
-              &AnimationDataTest::debugAnimationTrackTargetType});
+              &AnimationDataTest::debugAnimationTrackTargetType,
+
+              &AnimationDataTest::serialize,
+              &AnimationDataTest::serializeEmpty,
+              &AnimationDataTest::serializeIntoNotAligned,
+              &AnimationDataTest::serializeIntoTooSmall,
+              &AnimationDataTest::serializeCustomInterpolation,
+              &AnimationDataTest::serializeTrackNotContained,
+              &AnimationDataTest::deserializeCopy});
+
+    addInstancedTests({&AnimationDataTest::deserializeInvalid},
+        Containers::arraySize(DeserializeInvalidData));
 }
 
 using namespace Math::Literals;
@@ -668,6 +744,243 @@ void AnimationDataTest::debugAnimationTrackTargetType() {
     CORRADE_COMPARE(out.str(), "Trade::AnimationTrackTargetType::Rotation3D Trade::AnimationTrackTargetType::Custom(135) Trade::AnimationTrackTargetType(0x42)\n");
 }
 
+struct SerializeData {
+    Float time;
+    Vector3 position;
+    Quaternion rotation;
+    CubicHermite1D scale;
+};
+
+AnimationData serializeAnimation() {
+    Containers::Array<char> buffer{sizeof(SerializeData)*3};
+    auto view = Containers::arrayCast<SerializeData>(buffer);
+    view[0] = {0.0f, {3.0f, 1.0f, 0.1f}, Quaternion::rotation(45.0_degf, Vector3::yAxis()), {0.0f, 1.0f, 2.0f}};
+    view[1] = {5.0f, {0.3f, 0.6f, 1.0f}, Quaternion::rotation(20.0_degf, Vector3::yAxis()), {0.0f, 3.0f, 0.0f}};
+    view[2] = {7.5f, {1.0f, 0.3f, 2.1f}, Quaternion{}, {0.0f, 5.0f, 0.0f}};
+
+    /* The rotation track has the values in reverse order, with a negative
+       stride */
+    return AnimationData{std::move(buffer), {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 42,
+            Animation::TrackView<const Float, const Vector3>{
+                {view, &view[0].time, view.size(), sizeof(SerializeData)},
+                {view, &view[0].position, view.size(), sizeof(SerializeData)},
+                Animation::Interpolation::Constant,
+                animationInterpolatorFor<Vector3>(Animation::Interpolation::Constant),
+                Animation::Extrapolation::Extrapolated,
+                Animation::Extrapolation::DefaultConstructed}},
+        AnimationTrackData{AnimationTrackTargetType::Rotation3D, 1337,
+            Animation::TrackView<const Float, const Quaternion>{
+                {view, &view[0].time, view.size(), sizeof(SerializeData)},
+                Containers::StridedArrayView1D<const Quaternion>{view, &view[0].rotation, view.size(), sizeof(SerializeData)}.flipped<0>(),
+                Animation::Interpolation::Linear,
+                animationInterpolatorFor<Quaternion>(Animation::Interpolation::Linear)}},
+        AnimationTrackData{AnimationTrackTargetType(135), 7,
+            Animation::TrackView<const Float, const CubicHermite1D>{
+                {view, &view[0].time, view.size(), sizeof(SerializeData)},
+                {view, &view[0].scale, view.size(), sizeof(SerializeData)},
+                Animation::Interpolation::Spline,
+                animationInterpolatorFor<CubicHermite1D>(Animation::Interpolation::Spline)}},
+        }, {-1.0f, 7.0f}};
+}
+
+void AnimationDataTest::serialize() {
+    AnimationData data = serializeAnimation();
+
+    const std::size_t size = data.serializedSize();
+    CORRADE_COMPARE(size % 8, 0);
+
+    /* Extra space at the end is left untouched */
+    Containers::Array<char> out{Containers::DirectInit, size + 8, '\x7f'};
+    CORRADE_COMPARE(data.serializeInto(out), size);
+    CORRADE_COMPARE_AS(out.suffix(size),
+        Containers::arrayView<char>({'\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f'}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(data.serialize().size(), size);
+
+    Containers::Optional<AnimationData> deserialized = AnimationData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(deserialized->duration(), (Range1D{-1.0f, 7.0f}));
+    /* Importer state is not serialized */
+    CORRADE_COMPARE(deserialized->importerState(), nullptr);
+
+    /* The data should point into the blob */
+    CORRADE_VERIFY(deserialized->data().begin() > out.begin());
+    CORRADE_VERIFY(deserialized->data().end() <= out.end() - 8);
+    CORRADE_COMPARE(deserialized->data().size(), sizeof(SerializeData)*3);
+    CORRADE_COMPARE(deserialized->trackCount(), 3);
+
+    {
+        CORRADE_COMPARE(deserialized->trackType(0), AnimationTrackType::Vector3);
+        CORRADE_COMPARE(deserialized->trackResultType(0), AnimationTrackType::Vector3);
+        CORRADE_COMPARE(deserialized->trackTargetType(0), AnimationTrackTargetType::Translation3D);
+        CORRADE_COMPARE(deserialized->trackTarget(0), 42);
+
+        Animation::TrackView<const Float, const Vector3> track = deserialized->track<Vector3>(0);
+        CORRADE_COMPARE(static_cast<const void*>(track.keys().data()), deserialized->data().data());
+        CORRADE_COMPARE(track.keys().size(), 3);
+        CORRADE_COMPARE(track.values().size(), 3);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Constant);
+        CORRADE_VERIFY(track.interpolator() == animationInterpolatorFor<Vector3>(Animation::Interpolation::Constant));
+        CORRADE_COMPARE(track.before(), Animation::Extrapolation::Extrapolated);
+        CORRADE_COMPARE(track.after(), Animation::Extrapolation::DefaultConstructed);
+        CORRADE_COMPARE(track.at(2.5f), (Vector3{3.0f, 1.0f, 0.1f}));
+        CORRADE_COMPARE(track.at(10.0f), Vector3{});
+    } {
+        CORRADE_COMPARE(deserialized->trackType(1), AnimationTrackType::Quaternion);
+        CORRADE_COMPARE(deserialized->trackResultType(1), AnimationTrackType::Quaternion);
+        CORRADE_COMPARE(deserialized->trackTargetType(1), AnimationTrackTargetType::Rotation3D);
+        CORRADE_COMPARE(deserialized->trackTarget(1), 1337);
+
+        Animation::TrackView<const Float, const Quaternion> track = deserialized->track<Quaternion>(1);
+        CORRADE_COMPARE(track.values().stride(), -std::ptrdiff_t(sizeof(SerializeData)));
+        CORRADE_COMPARE(track.values()[0], Quaternion{});
+        CORRADE_COMPARE(track.values()[2], Quaternion::rotation(45.0_degf, Vector3::yAxis()));
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Linear);
+        CORRADE_VERIFY(track.interpolator() == animationInterpolatorFor<Quaternion>(Animation::Interpolation::Linear));
+        CORRADE_COMPARE(track.at(2.5f), Quaternion::rotation(10.0_degf, Vector3::yAxis()));
+    } {
+        CORRADE_COMPARE(deserialized->trackType(2), AnimationTrackType::CubicHermite1D);
+        CORRADE_COMPARE(deserialized->trackResultType(2), AnimationTrackType::Float);
+        CORRADE_COMPARE(deserialized->trackTargetType(2), AnimationTrackTargetType(135));
+        CORRADE_COMPARE(deserialized->trackTarget(2), 7);
+
+        Animation::TrackView<const Float, const CubicHermite1D> track = deserialized->track<CubicHermite1D>(2);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Spline);
+        CORRADE_VERIFY(track.interpolator() == animationInterpolatorFor<CubicHermite1D>(Animation::Interpolation::Spline));
+        CORRADE_COMPARE(track.at(5.0f), 3.0f);
+    }
+}
+
+void AnimationDataTest::serializeEmpty() {
+    AnimationData data{nullptr, Containers::Array<AnimationTrackData>{}, {1.0f, 2.0f}};
+    CORRADE_COMPARE(data.serializedSize(), 48);
+
+    Containers::Array<char> out = data.serialize();
+    CORRADE_COMPARE(out.size(), 48);
+
+    Containers::Optional<AnimationData> deserialized = AnimationData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->duration(), (Range1D{1.0f, 2.0f}));
+    CORRADE_COMPARE(deserialized->trackCount(), 0);
+    CORRADE_COMPARE(deserialized->data().size(), 0);
+}
+
+void AnimationDataTest::serializeIntoNotAligned() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    AnimationData data{nullptr, Containers::Array<AnimationTrackData>{}};
+
+    Containers::Array<char> out{Containers::ValueInit, 56};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out.suffix(4));
+    CORRADE_COMPARE(outStream.str(), "Trade::AnimationData::serializeInto(): data not aligned to 8 bytes\n");
+}
+
+void AnimationDataTest::serializeIntoTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    AnimationData data{nullptr, Containers::Array<AnimationTrackData>{}};
+
+    Containers::Array<char> out{Containers::ValueInit, 40};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out);
+    CORRADE_COMPARE(outStream.str(), "Trade::AnimationData::serializeInto(): expected at least 48 bytes but got 40\n");
+}
+
+void AnimationDataTest::serializeCustomInterpolation() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<char> buffer{sizeof(std::pair<Float, Vector3>)*2};
+    auto view = Containers::arrayCast<std::pair<Float, Vector3>>(buffer);
+    AnimationData data{std::move(buffer), {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 0,
+            Animation::TrackView<const Float, const Vector3>{view,
+                [](const Vector3& a, const Vector3&, Float) { return a; }}}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.serialize();
+    CORRADE_COMPARE(out.str(), "Trade::AnimationData::serializeInto(): can't serialize Animation::Interpolation::Custom interpolation of Trade::AnimationTrackType::Vector3 track 0\n");
+}
+
+void AnimationDataTest::serializeTrackNotContained() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const std::pair<Float, Vector3> keyframes[]{
+        {0.0f, {3.0f, 1.0f, 0.1f}},
+        {5.0f, {0.3f, 0.6f, 1.0f}}
+    };
+    AnimationData data{Containers::Array<char>{sizeof(keyframes)}, {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 0,
+            Animation::TrackView<const Float, const Vector3>{keyframes,
+                Animation::Interpolation::Linear,
+                animationInterpolatorFor<Vector3>(Animation::Interpolation::Linear)}}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.serialize();
+    CORRADE_COMPARE(out.str(), "Trade::AnimationData::serializeInto(): track 0 is not contained in the data array\n");
+}
+
+void AnimationDataTest::deserializeCopy() {
+    Containers::Array<char> out = serializeAnimation().serialize();
+
+    Containers::Optional<AnimationData> deserialized = Implementation::animationDataDeserializeCopy(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(deserialized->duration(), (Range1D{-1.0f, 7.0f}));
+    CORRADE_COMPARE(deserialized->data().size(), sizeof(SerializeData)*3);
+    CORRADE_VERIFY(deserialized->data().end() <= out.begin() || deserialized->data().begin() >= out.end());
+
+    /* The tracks point to the copy */
+    CORRADE_COMPARE(deserialized->trackCount(), 3);
+    Animation::TrackView<const Float, const Quaternion> track = deserialized->track<Quaternion>(1);
+    CORRADE_VERIFY(static_cast<const void*>(track.keys().data()) >= deserialized->data().begin());
+    CORRADE_VERIFY(static_cast<const void*>(track.keys().data()) < deserialized->data().end());
+    CORRADE_COMPARE(track.at(2.5f), Quaternion::rotation(10.0_degf, Vector3::yAxis()));
+}
+
+void AnimationDataTest::deserializeInvalid() {
+    auto&& data = DeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::pair<Float, Vector3> keyframes[]{
+        {0.0f, {3.0f, 1.0f, 0.1f}},
+        {5.0f, {0.3f, 0.6f, 1.0f}},
+        {7.5f, {1.0f, 0.3f, 2.1f}}
+    };
+    Containers::Array<char> out = AnimationData{{}, keyframes, {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 0,
+            Animation::TrackView<const Float, const Vector3>{
+                Containers::arrayView(keyframes),
+                Animation::Interpolation::Linear,
+                animationInterpolatorFor<Vector3>(Animation::Interpolation::Linear)}}
+    }}.serialize();
+    data.modify(out);
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    CORRADE_VERIFY(!AnimationData::deserialize(out));
+    CORRADE_COMPARE(outStream.str(), Utility::formatString(
+        "Trade::AnimationData::deserialize(): {}\n", Utility::formatString(data.message, out.size())));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AnimationDataTest)
@@ -24,8 +24,10 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Trade/Data.h"
 
@@ -36,11 +38,65 @@ struct DataTest: TestSuite::Tester {
 
     void debugDataFlag();
     void debugDataFlags();
+
+    void debugDataChunkType();
+
+    void dataChunkHeaderDeserialize();
+    void dataChunkHeaderDeserializeNotAligned();
+    void dataChunkHeaderDeserializeInvalid();
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    void(*modify)(DataChunkHeader&);
+    const char* message;
+} DataChunkHeaderDeserializeInvalidData[]{
+    {"too short", 23, [](DataChunkHeader&) {},
+        "expected at least 24 bytes for a header but got 23"},
+    {"invalid signature", 32, [](DataChunkHeader& header) {
+            header.signature[2] = 'r';
+        }, "invalid signature BLrB"},
+    {"unsupported version", 32, [](DataChunkHeader& header) {
+            header.version = 1;
+        }, "unsupported header version 1"},
+    {"different endianness", 32, [](DataChunkHeader& header) {
+            header.byteOrderMark = 0xfffe;
+        },
+        #ifndef CORRADE_TARGET_BIG_ENDIAN
+        "expected a little-endian chunk but got a big-endian one"
+        #else
+        "expected a big-endian chunk but got a little-endian one"
+        #endif
+        },
+    {"different pointer size", 32, [](DataChunkHeader& header) {
+            header.pointerSize = sizeof(std::size_t) == 8 ? 4 : 8;
+        },
+        #ifndef CORRADE_TARGET_32BIT
+        "expected a 64-bit chunk but got a 32-bit one"
+        #else
+        "expected a 32-bit chunk but got a 64-bit one"
+        #endif
+        },
+    {"chunk too small", 32, [](DataChunkHeader& header) {
+            header.size = 16;
+        }, "expected a chunk of at least 24 and at most 32 bytes but got 16"},
+    {"chunk too large", 32, [](DataChunkHeader& header) {
+            header.size = 40;
+        }, "expected a chunk of at least 24 and at most 32 bytes but got 40"}
 };
 
 DataTest::DataTest() {
     addTests({&DataTest::debugDataFlag,
-              &DataTest::debugDataFlags});
+              &DataTest::debugDataFlags,
+
+              &DataTest::debugDataChunkType,
+
+              &DataTest::dataChunkHeaderDeserialize,
+              &DataTest::dataChunkHeaderDeserializeNotAligned});
+
+    addInstancedTests({&DataTest::dataChunkHeaderDeserializeInvalid},
+        Containers::arraySize(DataChunkHeaderDeserializeInvalidData));
 }
 
 void DataTest::debugDataFlag() {
@@ -53,8 +109,56 @@ void DataTest::debugDataFlag() {
 void DataTest::debugDataFlags() {
     std::ostringstream out;
 
-    Debug{&out} << (DataFlag::Owned|DataFlag::Mutable) << DataFlags{};
-    CORRADE_COMPARE(out.str(), "Trade::DataFlag::Owned|Trade::DataFlag::Mutable Trade::DataFlags{}\n");
+    Debug{&out} << (DataFlag::Owned|DataFlag::Mutable) << (DataFlag::ExternallyOwned|DataFlag::Mutable) << DataFlags{};
+    CORRADE_COMPARE(out.str(), "Trade::DataFlag::Owned|Trade::DataFlag::Mutable Trade::DataFlag::Mutable|Trade::DataFlag::ExternallyOwned Trade::DataFlags{}\n");
+}
+
+void DataTest::debugDataChunkType() {
+    std::ostringstream out;
+
+    Debug{&out} << DataChunkType::Image2D << DataChunkType(0xdeadbeef);
+    CORRADE_COMPARE(out.str(), "Trade::DataChunkType::Image2D Trade::DataChunkType(0xdeadbeef)\n");
+}
+
+void DataTest::dataChunkHeaderDeserialize() {
+    CORRADE_ALIGNAS(8) char data[40];
+    Implementation::dataChunkHeaderSerializeInto(data, DataChunkType::Material, 32);
+
+    /* Trailing data after the chunk are ignored */
+    const DataChunkHeader* header = Trade::dataChunkHeaderDeserialize(data);
+    CORRADE_VERIFY(header);
+    CORRADE_COMPARE(static_cast<const void*>(header), data);
+    CORRADE_COMPARE(std::string(header->signature, 4), "BLOB");
+    CORRADE_COMPARE(header->version, 0);
+    CORRADE_COMPARE(header->pointerSize, sizeof(std::size_t));
+    CORRADE_COMPARE(header->byteOrderMark, 0xfeff);
+    CORRADE_COMPARE(header->type, DataChunkType::Material);
+    CORRADE_COMPARE(header->typeVersion, 0);
+    CORRADE_COMPARE(header->size, 32);
+}
+
+void DataTest::dataChunkHeaderDeserializeNotAligned() {
+    CORRADE_ALIGNAS(8) char data[40];
+    Implementation::dataChunkHeaderSerializeInto(data, DataChunkType::Mesh, 32);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(Containers::arrayView(data).suffix(4)));
+    CORRADE_COMPARE(out.str(), "Trade::dataChunkHeaderDeserialize(): data not aligned to 8 bytes\n");
+}
+
+void DataTest::dataChunkHeaderDeserializeInvalid() {
+    auto&& data = DataChunkHeaderDeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_ALIGNAS(8) char chunk[32];
+    Implementation::dataChunkHeaderSerializeInto(chunk, DataChunkType::Mesh, 32);
+    data.modify(*reinterpret_cast<DataChunkHeader*>(chunk));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(Containers::arrayView(chunk).prefix(data.size)));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Trade::dataChunkHeaderDeserialize(): {}\n", data.message));
 }
 
 }}}}
@@ -29,8 +29,10 @@
 #include "Magnum/Trade/ImageData.h"
 
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/ImageView.h"
@@ -87,6 +89,50 @@ struct ImageDataTest: TestSuite::Tester {
     void pixels2D();
     void pixels3D();
     void pixelsCompressed();
+
+    void serialize();
+    void serializeCompressed();
+    void serializeIntoNotAligned();
+    void serializeIntoTooSmall();
+    void deserializeInvalid();
+};
+
+/* Fields are accessed by their byte offset in the serialized image, the
+   fixed-size part after the 24-byte DataChunkHeader is private */
+template<class T> T& serializedImageField(Containers::ArrayView<char> data, std::size_t offset) {
+    return *reinterpret_cast<T*>(data.data() + offset);
+}
+
+const struct {
+    const char* name;
+    void(*modify)(Containers::ArrayView<char>);
+    const char* message;
+} DeserializeInvalidData[]{
+    {"wrong chunk type", [](Containers::ArrayView<char> data) {
+            serializedImageField<DataChunkType>(data, 8) = DataChunkType::Image3D;
+        }, "expected a Trade::DataChunkType::Image2D chunk but got Trade::DataChunkType::Image3D"},
+    {"data out of range", [](Containers::ArrayView<char> data) {
+            serializedImageField<UnsignedLong>(data, 96) = 1000;
+        }, "data of 1000 bytes don't fit into a chunk of 136 bytes"},
+    {"unused dimension not zero", [](Containers::ArrayView<char> data) {
+            serializedImageField<Int>(data, 48) = 1;
+        }, "invalid size Vector(2, 3, 1) or storage parameters"},
+    {"negative skip", [](Containers::ArrayView<char> data) {
+            serializedImageField<Int>(data, 68) = -1;
+        }, "invalid size Vector(2, 3, 0) or storage parameters"},
+    {"invalid alignment", [](Containers::ArrayView<char> data) {
+            serializedImageField<Int>(data, 52) = 3;
+        }, "invalid alignment 3"},
+    {"invalid pixel size", [](Containers::ArrayView<char> data) {
+            serializedImageField<UnsignedInt>(data, 36) = 0;
+        }, "invalid pixel size 0"},
+    {"too large", [](Containers::ArrayView<char> data) {
+            serializedImageField<Int>(data, 40) = 0x7fffffff;
+            serializedImageField<Int>(data, 44) = 0x7fffffff;
+        }, "image of size Vector(2147483647, 2147483647, 0) is too large"},
+    {"data too small", [](Containers::ArrayView<char> data) {
+            serializedImageField<Int>(data, 44) = 4;
+        }, "expected at least 36 bytes of data for an image of size Vector(2, 4, 0) but got 32"}
 };
 
 template<class> struct MutabilityTraits;
@@ -160,7 +206,15 @@ ImageDataTest::ImageDataTest() {
               &ImageDataTest::pixels1D,
               &ImageDataTest::pixels2D,
               &ImageDataTest::pixels3D,
-              &ImageDataTest::pixelsCompressed});
+              &ImageDataTest::pixelsCompressed,
+
+              &ImageDataTest::serialize,
+              &ImageDataTest::serializeCompressed,
+              &ImageDataTest::serializeIntoNotAligned,
+              &ImageDataTest::serializeIntoTooSmall});
+
+    addInstancedTests({&ImageDataTest::deserializeInvalid},
+        Containers::arraySize(DeserializeInvalidData));
 }
 
 namespace GL {
@@ -1105,6 +1159,118 @@ void ImageDataTest::pixelsCompressed() {
     CORRADE_COMPARE(out.str(), "Trade::ImageData::pixels(): the image is compressed\n");
 }
 
+void ImageDataTest::serialize() {
+    /* Custom row length, skip and alignment to verify the storage is
+       preserved as well */
+    Containers::Array<char> data{32};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = i;
+    const void* const importerState = &data;
+    ImageData2D image{PixelStorage{}.setAlignment(1).setRowLength(3).setSkip({1, 0, 0}), PixelFormat::RGB8Unorm, {2, 3}, std::move(data), importerState};
+
+    const std::size_t size = image.serializedSize();
+    CORRADE_COMPARE(size, 136);
+
+    /* Extra space at the end is left untouched */
+    Containers::Array<char> out{Containers::DirectInit, size + 8, '\x7f'};
+    CORRADE_COMPARE(image.serializeInto(out), size);
+    CORRADE_COMPARE_AS(out.suffix(size),
+        Containers::arrayView<char>({'\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f'}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(image.serialize().size(), size);
+
+    Containers::Optional<ImageData2D> deserialized = ImageData2D::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_VERIFY(!deserialized->isCompressed());
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlag::ExternallyOwned);
+    /* Importer state is not serialized */
+    CORRADE_COMPARE(deserialized->importerState(), nullptr);
+    CORRADE_COMPARE(deserialized->storage().alignment(), 1);
+    CORRADE_COMPARE(deserialized->storage().rowLength(), 3);
+    CORRADE_COMPARE(deserialized->storage().skip(), (Vector3i{1, 0, 0}));
+    CORRADE_COMPARE(deserialized->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(deserialized->pixelSize(), 3);
+    CORRADE_COMPARE(deserialized->size(), (Vector2i{2, 3}));
+
+    /* The data should point into the blob */
+    CORRADE_COMPARE(static_cast<const void*>(deserialized->data().data()), out.data() + 104);
+    CORRADE_COMPARE(deserialized->data().size(), 32);
+    CORRADE_COMPARE(deserialized->pixels<Color3ub>()[0][0], (Color3ub{3, 4, 5}));
+    CORRADE_COMPARE(deserialized->pixels<Color3ub>()[2][1], (Color3ub{24, 25, 26}));
+}
+
+void ImageDataTest::serializeCompressed() {
+    Containers::Array<char> data{Containers::DirectInit, 16, '\x3a'};
+    ImageData3D image{CompressedPixelStorage{}
+        .setCompressedBlockSize({4, 4, 1})
+        .setCompressedBlockDataSize(8),
+        CompressedPixelFormat::Bc1RGBAUnorm, {4, 4, 2}, std::move(data)};
+
+    Containers::Array<char> out = image.serialize();
+    CORRADE_COMPARE(out.size(), 120);
+
+    Containers::Optional<ImageData3D> deserialized = ImageData3D::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_VERIFY(deserialized->isCompressed());
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(deserialized->compressedStorage().compressedBlockSize(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(deserialized->compressedStorage().compressedBlockDataSize(), 8);
+    CORRADE_COMPARE(deserialized->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(deserialized->size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE(static_cast<const void*>(deserialized->data().data()), out.data() + 104);
+    CORRADE_COMPARE_AS(deserialized->data(),
+        Containers::arrayView<char>({'\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a', '\x3a'}),
+        TestSuite::Compare::Container);
+
+    /* A different dimension count is rejected */
+    std::ostringstream out2;
+    Error redirectError{&out2};
+    CORRADE_VERIFY(!ImageData2D::deserialize(out));
+    CORRADE_COMPARE(out2.str(), "Trade::ImageData::deserialize(): expected a Trade::DataChunkType::Image2D chunk but got Trade::DataChunkType::Image3D\n");
+}
+
+void ImageDataTest::serializeIntoNotAligned() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImageData2D image{PixelFormat::RGBA8Unorm, {1, 1}, Containers::Array<char>{4}};
+
+    Containers::Array<char> out{Containers::ValueInit, 120};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    image.serializeInto(out.suffix(4));
+    CORRADE_COMPARE(outStream.str(), "Trade::ImageData::serializeInto(): data not aligned to 8 bytes\n");
+}
+
+void ImageDataTest::serializeIntoTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImageData2D image{PixelFormat::RGBA8Unorm, {1, 1}, Containers::Array<char>{4}};
+
+    Containers::Array<char> out{Containers::ValueInit, 104};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    image.serializeInto(out);
+    CORRADE_COMPARE(outStream.str(), "Trade::ImageData::serializeInto(): expected at least 112 bytes but got 104\n");
+}
+
+void ImageDataTest::deserializeInvalid() {
+    auto&& data = DeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> out = ImageData2D{PixelStorage{}.setAlignment(1).setRowLength(3).setSkip({1, 0, 0}), PixelFormat::RGB8Unorm, {2, 3}, Containers::Array<char>{Containers::ValueInit, 32}}.serialize();
+    data.modify(out);
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    CORRADE_VERIFY(!ImageData2D::deserialize(out));
+    CORRADE_COMPARE(outStream.str(), std::string{"Trade::ImageData::deserialize(): "} + data.message + "\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageDataTest)
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StringStl.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -141,6 +142,13 @@ class MaterialDataTest: public TestSuite::Tester {
 
         void templateLayerAccess();
 
+        void serialize();
+        void serializeNoLayers();
+        void serializeIntoNotAligned();
+        void serializeIntoTooSmall();
+        void serializePointer();
+        void deserializeInvalid();
+
         void debugLayer();
         void debugAttribute();
         void debugTextureSwizzle();
@@ -155,6 +163,33 @@ class MaterialDataTest: public TestSuite::Tester {
         void debugAlphaMode();
 };
 
+/* The fixed-size part of a serialized material is 40 bytes, followed by
+   64-byte attributes and 4-byte layer offsets */
+const struct {
+    const char* name;
+    void(*modify)(Containers::ArrayView<char>);
+    const char* message;
+} DeserializeInvalidData[]{
+    {"attributes out of range", [](Containers::ArrayView<char> data) {
+            *reinterpret_cast<UnsignedInt*>(data.data() + 28) = 1000;
+        }, "1000 attributes and 2 layers don't fit into a chunk of 304 bytes"},
+    {"invalid attribute type", [](Containers::ArrayView<char> data) {
+            data[40 + 64] = 0x7f;
+        }, "invalid type Trade::MaterialAttributeType(0x7f) of attribute 1"},
+    {"pointer attribute type", [](Containers::ArrayView<char> data) {
+            data[40 + 64] = char(MaterialAttributeType::Pointer);
+        }, "invalid type Trade::MaterialAttributeType::Pointer of attribute 1"},
+    {"empty attribute name", [](Containers::ArrayView<char> data) {
+            data[40 + 1] = '\0';
+        }, "invalid name of attribute 0"},
+    {"invalid layer range", [](Containers::ArrayView<char> data) {
+            *reinterpret_cast<UnsignedInt*>(data.data() + 40 + 4*64) = 5;
+        }, "invalid range (0, 5) for layer 0 with 4 attributes in total"},
+    {"attributes not sorted", [](Containers::ArrayView<char> data) {
+            std::swap_ranges(data.data() + 40, data.data() + 40 + 64, data.data() + 40 + 64);
+        }, "attributes in layer 0 are not sorted or contain duplicates"}
+};
+
 MaterialDataTest::MaterialDataTest() {
     addTests({&MaterialDataTest::textureSwizzleComponentCount,
 
@@ -277,7 +312,16 @@ MaterialDataTest::MaterialDataTest() {
 
               &MaterialDataTest::templateLayerAccess,
 
-              &MaterialDataTest::debugLayer,
+              &MaterialDataTest::serialize,
+              &MaterialDataTest::serializeNoLayers,
+              &MaterialDataTest::serializeIntoNotAligned,
+              &MaterialDataTest::serializeIntoTooSmall,
+              &MaterialDataTest::serializePointer});
+
+    addInstancedTests({&MaterialDataTest::deserializeInvalid},
+        Containers::arraySize(DeserializeInvalidData));
+
+    addTests({&MaterialDataTest::debugLayer,
               &MaterialDataTest::debugAttribute,
               &MaterialDataTest::debugTextureSwizzle,
               &MaterialDataTest::debugAttributeType,
@@ -2431,6 +2475,126 @@ void MaterialDataTest::templateLayerAccess() {
     CORRADE_COMPARE(data.attributeOr("LayerFactorTexture", 5u), 3);
 }
 
+void MaterialDataTest::serialize() {
+    int state;
+    MaterialData data{MaterialType::Phong|MaterialType::PbrClearCoat, {
+        {MaterialAttribute::DoubleSided, true},
+        {MaterialAttribute::DiffuseTextureCoordinates, 5u},
+
+        {MaterialLayer::ClearCoat},
+        {"thickness", 0.015f}
+    }, {2, 4}, &state};
+
+    const std::size_t size = data.serializedSize();
+    CORRADE_COMPARE(size, 304);
+
+    /* Extra space at the end is left untouched */
+    Containers::Array<char> out{Containers::DirectInit, size + 8, '\x7f'};
+    CORRADE_COMPARE(data.serializeInto(out), size);
+    CORRADE_COMPARE(out[size], '\x7f');
+    CORRADE_COMPARE(out[size + 7], '\x7f');
+    CORRADE_COMPARE(data.serialize().size(), size);
+
+    Containers::Optional<MaterialData> deserialized = MaterialData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->types(), MaterialType::Phong|MaterialType::PbrClearCoat);
+    /* Importer state is not serialized */
+    CORRADE_COMPARE(deserialized->importerState(), nullptr);
+
+    /* The data should point into the blob */
+    CORRADE_COMPARE(static_cast<const void*>(deserialized->attributeData().data()), out.data() + 40);
+    CORRADE_COMPARE(static_cast<const void*>(deserialized->layerData().data()), out.data() + 40 + 4*64);
+
+    CORRADE_COMPARE(deserialized->layerCount(), 2);
+    CORRADE_COMPARE(deserialized->attributeCount(0), 2);
+    CORRADE_COMPARE(deserialized->attributeCount(1), 2);
+    CORRADE_VERIFY(deserialized->isDoubleSided());
+    CORRADE_COMPARE(deserialized->attribute<UnsignedInt>(MaterialAttribute::DiffuseTextureCoordinates), 5);
+    CORRADE_COMPARE(deserialized->layerName(1), "ClearCoat");
+    CORRADE_COMPARE(deserialized->attribute<Float>(MaterialLayer::ClearCoat, "thickness"), 0.015f);
+}
+
+void MaterialDataTest::serializeNoLayers() {
+    MaterialData data{MaterialType::Flat, {
+        {MaterialAttribute::BaseColor, 0x335566ff_rgbaf}
+    }};
+
+    Containers::Array<char> out = data.serialize();
+    CORRADE_COMPARE(out.size(), 104);
+
+    Containers::Optional<MaterialData> deserialized = MaterialData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->types(), MaterialType::Flat);
+    CORRADE_COMPARE(deserialized->layerCount(), 1);
+    CORRADE_COMPARE(deserialized->layerData().data(), nullptr);
+    CORRADE_COMPARE(deserialized->attribute<Color4>(MaterialAttribute::BaseColor), 0x335566ff_rgbaf);
+}
+
+void MaterialDataTest::serializeIntoNotAligned() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MaterialData data{{}, {}};
+
+    Containers::Array<char> out{Containers::ValueInit, 48};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out.suffix(4));
+    CORRADE_COMPARE(outStream.str(), "Trade::MaterialData::serializeInto(): data not aligned to 8 bytes\n");
+}
+
+void MaterialDataTest::serializeIntoTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MaterialData data{{}, {}};
+
+    Containers::Array<char> out{Containers::ValueInit, 32};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out);
+    CORRADE_COMPARE(outStream.str(), "Trade::MaterialData::serializeInto(): expected at least 40 bytes but got 32\n");
+}
+
+void MaterialDataTest::serializePointer() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MaterialData data{{}, {
+        {MaterialAttribute::DoubleSided, true},
+        {"pointer!", &SomeData}
+    }};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serialize();
+    CORRADE_COMPARE(outStream.str(), "Trade::MaterialData::serializeInto(): can't serialize a Trade::MaterialAttributeType::Pointer attribute pointer!\n");
+}
+
+void MaterialDataTest::deserializeInvalid() {
+    auto&& data = DeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> out = MaterialData{MaterialType::PbrClearCoat, {
+        {MaterialAttribute::DoubleSided, true},
+        {MaterialAttribute::DiffuseTextureCoordinates, 5u},
+
+        {MaterialLayer::ClearCoat},
+        {"thickness", 0.015f}
+    }, {2, 4}}.serialize();
+    data.modify(out);
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    CORRADE_VERIFY(!MaterialData::deserialize(out));
+    CORRADE_COMPARE(outStream.str(), std::string{"Trade::MaterialData::deserialize(): "} + data.message + "\n");
+}
+
 void MaterialDataTest::debugLayer() {
     std::ostringstream out;
 
@@ -24,9 +24,11 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Half.h"
@@ -167,6 +169,69 @@ struct MeshDataTest: TestSuite::Tester {
     void releaseIndexData();
     void releaseAttributeData();
     void releaseVertexData();
+
+    void serialize();
+    void serializeNotIndexed();
+    void serializeIntoNotAligned();
+    void serializeIntoTooSmall();
+    void deserializeInvalid();
+};
+
+/* Fields are accessed by their byte offset in the serialized mesh, the
+   fixed-size part after the 24-byte DataChunkHeader is private */
+template<class T> T& serializedMeshField(Containers::ArrayView<char> data, std::size_t offset) {
+    return *reinterpret_cast<T*>(data.data() + offset);
+}
+
+const struct {
+    const char* name;
+    void(*modify)(Containers::ArrayView<char>);
+    const char* message;
+} DeserializeInvalidData[]{
+    {"wrong chunk type", [](Containers::ArrayView<char> data) {
+            serializedMeshField<DataChunkType>(data, 8) = DataChunkType::Image2D;
+        }, "expected a Trade::DataChunkType::Mesh chunk but got Trade::DataChunkType::Image2D"},
+    {"index data out of range", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedLong>(data, 48) = 1000;
+        }, "index data of 1000 bytes and 1 attributes don't fit into a chunk of {} bytes"},
+    {"vertex data out of range", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedLong>(data, 56) = 1000;
+        }, "vertex data of 1000 bytes don't fit into a chunk of {} bytes"},
+    {"invalid index type", [](Containers::ArrayView<char> data) {
+            serializedMeshField<MeshIndexType>(data, 36) = MeshIndexType(0x7f);
+        }, "invalid index type MeshIndexType(0x7f)"},
+    {"indices out of range", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedInt>(data, 28) = 4;
+        }, "indices of 8 bytes at offset 0 don't fit into index data of 6 bytes"},
+    {"index count for a non-indexed mesh", [](Containers::ArrayView<char> data) {
+            serializedMeshField<MeshIndexType>(data, 36) = MeshIndexType{};
+        }, "index count specified for a non-indexed mesh"},
+    {"invalid vertex count", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedInt>(data, 24) = ~UnsignedInt{};
+        }, "invalid vertex count 4294967295"},
+    {"attribute vertex count mismatch", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedInt>(data, 24) = 2;
+        }, "attribute 0 has 3 vertices but 2 expected"},
+    {"invalid attribute name", [](Containers::ArrayView<char> data) {
+            serializedMeshField<MeshAttribute>(data, 68) = MeshAttribute(0x123);
+        }, "invalid name Trade::MeshAttribute(0x123) of attribute 0"},
+    {"zero attribute name", [](Containers::ArrayView<char> data) {
+            serializedMeshField<MeshAttribute>(data, 68) = MeshAttribute{};
+        }, "invalid name Trade::MeshAttribute(0x0) of attribute 0"},
+    {"attribute name and format mismatch", [](Containers::ArrayView<char> data) {
+            serializedMeshField<VertexFormat>(data, 64) = VertexFormat::Matrix3x3;
+        }, "VertexFormat::Matrix3x3 is not a valid format for Trade::MeshAttribute::Position attribute 0"},
+    {"builtin array attribute", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedShort>(data, 78) = 3;
+        }, "Trade::MeshAttribute::Position attribute 0 can't be an array"},
+    {"implementation-specific array attribute", [](Containers::ArrayView<char> data) {
+            serializedMeshField<VertexFormat>(data, 64) = vertexFormatWrap(0xdead);
+            serializedMeshField<MeshAttribute>(data, 68) = meshAttributeCustom(0);
+            serializedMeshField<UnsignedShort>(data, 78) = 3;
+        }, "array attribute 0 can't have an implementation-specific format"},
+    {"attribute not contained", [](Containers::ArrayView<char> data) {
+            serializedMeshField<UnsignedLong>(data, 56) = 35;
+        }, "attribute 0 is not contained in vertex data of 35 bytes"}
 };
 
 const struct {
@@ -387,7 +452,15 @@ MeshDataTest::MeshDataTest() {
 
               &MeshDataTest::releaseIndexData,
               &MeshDataTest::releaseAttributeData,
-              &MeshDataTest::releaseVertexData});
+              &MeshDataTest::releaseVertexData,
+
+              &MeshDataTest::serialize,
+              &MeshDataTest::serializeNotIndexed,
+              &MeshDataTest::serializeIntoNotAligned,
+              &MeshDataTest::serializeIntoTooSmall});
+
+    addInstancedTests({&MeshDataTest::deserializeInvalid},
+        Containers::arraySize(DeserializeInvalidData));
 }
 
 void MeshDataTest::customAttributeName() {
@@ -3006,6 +3079,154 @@ void MeshDataTest::releaseVertexData() {
     CORRADE_COMPARE(data.attributeOffset(0), 48);
 }
 
+void MeshDataTest::serialize() {
+    /* Indices not at the start of the index data, interleaved vertex data
+       with an array attribute */
+    Containers::Array<char> indexData{2 + 6*sizeof(UnsignedShort)};
+    auto indexView = Containers::arrayCast<UnsignedShort>(indexData.suffix(2));
+    indexView[0] = 0;
+    indexView[1] = 1;
+    indexView[2] = 2;
+    indexView[3] = 2;
+    indexView[4] = 1;
+    indexView[5] = 0;
+
+    struct Vertex {
+        Vector3 position;
+        Short weights[3];
+    };
+    Containers::Array<char> vertexData{3*sizeof(Vertex)};
+    auto vertexView = Containers::arrayCast<Vertex>(vertexData);
+    vertexView[0] = {{1.0f, 2.0f, 3.0f}, {1, 2, 3}};
+    vertexView[1] = {{4.0f, 5.0f, 6.0f}, {4, 5, 6}};
+    vertexView[2] = {{7.0f, 8.0f, 9.0f}, {7, 8, 9}};
+    Containers::StridedArrayView1D<Vector3> positions{vertexData, &vertexView[0].position, 3, sizeof(Vertex)};
+    Containers::StridedArrayView1D<Short> weights{vertexData, &vertexView[0].weights[0], 3, sizeof(Vertex)};
+
+    const void* const importerState = &indexData;
+    MeshData data{MeshPrimitive::Triangles,
+        std::move(indexData), MeshIndexData{indexView},
+        std::move(vertexData), {
+            MeshAttributeData{MeshAttribute::Position, positions},
+            MeshAttributeData{meshAttributeCustom(3), VertexFormat::Short, weights, 3}
+        }, MeshData::ImplicitVertexCount, importerState};
+
+    const std::size_t size = data.serializedSize();
+    CORRADE_COMPARE(size % 8, 0);
+
+    /* Extra space at the end is left untouched */
+    Containers::Array<char> out{Containers::DirectInit, size + 8, '\x7f'};
+    CORRADE_COMPARE(data.serializeInto(out), size);
+    CORRADE_COMPARE_AS(out.suffix(size),
+        Containers::arrayView<char>({'\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f'}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(data.serialize().size(), size);
+
+    Containers::Optional<MeshData> deserialized = MeshData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(deserialized->indexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(deserialized->vertexDataFlags(), DataFlag::ExternallyOwned);
+    /* Importer state is not serialized */
+    CORRADE_COMPARE(deserialized->importerState(), nullptr);
+
+    /* The data should point into the blob */
+    CORRADE_VERIFY(deserialized->indexData().begin() > out.begin());
+    CORRADE_VERIFY(deserialized->vertexData().end() <= out.end() - 8);
+    CORRADE_COMPARE(deserialized->indexData().size(), 2 + 6*sizeof(UnsignedShort));
+    CORRADE_COMPARE(deserialized->vertexData().size(), 3*sizeof(Vertex));
+
+    CORRADE_VERIFY(deserialized->isIndexed());
+    CORRADE_COMPARE(deserialized->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(deserialized->indexCount(), 6);
+    CORRADE_COMPARE(deserialized->indices().data(), static_cast<const void*>(deserialized->indexData().data() + 2));
+    CORRADE_COMPARE_AS(deserialized->indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 2, 2, 1, 0}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(deserialized->vertexCount(), 3);
+    CORRADE_COMPARE(deserialized->attributeCount(), 2);
+    CORRADE_VERIFY(deserialized->attributeData()[0].isOffsetOnly());
+    CORRADE_COMPARE(deserialized->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(deserialized->attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(deserialized->attributeOffset(0), 0);
+    CORRADE_COMPARE(deserialized->attributeStride(0), sizeof(Vertex));
+    CORRADE_COMPARE_AS(deserialized->attribute<Vector3>(0),
+        Containers::arrayView<Vector3>({{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(deserialized->attributeName(1), meshAttributeCustom(3));
+    CORRADE_COMPARE(deserialized->attributeFormat(1), VertexFormat::Short);
+    CORRADE_COMPARE(deserialized->attributeOffset(1), sizeof(Vector3));
+    CORRADE_COMPARE(deserialized->attributeArraySize(1), 3);
+    CORRADE_COMPARE_AS((deserialized->attribute<Short[]>(1).transposed<0, 1>()[2]),
+        Containers::arrayView<Short>({3, 6, 9}),
+        TestSuite::Compare::Container);
+}
+
+void MeshDataTest::serializeNotIndexed() {
+    MeshData data{MeshPrimitive::Points, 15};
+    CORRADE_COMPARE(data.serializedSize(), 64);
+
+    Containers::Array<char> out = data.serialize();
+    CORRADE_COMPARE(out.size(), 64);
+
+    Containers::Optional<MeshData> deserialized = MeshData::deserialize(out);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!deserialized->isIndexed());
+    CORRADE_COMPARE(deserialized->vertexCount(), 15);
+    CORRADE_COMPARE(deserialized->attributeCount(), 0);
+    CORRADE_COMPARE(deserialized->vertexData().size(), 0);
+}
+
+void MeshDataTest::serializeIntoNotAligned() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MeshData data{MeshPrimitive::Points, 15};
+
+    Containers::Array<char> out{Containers::ValueInit, 72};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out.suffix(4));
+    CORRADE_COMPARE(outStream.str(), "Trade::MeshData::serializeInto(): data not aligned to 8 bytes\n");
+}
+
+void MeshDataTest::serializeIntoTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    MeshData data{MeshPrimitive::Points, 15};
+
+    Containers::Array<char> out{Containers::ValueInit, 56};
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    data.serializeInto(out);
+    CORRADE_COMPARE(outStream.str(), "Trade::MeshData::serializeInto(): expected at least 64 bytes but got 56\n");
+}
+
+void MeshDataTest::deserializeInvalid() {
+    auto&& data = DeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedShort indices[]{0, 1, 2};
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    Containers::Array<char> out = MeshData{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, positions, {MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}}}.serialize();
+    data.modify(out);
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    CORRADE_VERIFY(!MeshData::deserialize(out));
+    CORRADE_COMPARE(outStream.str(), Utility::formatString(
+        "Trade::MeshData::deserialize(): {}\n", Utility::formatString(data.message, out.size())));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataTest)
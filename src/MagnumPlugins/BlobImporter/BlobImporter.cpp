@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlobImporter.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/Data.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+struct BlobImporter::State {
+    /* Copy of the data if opened through openData(), empty otherwise. The
+       imported instances then get their own copy as well so they don't
+       reference memory owned by the importer. */
+    Containers::Array<char> data;
+    bool copy;
+
+    Containers::Array<Containers::ArrayView<const char>> animations, meshes, materials, images1D, images2D, images3D;
+};
+
+BlobImporter::BlobImporter() = default;
+
+BlobImporter::BlobImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+BlobImporter::~BlobImporter() = default;
+
+ImporterFeatures BlobImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::OpenMemory; }
+
+bool BlobImporter::doIsOpened() const { return !!_state; }
+
+void BlobImporter::doClose() { _state = nullptr; }
+
+void BlobImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    /* The copy is allocated with new[], which is aligned enough for the
+       chunks */
+    Containers::Array<char> owned{Containers::NoInit, data.size()};
+    std::copy(data.begin(), data.end(), owned.begin());
+    openInternal(std::move(owned), owned, "Trade::BlobImporter::openData():");
+}
+
+void BlobImporter::doOpenMemory(const Containers::ArrayView<const char> memory) {
+    openInternal(nullptr, memory, "Trade::BlobImporter::openMemory():");
+}
+
+void BlobImporter::openInternal(Containers::Array<char>&& owned, const Containers::ArrayView<const char> data, const char* const prefix) {
+    Containers::Pointer<State> state{Containers::InPlaceInit};
+    state->copy = !!owned.data();
+
+    /* Only the headers are checked here, the chunk contents are validated
+       when importing each */
+    for(std::size_t offset = 0; offset < data.size(); ) {
+        const DataChunkHeader* const header = dataChunkHeaderDeserialize(data.suffix(offset));
+        if(!header) {
+            Error{} << prefix << "invalid chunk at offset" << offset;
+            return;
+        }
+
+        const Containers::ArrayView<const char> chunk = data.slice(offset, offset + header->size);
+        switch(header->type) {
+            case DataChunkType::Animation:
+                arrayAppend(state->animations, chunk);
+                break;
+            case DataChunkType::Mesh:
+                arrayAppend(state->meshes, chunk);
+                break;
+            case DataChunkType::Material:
+                arrayAppend(state->materials, chunk);
+                break;
+            case DataChunkType::Image1D:
+                arrayAppend(state->images1D, chunk);
+                break;
+            case DataChunkType::Image2D:
+                arrayAppend(state->images2D, chunk);
+                break;
+            case DataChunkType::Image3D:
+                arrayAppend(state->images3D, chunk);
+                break;
+            /* Skipping unknown chunks for forward compatibility */
+            default: break;
+        }
+
+        offset += header->size;
+    }
+
+    /* Moving the array doesn't change the memory location, so the views stay
+       valid */
+    state->data = std::move(owned);
+    _state = std::move(state);
+}
+
+UnsignedInt BlobImporter::doAnimationCount() const { return _state->animations.size(); }
+
+Containers::Optional<AnimationData> BlobImporter::doAnimation(const UnsignedInt id) {
+    /* The track views are recreated during deserialization, so it's easiest
+       to deserialize directly into a copy of the keyframe data */
+    if(_state->copy)
+        return Implementation::animationDataDeserializeCopy(_state->animations[id]);
+    return AnimationData::deserialize(_state->animations[id]);
+}
+
+UnsignedInt BlobImporter::doMeshCount() const { return _state->meshes.size(); }
+
+Containers::Optional<MeshData> BlobImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    Containers::Optional<MeshData> mesh = MeshData::deserialize(_state->meshes[id]);
+    if(!mesh || !_state->copy) return mesh;
+
+    Containers::Array<char> indexData{Containers::NoInit, mesh->indexData().size()};
+    std::copy(mesh->indexData().begin(), mesh->indexData().end(), indexData.begin());
+    MeshIndexData indices;
+    if(mesh->isIndexed()) {
+        const std::size_t indexOffset = static_cast<const char*>(mesh->indices().data()) - mesh->indexData().data();
+        indices = MeshIndexData{mesh->indexType(), indexData.slice(indexOffset, indexOffset + mesh->indexCount()*meshIndexTypeSize(mesh->indexType()))};
+    }
+
+    Containers::Array<char> vertexData{Containers::NoInit, mesh->vertexData().size()};
+    std::copy(mesh->vertexData().begin(), mesh->vertexData().end(), vertexData.begin());
+
+    /* The attributes are offset-only, so they can be copied as-is */
+    Containers::Array<MeshAttributeData> attributes{mesh->attributeCount()};
+    std::copy(mesh->attributeData().begin(), mesh->attributeData().end(), attributes.begin());
+
+    return MeshData{mesh->primitive(), std::move(indexData), indices, std::move(vertexData), std::move(attributes), mesh->vertexCount()};
+}
+
+UnsignedInt BlobImporter::doMaterialCount() const { return _state->materials.size(); }
+
+Containers::Optional<MaterialData> BlobImporter::doMaterial(const UnsignedInt id) {
+    Containers::Optional<MaterialData> material = MaterialData::deserialize(_state->materials[id]);
+    if(!material || !_state->copy) return material;
+
+    Containers::Array<MaterialAttributeData> attributes{material->attributeData().size()};
+    std::copy(material->attributeData().begin(), material->attributeData().end(), attributes.begin());
+
+    /* Empty layer data have to be null in order to be treated as an implicit
+       base layer */
+    Containers::Array<UnsignedInt> layers;
+    if(!material->layerData().empty()) {
+        layers = Containers::Array<UnsignedInt>{Containers::NoInit, material->layerData().size()};
+        std::copy(material->layerData().begin(), material->layerData().end(), layers.begin());
+    }
+
+    return MaterialData{material->types(), std::move(attributes), std::move(layers)};
+}
+
+namespace {
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> imageInternal(const Containers::ArrayView<const char> chunk, const bool copy) {
+    Containers::Optional<ImageData<dimensions>> image = ImageData<dimensions>::deserialize(chunk);
+    if(!image || !copy) return image;
+
+    Containers::Array<char> data{Containers::NoInit, image->data().size()};
+    std::copy(image->data().begin(), image->data().end(), data.begin());
+    if(image->isCompressed())
+        return ImageData<dimensions>{image->compressedStorage(), image->compressedFormat(), image->size(), std::move(data)};
+    return ImageData<dimensions>{image->storage(), image->format(), image->formatExtra(), image->pixelSize(), image->size(), std::move(data)};
+}
+
+}
+
+UnsignedInt BlobImporter::doImage1DCount() const { return _state->images1D.size(); }
+
+Containers::Optional<ImageData1D> BlobImporter::doImage1D(const UnsignedInt id, UnsignedInt) {
+    return imageInternal<1>(_state->images1D[id], _state->copy);
+}
+
+UnsignedInt BlobImporter::doImage2DCount() const { return _state->images2D.size(); }
+
+Containers::Optional<ImageData2D> BlobImporter::doImage2D(const UnsignedInt id, UnsignedInt) {
+    return imageInternal<2>(_state->images2D[id], _state->copy);
+}
+
+UnsignedInt BlobImporter::doImage3DCount() const { return _state->images3D.size(); }
+
+Containers::Optional<ImageData3D> BlobImporter::doImage3D(const UnsignedInt id, UnsignedInt) {
+    return imageInternal<3>(_state->images3D[id], _state->copy);
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(BlobImporter, Magnum::Trade::BlobImporter,
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3.4")
@@ -0,0 +1,165 @@
+#ifndef Magnum_Trade_BlobImporter_h
+#define Magnum_Trade_BlobImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::BlobImporter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/BlobImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BLOBIMPORTER_BUILD_STATIC
+    #ifdef BlobImporter_EXPORTS
+        #define MAGNUM_BLOBIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_BLOBIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_BLOBIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_BLOBIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_BLOBIMPORTER_EXPORT
+#define MAGNUM_BLOBIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum blob importer plugin
+@m_since_latest
+
+Imports animations, meshes, images and materials from Magnum's own binary
+blob format (`*.blob`), which is a sequence of data chunks described by
+@ref DataChunkHeader, as produced for example by @ref BlobSceneConverter or
+by concatenating the output of @ref AnimationData::serialize(),
+@ref MeshData::serialize(), @ref ImageData::serialize() and
+@ref MaterialData::serialize().
+
+@section Trade-BlobImporter-usage Usage
+
+This plugin depends on the @ref Trade library and is built if
+`WITH_BLOBIMPORTER` is enabled when building Magnum. To use as a dynamic
+plugin, load @cpp "BlobImporter" @ce via @ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(WITH_BLOBIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::BlobImporter)
+@endcode
+
+To use as a static plugin or use this as a dependency of another plugin with
+CMake, you need to request the `BlobImporter` component of the `Magnum` package
+and link to the `Magnum::BlobImporter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED BlobImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::BlobImporter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-BlobImporter-behavior Behavior and limitations
+
+The plugin supports @ref ImporterFeature::OpenMemory, which means
+@ref openFile() maps the file into memory instead of reading it and the
+imported animations, meshes, images and materials reference the mapped
+memory directly, without any copying or parsing apart from validation of the
+chunk headers and contents. The same happens with memory passed to
+@ref openMemory(). In that case the imported data have
+@ref DataFlag::ExternallyOwned set and are valid only until the importer is
+closed or the memory goes out of scope. Only the animation track table is
+allocated, as the track interpolators are recreated during import. When
+opening through @ref openData(), the data are copied and every imported
+instance owns a copy of its data.
+
+Chunks are expected to be aligned to 8 bytes, chunks of unknown types are
+skipped. Animations, meshes, images and materials are exposed in the order
+they are present in the file, @ref DataChunkType::Image1D,
+@relativeref{DataChunkType,Image2D} and @relativeref{DataChunkType,Image3D}
+chunks are imported through @ref image1D(), @ref image2D() and
+@ref image3D(), respectively. Animation, mesh, image and material names,
+image levels and scene hierarchy are not supported.
+*/
+class MAGNUM_BLOBIMPORTER_EXPORT BlobImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit BlobImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit BlobImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
+
+        ~BlobImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_BLOBIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_BLOBIMPORTER_LOCAL void doOpenMemory(Containers::ArrayView<const char> memory) override;
+        MAGNUM_BLOBIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doAnimationCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<AnimationData> doAnimation(UnsignedInt id) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
+        MAGNUM_BLOBIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_BLOBIMPORTER_LOCAL void openInternal(Containers::Array<char>&& owned, Containers::ArrayView<const char> data, const char* prefix);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,314 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct BlobImporterTest: TestSuite::Tester {
+    explicit BlobImporterTest();
+
+    void openEmpty();
+    void openInvalid();
+    void openUnknownChunk();
+
+    void import();
+    void importInvalid();
+    void importFile();
+
+    void openTwice();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+constexpr struct {
+    const char* name;
+    bool memory;
+} ImportData[]{
+    {"data", false},
+    {"memory", true}
+};
+
+const UnsignedShort Indices[]{0, 2, 1, 1, 2, 0};
+const Vector3 Positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+const Color3ub Pixels[]{{0x11, 0x22, 0x33}, {0x44, 0x55, 0x66}, {0x77, 0x88, 0x99}, {0xaa, 0xbb, 0xcc}};
+const std::pair<Float, Vector3> Keyframes[]{
+    {0.0f, {3.0f, 1.0f, 0.1f}},
+    {5.0f, {0.3f, 0.6f, 1.0f}}
+};
+
+/* A mesh, a 2D image, a material and an animation, in this order */
+Containers::Array<char> blob() {
+    const MeshData mesh{MeshPrimitive::Triangles,
+        {}, Indices, MeshIndexData{Indices},
+        {}, Positions, {MeshAttributeData{MeshAttribute::Position, Containers::arrayView(Positions)}}};
+    const ImageData2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, DataFlags{}, Pixels};
+    const MaterialData material{MaterialType::Phong, {
+        {MaterialAttribute::DiffuseColor, Color4{0.2f, 0.3f, 0.4f, 1.0f}},
+        {MaterialAttribute::DiffuseTexture, 5u}
+    }};
+    const AnimationData animation{{}, Keyframes, {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 3,
+            Animation::TrackView<const Float, const Vector3>{Keyframes, Animation::Interpolation::Linear}}
+    }};
+
+    Containers::Array<char> out{Containers::NoInit, mesh.serializedSize() + image.serializedSize() + material.serializedSize() + animation.serializedSize()};
+    std::size_t offset = mesh.serializeInto(out);
+    offset += image.serializeInto(out.suffix(offset));
+    offset += material.serializeInto(out.suffix(offset));
+    animation.serializeInto(out.suffix(offset));
+    return out;
+}
+
+BlobImporterTest::BlobImporterTest() {
+    addTests({&BlobImporterTest::openEmpty,
+              &BlobImporterTest::openInvalid,
+              &BlobImporterTest::openUnknownChunk});
+
+    addInstancedTests({&BlobImporterTest::import,
+                       &BlobImporterTest::importInvalid},
+        Containers::arraySize(ImportData));
+
+    addTests({&BlobImporterTest::importFile,
+              &BlobImporterTest::openTwice});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef BLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(BLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Create the output directory if it doesn't exist yet */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::mkpath(BLOBIMPORTER_TEST_OUTPUT_DIR));
+}
+
+void BlobImporterTest::openEmpty() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    /* An empty file is a valid blob with no chunks */
+    char a{};
+    CORRADE_VERIFY(importer->openData({&a, 0}));
+    CORRADE_COMPARE(importer->animationCount(), 0);
+    CORRADE_COMPARE(importer->meshCount(), 0);
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 0);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->materialCount(), 0);
+}
+
+void BlobImporterTest::openInvalid() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    /* Second chunk cut in half */
+    Containers::Array<char> data = blob();
+    const std::size_t meshSize = reinterpret_cast<const DataChunkHeader*>(data.data())->size;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openMemory(data.prefix(meshSize + 16)));
+    CORRADE_VERIFY(!importer->isOpened());
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::dataChunkHeaderDeserialize(): expected at least 24 bytes for a header but got 16\n"
+        "Trade::BlobImporter::openMemory(): invalid chunk at offset {}\n", meshSize));
+}
+
+void BlobImporterTest::openUnknownChunk() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    /* Change the type of the first chunk to something unknown, it should be
+       skipped */
+    Containers::Array<char> data = blob();
+    reinterpret_cast<DataChunkHeader*>(data.data())->type = DataChunkType(Utility::Endianness::fourCC('H', 'u', 'h', '?'));
+
+    CORRADE_VERIFY(importer->openMemory(data));
+    CORRADE_COMPARE(importer->meshCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->animationCount(), 1);
+}
+
+void BlobImporterTest::import() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    Containers::Array<char> in = blob();
+    CORRADE_VERIFY(data.memory ? importer->openMemory(in) : importer->openData(in));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->animationCount(), 1);
+
+    /* When opened through openData(), the data should be owned by the
+       instances, otherwise they should point to the original memory */
+    const DataFlags expectedFlags = data.memory ? DataFlag::ExternallyOwned : DataFlag::Owned|DataFlag::Mutable;
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indexDataFlags(), expectedFlags);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), expectedFlags);
+    CORRADE_COMPARE(mesh->vertexData().data() >= in.begin() && mesh->vertexData().data() < in.end(), data.memory);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeCount(), 1);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), expectedFlags);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color3ub>(image->data()),
+        Containers::arrayView(Pixels),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->types(), MaterialType::Phong);
+    CORRADE_COMPARE(material->layerCount(), 1);
+    CORRADE_COMPARE(material->attributeCount(), 2);
+    CORRADE_COMPARE(material->attribute<Color4>(MaterialAttribute::DiffuseColor), (Color4{0.2f, 0.3f, 0.4f, 1.0f}));
+    CORRADE_COMPARE(material->attribute<UnsignedInt>(MaterialAttribute::DiffuseTexture), 5);
+
+    Containers::Optional<AnimationData> animation = importer->animation(0);
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->dataFlags(), expectedFlags);
+    CORRADE_COMPARE(animation->data().data() >= in.begin() && animation->data().data() < in.end(), data.memory);
+    CORRADE_COMPARE(animation->duration(), (Range1D{0.0f, 5.0f}));
+    CORRADE_COMPARE(animation->trackCount(), 1);
+    CORRADE_COMPARE(animation->trackType(0), AnimationTrackType::Vector3);
+    CORRADE_COMPARE(animation->trackTargetType(0), AnimationTrackTargetType::Translation3D);
+    CORRADE_COMPARE(animation->trackTarget(0), 3);
+    CORRADE_COMPARE(animation->track<Vector3>(0).at(2.5f), (Vector3{1.65f, 0.8f, 0.55f}));
+}
+
+void BlobImporterTest::importInvalid() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    /* Break the vertex count of the first attribute. The headers are still
+       valid so the file opens, but the mesh import fails. */
+    Containers::Array<char> in = blob();
+    reinterpret_cast<UnsignedInt*>(in.data() + sizeof(DataChunkHeader))[0] = 2;
+    CORRADE_VERIFY(data.memory ? importer->openMemory(in) : importer->openData(in));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::deserialize(): attribute 0 has 3 vertices but 2 expected\n");
+
+    /* The other data are still importable */
+    CORRADE_VERIFY(importer->image2D(0));
+    CORRADE_VERIFY(importer->material(0));
+}
+
+void BlobImporterTest::importFile() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    const std::string filename = Utility::Directory::join(BLOBIMPORTER_TEST_OUTPUT_DIR, "file.blob");
+    const Containers::Array<char> in = blob();
+    CORRADE_VERIFY(Utility::Directory::write(filename, in));
+
+    /* The file gets mapped and opened through openMemory(), so all imported
+       data should reference the mapping instead of owning a copy */
+    CORRADE_VERIFY(importer->openFile(filename));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->animationCount(), 1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color3ub>(image->data()),
+        Containers::arrayView(Pixels),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->attribute<Color4>(MaterialAttribute::DiffuseColor), (Color4{0.2f, 0.3f, 0.4f, 1.0f}));
+    CORRADE_COMPARE(material->attribute<UnsignedInt>(MaterialAttribute::DiffuseTexture), 5);
+
+    Containers::Optional<AnimationData> animation = importer->animation(0);
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->dataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(animation->track<Vector3>(0).at(2.5f), (Vector3{1.65f, 0.8f, 0.55f}));
+}
+
+void BlobImporterTest::openTwice() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("BlobImporter");
+
+    Containers::Array<char> in = blob();
+    CORRADE_VERIFY(importer->openMemory(in));
+    CORRADE_VERIFY(importer->openData(in));
+
+    /* Shouldn't crash, leak or anything */
+    CORRADE_COMPARE(importer->meshCount(), 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BlobImporterTest)
@@ -0,0 +1,58 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlobSceneConverter.h"
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+BlobSceneConverter::BlobSceneConverter() = default;
+
+BlobSceneConverter::BlobSceneConverter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractSceneConverter{manager, plugin} {}
+
+BlobSceneConverter::~BlobSceneConverter() = default;
+
+SceneConverterFeatures BlobSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMeshToData;
+}
+
+Containers::Array<char> BlobSceneConverter::doConvertToData(const MeshData& mesh) {
+    /* MeshData::serializeInto() asserts on this, which is not desirable
+       for a converter */
+    if(mesh.attributeCount() > 65535) {
+        Error{} << "Trade::BlobSceneConverter::convertToData(): expected at most 65535 attributes but got" << mesh.attributeCount();
+        return {};
+    }
+
+    return mesh.serialize();
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(BlobSceneConverter, Magnum::Trade::BlobSceneConverter,
+    "cz.mosra.magnum.Trade.AbstractSceneConverter/0.1")
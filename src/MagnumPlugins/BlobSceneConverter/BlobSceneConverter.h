@@ -0,0 +1,118 @@
+#ifndef Magnum_Trade_BlobSceneConverter_h
+#define Magnum_Trade_BlobSceneConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::BlobSceneConverter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "MagnumPlugins/BlobSceneConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BLOBSCENECONVERTER_BUILD_STATIC
+    #ifdef BlobSceneConverter_EXPORTS
+        #define MAGNUM_BLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_BLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_BLOBSCENECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_BLOBSCENECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_BLOBSCENECONVERTER_EXPORT
+#define MAGNUM_BLOBSCENECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum blob scene converter plugin
+@m_since_latest
+
+Saves meshes into Magnum's own binary blob format (`*.blob`) that can be
+imported back with zero copies using @ref BlobImporter. The output is a single
+@ref DataChunkType::Mesh chunk produced by @ref MeshData::serialize(), see
+@ref Trade-MeshData-serialization for more information.
+
+@section Trade-BlobSceneConverter-usage Usage
+
+This plugin depends on the @ref Trade library and is built if
+`WITH_BLOBSCENECONVERTER` is enabled when building Magnum. To use as a dynamic
+plugin, load @cpp "BlobSceneConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(WITH_BLOBSCENECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::BlobSceneConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `BlobSceneConverter` component of the `Magnum` package and
+link to the `Magnum::BlobSceneConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED BlobSceneConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::BlobSceneConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-BlobSceneConverter-behavior Behavior and limitations
+
+The mesh data are saved as-is, in the same layout as they are in memory and
+with the endianness and pointer size of the platform the conversion is done
+on. Meshes with more than 65535 attributes can't be saved. Images and materials can be saved into the same format using
+@ref ImageData::serialize() and @ref MaterialData::serialize().
+*/
+class MAGNUM_BLOBSCENECONVERTER_EXPORT BlobSceneConverter: public AbstractSceneConverter {
+    public:
+        /** @brief Default constructor */
+        explicit BlobSceneConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit BlobSceneConverter(PluginManager::AbstractManager& manager, const std::string& plugin);
+
+        ~BlobSceneConverter();
+
+    private:
+        MAGNUM_BLOBSCENECONVERTER_LOCAL SceneConverterFeatures doFeatures() const override;
+        MAGNUM_BLOBSCENECONVERTER_LOCAL Containers::Array<char> doConvertToData(const MeshData& mesh) override;
+};
+
+}}
+
+#endif
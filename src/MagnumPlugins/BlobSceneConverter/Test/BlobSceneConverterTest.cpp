@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/FileToString.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct BlobSceneConverterTest: TestSuite::Tester {
+    explicit BlobSceneConverterTest();
+
+    void convert();
+    void convertToFile();
+    void convertImport();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _manager{"nonexistent"};
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+};
+
+const UnsignedShort Indices[]{0, 2, 1, 1, 2, 0};
+const Vector3 Positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+
+BlobSceneConverterTest::BlobSceneConverterTest() {
+    addTests({&BlobSceneConverterTest::convert,
+              &BlobSceneConverterTest::convertToFile,
+              &BlobSceneConverterTest::convertImport});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef BLOBSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(BLOBSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef BLOBIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(BLOBIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Create the output directory if it doesn't exist yet */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::mkpath(BLOBSCENECONVERTER_TEST_OUTPUT_DIR));
+}
+
+void BlobSceneConverterTest::convert() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("BlobSceneConverter");
+
+    const MeshData mesh{MeshPrimitive::Triangles,
+        {}, Indices, MeshIndexData{Indices},
+        {}, Positions, {MeshAttributeData{MeshAttribute::Position, Containers::arrayView(Positions)}}};
+
+    Containers::Array<char> data = converter->convertToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data.size(), mesh.serializedSize());
+
+    Containers::Optional<MeshData> out = MeshData::deserialize(data);
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(out->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out->attributeCount(), 1);
+    CORRADE_COMPARE_AS(out->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+}
+
+void BlobSceneConverterTest::convertToFile() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("BlobSceneConverter");
+
+    const MeshData mesh{MeshPrimitive::Points,
+        {}, Positions, {MeshAttributeData{MeshAttribute::Position, Containers::arrayView(Positions)}}};
+
+    const std::string filename = Utility::Directory::join(BLOBSCENECONVERTER_TEST_OUTPUT_DIR, "mesh.blob");
+    CORRADE_VERIFY(converter->convertToFile(filename, mesh));
+    const Containers::Array<char> expected = mesh.serialize();
+    CORRADE_COMPARE_AS(filename, (std::string{expected.data(), expected.size()}), TestSuite::Compare::FileToString);
+}
+
+void BlobSceneConverterTest::convertImport() {
+    if(!(_importerManager.loadState("BlobImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("BlobImporter plugin not enabled, can't test the round trip");
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("BlobSceneConverter");
+
+    const MeshData mesh{MeshPrimitive::Triangles,
+        {}, Indices, MeshIndexData{Indices},
+        {}, Positions, {MeshAttributeData{MeshAttribute::Position, Containers::arrayView(Positions)}}};
+
+    const std::string filename = Utility::Directory::join(BLOBSCENECONVERTER_TEST_OUTPUT_DIR, "roundtrip.blob");
+    CORRADE_VERIFY(converter->convertToFile(filename, mesh));
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("BlobImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> out = importer->mesh(0);
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->indexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(out->vertexDataFlags(), DataFlag::ExternallyOwned);
+    CORRADE_COMPARE(out->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(out->indices<UnsignedShort>(),
+        Containers::arrayView(Indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out->attributeCount(), 1);
+    CORRADE_COMPARE_AS(out->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BlobSceneConverterTest)